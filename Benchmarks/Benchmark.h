@@ -0,0 +1,215 @@
+/**
+ * @file Benchmark.h
+ *
+ * @brief Benchmark Base Class for the Performance Suite.
+ *
+ * This header file declares the Benchmark base class, which times the filters, projections, slicing and loading code on
+ * reproducible synthetic inputs. A benchmark case is made of a setup step, which prepares a fresh input and is not timed,
+ * and a body, which is timed with a steady clock. Each case is repeated several times, and the median and fastest run
+ * are recorded together with the number of heap allocations and bytes requested through operator new during one run,
+ * and the share of BufferPool requests served from the pool's free lists.
+ * From the median time the suite derives nanoseconds per pixel (or voxel) and the throughput in GB/s, counting the bytes
+ * read from the input and written to the output. All results are collected in a single list and written as JSON, so that
+ * successive runs can be compared by release scripts.
+ *
+ * Usage:
+ * Derived classes implement the `runBenchmarks` method and register their cases with `runBenchmark`. The input sizes are
+ * chosen from the scale selected on the command line.
+ *
+ * @date Created on October 19, 2026.
+ *
+ * @authors
+ * Advanced Programming Group Radix Sort:
+ *   - Benjamin Duncan (edsml-bd1023)
+ *   - Boyang Hu (edsml-bh223)
+ *   - Chawk Chamoun (edsml-cc8915)
+ *   - Mingsheng Cai (acse-sc4623)
+ *   - Moyu Zhang (acse-mz223)
+ *   - Ryan Benney (acse-rgb123)
+ */
+
+#pragma once
+
+#include "BufferPool.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <functional>
+#include <iostream>
+#include <string>
+#include <vector>
+
+// Counters maintained by the replacement operator new in main.cpp
+extern std::atomic<std::size_t> allocationCount;
+extern std::atomic<std::size_t> allocationBytes;
+
+// Input sizes covered by a run: small is quick enough for every commit, large covers 8K images and 512^3 volumes
+enum class BenchmarkScale {
+    Small,
+    Medium,
+    Large
+};
+
+// Measurements of one benchmark case
+struct BenchmarkResult {
+    std::string name; // Benchmarked operation, e.g. "Gaussian3DFilter"
+    std::string variant; // Parameters of the operation, e.g. "sigma=1,kernel=5"
+    std::string input; // Input dimensions, e.g. "512x512x3"
+    size_t pixels; // Number of input pixels or voxels
+    size_t bytes; // Bytes read from the input and written to the output
+    int runs; // Number of timed runs
+    double minNs; // Fastest run
+    double medianNs; // Median run
+    size_t allocations; // operator new calls during one run
+    size_t allocatedBytes; // Bytes requested from operator new during one run
+    double poolHitRate; // Share of BufferPool requests served without allocating during one run
+};
+
+class Benchmark {
+public:
+    /**
+     * Virtual Destructor
+     *
+     * Ensures that derived benchmark classes are destroyed correctly.
+     */
+    virtual ~Benchmark() {}
+
+    /**
+     * Runs All Benchmarks
+     *
+     * A pure virtual function that derived classes implement to register their cases through runBenchmark.
+     */
+    virtual void runBenchmarks() = 0;
+
+    /**
+     * Selects the Cases to Run
+     *
+     * @param newScale The scale that determines the input sizes.
+     * @param newRepetitions The maximum number of timed runs per case.
+     * @param newFilter Only cases whose name contains this string are run; an empty string runs every case.
+     */
+    static void configure(BenchmarkScale newScale, int newRepetitions, const std::string &newFilter) {
+        scale = newScale;
+        repetitions = std::max(1, newRepetitions);
+        filter = newFilter;
+    }
+
+    /**
+     * Writes All Results as JSON
+     *
+     * @param out The stream to write the JSON document to.
+     */
+    static void writeJson(std::ostream &out) {
+        const char *scaleNames[] = {"small", "medium", "large"};
+        out << "{\n  \"scale\": \"" << scaleNames[static_cast<int>(scale)] << "\",\n"
+            << "  \"repetitions\": " << repetitions << ",\n  \"results\": [";
+        for (size_t i = 0; i < results.size(); ++i) {
+            const auto &r = results[i];
+            out << (i ? "," : "") << "\n    {\"name\": \"" << r.name << "\", \"variant\": \"" << r.variant
+                << "\", \"input\": \"" << r.input << "\", \"pixels\": " << r.pixels << ", \"bytes\": " << r.bytes
+                << ", \"runs\": " << r.runs << ", \"min_ns\": " << static_cast<long long>(r.minNs)
+                << ", \"median_ns\": " << static_cast<long long>(r.medianNs)
+                << ", \"ns_per_pixel\": " << r.medianNs / std::max<size_t>(r.pixels, 1)
+                << ", \"gb_per_s\": " << r.bytes / std::max(r.medianNs, 1.0)
+                << ", \"allocations\": " << r.allocations << ", \"allocated_bytes\": " << r.allocatedBytes
+                << ", \"pool_hit_rate\": " << r.poolHitRate << "}";
+        }
+        out << "\n  ]\n}\n";
+    }
+
+protected:
+    static BenchmarkScale scale; // Selected input sizes
+    static int repetitions; // Maximum number of timed runs per case
+    static std::string filter; // Substring that selects cases by name
+    static std::vector<BenchmarkResult> results; // Results of every case run so far
+    static constexpr double timeBudgetNs = 5e9; // Slow cases stop repeating once they have used this much time
+
+    /**
+     * Returns the Image Edge Lengths for the Selected Scale
+     */
+    static std::vector<int> imageSizes() {
+        std::vector<int> sizes = {512, 2048, 8192};
+        sizes.resize(static_cast<int>(scale) + 1);
+        return sizes;
+    }
+
+    /**
+     * Returns the Volume Edge Lengths for the Selected Scale
+     */
+    static std::vector<int> volumeSizes() {
+        std::vector<int> sizes = {128, 256, 512};
+        sizes.resize(static_cast<int>(scale) + 1);
+        return sizes;
+    }
+
+    /**
+     * Generates Reproducible Pseudo-Random Samples
+     *
+     * @param count The number of samples.
+     * @param seed The generator seed; the same seed always gives the same samples.
+     * @return The samples.
+     */
+    static std::vector<unsigned char> syntheticData(size_t count, unsigned int seed = 2026) {
+        std::vector<unsigned char> data(count);
+        for (auto &value: data) {
+            seed = seed * 1664525u + 1013904223u;
+            value = static_cast<unsigned char>(seed >> 24);
+        }
+        return data;
+    }
+
+    /**
+     * Times a Single Benchmark Case
+     *
+     * Calls setup before every run and times only body. Runs stop after the configured number of repetitions, or earlier
+     * once the case has used timeBudgetNs. Standard output is silenced while the body runs, because several filters report
+     * their progress there.
+     *
+     * @param name The benchmarked operation.
+     * @param variant The parameters of the operation.
+     * @param input The input dimensions.
+     * @param pixels The number of input pixels or voxels.
+     * @param bytes The bytes read from the input and written to the output.
+     * @param setup Prepares a fresh input before each run.
+     * @param body The operation to time.
+     */
+    void runBenchmark(const std::string &name, const std::string &variant, const std::string &input, size_t pixels,
+                      size_t bytes, const std::function<void()> &setup, const std::function<void()> &body) {
+        if (!filter.empty() && name.find(filter) == std::string::npos) {
+            return;
+        }
+        std::cerr << "Benchmarking " << name << " [" << variant << "] on " << input << std::endl;
+
+        std::vector<double> times;
+        size_t allocations = 0, allocatedBytes = 0;
+        double total = 0.0, poolHitRate = 0.0;
+        while (static_cast<int>(times.size()) < repetitions && (times.empty() || total < timeBudgetNs)) {
+            setup();
+            std::cout.setstate(std::ios::failbit);
+            BufferPool::global().resetStats();
+            size_t countBefore = allocationCount.load(), bytesBefore = allocationBytes.load();
+            auto start = std::chrono::steady_clock::now();
+            body();
+            auto end = std::chrono::steady_clock::now();
+            allocations = allocationCount.load() - countBefore;
+            allocatedBytes = allocationBytes.load() - bytesBefore;
+            poolHitRate = BufferPool::global().getStats().hitRate();
+            std::cout.clear();
+
+            times.push_back(std::chrono::duration<double, std::nano>(end - start).count());
+            total += times.back();
+        }
+
+        std::sort(times.begin(), times.end());
+        results.push_back({name, variant, input, pixels, bytes, static_cast<int>(times.size()), times.front(),
+                           times[times.size() / 2], allocations, allocatedBytes, poolHitRate});
+    }
+};
+
+// Initialize static member variables
+BenchmarkScale Benchmark::scale = BenchmarkScale::Small;
+int Benchmark::repetitions = 5;
+std::string Benchmark::filter;
+std::vector<BenchmarkResult> Benchmark::results;
@@ -0,0 +1,145 @@
+/**
+ * @file Benchmark2DFilters.h
+ *
+ * @brief Benchmarks for the 2D image filters.
+ *
+ * This header file defines the Benchmark2DFilters class, which times Box2DFilter, Gaussian2DFilter in each of its
+ * modes, Median2DFilter, every EdgeFilter operator and every PixelFilter operation on square synthetic images. Colour
+ * operations run on three-channel images, while the edge detectors and greyscale equalisation run on single-channel
+ * images, as they require.
+ *
+ * @date Created on October 19, 2026.
+ *
+ * @authors
+ * Advanced Programming Group Radix Sort:
+ *   - Benjamin Duncan (edsml-bd1023)
+ *   - Boyang Hu (edsml-bh223)
+ *   - Chawk Chamoun (edsml-cc8915)
+ *   - Mingsheng Cai (acse-sc4623)
+ *   - Moyu Zhang (acse-mz223)
+ *   - Ryan Benney (acse-rgb123)
+ */
+
+#pragma once
+
+#include "Benchmark.h"
+#include "Image.h"
+#include "ImageStream.h"
+#include "Pyramid.h"
+#include "Filters/Box2DFilter.h"
+#include "Filters/Gaussian2DFilter.h"
+#include "Filters/Median2DFilter.h"
+#include "Filters/EdgeFilter.h"
+#include "Filters/PixelFilter.h"
+#include "stb_image_write.h"
+
+#include <filesystem>
+#include <memory>
+#include <string>
+#include <vector>
+
+class Benchmark2DFilters : public Benchmark {
+private:
+    /**
+     * Times One Image Operation
+     *
+     * @param name The benchmarked operation.
+     * @param variant The parameters of the operation.
+     * @param size The edge length of the square image.
+     * @param channels The number of channels of the input image.
+     * @param outputChannels The number of channels the operation writes.
+     * @param operation Applies the operation to the image.
+     */
+    void runImageBenchmark(const std::string &name, const std::string &variant, int size, int channels,
+                           int outputChannels, const std::function<void(Image &)> &operation) {
+        size_t pixels = static_cast<size_t>(size) * size;
+        auto data = syntheticData(pixels * channels);
+        std::unique_ptr<Image> image;
+        runBenchmark(name, variant, std::to_string(size) + "x" + std::to_string(size) + "x" + std::to_string(channels),
+                     pixels, pixels * (channels + outputChannels),
+                     [&]() { image = std::make_unique<Image>(size, size, channels, data.data()); },
+                     [&]() { operation(*image); });
+    }
+
+public:
+    /**
+     * Runs the 2D Filter Benchmarks
+     */
+    virtual void runBenchmarks() override {
+        for (int size: imageSizes()) {
+            runImageBenchmark("Box2DFilter", "kernel=3", size, 3, 3, [](Image &image) {
+                Box2DFilter(3).apply(image);
+            });
+            runImageBenchmark("Gaussian2DFilter", "sigma=1,kernel=5", size, 3, 3, [](Image &image) {
+                Gaussian2DFilter(5, 1.0).apply(image);
+            });
+            runImageBenchmark("Gaussian2DFilter", "sigma=1,kernel=5,fixed", size, 3, 3, [](Image &image) {
+                Gaussian2DFilter(5, 1.0, PaddingType::ZeroPadding, GaussianMode::FixedPoint).apply(image);
+            });
+            runImageBenchmark("Gaussian2DFilter", "sigma=8,recursive", size, 3, 3, [](Image &image) {
+                Gaussian2DFilter(1, 8.0, PaddingType::EdgeReplication, GaussianMode::Recursive).apply(image);
+            });
+            for (auto [mode, label]: {std::pair{DownsampleMode::Box, "box"}, {DownsampleMode::Gaussian, "gaussian"}}) {
+                runImageBenchmark("ImagePyramid::downsample", label, size, 3, 1, [mode](Image &image) {
+                    ImagePyramid::downsample(image, mode);
+                });
+            }
+            runImageBenchmark("Median2DFilter", "kernel=3", size, 3, 3, [](Image &image) {
+                Median2DFilter(3).apply(image);
+            });
+
+            const std::pair<FilterType, const char *> edgeFilters[] = {
+                    {FilterType::Sobel, "sobel"}, {FilterType::Prewitt, "prewitt"},
+                    {FilterType::Scharr, "scharr"}, {FilterType::Roberts, "roberts"}};
+            for (auto [type, label]: edgeFilters) {
+                runImageBenchmark("EdgeFilter", label, size, 1, 1, [type](Image &image) {
+                    EdgeFilter(type).apply(image);
+                });
+            }
+
+            runImageBenchmark("PixelFilter", "grayscale", size, 3, 1, [](Image &image) {
+                PixelFilter("Grayscale").apply(image);
+            });
+            runImageBenchmark("PixelFilter", "brightness=50", size, 3, 3, [](Image &image) {
+                PixelFilter("Brightness", 50).apply(image);
+            });
+            for (const char *space: {"HSV", "HSL"}) {
+                runImageBenchmark("PixelFilter", std::string("equalisation,") + space, size, 3, 3, [space](Image &image) {
+                    PixelFilter("Equalisation", std::nullopt, space).apply(image);
+                });
+            }
+            runImageBenchmark("PixelFilter", "equalisation,GREY", size, 1, 1, [](Image &image) {
+                PixelFilter("Equalisation", std::nullopt, "GREY").apply(image);
+            });
+            runImageBenchmark("PixelFilter", "threshold=128,HSV", size, 3, 3, [](Image &image) {
+                PixelFilter("Thresholding", std::nullopt, "HSV", 128).apply(image);
+            });
+            runImageBenchmark("PixelFilter", "noise=0.1", size, 3, 3, [](Image &image) {
+                PixelFilter("SaltAndPepperNoise", std::nullopt, "", 0, 0.1).apply(image);
+            });
+
+            // File to file: streamed in bands against loading, filtering and saving the whole image
+            size_t pixels = static_cast<size_t>(size) * size;
+            auto data = syntheticData(pixels * 3);
+            auto directory = std::filesystem::temp_directory_path();
+            std::string input = (directory / "mdip_benchmark_stream_input.png").string();
+            std::string output = (directory / "mdip_benchmark_stream_output.png").string();
+            stbi_write_png(input.c_str(), size, size, 3, data.data(), size * 3);
+            std::string shape = std::to_string(size) + "x" + std::to_string(size) + "x3";
+            Box2DFilter box(5);
+            runBenchmark("ImageStream::filterPng", "box5,streamed", shape, pixels, pixels * 6, []() {}, [&]() {
+                ImageStream::filterPng(input, output, {{2, [&](Image &image, const Region2D &region) {
+                    box.apply(image, region);
+                }}});
+            });
+            runBenchmark("ImageStream::filterPng", "box5,whole", shape, pixels, pixels * 6, []() {}, [&]() {
+                Image image;
+                image.loadFromFile(input);
+                box.apply(image);
+                image.saveToFile(output);
+            });
+            std::filesystem::remove(input);
+            std::filesystem::remove(output);
+        }
+    }
+};
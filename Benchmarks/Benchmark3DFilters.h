@@ -0,0 +1,172 @@
+/**
+ * @file Benchmark3DFilters.h
+ *
+ * @brief Benchmarks for the 3D volume filters.
+ *
+ * This header file defines the Benchmark3DFilters class, which times Gaussian3DFilter in its floating-point, fixed-
+ * point and recursive modes and Median3DFilter on cubic synthetic volumes. Every run filters a fresh copy of the same
+ * volume.
+ *
+ * @date Created on October 19, 2026.
+ *
+ * @authors
+ * Advanced Programming Group Radix Sort:
+ *   - Benjamin Duncan (edsml-bd1023)
+ *   - Boyang Hu (edsml-bh223)
+ *   - Chawk Chamoun (edsml-cc8915)
+ *   - Mingsheng Cai (acse-sc4623)
+ *   - Moyu Zhang (acse-mz223)
+ *   - Ryan Benney (acse-rgb123)
+ */
+
+#pragma once
+
+#include "Benchmark.h"
+#include "FilteredVolume.h"
+#include "Projection.h"
+#include "Volume.h"
+#include "Pyramid.h"
+#include "ResultCache.h"
+#include "Filters/Gaussian3DFilter.h"
+#include "Filters/Median3DFilter.h"
+
+#include <cstdint>
+#include <filesystem>
+#include <memory>
+#include <string>
+#include <vector>
+
+class Benchmark3DFilters : public Benchmark {
+private:
+    /**
+     * Times One Volume Filter
+     *
+     * @param name The benchmarked filter.
+     * @param variant The parameters of the filter.
+     * @param size The edge length of the cubic volume.
+     * @param filter The filter to apply.
+     */
+    void runVolumeBenchmark(const std::string &name, const std::string &variant, int size, IFilter3D &filter) {
+        size_t voxels = static_cast<size_t>(size) * size * size;
+        auto data = syntheticData(voxels);
+        std::vector<unsigned char> working;
+        std::unique_ptr<Volume> volume;
+        runBenchmark(name, variant, std::to_string(size) + "^3", voxels, 2 * voxels,
+                     [&]() {
+                         working = data;
+                         volume = std::make_unique<Volume>(size, size, size, working.data());
+                     },
+                     [&]() { filter.apply(*volume); });
+    }
+
+public:
+    /**
+     * Runs the 3D Filter Benchmarks
+     */
+    virtual void runBenchmarks() override {
+        for (int size: volumeSizes()) {
+            Gaussian3DFilter gaussian(1.0, 5);
+            runVolumeBenchmark("Gaussian3DFilter", "sigma=1,kernel=5", size, gaussian);
+            Gaussian3DFilter fixedGaussian(1.0, 5, GaussianMode::FixedPoint);
+            runVolumeBenchmark("Gaussian3DFilter", "sigma=1,kernel=5,fixed", size, fixedGaussian);
+            Gaussian3DFilter wideGaussian(8.0, 49);
+            runVolumeBenchmark("Gaussian3DFilter", "sigma=8,kernel=49", size, wideGaussian);
+            Gaussian3DFilter recursiveGaussian(8.0, 1, GaussianMode::Recursive);
+            runVolumeBenchmark("Gaussian3DFilter", "sigma=8,recursive", size, recursiveGaussian);
+            Median3DFilter median(3);
+            runVolumeBenchmark("Median3DFilter", "kernel=3", size, median);
+
+            size_t voxels = static_cast<size_t>(size) * size * size;
+            auto data = syntheticData(voxels);
+
+            // Filtering a 64^3 region of interest in the middle of the volume
+            Region3D region{size / 2 - 32, size / 2 - 32, size / 2 - 32, 64, 64, 64};
+            std::vector<unsigned char> working;
+            std::unique_ptr<Volume> target;
+            runBenchmark("Gaussian3DFilter", "sigma=1,kernel=5,roi=64^3", std::to_string(size) + "^3", 64 * 64 * 64,
+                         2 * 68 * 68 * 68,
+                         [&]() {
+                             working = data;
+                             target = std::make_unique<Volume>(size, size, size, working.data());
+                         },
+                         [&]() { gaussian.apply(*target, region); });
+
+            // One filtered x-y slice through a lazy view, i.e. the slice and its kernel halo only
+            Volume source(size, size, size, data.data());
+            std::unique_ptr<FilteredVolume> view;
+            Volume slice;
+            size_t slicePixels = static_cast<size_t>(size) * size;
+            runBenchmark("FilteredVolume::getSlab", "sigma=1,kernel=5,slices=1", std::to_string(size) + "^3",
+                         slicePixels, 6 * slicePixels,
+                         [&]() { view = std::make_unique<FilteredVolume>(source); view->addFilter(gaussian); },
+                         [&]() { view->getSlab(size / 2, size / 2 + 1, slice); });
+
+            // A filtered MIP fused over slabs against filtering the whole volume and projecting it
+            runBenchmark("FilteredVolume::getProjectionUInt8", "MIP,sigma=1,kernel=5,fused",
+                         std::to_string(size) + "^3", voxels, voxels + slicePixels,
+                         [&]() { view = std::make_unique<FilteredVolume>(source); view->addFilter(gaussian); },
+                         [&]() { view->getProjectionUInt8("MIP", 0, size); });
+            runBenchmark("FilteredVolume::getProjectionUInt8", "MIP,sigma=1,kernel=5,materialised",
+                         std::to_string(size) + "^3", voxels, 3 * voxels + slicePixels,
+                         [&]() {
+                             working = data;
+                             target = std::make_unique<Volume>(size, size, size, working.data());
+                         },
+                         [&]() {
+                             gaussian.apply(*target);
+                             Projection::maximumIntensityProjection(size, size, size, target->getData());
+                         });
+
+            // A five-stage chain rerun with only its last stage changed, against running every stage
+            auto cacheDirectory = std::filesystem::temp_directory_path() / "mdip_benchmark_result_cache";
+            std::filesystem::remove_all(cacheDirectory);
+            ResultCache cache(cacheDirectory.string());
+            std::vector<std::unique_ptr<Gaussian3DFilter>> stages;
+            for (double sigma: {0.8, 1.0, 1.2, 1.4}) {
+                stages.push_back(std::make_unique<Gaussian3DFilter>(sigma, 5, GaussianMode::FixedPoint));
+            }
+            std::unique_ptr<Gaussian3DFilter> last;
+            int run = 0;
+            auto chain = [&]() {
+                std::vector<CachedStage<Volume>> result;
+                for (auto &stage: stages) {
+                    result.push_back(ResultCache::stage<Volume>(*stage));
+                }
+                result.push_back(ResultCache::stage<Volume>(*last));
+                return result;
+            };
+            std::uint64_t key = ResultCache::keyOf(source);
+            for (bool cached: {true, false}) {
+                runBenchmark("ResultCache::run", cached ? "5 stages,4 cached" : "5 stages,uncached",
+                             std::to_string(size) + "^3", voxels, 2 * voxels,
+                             [&]() {
+                                 // A new last stage every run, so only the first four can be cached
+                                 last = std::make_unique<Gaussian3DFilter>(1.0 + 0.01 * ++run, 5,
+                                                                           GaussianMode::FixedPoint);
+                                 working = data;
+                                 target = std::make_unique<Volume>(size, size, size, working.data());
+                             },
+                             [&, cached]() {
+                                 if (cached) {
+                                     cache.run(*target, key, chain());
+                                 } else {
+                                     for (auto &stage: chain()) {
+                                         stage.apply(*target);
+                                     }
+                                 }
+                             });
+            }
+            std::filesystem::remove_all(cacheDirectory);
+
+            // Building a preview at 1/8 scale, i.e. pyramid levels 1 to 3
+            for (auto [mode, label]: {std::pair{DownsampleMode::Box, "level=3,box"},
+                                      {DownsampleMode::Gaussian, "level=3,gaussian"}}) {
+                Volume volume(size, size, size, data.data());
+                std::unique_ptr<VolumePyramid> pyramid;
+                runBenchmark("VolumePyramid::getLevel", label, std::to_string(size) + "^3", voxels, voxels + voxels / 7,
+                             [&, mode]() { pyramid = std::make_unique<VolumePyramid>(volume, mode); },
+                             [&]() { pyramid->getLevel(3); });
+            }
+        }
+    }
+};
@@ -0,0 +1,126 @@
+/**
+ * @file BenchmarkLoader.h
+ *
+ * @brief Benchmarks for loading and streaming slice stacks.
+ *
+ * This header file defines the BenchmarkLoader class, which writes a synthetic stack of PNG slices to a temporary
+ * directory and times Volume::loadFromFiles on it, together with the projections that stream the same stack through
+ * VolumeStream and the pipelined and serial filters that load, filter and save it. PNG decoding allocates through
+ * malloc inside stb_image, so the allocation counts of these cases only cover the library's own buffers.
+ *
+ * @date Created on October 19, 2026.
+ *
+ * @authors
+ * Advanced Programming Group Radix Sort:
+ *   - Benjamin Duncan (edsml-bd1023)
+ *   - Boyang Hu (edsml-bh223)
+ *   - Chawk Chamoun (edsml-cc8915)
+ *   - Mingsheng Cai (acse-sc4623)
+ *   - Moyu Zhang (acse-mz223)
+ *   - Ryan Benney (acse-rgb123)
+ */
+
+#pragma once
+
+#include "Benchmark.h"
+#include "ChunkedVolumeFile.h"
+#include "Projection.h"
+#include "Volume.h"
+#include "VolumeFormats.h"
+#include "VolumePipeline.h"
+#include "VolumeStream.h"
+#include "Filters/Gaussian3DFilter.h"
+#include "stb_image_write.h"
+
+#include <cstdio>
+#include <filesystem>
+#include <memory>
+#include <string>
+#include <vector>
+
+class BenchmarkLoader : public Benchmark {
+public:
+    /**
+     * Runs the Loader Benchmarks
+     */
+    virtual void runBenchmarks() override {
+        for (int size: volumeSizes()) {
+            size_t voxels = static_cast<size_t>(size) * size * size;
+            size_t slice = static_cast<size_t>(size) * size;
+            std::string input = std::to_string(size) + "^3";
+
+            // Write the stack once; zero-padded names keep the directory order equal to the z order
+            auto directory = std::filesystem::temp_directory_path() / ("mdip_benchmark_stack_" + std::to_string(size));
+            std::filesystem::create_directories(directory);
+            auto data = syntheticData(voxels);
+            std::vector<std::string> paths;
+            for (int z = 0; z < size; ++z) {
+                char name[32];
+                std::snprintf(name, sizeof(name), "slice_%04d.png", z);
+                paths.push_back((directory / name).string());
+                stbi_write_png(paths.back().c_str(), size, size, 1, &data[z * slice], size);
+            }
+
+            std::unique_ptr<Volume> volume;
+            runBenchmark("Volume::loadFromFiles", "png", input, voxels, voxels,
+                         [&]() { volume = std::make_unique<Volume>(); },
+                         [&]() { volume->loadFromFiles(paths); });
+            volume.reset();
+
+            VolumeStream stream;
+            stream.openFiles(paths);
+            using StreamProjector = std::vector<unsigned char> (*)(const VolumeStream &);
+            const std::pair<const char *, StreamProjector> projectors[] = {
+                    {"Projection::maximumIntensityProjection", &Projection::maximumIntensityProjection},
+                    {"Projection::minimumIntensityProjection", &Projection::minimumIntensityProjection},
+                    {"Projection::averageIntensityProjection", &Projection::averageIntensityProjection}};
+            for (auto [name, projector]: projectors) {
+                runBenchmark(name, "streamed", input, voxels, voxels + slice, []() {}, [&, projector]() {
+                    projector(stream);
+                });
+            }
+
+            Volume source(size, size, size, data.data());
+            // Slices are encoded by the output service while the next ones are extracted
+            std::string savePath = (directory / "saved").string();
+            runBenchmark("Volume::save", "png", input, voxels, voxels, []() {}, [&]() {
+                source.save(savePath, "x-y");
+            });
+
+            // Load, filter and save: decoding, filtering and encoding overlapped against the serial streamed filter
+            Gaussian3DFilter gaussian(1.0, 5);
+            runBenchmark("VolumePipeline::run", "gaussian,sigma=1,kernel=5", input, voxels, 2 * voxels, []() {}, [&]() {
+                VolumePipeline(PipelineOptions{}).addFilter(gaussian).run(stream, savePath);
+            });
+            runBenchmark("Gaussian3DFilter", "streamed,sigma=1,kernel=5", input, voxels, 2 * voxels, []() {}, [&]() {
+                gaussian.apply(stream, savePath);
+            });
+
+            // The same stack in one chunked file, read whole and one slice at a time
+            std::string chunkedPath = (directory / "volume.mdip").string();
+            runBenchmark("ChunkedVolumeFile::save", "lz", input, voxels, voxels, []() {}, [&]() {
+                ChunkedVolumeFile::save(source, chunkedPath);
+            });
+            ChunkedVolumeFile chunked;
+            chunked.open(chunkedPath);
+            runBenchmark("ChunkedVolumeFile::load", "lz", input, voxels, voxels,
+                         [&]() { volume = std::make_unique<Volume>(); },
+                         [&]() { chunked.load(*volume); });
+            volume.reset();
+            std::vector<unsigned char> sliceData(slice);
+            runBenchmark("ChunkedVolumeFile::readSlices", "lz,1 slice", input, slice, slice, []() {}, [&]() {
+                chunked.readSlices(size / 2, size / 2, sliceData.data());
+            });
+
+            // A raw NRRD payload is mapped rather than read, so loading is a header parse and an mmap
+            std::string nrrdPath = (directory / "volume.nrrd").string();
+            VolumeFormats::saveNrrd(source, nrrdPath);
+            runBenchmark("VolumeFormats::loadNrrd", "raw,mapped", input, voxels, voxels,
+                         [&]() { volume = std::make_unique<Volume>(); },
+                         [&]() { VolumeFormats::loadNrrd(nrrdPath, *volume); });
+            volume.reset();
+
+            std::filesystem::remove_all(directory);
+        }
+    }
+};
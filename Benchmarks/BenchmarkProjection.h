@@ -0,0 +1,125 @@
+/**
+ * @file BenchmarkProjection.h
+ *
+ * @brief Benchmarks for the projections and slice extraction.
+ *
+ * This header file defines the BenchmarkProjection class, which times every in-memory Projection function on 8-bit and
+ * 16-bit volumes and on the bricked layout, and Slice::getPlaneSlice for each of the three planes. The streamed
+ * projections read from disk and are timed with the loaders in BenchmarkLoader.
+ *
+ * @date Created on October 19, 2026.
+ *
+ * @authors
+ * Advanced Programming Group Radix Sort:
+ *   - Benjamin Duncan (edsml-bd1023)
+ *   - Boyang Hu (edsml-bh223)
+ *   - Chawk Chamoun (edsml-cc8915)
+ *   - Mingsheng Cai (acse-sc4623)
+ *   - Moyu Zhang (acse-mz223)
+ *   - Ryan Benney (acse-rgb123)
+ */
+
+#pragma once
+
+#include "Benchmark.h"
+#include "Projection.h"
+#include "ProjectionIndex.h"
+#include "ProjectionKernels.h"
+#include "Slice.h"
+#include "BrickedVolume.h"
+#include "Volume.h"
+
+#include <string>
+#include <vector>
+
+class BenchmarkProjection : public Benchmark {
+public:
+    /**
+     * Runs the Projection and Slice Benchmarks
+     */
+    virtual void runBenchmarks() override {
+        for (int size: volumeSizes()) {
+            size_t voxels = static_cast<size_t>(size) * size * size;
+            size_t slice = static_cast<size_t>(size) * size;
+            std::string input = std::to_string(size) + "^3";
+            auto data = syntheticData(voxels);
+            std::vector<unsigned short> wide(data.begin(), data.end());
+            for (auto &value: wide) {
+                value = static_cast<unsigned short>(value * 257);
+            }
+            auto noSetup = []() {};
+
+            using Projector = std::vector<unsigned char> (*)(int, int, int, const unsigned char *);
+            using WideProjector = std::vector<unsigned short> (*)(int, int, int, const unsigned short *);
+            const std::pair<const char *, Projector> projectors[] = {
+                    {"Projection::maximumIntensityProjection", &Projection::maximumIntensityProjection},
+                    {"Projection::minimumIntensityProjection", &Projection::minimumIntensityProjection},
+                    {"Projection::averageIntensityProjection", &Projection::averageIntensityProjection},
+                    {"Projection::medianIntensityProjection", &Projection::medianIntensityProjection}};
+            const WideProjector wideProjectors[] = {
+                    &Projection::maximumIntensityProjection<unsigned short>,
+                    &Projection::minimumIntensityProjection<unsigned short>,
+                    &Projection::averageIntensityProjection<unsigned short>,
+                    &Projection::medianIntensityProjection<unsigned short>};
+            for (int i = 0; i < 4; ++i) {
+                auto [name, projector] = projectors[i];
+                runBenchmark(name, "uint8", input, voxels, voxels + slice, noSetup, [&, projector]() {
+                    projector(size, size, size, data.data());
+                });
+                runBenchmark(name, "uint16", input, voxels, 2 * (voxels + slice), noSetup, [&, i]() {
+                    wideProjectors[i](size, size, size, wide.data());
+                });
+            }
+
+            // 8-bit MIP and AIP at every instruction set level the processor supports
+            SimdLevel detected = ProjectionKernels::detectedLevel();
+            for (SimdLevel level: {SimdLevel::Scalar, SimdLevel::SSE2, SimdLevel::AVX2, SimdLevel::AVX512}) {
+                if (level > detected) {
+                    break;
+                }
+                std::string variant = std::string("uint8-") + ProjectionKernels::levelName(level);
+                auto select = [level]() { ProjectionKernels::setLevel(level); };
+                runBenchmark("Projection::maximumIntensityProjection", variant, input, voxels, voxels + slice, select,
+                             [&]() { Projection::maximumIntensityProjection(size, size, size, data.data()); });
+                runBenchmark("Projection::averageIntensityProjection", variant, input, voxels, voxels + slice, select,
+                             [&]() { Projection::averageIntensityProjection(size, size, size, data.data()); });
+            }
+            ProjectionKernels::setLevel(detected);
+
+            // Thick-slab MIP and AIP computed directly and answered by a projection index built once
+            int slabBegin = size / 8, slabEnd = size - size / 8 - 1, slabDepth = slabEnd - slabBegin + 1;
+            const unsigned char *slab = data.data() + slabBegin * slice;
+            ProjectionIndex<unsigned char> index(size, size, size, data.data());
+            runBenchmark("Projection::maximumIntensityProjection", "slab", input, slice * slabDepth,
+                         slice * (slabDepth + 1), noSetup,
+                         [&]() { Projection::maximumIntensityProjection(size, size, slabDepth, slab); });
+            runBenchmark("ProjectionIndex::maximum", "slab", input, slice * slabDepth, slice * (slabDepth + 1), noSetup,
+                         [&]() { index.maximum(slabBegin, slabEnd); });
+            runBenchmark("Projection::averageIntensityProjection", "slab", input, slice * slabDepth,
+                         slice * (slabDepth + 1), noSetup,
+                         [&]() { Projection::averageIntensityProjection(size, size, slabDepth, slab); });
+            runBenchmark("ProjectionIndex::average", "slab", input, slice * slabDepth, slice * (slabDepth + 1), noSetup,
+                         [&]() { index.average(slabBegin, slabEnd); });
+
+            Volume volume(size, size, size, data.data());
+            BrickedVolume bricked(volume);
+            using BrickedProjector = std::vector<unsigned char> (*)(const BrickedVolume &);
+            const std::pair<const char *, BrickedProjector> brickedProjectors[] = {
+                    {"Projection::maximumIntensityProjection", &Projection::maximumIntensityProjection},
+                    {"Projection::minimumIntensityProjection", &Projection::minimumIntensityProjection},
+                    {"Projection::averageIntensityProjection", &Projection::averageIntensityProjection},
+                    {"Projection::medianIntensityProjection", &Projection::medianIntensityProjection}};
+            for (auto [name, projector]: brickedProjectors) {
+                runBenchmark(name, "bricked", input, voxels, voxels + slice, noSetup, [&, projector]() {
+                    projector(bricked);
+                });
+            }
+
+            for (const char *plane: {"x-y", "x-z", "y-z"}) {
+                runBenchmark("Slice::getPlaneSlice", plane, input, slice, 2 * slice, noSetup, [&, plane]() {
+                    Slice::getPlaneSlice(size, size, size, data.data(), plane, size / 2);
+                });
+            }
+        }
+    }
+};
@@ -0,0 +1,183 @@
+/**
+ * @file main.cpp
+ *
+ * @brief Entry Point for the Benchmark Suite.
+ *
+ * This file acts as the entry point for the runBenchmarks executable, which times the 2D filters, the 3D filters, the
+ * projections, slice extraction and the slice stack loaders on synthetic inputs and reports the results as JSON. It also
+ * replaces the global operator new and operator delete with versions that count every allocation, so each result records
+ * how many heap allocations the benchmarked operation made and how many bytes it requested.
+ *
+ * Usage:
+ *   runBenchmarks [--scale small|medium|large] [--repetitions N] [--filter NAME] [--output FILE]
+ *
+ * The small scale uses 512x512 images and 128^3 volumes, the medium scale adds 2048x2048 images and 256^3 volumes, and the
+ * large scale adds 8192x8192 images and 512^3 volumes. Only cases whose name contains the filter string are run. The
+ * JSON document is written to the output file, or to standard output when no file is given; progress is reported on
+ * standard error.
+ *
+ * @date Created on October 19, 2026.
+ *
+ * @authors
+ * Advanced Programming Group Radix Sort:
+ *   - Benjamin Duncan (edsml-bd1023)
+ *   - Boyang Hu (edsml-bh223)
+ *   - Chawk Chamoun (edsml-cc8915)
+ *   - Mingsheng Cai (acse-sc4623)
+ *   - Moyu Zhang (acse-mz223)
+ *   - Ryan Benney (acse-rgb123)
+ */
+
+#include "Benchmark.h"
+#include "Benchmark2DFilters.h"
+#include "Benchmark3DFilters.h"
+#include "BenchmarkProjection.h"
+#include "BenchmarkLoader.h"
+
+#include <algorithm>
+#include <cstdlib>
+#include <fstream>
+#include <new>
+#include <string>
+
+#define STB_IMAGE_WRITE_IMPLEMENTATION
+
+#include "stb_image_write.h"
+
+#define STB_IMAGE_IMPLEMENTATION
+
+#include "stb_image.h"
+
+std::atomic<std::size_t> allocationCount{0};
+std::atomic<std::size_t> allocationBytes{0};
+
+namespace {
+    // Counts an allocation and gets it from malloc, or aligned_alloc when an alignment is given. Kept out of line with
+    // release, so that GCC sees new and delete pair through these helpers rather than matching free against new.
+    [[gnu::noinline]] void *allocate(std::size_t size, std::size_t alignment = 0) {
+        allocationCount.fetch_add(1, std::memory_order_relaxed);
+        allocationBytes.fetch_add(size, std::memory_order_relaxed);
+        size = std::max<std::size_t>(size, 1);
+        void *pointer = alignment ? std::aligned_alloc(alignment, (size + alignment - 1) / alignment * alignment)
+                                  : std::malloc(size);
+        if (!pointer) {
+            throw std::bad_alloc();
+        }
+        return pointer;
+    }
+
+    [[gnu::noinline]] void release(void *pointer) noexcept {
+        std::free(pointer);
+    }
+}
+
+// Counting replacements for the global allocation functions; the remaining forms forward to these
+void *operator new(std::size_t size) {
+    return allocate(size);
+}
+
+void *operator new[](std::size_t size) {
+    return operator new(size);
+}
+
+void *operator new(std::size_t size, std::align_val_t alignment) {
+    return allocate(size, static_cast<std::size_t>(alignment));
+}
+
+void *operator new[](std::size_t size, std::align_val_t alignment) {
+    return operator new(size, alignment);
+}
+
+void operator delete(void *pointer) noexcept {
+    release(pointer);
+}
+
+void operator delete[](void *pointer) noexcept {
+    release(pointer);
+}
+
+void operator delete(void *pointer, std::size_t) noexcept {
+    release(pointer);
+}
+
+void operator delete[](void *pointer, std::size_t) noexcept {
+    release(pointer);
+}
+
+void operator delete(void *pointer, std::align_val_t) noexcept {
+    release(pointer);
+}
+
+void operator delete[](void *pointer, std::align_val_t) noexcept {
+    release(pointer);
+}
+
+void operator delete(void *pointer, std::size_t, std::align_val_t) noexcept {
+    release(pointer);
+}
+
+void operator delete[](void *pointer, std::size_t, std::align_val_t) noexcept {
+    release(pointer);
+}
+
+int main(int argc, char **argv) {
+    BenchmarkScale scale = BenchmarkScale::Small;
+    int repetitions = 5;
+    std::string filter, output;
+
+    // Parse the command line
+    for (int i = 1; i < argc; ++i) {
+        std::string argument = argv[i];
+        bool hasValue = i + 1 < argc;
+        if (argument == "--scale" && hasValue) {
+            std::string value = argv[++i];
+            if (value == "small") {
+                scale = BenchmarkScale::Small;
+            } else if (value == "medium") {
+                scale = BenchmarkScale::Medium;
+            } else if (value == "large") {
+                scale = BenchmarkScale::Large;
+            } else {
+                std::cerr << "Unknown scale: " << value << std::endl;
+                return 1;
+            }
+        } else if (argument == "--repetitions" && hasValue) {
+            repetitions = std::atoi(argv[++i]);
+        } else if (argument == "--filter" && hasValue) {
+            filter = argv[++i];
+        } else if (argument == "--output" && hasValue) {
+            output = argv[++i];
+        } else {
+            std::cerr << "Usage: runBenchmarks [--scale small|medium|large] [--repetitions N] [--filter NAME] "
+                         "[--output FILE]" << std::endl;
+            return 1;
+        }
+    }
+    Benchmark::configure(scale, repetitions, filter);
+
+    // Create benchmark objects
+    Benchmark2DFilters benchmark2DFilters;
+    Benchmark3DFilters benchmark3DFilters;
+    BenchmarkProjection benchmarkProjection;
+    BenchmarkLoader benchmarkLoader;
+
+    // Run benchmarks
+    benchmark2DFilters.runBenchmarks();
+    benchmark3DFilters.runBenchmarks();
+    benchmarkProjection.runBenchmarks();
+    benchmarkLoader.runBenchmarks();
+
+    // Report the results
+    if (output.empty()) {
+        Benchmark::writeJson(std::cout);
+    } else {
+        std::ofstream file(output);
+        if (!file) {
+            std::cerr << "Failed to open output file: " << output << std::endl;
+            return 1;
+        }
+        Benchmark::writeJson(file);
+    }
+
+    return 0;
+}
@@ -0,0 +1,112 @@
+/**
+ * @file BoundedQueue.h
+ *
+ * @brief Declares the BoundedQueue class, a blocking first-in first-out queue with a fixed capacity.
+ *
+ * The stages of a pipeline hand work to each other through queues. An unbounded queue lets a fast producer run ahead
+ * of a slow consumer until memory runs out; a BoundedQueue instead makes the producer wait while the queue is full, so
+ * the amount of work in flight is capped and every stage runs at the pace of the slowest one. Closing a queue wakes
+ * every waiting thread: producers are refused and consumers drain what is left, which lets a pipeline shut down both
+ * when its input is exhausted and when a stage fails.
+ *
+ * @date Created on October 19, 2026
+ *
+ * @authors
+ * Advanced Programming Group Radix Sort:
+ *   - Benjamin Duncan (edsml-bd1023)
+ *   - Boyang Hu (edsml-bh223)
+ *   - Chawk Chamoun (edsml-cc8915)
+ *   - Mingsheng Cai (acse-sc4623)
+ *   - Moyu Zhang (acse-mz223)
+ *   - Ryan Benney (acse-rgb123)
+ */
+
+#pragma once
+
+#ifndef ADVANCED_PROGRAMMING_GROUP_RADIX_SORT_BOUNDEDQUEUE_H
+#define ADVANCED_PROGRAMMING_GROUP_RADIX_SORT_BOUNDEDQUEUE_H
+
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <mutex>
+#include <stdexcept>
+#include <utility>
+
+template<typename T>
+class BoundedQueue {
+private:
+    std::mutex mutex; // Guards the members below
+    std::condition_variable notFull, notEmpty; // Signalled when an item is removed or added, and on close
+    std::deque<T> items; // Queued items, oldest first
+    size_t capacity; // Most items held at once
+    bool closed; // Whether push is refused
+
+public:
+    /**
+     * Constructor for the BoundedQueue class.
+     *
+     * @param capacity: The number of items the queue holds before push waits, at least 1.
+     */
+    explicit BoundedQueue(size_t capacity) : capacity(capacity), closed(false) {
+        if (capacity == 0) {
+            throw std::invalid_argument("A bounded queue must hold at least one item.");
+        }
+    }
+
+    /**
+     * Appends an item, waiting while the queue is full.
+     *
+     * @param item: The item to append.
+     * @return: True if the item was queued, or false if the queue is or becomes closed, in which case the item is
+     * dropped.
+     */
+    bool push(T item) {
+        std::unique_lock<std::mutex> lock(mutex);
+        notFull.wait(lock, [this]() { return closed || items.size() < capacity; });
+        if (closed) {
+            return false;
+        }
+        items.push_back(std::move(item));
+        notEmpty.notify_one();
+        return true;
+    }
+
+    /**
+     * Removes the oldest item, waiting while the queue is empty and open.
+     *
+     * @param item: Receives the item.
+     * @return: True if an item was removed, or false once the queue is closed and empty.
+     */
+    bool pop(T &item) {
+        std::unique_lock<std::mutex> lock(mutex);
+        notEmpty.wait(lock, [this]() { return closed || !items.empty(); });
+        if (items.empty()) {
+            return false;
+        }
+        item = std::move(items.front());
+        items.pop_front();
+        notFull.notify_one();
+        return true;
+    }
+
+    /**
+     * Refuses further items and wakes every waiting thread. Items already queued can still be popped.
+     */
+    void close() {
+        std::lock_guard<std::mutex> lock(mutex);
+        closed = true;
+        notFull.notify_all();
+        notEmpty.notify_all();
+    }
+
+    /**
+     * @brief Get the number of queued items.
+     */
+    size_t size() {
+        std::lock_guard<std::mutex> lock(mutex);
+        return items.size();
+    }
+};
+
+#endif //ADVANCED_PROGRAMMING_GROUP_RADIX_SORT_BOUNDEDQUEUE_H
@@ -0,0 +1,248 @@
+/**
+ * @file BrickedVolume.h
+ *
+ * @brief Stores 3D volumetric data in cubic bricks for cache-friendly access along every axis.
+ *
+ * The BrickedVolume class keeps a copy of a Volume split into cubic bricks (for example 32^3 or 64^3 voxels), each of
+ * which is stored contiguously in memory. Bricks can be laid out in plain x-y-z order or along a Morton (Z-order) curve so
+ * that spatially neighbouring bricks also end up close together in memory. Walking the data along x, y or z therefore only
+ * touches a handful of bricks instead of striding through the whole z-major array, which keeps x-z and y-z slices, z-axis
+ * filter passes and z-column projections cache and TLB friendly. The class converts to and from the linear layout used by
+ * Volume and provides brick-aware accessors that are used by Slice, Projection and the 3D filters.
+ *
+ * @date Created on October 19, 2026
+ *
+ * @authors
+ * Advanced Programming Group Radix Sort:
+ *   - Benjamin Duncan (edsml-bd1023)
+ *   - Boyang Hu (edsml-bh223)
+ *   - Chawk Chamoun (edsml-cc8915)
+ *   - Mingsheng Cai (acse-sc4623)
+ *   - Moyu Zhang (acse-mz223)
+ *   - Ryan Benney (acse-rgb123)
+ */
+
+#pragma once
+
+#ifndef ADVANCED_PROGRAMMING_GROUP_RADIX_SORT_BRICKEDVOLUME_H
+#define ADVANCED_PROGRAMMING_GROUP_RADIX_SORT_BRICKEDVOLUME_H
+
+#include "Volume.h"
+
+#include <cstddef>
+#include <vector>
+
+enum class BrickOrder {
+    Linear, // Bricks stored in x-fastest, then y, then z order
+    Morton // Bricks stored along a Morton (Z-order) curve
+};
+
+class BrickedVolume {
+private:
+    int width, height, depth; // Size of the volume
+    int brickSize; // Edge length of a brick, always a power of two
+    int brickShift; // log2(brickSize)
+    int bricksX, bricksY, bricksZ; // Number of bricks along each axis
+    BrickOrder brickOrder; // Order in which bricks are laid out in memory
+    std::vector<int> brickSlots; // Maps a linear brick index to its position in memory
+    std::vector<unsigned char> data; // Brick data, brickSize^3 voxels per brick
+
+    /**
+     * Initialises the brick grid and the brick slot table.
+     *
+     * This helper validates the brick size, derives the number of bricks needed along each axis and computes the slot at
+     * which every brick is stored. For Morton ordering the bricks are ranked by the interleaved bits of their brick
+     * coordinates, so that the layout stays dense even when the brick grid is not a power of two along every axis.
+     *
+     * @param brickSize: The edge length of a brick.
+     * @throws std::invalid_argument if brickSize is not a positive power of two.
+     */
+    void initialiseLayout(int brickSize);
+
+public:
+    /**
+     * Constructor for an empty BrickedVolume.
+     *
+     * Creates a zero-filled bricked volume of the specified size.
+     *
+     * @param width: The width of the volume.
+     * @param height: The height of the volume.
+     * @param depth: The depth of the volume.
+     * @param brickSize: The edge length of a brick. Must be a power of two.
+     * @param brickOrder: The order in which bricks are stored in memory.
+     * @throws std::invalid_argument if brickSize is not a positive power of two.
+     */
+    BrickedVolume(int width, int height, int depth, int brickSize = 32, BrickOrder brickOrder = BrickOrder::Morton);
+
+    /**
+     * Constructor converting a linear Volume into the bricked layout.
+     *
+     * Copies the voxels of a z-major Volume into bricks. The source volume is left untouched.
+     *
+     * @param volume: The volume to convert.
+     * @param brickSize: The edge length of a brick. Must be a power of two.
+     * @param brickOrder: The order in which bricks are stored in memory.
+     * @throws std::invalid_argument if brickSize is not a positive power of two or the volume is not 8-bit.
+     */
+    explicit BrickedVolume(const Volume &volume, int brickSize = 32, BrickOrder brickOrder = BrickOrder::Morton);
+
+    /**
+     * Get the width of the volume.
+     *
+     * @return The width of the volume.
+     */
+    int getWidth() const { return width; }
+
+    /**
+     * Get the height of the volume.
+     *
+     * @return The height of the volume.
+     */
+    int getHeight() const { return height; }
+
+    /**
+     * Get the depth of the volume.
+     *
+     * @return The depth of the volume.
+     */
+    int getDepth() const { return depth; }
+
+    /**
+     * Get the edge length of a brick.
+     *
+     * @return The edge length of a brick.
+     */
+    int getBrickSize() const { return brickSize; }
+
+    /**
+     * Get the order in which bricks are stored.
+     *
+     * @return The order in which bricks are stored.
+     */
+    BrickOrder getBrickOrder() const { return brickOrder; }
+
+    /**
+     * Get the number of bricks along the x-axis.
+     *
+     * @return The number of bricks along the x-axis.
+     */
+    int getBricksX() const { return bricksX; }
+
+    /**
+     * Get the number of bricks along the y-axis.
+     *
+     * @return The number of bricks along the y-axis.
+     */
+    int getBricksY() const { return bricksY; }
+
+    /**
+     * Get the number of bricks along the z-axis.
+     *
+     * @return The number of bricks along the z-axis.
+     */
+    int getBricksZ() const { return bricksZ; }
+
+    /**
+     * Returns the offset of a voxel within the brick storage.
+     *
+     * The coordinates must lie inside the volume; no bounds checking is performed.
+     *
+     * @param x: The x-coordinate of the voxel.
+     * @param y: The y-coordinate of the voxel.
+     * @param z: The z-coordinate of the voxel.
+     *
+     * @return: The index of the voxel in the brick storage.
+     */
+    std::size_t voxelOffset(int x, int y, int z) const {
+        int mask = brickSize - 1;
+        int brick = ((z >> brickShift) * bricksY + (y >> brickShift)) * bricksX + (x >> brickShift);
+        std::size_t local = (static_cast<std::size_t>(z & mask) << (2 * brickShift)) |
+                            (static_cast<std::size_t>(y & mask) << brickShift) | static_cast<std::size_t>(x & mask);
+        return (static_cast<std::size_t>(brickSlots[brick]) << (3 * brickShift)) + local;
+    }
+
+    /**
+     * Returns the voxel value at the specified coordinates without bounds checking.
+     *
+     * @param x: The x-coordinate of the voxel.
+     * @param y: The y-coordinate of the voxel.
+     * @param z: The z-coordinate of the voxel.
+     *
+     * @return: The voxel value.
+     */
+    unsigned char getVoxel(int x, int y, int z) const { return data[voxelOffset(x, y, z)]; }
+
+    /**
+     * Sets the voxel value at the specified coordinates without bounds checking.
+     *
+     * @param x: The x-coordinate of the voxel.
+     * @param y: The y-coordinate of the voxel.
+     * @param z: The z-coordinate of the voxel.
+     * @param value: The new voxel value.
+     */
+    void setVoxel(int x, int y, int z, unsigned char value) { data[voxelOffset(x, y, z)] = value; }
+
+    /**
+     * Returns a pointer to the first voxel of a brick.
+     *
+     * Voxels inside a brick are stored x-fastest, then y, then z, with brickSize voxels per row. Bricks on the upper
+     * edges of the volume are allocated in full; voxels outside the volume are padding and hold zero.
+     *
+     * @param bx: The brick coordinate along x.
+     * @param by: The brick coordinate along y.
+     * @param bz: The brick coordinate along z.
+     *
+     * @return: A pointer to the brick's voxels.
+     */
+    const unsigned char *getBrick(int bx, int by, int bz) const;
+
+    /**
+     * Reads a run of voxels along the x-axis.
+     *
+     * Copies count consecutive voxels starting at (x, y, z) into out. Runs that cross brick boundaries are copied one
+     * contiguous brick row at a time.
+     *
+     * @param x: The x-coordinate of the first voxel.
+     * @param y: The y-coordinate of the run.
+     * @param z: The z-coordinate of the run.
+     * @param count: The number of voxels to read.
+     * @param out: The destination buffer, which must hold at least count voxels.
+     */
+    void readSpanX(int x, int y, int z, int count, unsigned char *out) const;
+
+    /**
+     * Writes a run of voxels along the x-axis.
+     *
+     * The counterpart of readSpanX, copying count voxels from in into the volume starting at (x, y, z).
+     *
+     * @param x: The x-coordinate of the first voxel.
+     * @param y: The y-coordinate of the run.
+     * @param z: The z-coordinate of the run.
+     * @param count: The number of voxels to write.
+     * @param in: The source buffer holding at least count voxels.
+     */
+    void writeSpanX(int x, int y, int z, int count, const unsigned char *in);
+
+    /**
+     * Copies the volume into a linear z-major buffer.
+     *
+     * @param out: The destination buffer, which must hold width * height * depth voxels.
+     */
+    void copyToLinear(unsigned char *out) const;
+
+    /**
+     * Copies a linear z-major buffer into the bricked layout.
+     *
+     * @param in: The source buffer holding width * height * depth voxels.
+     */
+    void copyFromLinear(const unsigned char *in);
+
+    /**
+     * Converts the bricked volume back into the linear layout.
+     *
+     * @return: A vector of width * height * depth voxels in z-major order, suitable for Volume::updateData.
+     */
+    std::vector<unsigned char> toLinear() const;
+};
+
+#endif //ADVANCED_PROGRAMMING_GROUP_RADIX_SORT_BRICKEDVOLUME_H
@@ -0,0 +1,171 @@
+/**
+ * @file Buffer.h
+ *
+ * @brief Declares the Buffer class, which owns or views the sample memory of images and volumes.
+ *
+ * Image and Volume samples come from several places: stb_image allocates with malloc, the filters used to allocate with
+ * new[], and the tests wrap memory owned by a std::vector. The Buffer class records how its memory must be released by
+ * storing a deleter next to the pointer, so the right function is always called whatever the origin of the memory. A
+ * buffer allocated by the class itself is aligned to 64 bytes, the size of a cache line and of an AVX-512 register. A
+ * buffer created with Buffer::view only refers to memory owned elsewhere and never releases it.
+ *
+ * Buffers cannot be copied, only moved, so ownership is always explicit. Moving or swapping a buffer exchanges pointers
+ * and never touches the samples, which lets filters hand their output to an image without allocating or copying.
+ *
+ * @date Created on October 19, 2026
+ *
+ * @authors
+ * Advanced Programming Group Radix Sort:
+ *   - Benjamin Duncan (edsml-bd1023)
+ *   - Boyang Hu (edsml-bh223)
+ *   - Chawk Chamoun (edsml-cc8915)
+ *   - Mingsheng Cai (acse-sc4623)
+ *   - Moyu Zhang (acse-mz223)
+ *   - Ryan Benney (acse-rgb123)
+ */
+
+#pragma once
+
+#ifndef ADVANCED_PROGRAMMING_GROUP_RADIX_SORT_BUFFER_H
+#define ADVANCED_PROGRAMMING_GROUP_RADIX_SORT_BUFFER_H
+
+#include <cstddef>
+
+class Buffer {
+public:
+    using Deleter = void (*)(void *); // Releases the memory of an owning buffer
+
+    static constexpr size_t alignment = 64; // Alignment of the memory allocated by the class
+
+private:
+    unsigned char *data; // First byte of the buffer
+    size_t size; // Size of the buffer in bytes
+    Deleter deleter; // Releases data, or nullptr for views and empty buffers
+
+    Buffer(const Buffer &) = delete;
+
+    Buffer &operator=(const Buffer &) = delete;
+
+public:
+    /**
+     * Default constructor for the Buffer class.
+     *
+     * Creates an empty buffer that holds no memory.
+     */
+    Buffer();
+
+    /**
+     * Constructor allocating a new buffer.
+     *
+     * Allocates size bytes aligned to Buffer::alignment. The contents are left uninitialised.
+     *
+     * @param size: The size of the buffer in bytes.
+     * @throws std::bad_alloc if the memory cannot be allocated.
+     */
+    explicit Buffer(size_t size);
+
+    /**
+     * Constructor adopting memory allocated elsewhere.
+     *
+     * The buffer takes ownership of data and releases it with deleter when it is destroyed or reset.
+     *
+     * @param data: The memory to adopt.
+     * @param size: The size of the memory in bytes.
+     * @param deleter: The function that releases data, for example Buffer::freeArray for memory from new[].
+     */
+    Buffer(void *data, size_t size, Deleter deleter);
+
+    /**
+     * Move constructor for the Buffer class.
+     *
+     * Takes over the memory of other, which is left empty.
+     *
+     * @param other: The buffer to move from.
+     */
+    Buffer(Buffer &&other) noexcept;
+
+    /**
+     * Move assignment operator for the Buffer class.
+     *
+     * Releases the current memory and takes over the memory of other, which is left empty.
+     *
+     * @param other: The buffer to move from.
+     * @return: A reference to this buffer.
+     */
+    Buffer &operator=(Buffer &&other) noexcept;
+
+    /**
+     * Destructor for the Buffer class.
+     *
+     * Releases the memory with the stored deleter if the buffer owns it.
+     */
+    ~Buffer();
+
+    /**
+     * Creates a non-owning view of existing memory.
+     *
+     * The view never releases the memory, so the caller must keep it alive for as long as the view is used.
+     *
+     * @param data: The memory to refer to.
+     * @param size: The size of the memory in bytes.
+     * @return: A buffer that refers to data without owning it.
+     */
+    static Buffer view(void *data, size_t size);
+
+    /**
+     * Releases memory allocated by Buffer(size_t).
+     */
+    static void freeAligned(void *data);
+
+    /**
+     * Releases memory allocated with new unsigned char[].
+     */
+    static void freeArray(void *data);
+
+    /**
+     * Releases memory allocated with malloc.
+     */
+    static void freeMalloc(void *data);
+
+    /**
+     * Get a pointer to the first byte of the buffer.
+     *
+     * @return: The pointer, or nullptr for an empty buffer.
+     */
+    unsigned char *getData() const;
+
+    /**
+     * Get the size of the buffer.
+     *
+     * @return: The size in bytes.
+     */
+    size_t getSize() const;
+
+    /**
+     * Check whether the buffer holds no memory.
+     *
+     * @return: True if the buffer is empty.
+     */
+    bool isEmpty() const;
+
+    /**
+     * Check whether the buffer releases its memory when destroyed.
+     *
+     * @return: True for owning buffers, false for views and empty buffers.
+     */
+    bool ownsData() const;
+
+    /**
+     * Exchanges the memory of two buffers without copying any samples.
+     *
+     * @param other: The buffer to swap with.
+     */
+    void swap(Buffer &other) noexcept;
+
+    /**
+     * Releases the memory if it is owned and leaves the buffer empty.
+     */
+    void reset();
+};
+
+#endif //ADVANCED_PROGRAMMING_GROUP_RADIX_SORT_BUFFER_H
@@ -0,0 +1,159 @@
+/**
+ * @file BufferPool.h
+ *
+ * @brief Declares the BufferPool class, a thread-safe cache of aligned buffers for filter outputs and scratch memory.
+ *
+ * Every filter application needs an output buffer the size of its input, and several need scratch buffers of the same
+ * size. Allocating these afresh costs page faults on first touch and, for std::vector, a full zero fill, which in batch
+ * jobs over same-sized images is a large share of the runtime. The BufferPool class keeps released buffers in free
+ * lists keyed by size class and hands them out again, so a second image of the same size reuses the memory of the first.
+ *
+ * Requested sizes are rounded up to a size class: 4 KB at least, and above that one of four evenly spaced sizes per power
+ * of two, so at most a fifth of a buffer is unused. Buffers returned by acquire are ordinary Buffer objects whose deleter
+ * gives the memory back to the pool, so images and volumes release pooled memory like any other. The pool keeps at most
+ * cacheLimit bytes of idle memory and frees anything beyond that. Pooled memory is 64-byte aligned and is not cleared.
+ *
+ * @date Created on October 19, 2026
+ *
+ * @authors
+ * Advanced Programming Group Radix Sort:
+ *   - Benjamin Duncan (edsml-bd1023)
+ *   - Boyang Hu (edsml-bh223)
+ *   - Chawk Chamoun (edsml-cc8915)
+ *   - Mingsheng Cai (acse-sc4623)
+ *   - Moyu Zhang (acse-mz223)
+ *   - Ryan Benney (acse-rgb123)
+ */
+
+#pragma once
+
+#ifndef ADVANCED_PROGRAMMING_GROUP_RADIX_SORT_BUFFERPOOL_H
+#define ADVANCED_PROGRAMMING_GROUP_RADIX_SORT_BUFFERPOOL_H
+
+#include "Buffer.h"
+
+#include <cstddef>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+// Counters describing how well a pool is reused
+struct BufferPoolStats {
+    size_t requests; // Calls to acquire
+    size_t hits; // Requests served from a free list
+    size_t bytesInUse; // Capacity of the buffers currently handed out
+    size_t peakBytesInUse; // Largest value bytesInUse has reached
+    size_t bytesCached; // Capacity of the idle buffers held in the free lists
+
+    /**
+     * Returns the fraction of requests served without allocating, or 0 if there were none.
+     */
+    double hitRate() const {
+        return requests ? static_cast<double>(hits) / requests : 0.0;
+    }
+};
+
+class BufferPool {
+private:
+    size_t cacheLimit; // Most idle memory kept in the free lists, in bytes
+    std::unordered_map<size_t, std::vector<unsigned char *>> freeLists; // Idle blocks by size class
+    BufferPoolStats stats; // Counters returned by getStats
+    mutable std::mutex mutex; // Guards the free lists and the counters
+
+    BufferPool(const BufferPool &) = delete;
+
+    BufferPool &operator=(const BufferPool &) = delete;
+
+    /**
+     * Returns a block to the free list of its size class, or frees it if the cache is full.
+     *
+     * @param block: The start of the block, including its header.
+     * @param capacity: The size class of the block.
+     */
+    void recycle(unsigned char *block, size_t capacity);
+
+    /**
+     * Frees idle blocks until at most target bytes remain cached.
+     *
+     * @param target: The most idle memory, in bytes, left in the free lists.
+     */
+    void evict(size_t target);
+
+    /**
+     * Deleter of pooled buffers, which finds the owning pool in the header in front of the data.
+     */
+    static void release(void *data);
+
+public:
+    static constexpr size_t defaultCacheLimit = size_t(1) << 30; // 1 GB of idle memory
+    static constexpr size_t minSizeClass = 4096; // Smallest block handed out
+
+    /**
+     * Constructor for the BufferPool class.
+     *
+     * @param cacheLimit: The most idle memory, in bytes, kept for reuse.
+     */
+    explicit BufferPool(size_t cacheLimit = defaultCacheLimit);
+
+    /**
+     * Destructor for the BufferPool class.
+     *
+     * Frees the idle blocks. Buffers acquired from the pool must be released before the pool is destroyed.
+     */
+    ~BufferPool();
+
+    /**
+     * Returns the pool shared by all filters.
+     *
+     * The shared pool is never destroyed, so pooled buffers may safely outlive static objects at program exit.
+     *
+     * @return: The shared pool.
+     */
+    static BufferPool &global();
+
+    /**
+     * Rounds a size up to its size class.
+     *
+     * @param size: The requested size in bytes.
+     * @return: The capacity of the blocks that serve the request.
+     * @throws std::bad_alloc if the size class does not fit in size_t.
+     */
+    static size_t sizeClass(size_t size);
+
+    /**
+     * Hands out a buffer of at least size bytes.
+     *
+     * Reuses an idle block of the matching size class if there is one and allocates a new block otherwise. The buffer
+     * reports the requested size, is 64-byte aligned and holds whatever its previous user left in it. It returns to this
+     * pool when it is destroyed or reset.
+     *
+     * @param size: The requested size in bytes.
+     * @return: The buffer, or an empty buffer if size is 0.
+     * @throws std::bad_alloc if a new block cannot be allocated or size has no size class.
+     */
+    Buffer acquire(size_t size);
+
+    /**
+     * Frees every idle block.
+     */
+    void trim();
+
+    /**
+     * Changes the most idle memory kept for reuse and frees idle blocks beyond the new limit.
+     *
+     * @param limit: The new limit in bytes; 0 disables caching.
+     */
+    void setCacheLimit(size_t limit);
+
+    /**
+     * Returns a snapshot of the counters.
+     */
+    BufferPoolStats getStats() const;
+
+    /**
+     * Resets the request and hit counters and sets the peak to the memory currently in use.
+     */
+    void resetStats();
+};
+
+#endif //ADVANCED_PROGRAMMING_GROUP_RADIX_SORT_BUFFERPOOL_H
@@ -0,0 +1,237 @@
+/**
+ * @file ChunkedVolumeFile.h
+ *
+ * @brief Declares a compressed, chunked volume file format with random access to bricks and slice ranges.
+ *
+ * Directories of PNG slices are slow to write and read, and a single slice or sub-box can only be read by decoding
+ * whole slices. The ChunkedVolumeFile class stores a volume in one file, split into cubic chunks of chunkSize voxels
+ * per edge (clipped at the volume border). Each chunk is compressed on its own, and a chunk index after the header
+ * records where every chunk starts. Saving compresses all chunks in parallel. Reading a region, e.g. a single slice or
+ * a box around a lesion, decompresses only the chunks that overlap it, also in parallel.
+ *
+ * Chunks are compressed with ChunkCodec, a built-in byte-oriented LZ77 codec in the style of the LZ4 block format, so
+ * no external library is needed. Samples wider than a byte are byte-shuffled first (all low bytes of the chunk, then
+ * all high bytes), which turns the slowly varying high bytes of 16-bit and float data into long runs. A chunk that does
+ * not shrink is stored raw.
+ *
+ * Layout, all integers little-endian:
+ *   header: "MDIPCVF1", uint32 width, height, depth, chunkSize, uint8 dataType, uint8 codec, uint16 reserved
+ *   index:  per chunk, x fastest then y then z: uint64 offset from the start of the file, uint32 stored size,
+ *           uint32 flags (1 = raw)
+ *   data:   the stored chunks, each holding its voxels x fastest, then y, then z
+ *
+ * @date Created on October 19, 2026
+ *
+ * @authors
+ * Advanced Programming Group Radix Sort:
+ *   - Benjamin Duncan (edsml-bd1023)
+ *   - Boyang Hu (edsml-bh223)
+ *   - Chawk Chamoun (edsml-cc8915)
+ *   - Mingsheng Cai (acse-sc4623)
+ *   - Moyu Zhang (acse-mz223)
+ *   - Ryan Benney (acse-rgb123)
+ */
+
+#pragma once
+
+#ifndef ADVANCED_PROGRAMMING_GROUP_RADIX_SORT_CHUNKEDVOLUMEFILE_H
+#define ADVANCED_PROGRAMMING_GROUP_RADIX_SORT_CHUNKEDVOLUMEFILE_H
+
+#include "DataType.h"
+#include "Region.h"
+#include "Volume.h"
+
+#include <cstdint>
+#include <fstream>
+#include <mutex>
+#include <string>
+#include <vector>
+
+class ChunkCodec {
+public:
+    /**
+     * Compresses a block of bytes.
+     *
+     * The output is a sequence of literal runs and back-references of at least 4 bytes from at most 65535 bytes back,
+     * encoded as in the LZ4 block format.
+     *
+     * @param source: The bytes to compress.
+     * @param size: The number of bytes.
+     * @param out: Replaced by the compressed bytes.
+     */
+    static void compress(const unsigned char *source, size_t size, std::vector<unsigned char> &out);
+
+    /**
+     * Decompresses a block produced by compress.
+     *
+     * Every length and offset is checked, so corrupt input is reported instead of reading or writing out of bounds.
+     *
+     * @param source: The compressed bytes.
+     * @param size: The number of compressed bytes.
+     * @param out: The destination, which must hold exactly outSize bytes.
+     * @param outSize: The size of the decompressed block.
+     * @return: True if the block decoded to exactly outSize bytes.
+     */
+    static bool decompress(const unsigned char *source, size_t size, unsigned char *out, size_t outSize);
+
+    /**
+     * Groups the bytes of multi-byte samples: all first bytes, then all second bytes, and so on.
+     *
+     * @param source: The samples.
+     * @param count: The number of samples.
+     * @param sampleSize: The number of bytes per sample.
+     * @param out: The destination, count * sampleSize bytes.
+     */
+    static void shuffle(const unsigned char *source, size_t count, size_t sampleSize, unsigned char *out);
+
+    /**
+     * Reverses shuffle.
+     *
+     * @param source: The shuffled bytes.
+     * @param count: The number of samples.
+     * @param sampleSize: The number of bytes per sample.
+     * @param out: The destination, count * sampleSize bytes.
+     */
+    static void unshuffle(const unsigned char *source, size_t count, size_t sampleSize, unsigned char *out);
+
+private:
+    /**
+     * Default constructor for the ChunkCodec class.
+     *
+     * The constructor is deleted because the class only provides static helpers.
+     */
+    ChunkCodec() = delete;
+
+    /**
+     * Destructor for the ChunkCodec class.
+     *
+     * The destructor is deleted because the class only provides static helpers.
+     */
+    ~ChunkCodec() = delete;
+};
+
+class ChunkedVolumeFile {
+private:
+    // Location of one stored chunk in the file
+    struct ChunkEntry {
+        uint64_t offset; // Start of the chunk from the start of the file
+        uint32_t size; // Number of stored bytes
+        uint32_t flags; // rawChunk if the chunk is stored uncompressed
+    };
+
+    int width, height, depth; // Size of the volume
+    int chunkSize; // Edge length of the chunks
+    DataType dataType; // Type of the samples
+    std::vector<ChunkEntry> index; // Chunks, x fastest then y then z
+    mutable std::ifstream file; // The open file
+    mutable std::mutex fileMutex; // Serialises seeks and reads of file
+
+    /**
+     * Reads and decompresses one chunk.
+     *
+     * @param chunk: The position of the chunk in the index.
+     * @param out: The destination, holding the voxels of the chunk x fastest.
+     * @return: True if the chunk was read and decoded.
+     */
+    bool decodeChunk(size_t chunk, std::vector<unsigned char> &out) const;
+
+public:
+    static constexpr int defaultChunkSize = 64; // Voxels per chunk edge
+    static constexpr int maxChunkSize = 512; // Longest chunk edge, so that a raw float chunk fits a 32-bit size
+    static constexpr uint32_t rawChunk = 1; // Flag of chunks stored uncompressed
+
+    /**
+     * Default constructor for the ChunkedVolumeFile class, creating a closed file.
+     */
+    ChunkedVolumeFile();
+
+    /**
+     * Saves a volume as a chunked file.
+     *
+     * All chunks are compressed in parallel before the file is written.
+     *
+     * @param volume: The volume to save, with 8-bit, 16-bit or float samples.
+     * @param path: The path of the file to write.
+     * @param chunkSize: The edge length of the chunks, from 1 to maxChunkSize.
+     * @return: A boolean value indicating the success (true) or failure (false) of saving the volume.
+     */
+    static bool save(const Volume &volume, const std::string &path, int chunkSize = defaultChunkSize);
+
+    /**
+     * Opens a chunked file and reads its header and chunk index.
+     *
+     * No chunk is decoded. If the file cannot be read or is not a valid chunked volume file, an error message is
+     * printed to standard error and the file is left closed.
+     *
+     * @param path: The path of the file.
+     * @return: A boolean value indicating the success (true) or failure (false) of opening the file.
+     */
+    bool open(const std::string &path);
+
+    /**
+     * Checks whether a file is open.
+     */
+    bool isOpen() const;
+
+    /**
+     * @brief Get the width of the volume.
+     */
+    int getWidth() const;
+
+    /**
+     * @brief Get the height of the volume.
+     */
+    int getHeight() const;
+
+    /**
+     * @brief Get the depth of the volume.
+     */
+    int getDepth() const;
+
+    /**
+     * @brief Get the edge length of the chunks.
+     */
+    int getChunkSize() const;
+
+    /**
+     * @brief Get the type of the samples.
+     */
+    DataType getDataType() const;
+
+    /**
+     * @brief Get the total number of bytes the chunks occupy in the file.
+     */
+    size_t getStoredSize() const;
+
+    /**
+     * Reads a box of the volume.
+     *
+     * Only the chunks that overlap the box are decoded, in parallel.
+     *
+     * @param region: The box to read, which must lie inside the volume.
+     * @param out: The destination, holding the box x fastest, then y, then z, i.e. width * height * depth samples of
+     * the region.
+     * @return: A boolean value indicating the success (true) or failure (false) of reading the box.
+     */
+    bool readRegion(const Region3D &region, unsigned char *out) const;
+
+    /**
+     * Reads a range of x-y slices.
+     *
+     * @param begin: The zero-based index of the first slice.
+     * @param end: The zero-based index of the last slice.
+     * @param out: The destination, (end - begin + 1) slices of width * height samples.
+     * @return: A boolean value indicating the success (true) or failure (false) of reading the slices.
+     */
+    bool readSlices(int begin, int end, unsigned char *out) const;
+
+    /**
+     * Reads the whole volume.
+     *
+     * @param volume: Replaced by a volume that owns the decoded samples.
+     * @return: A boolean value indicating the success (true) or failure (false) of reading the volume.
+     */
+    bool load(Volume &volume) const;
+};
+
+#endif //ADVANCED_PROGRAMMING_GROUP_RADIX_SORT_CHUNKEDVOLUMEFILE_H
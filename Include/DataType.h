@@ -0,0 +1,126 @@
+/**
+ * @file DataType.h
+ *
+ * @brief Describes the sample types that Image and Volume can store.
+ *
+ * Images and volumes store their samples either as 8-bit unsigned integers, 16-bit unsigned integers or 32-bit floats.
+ * The DataType enumeration identifies the type of a buffer at runtime, while the DataTypeTraits template provides the
+ * compile-time properties that the templated filters and projections need for each type: how a filtered value is
+ * rounded and clamped back into the type, and how a sample is mapped to the 8-bit range when it is written to an image
+ * file. 16-bit samples keep their full 0 to 65535 range, while float samples use the same 0 to 255 intensity scale as
+ * 8-bit samples with fractional precision, so that 16-bit input converted to float is stored as value / 257.
+ *
+ * @date Created on October 19, 2026
+ *
+ * @authors
+ * Advanced Programming Group Radix Sort:
+ *   - Benjamin Duncan (edsml-bd1023)
+ *   - Boyang Hu (edsml-bh223)
+ *   - Chawk Chamoun (edsml-cc8915)
+ *   - Mingsheng Cai (acse-sc4623)
+ *   - Moyu Zhang (acse-mz223)
+ *   - Ryan Benney (acse-rgb123)
+ */
+
+#pragma once
+
+#ifndef ADVANCED_PROGRAMMING_GROUP_RADIX_SORT_DATATYPE_H
+#define ADVANCED_PROGRAMMING_GROUP_RADIX_SORT_DATATYPE_H
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <initializer_list>
+
+// Sample types supported by Image and Volume
+enum class DataType {
+    UInt8,  // unsigned char, 0 to 255
+    UInt16, // unsigned short, 0 to 65535
+    Float32 // float, 0 to 255 intensity scale
+};
+
+/**
+ * Returns the size of a single sample of the given type.
+ *
+ * @param type: The sample type.
+ *
+ * @return: The number of bytes used by one sample.
+ */
+inline std::size_t bytesPerSample(DataType type) {
+    switch (type) {
+        case DataType::UInt16:
+            return sizeof(unsigned short);
+        case DataType::Float32:
+            return sizeof(float);
+        default:
+            return sizeof(unsigned char);
+    }
+}
+
+/**
+ * Computes the size in bytes of a block of samples, such as a volume or an image, detecting overflow.
+ *
+ * @param extents: The extents of the block, e.g. width, height and depth.
+ * @param type: The sample type.
+ * @param bytes: Receives the size in bytes.
+ *
+ * @return: False if an extent is negative or the size does not fit in size_t, in which case bytes is undefined.
+ */
+inline bool checkedSampleBytes(std::initializer_list<long long> extents, DataType type, std::size_t &bytes) {
+    bytes = bytesPerSample(type);
+    for (long long extent: extents) {
+        if (extent < 0 || __builtin_mul_overflow(bytes, static_cast<unsigned long long>(extent), &bytes)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+// Compile-time properties of each sample type
+template<typename T>
+struct DataTypeTraits;
+
+template<>
+struct DataTypeTraits<unsigned char> {
+    static constexpr DataType type = DataType::UInt8;
+
+    // Rounds a filtered value and clamps it to the [0, 255] range
+    static unsigned char fromDouble(double value) {
+        return static_cast<unsigned char>(std::max(0.0, std::min(255.0, std::round(value))));
+    }
+
+    static unsigned char toUInt8(unsigned char value) {
+        return value;
+    }
+};
+
+template<>
+struct DataTypeTraits<unsigned short> {
+    static constexpr DataType type = DataType::UInt16;
+
+    // Rounds a filtered value and clamps it to the [0, 65535] range
+    static unsigned short fromDouble(double value) {
+        return static_cast<unsigned short>(std::max(0.0, std::min(65535.0, std::round(value))));
+    }
+
+    // Maps 65535 to 255, the inverse of the 257 scaling stb_image uses to widen 8-bit data
+    static unsigned char toUInt8(unsigned short value) {
+        return static_cast<unsigned char>((value + 128) / 257);
+    }
+};
+
+template<>
+struct DataTypeTraits<float> {
+    static constexpr DataType type = DataType::Float32;
+
+    // Float samples keep their full precision and range
+    static float fromDouble(double value) {
+        return static_cast<float>(value);
+    }
+
+    static unsigned char toUInt8(float value) {
+        return static_cast<unsigned char>(std::max(0.0f, std::min(255.0f, std::round(value))));
+    }
+};
+
+#endif //ADVANCED_PROGRAMMING_GROUP_RADIX_SORT_DATATYPE_H
@@ -0,0 +1,92 @@
+/**
+ * @file Deflate.h
+ *
+ * @brief Declares the DeflateStream class, an incremental zlib encoder for streamed PNG output.
+ *
+ * PNG image data is a single zlib stream over all rows, so an encoder that writes rows as they are produced must
+ * compress incrementally. A DeflateStream accepts input in pieces of any size and appends compressed bytes as soon as
+ * they are known, keeping only the 32 KB window that back-references may reach and a short look-ahead.
+ *
+ * Matches are found through hash chains over the window and coded with the fixed Huffman codes of DEFLATE, the same
+ * scheme as stb_image_write, so streamed PNG files are about the size of those written by Image::saveToFile.
+ *
+ * @date Created on October 19, 2026
+ *
+ * @authors
+ * Advanced Programming Group Radix Sort:
+ *   - Benjamin Duncan (edsml-bd1023)
+ *   - Boyang Hu (edsml-bh223)
+ *   - Chawk Chamoun (edsml-cc8915)
+ *   - Mingsheng Cai (acse-sc4623)
+ *   - Moyu Zhang (acse-mz223)
+ *   - Ryan Benney (acse-rgb123)
+ */
+
+#pragma once
+
+#ifndef ADVANCED_PROGRAMMING_GROUP_RADIX_SORT_DEFLATE_H
+#define ADVANCED_PROGRAMMING_GROUP_RADIX_SORT_DEFLATE_H
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+class DeflateStream {
+private:
+    std::vector<unsigned char> window; // Recent input: history, then bytes not yet encoded
+    size_t windowStart; // Stream position of window[0]
+    size_t encoded; // Stream position of the first byte not yet encoded
+    std::vector<size_t> head; // Last stream position + 1 of each 3-byte hash, 0 if none
+    std::vector<size_t> previous; // Earlier position + 1 with the same hash, by position modulo the window size
+    uint64_t bits; // Output bits not yet appended, least significant first
+    int bitCount; // Number of bits in bits
+    uint32_t adlerA, adlerB; // Running Adler-32 checksum of the input
+    bool started; // True once the zlib header and block header are written
+
+    /**
+     * Appends bits to the output, least significant first.
+     */
+    void putBits(uint32_t value, int count, std::vector<unsigned char> &out);
+
+    /**
+     * Appends a literal/length symbol in its fixed Huffman code.
+     */
+    void putSymbol(int symbol, std::vector<unsigned char> &out);
+
+    /**
+     * Encodes the window up to a stream position.
+     *
+     * @param end: The stream position to stop before; matches never reach past the end of the window.
+     * @param out: The output.
+     */
+    void encodeUpTo(size_t end, std::vector<unsigned char> &out);
+
+public:
+    static constexpr size_t historySize = 32768; // Farthest back-reference of DEFLATE
+    static constexpr size_t maxMatch = 258; // Longest back-reference of DEFLATE
+
+    /**
+     * Default constructor for the DeflateStream class, creating an empty stream.
+     */
+    DeflateStream();
+
+    /**
+     * Compresses the next piece of input.
+     *
+     * The last maxMatch bytes are held back until more input or finish shows how far a match may run.
+     *
+     * @param data: The bytes to compress.
+     * @param size: The number of bytes.
+     * @param out: The compressed bytes known so far are appended here, starting with the zlib header.
+     */
+    void write(const unsigned char *data, size_t size, std::vector<unsigned char> &out);
+
+    /**
+     * Compresses the held-back input and ends the stream with the final block and the Adler-32 checksum.
+     *
+     * @param out: The remaining compressed bytes are appended here.
+     */
+    void finish(std::vector<unsigned char> &out);
+};
+
+#endif //ADVANCED_PROGRAMMING_GROUP_RADIX_SORT_DEFLATE_H
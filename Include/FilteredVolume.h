@@ -0,0 +1,215 @@
+/**
+ * @file FilteredVolume.h
+ *
+ * @brief Declares the FilteredVolume class, a lazy view of a volume through a chain of 3D filters.
+ *
+ * Saving one slice of a filtered volume used to mean filtering the whole volume first, although a slice only depends
+ * on the voxels within the filters' reach of it. A FilteredVolume wraps a volume and a chain of 3D filters without
+ * running them; when a slice, slab or projection is requested, only the requested box and the voxels within the summed
+ * reach of the filters around it are copied out of the source and filtered, through the filters' region overloads, so
+ * the result is identical to filtering the whole volume. Saving x-y slice 200 of a 256-slice volume after a Gaussian
+ * with a 5-voxel kernel filters 5 slices instead of 256.
+ *
+ * Filtered x-y slices are kept in a least-recently-used cache, so stepping through neighbouring slices filters each
+ * slice once. x-z and y-z slices span every x-y slice and are computed on demand without being cached.
+ *
+ * Maximum, minimum and average projections of the filtered volume are fused with the filtering: the range is cut into
+ * slabs, each thread filters its slabs one at a time and folds them into its own partial projection, and the partial
+ * projections are merged at the end. The filtered volume is never stored, so memory stays at the source plus a few
+ * slabs per thread, and each slab is folded while it is still in the processor cache instead of being written to and
+ * read back from a full-size volume.
+ *
+ * @date Created on October 19, 2026
+ *
+ * @authors
+ * Advanced Programming Group Radix Sort:
+ *   - Benjamin Duncan (edsml-bd1023)
+ *   - Boyang Hu (edsml-bh223)
+ *   - Chawk Chamoun (edsml-cc8915)
+ *   - Mingsheng Cai (acse-sc4623)
+ *   - Moyu Zhang (acse-mz223)
+ *   - Ryan Benney (acse-rgb123)
+ */
+
+#pragma once
+
+#ifndef ADVANCED_PROGRAMMING_GROUP_RADIX_SORT_FILTEREDVOLUME_H
+#define ADVANCED_PROGRAMMING_GROUP_RADIX_SORT_FILTEREDVOLUME_H
+
+#include "Buffer.h"
+#include "Region.h"
+#include "Volume.h"
+#include "Filters/Filter.h"
+
+#include <cstddef>
+#include <list>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+class FilteredVolume {
+private:
+    const Volume &source; // The unfiltered volume, which must outlive the view and not change while it is used
+    std::vector<IFilter3D *> filters; // The filters, applied in order; owned by the caller
+    int reach; // Sum of the reaches of the filters
+    size_t cacheSlices; // Most filtered x-y slices kept
+    std::list<int> recent; // Indices of the cached slices, most recently used first
+    std::unordered_map<int, std::pair<Buffer, std::list<int>::iterator>> cache; // Filtered x-y slices by index
+    size_t computedSlices; // Number of x-y slices filtered so far
+
+    /**
+     * Filters a box of the volume.
+     *
+     * The box and the voxels within reach of it are copied from the source, each filter is applied to the part that
+     * later filters read, and the box is copied to out.
+     *
+     * @param box: The box to filter, which must lie inside the volume.
+     * @param out: The destination, the samples of the box with x varying fastest, then y, then z.
+     */
+    void compute(const Region3D &box, unsigned char *out) const;
+
+    /**
+     * Adds a filtered x-y slice to the cache, dropping the least recently used slices beyond the capacity.
+     */
+    void remember(int z, const unsigned char *samples);
+
+    /**
+     * Computes a maximum, minimum or average projection of filtered x-y slices, one slab at a time.
+     *
+     * @param projector: The projection to compute ('MIP', 'MinIP' or 'AIP').
+     * @param begin: The zero-based index of the first slice.
+     * @param end: The zero-based index one past the last slice.
+     * @param slabDepth: The number of slices filtered together.
+     * @return: The projection in the source's sample type.
+     */
+    template<typename T>
+    std::vector<T> projectSlabs(const std::string &projector, int begin, int end, int slabDepth) const;
+
+public:
+    static constexpr size_t defaultCacheSlices = 64; // Filtered x-y slices kept by default
+    static constexpr int defaultSlabDepth = 32; // x-y slices filtered together by a fused projection
+
+    /**
+     * Constructor for the FilteredVolume class, creating a view of a volume with no filters.
+     *
+     * @param source: The volume to filter. It is not copied and must outlive the view.
+     * @param cacheSlices: The number of filtered x-y slices to keep.
+     */
+    explicit FilteredVolume(const Volume &source, size_t cacheSlices = defaultCacheSlices);
+
+    /**
+     * Appends a filter to the chain and empties the cache.
+     *
+     * @param filter: The filter. It is not copied and must outlive the view.
+     * @return: A reference to this view, so that filters can be chained.
+     */
+    FilteredVolume &addFilter(IFilter3D &filter);
+
+    /**
+     * @brief Get the width of the volume.
+     */
+    int getWidth() const;
+
+    /**
+     * @brief Get the height of the volume.
+     */
+    int getHeight() const;
+
+    /**
+     * @brief Get the depth of the volume.
+     */
+    int getDepth() const;
+
+    /**
+     * @brief Get the sample type of the volume.
+     */
+    DataType getDataType() const;
+
+    /**
+     * @brief Get the number of x-y slices filtered so far, counting each computation of a slice missing from the cache.
+     */
+    size_t getComputedSlices() const;
+
+    /**
+     * Filters a range of x-y slices.
+     *
+     * Cached slices are copied; the missing ones are filtered in contiguous runs and added to the cache.
+     *
+     * @param begin: The zero-based index of the first slice.
+     * @param end: The zero-based index one past the last slice.
+     * @param out: Receives the filtered slices as a volume of end - begin slices of the source's sample type.
+     * @return: A boolean value indicating the success (true) or failure (false) of filtering the slices. On failure an
+     * error message is printed and out is left unchanged.
+     */
+    bool getSlab(int begin, int end, Volume &out);
+
+    /**
+     * Filters one slice and converts it to 8-bit samples.
+     *
+     * @param plane: The plane of the slice ('x-y', 'x-z', 'y-z').
+     * @param sliceIndex: The index of the slice, starting from 1.
+     * @return: The 8-bit slice laid out as by Slice::getPlaneSlice, or an empty vector if the plane or index is
+     * invalid.
+     */
+    std::vector<unsigned char> getSliceUInt8(const std::string &plane, int sliceIndex);
+
+    /**
+     * Projects a range of filtered x-y slices and converts the projection to 8-bit samples.
+     *
+     * MIP, MinIP and AIP are fused with the filtering and never store the filtered slices or use the cache; the result
+     * is identical to projecting the fully filtered volume. MedIP needs every sample of a column at once, so the range
+     * is filtered with getSlab first.
+     *
+     * @param projector: The projection to compute ('MIP', 'MinIP', 'AIP' or 'MedIP').
+     * @param begin: The zero-based index of the first slice.
+     * @param end: The zero-based index one past the last slice.
+     * @param slabDepth: The number of slices filtered together by a fused projection. Each slab is filtered with the
+     * reach of the filters around it, so thicker slabs filter fewer slices twice but use more memory.
+     * @return: The 8-bit projection, or an empty vector if the projector or range is invalid, in which case an error
+     * message is printed.
+     */
+    std::vector<unsigned char> getProjectionUInt8(const std::string &projector, int begin, int end,
+                                                  int slabDepth = defaultSlabDepth);
+
+    /**
+     * Saves one filtered slice to a file.
+     *
+     * Equivalent to filtering the whole volume and calling Volume::save(path, plane, sliceIndex), writing the same
+     * "slice_<index>.png" file, but only the slices within reach of the requested one are filtered.
+     *
+     * @param path: The directory to save the slice in, which is created if needed.
+     * @param plane: The plane of the slice ('x-y', 'x-z', 'y-z').
+     * @param sliceIndex: The index of the slice, starting from 1.
+     */
+    void save(const std::string &path, const std::string &plane, int sliceIndex);
+
+    /**
+     * Saves a projection of the filtered volume to a file.
+     *
+     * Equivalent to filtering the whole volume and calling Volume::save(path, plane, projector), writing the same
+     * "<projector>.png" file, but MIP, MinIP and AIP are computed without storing the filtered volume.
+     *
+     * @param path: The directory to save the projection in, which is created if needed.
+     * @param plane: The plane of the projection, which must be 'x-y'.
+     * @param projector: The projection to compute ('MIP', 'MinIP', 'AIP' or 'MedIP').
+     */
+    void save(const std::string &path, const std::string &plane, const std::string &projector);
+
+    /**
+     * Saves a projection of a range of filtered x-y slices to a file.
+     *
+     * Equivalent to filtering the whole volume and calling Volume::save(path, plane, projector, begin, end), writing
+     * the same "<projector>_range_<begin>_<end>.png" file, but only the range and the slices within reach of it are
+     * filtered, as by getProjectionUInt8.
+     *
+     * @param path: The directory to save the projection in, which is created if needed.
+     * @param plane: The plane of the projection, which must be 'x-y'.
+     * @param projector: The projection to compute ('MIP', 'MinIP', 'AIP' or 'MedIP').
+     * @param begin: The index of the first slice of the range, starting from 1.
+     * @param end: The index of the last slice of the range, inclusive.
+     */
+    void save(const std::string &path, const std::string &plane, const std::string &projector, int begin, int end);
+};
+
+#endif //ADVANCED_PROGRAMMING_GROUP_RADIX_SORT_FILTEREDVOLUME_H
@@ -29,7 +29,9 @@
 
 #include "Image.h"
 #include "Padding.h"
+#include "Region.h"
 
+#include <string>
 #include <vector>
 
 class Box2DFilter {
@@ -68,6 +70,22 @@ public:
      * with the filtered results.
      */
     void apply(Image &image) const;
+
+    /**
+     * Applies the filter to a rectangle of an image.
+     *
+     * Only the rectangle and the kernelSize / 2 pixels around it are read, and only the rectangle is written. Inside the rectangle
+     * the result equals that of apply(Image &), including the padding where the rectangle meets the image border.
+     *
+     * @param image: A reference to the Image object to be processed.
+     * @param region: The rectangle to filter, which must lie inside the image.
+     */
+    void apply(Image &image, const Region2D &region) const;
+
+    /**
+     * Describes the filter, e.g. "Box2DFilter(kernelSize=5,padding=1)", with the padding as its enumerator index.
+     */
+    std::string describe() const;
 };
 
 #endif //ADVANCED_PROGRAMMING_GROUP_RADIX_SORT_BOX2DFILTER_H
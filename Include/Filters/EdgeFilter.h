@@ -28,7 +28,9 @@
 
 #include "Image.h"
 #include "Padding.h"
+#include "Region.h"
 
+#include <string>
 #include <vector>
 
 enum class FilterType {
@@ -130,6 +132,22 @@ public:
      * initialized and loaded with image data prior to calling this method.
      */
     void apply(Image &image);
+
+    /**
+     * Applies the filter to a rectangle of an image.
+     *
+     * Only the rectangle and the 2 pixels the kernels reach around it are read, and only the rectangle is written. Inside the rectangle
+     * the result equals that of apply(Image &), including the padding where the rectangle meets the image border.
+     *
+     * @param image: A reference to the Image object to be processed.
+     * @param region: The rectangle to filter, which must lie inside the image.
+     */
+    void apply(Image &image, const Region2D &region);
+
+    /**
+     * Describes the filter, e.g. "EdgeFilter(type=0,padding=1)", with the operator and padding as enumerator indices.
+     */
+    std::string describe() const;
 };
 
 #endif // ADVANCED_PROGRAMMING_GROUP_RADIX_SORT_EDGEFILTER_H
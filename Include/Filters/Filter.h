@@ -29,6 +29,9 @@
 
 #include "Image.h"
 #include "Volume.h"
+#include "Region.h"
+
+#include <string>
 
 // Interface for 3D filters
 class IFilter3D {
@@ -49,6 +52,33 @@ public:
      * @param volume: The volume to which the filter will be applied.
      */
     virtual void apply(Volume &volume) = 0;
+
+    /**
+     * Applies a filter to a box of a 3D volume.
+     *
+     * Only the box plus the reach of the filter is read and only the box is written. Inside the box the result equals
+     * that of filtering the whole volume.
+     *
+     * @param volume: The volume to which the filter will be applied.
+     * @param region: The box to filter.
+     */
+    virtual void apply(Volume &volume, const Region3D &region) = 0;
+
+    /**
+     * Gets the reach of the filter.
+     *
+     * @return: The farthest distance, in voxels, from which the filter reads neighbours along any axis.
+     */
+    virtual int getReach() const = 0;
+
+    /**
+     * Describes the filter and its parameters.
+     *
+     * @return: A string naming the filter and every parameter that affects its output, so that two filters with the
+     * same description give the same result. Used to key cached results. A filter whose output is not reproducible,
+     * such as random noise, returns an empty string, and neither its result nor any later one is cached.
+     */
+    virtual std::string describe() const = 0;
 };
 
 // Interface for 2D filters
@@ -70,6 +100,21 @@ public:
      * @param image: The image to which the filter will be applied.
      */
     virtual void apply(Image &image) = 0;
+
+    /**
+     * Applies a filter to a rectangle of a 2D image.
+     *
+     * Only the rectangle plus the reach of the filter is read and only the rectangle is written.
+     *
+     * @param image: The image to which the filter will be applied.
+     * @param region: The rectangle to filter.
+     */
+    virtual void apply(Image &image, const Region2D &region) = 0;
+
+    /**
+     * Describes the filter and its parameters, as IFilter3D::describe does.
+     */
+    virtual std::string describe() const = 0;
 };
 
 #endif //ADVANCED_PROGRAMMING_GROUP_RADIX_SORT_FILTER_H
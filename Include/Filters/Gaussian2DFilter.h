@@ -30,7 +30,11 @@
 
 #include "Image.h"
 #include "Padding.h"
+#include "Region.h"
+#include "GaussianKernel.h"
 
+#include <optional>
+#include <string>
 #include <vector>
 
 class Gaussian2DFilter {
@@ -39,6 +43,10 @@ private:
     double sigma; // standard deviation
     int kernelSize; // size of the kernel
     PaddingType paddingType; // padding type
+    GaussianMode mode; // floating-point, fixed-point or recursive evaluation of the kernel
+    std::vector<unsigned short> fixedKernel; // kernel quantised for the fixed-point mode, row by row
+    int fixedShift; // number of fractional bits of fixedKernel
+    std::optional<RecursiveGaussian> recursive; // recursion coefficients, set in recursive mode only
 
     /**
      * Generates the Gaussian kernel based on the specified sigma and kernel size.
@@ -46,7 +54,8 @@ private:
      * This method constructs the Gaussian kernel used for blurring the image. It calculates the value of each element in the
      * kernel matrix based on the Gaussian function, ensuring the kernel is normalized so that its sum equals 1. This normalization
      * is crucial for maintaining the original image's brightness level after the application of the blur. The kernel is stored
-     * internally within the Gaussian2DFilter object and used in the `apply` method to blur images.
+     * internally within the Gaussian2DFilter object and used in the `apply` method to blur images. The quantised copy used by
+     * the fixed-point mode is generated at the same time.
      */
     void generateKernel();
 
@@ -63,9 +72,14 @@ public:
      * @param kernelSize: The size of the kernel for the Gaussian blur, which must be an odd number.
      * @param sigma: The standard deviation of the Gaussian distribution, determining the blur's spread.
      * @param paddingType: The type of padding to use when processing edges of the image.
-     * @throws std::invalid_argument if kernelSize is not an odd number.
+     * @param mode: Whether the weighted sums are accumulated in floating point or with 16-bit integer weights and 32-bit
+     * integer sums. The fixed-point mode stays within one grey level of the floating-point result. The recursive mode
+     * ignores the kernel size and filters rows and then columns with the Young-van Vliet recursion, whose cost does not
+     * depend on sigma; it is meant for large sigma.
+     * @throws std::invalid_argument if kernelSize is not an odd number, or if sigma is below 0.5 in recursive mode.
      */
-    Gaussian2DFilter(int kernelSize, double sigma = 1.0, PaddingType paddingType = PaddingType::ZeroPadding);
+    Gaussian2DFilter(int kernelSize, double sigma = 1.0, PaddingType paddingType = PaddingType::ZeroPadding,
+                     GaussianMode mode = GaussianMode::FloatingPoint);
 
     /**
      * Returns the Gaussian kernel used for blurring images.
@@ -85,12 +99,32 @@ public:
      * It applies the blur separately to each channel of the image, accommodating images with multiple color channels. The
      * method handles edge pixels according to the specified padding type, ensuring the blur extends to the edges of the image
      * without artifacts. The blurred image replaces the original image data, resulting in a smoothly blurred version of the
-     * original image.
+     * original image. In recursive mode zero padding continues the rows and columns with zeros, while edge replication
+     * and reflection both continue them with their edge pixels, and the rows and columns are split across threads.
      *
      * @param image: A reference to an Image object representing the image to be blurred. The Image object must be initialized
      * and loaded with data prior to calling this method.
      */
     void apply(Image &image) const;
+
+    /**
+     * Applies the filter to a rectangle of an image.
+     *
+     * Only the rectangle and the kernelSize / 2 pixels around it are read, and only the rectangle is written. Inside the
+     * rectangle the result equals that of apply(Image &), including the padding where the rectangle meets the image
+     * border. The recursive mode has no finite reach; it reads 4 sigma around the rectangle, which makes the result
+     * inside the rectangle differ from a full run by well under a grey level.
+     *
+     * @param image: A reference to the Image object to be processed.
+     * @param region: The rectangle to filter, which must lie inside the image.
+     */
+    void apply(Image &image, const Region2D &region) const;
+
+    /**
+     * Describes the filter, e.g. "Gaussian2DFilter(sigma=1,kernelSize=5,padding=1,mode=1)", with the padding and mode
+     * as enumerator indices.
+     */
+    std::string describe() const;
 };
 
 #endif //ADVANCED_PROGRAMMING_GROUP_RADIX_SORT_GAUSSIAN2DFILTER_H
@@ -26,14 +26,27 @@
 #define ADVANCED_PROGRAMMING_GROUP_RADIX_SORT_GAUSSIAN3DFILTER_H
 
 #include "Filters/Filter.h"
+#include "Filters/GaussianKernel.h"
 #include "Volume.h"
+#include "BrickedVolume.h"
+#include "VolumeStream.h"
 
+#include <optional>
+#include <string>
 #include <vector>
 
 class Gaussian3DFilter : public IFilter3D {
 private:
     double sigma; // Standard deviation of the Gaussian
     int kernelSize; // Size of the kernel
+    GaussianMode mode; // Floating-point, fixed-point or recursive evaluation of the kernel
+    std::vector<double> kernel; // Normalised 1D kernel
+    std::vector<unsigned short> fixedKernel; // 1D kernel quantised for the fixed-point mode
+    int fixedShift; // Number of fractional bits of fixedKernel
+    std::optional<RecursiveGaussian> recursive; // Recursion coefficients, set in recursive mode only
+    static constexpr int lineBlock = 4096; // Number of neighbouring lines convolved together along y and z
+    static constexpr int accumulatorBlock = 256; // Number of lines whose sums are kept in registers at once
+    static constexpr int recursiveBlock = 64; // Number of neighbouring lines run through the recursion together
 
     /**
      * Computes a 1D Gaussian kernel.
@@ -47,6 +60,42 @@ private:
      */
     std::vector<double> computeGaussian1DKernel() const;
 
+    /**
+     * Computes one output sample for each of a set of parallel lines.
+     *
+     * taps[k] points to the input samples that kernel weight k is applied to, with neighbouring lines stored next to each
+     * other, so every tap is read contiguously. The weighted sums are accumulated in blocks of accumulatorBlock lines in
+     * the order of the kernel. In fixed-point mode 8-bit samples are multiplied by the 16-bit quantised weights and summed
+     * in 32-bit integers, and the result is rounded by adding half a unit before shifting; otherwise the sums are computed
+     * in double precision and converted with DataTypeTraits<T>::fromDouble. 16-bit and float samples always use the
+     * floating-point path.
+     *
+     * @param taps: One pointer per kernel weight to the first line's input sample for that weight.
+     * @param out: A pointer to the first line's output sample; the other lines follow contiguously.
+     * @param lines: The number of neighbouring lines.
+     */
+    template<typename T>
+    void convolveTaps(const T *const *taps, T *out, int lines) const;
+
+    /**
+     * Convolves a set of parallel lines with the 1D kernel.
+     *
+     * This helper is shared by every axis pass. The samples of each line are sampleStride elements apart, and the lines
+     * themselves are stored next to each other, so line l starts at src + l. Processing many neighbouring lines together
+     * keeps the innermost loop running over contiguous memory, which lets the compiler vectorise it for the y and z passes.
+     * Samples beyond either end of a line are replaced by the nearest edge sample, and each output sample is computed
+     * with convolveTaps. In recursive mode the lines are instead copied, recursiveBlock at a time, into a double-precision
+     * buffer, run through RecursiveGaussian::filterLines and converted back with DataTypeTraits<T>::fromDouble.
+     *
+     * @param src: A pointer to the first sample of the first line.
+     * @param dst: A pointer to the output location of the first sample of the first line, laid out like src.
+     * @param length: The number of samples in each line.
+     * @param sampleStride: The distance, in elements, between consecutive samples of a line.
+     * @param lines: The number of neighbouring lines to convolve.
+     */
+    template<typename T>
+    void convolveLines(const T *src, T *dst, int length, size_t sampleStride, int lines) const;
+
     /**
      * Applies the Gaussian filter along the X-axis of the volume.
      *
@@ -55,12 +104,14 @@ private:
      * neighborhood along the X-axis and updating the voxel's value based on the weighted sum of its neighbors. The process
      * results in a volume that is blurred along the X-axis while retaining its structure along the Y and Z axes.
      *
-     * @param data: A reference to a vector of unsigned char representing the volume data to be filtered.
+     * @param src: A pointer to the samples of the volume to be filtered.
+     * @param dst: A pointer to the output samples, which must not overlap src.
      * @param width: The width of the volume.
      * @param height: The height of the volume.
      * @param depth: The depth of the volume.
      */
-    void applyGaussian1DFilter_X(std::vector<unsigned char> &data, int width, int height, int depth);
+    template<typename T>
+    void applyGaussian1DFilter_X(const T *src, T *dst, int width, int height, int depth);
 
     /**
      * Applies the Gaussian filter along the Y-axis of the volume.
@@ -69,12 +120,14 @@ private:
      * data along the Y-axis, applying the Gaussian kernel to each voxel's neighborhood in this direction. The resulting volume
      * exhibits blurring along the Y-axis, with its characteristics along the X and Z axes preserved.
      *
-     * @param data: A reference to a vector of unsigned char representing the volume data to be filtered.
+     * @param src: A pointer to the samples of the volume to be filtered.
+     * @param dst: A pointer to the output samples, which must not overlap src.
      * @param width: The width of the volume.
      * @param height: The height of the volume.
      * @param depth: The depth of the volume.
      */
-    void applyGaussian1DFilter_Y(std::vector<unsigned char> &data, int width, int height, int depth);
+    template<typename T>
+    void applyGaussian1DFilter_Y(const T *src, T *dst, int width, int height, int depth);
 
     /**
      * Applies the Gaussian filter along the Z-axis of the volume.
@@ -84,12 +137,27 @@ private:
      * updating the voxel's value accordingly. The operation blurs the volume along the Z-axis, maintaining its dimensions
      * along the X and Y axes.
      *
-     * @param data: A reference to a vector of unsigned char representing the volume data to be filtered.
+     * @param src: A pointer to the samples of the volume to be filtered.
+     * @param dst: A pointer to the output samples, which must not overlap src.
      * @param width: The width of the volume.
      * @param height: The height of the volume.
      * @param depth: The depth of the volume.
      */
-    void applyGaussian1DFilter_Z(std::vector<unsigned char> &data, int width, int height, int depth);
+    template<typename T>
+    void applyGaussian1DFilter_Z(const T *src, T *dst, int width, int height, int depth);
+
+    /**
+     * Applies the separable Gaussian filter to a volume whose samples are of type T.
+     *
+     * The passes are compiled separately for every sample type, so 16-bit and float volumes are filtered in their own
+     * precision without being converted to 8 bits. The passes alternate between the volume's own buffer and a single
+     * scratch buffer from Volume::takeSpareBuffer, which holds the result after the last pass and is handed to the volume
+     * by move, so filtering allocates nothing after the first volume and copies nothing back.
+     *
+     * @param volume: A reference to the Volume object to be filtered; its sample type must be T.
+     */
+    template<typename T>
+    void filterVolume(Volume &volume);
 
 public:
     /**
@@ -102,9 +170,14 @@ public:
      *
      * @param sigma: The standard deviation of the Gaussian distribution used for the kernel.
      * @param kernelSize: The size of the kernel. It must be an odd number.
-     * @throws std::invalid_argument if kernelSize is not an odd number.
+     * @param mode: Whether 8-bit volumes are filtered with floating-point or fixed-point arithmetic. The fixed-point mode
+     * keeps every pass within one grey level of the floating-point result; 16-bit and float volumes always use floating
+     * point. The recursive mode ignores the kernel size and uses the Young-van Vliet recursion for every sample type, so
+     * its cost does not grow with sigma; it approximates the Gaussian to within a few percent of an impulse's peak and is
+     * meant for large sigma.
+     * @throws std::invalid_argument if kernelSize is not an odd number, or if sigma is below 0.5 in recursive mode.
      */
-    Gaussian3DFilter(double sigma, int kernelSize);
+    Gaussian3DFilter(double sigma, int kernelSize, GaussianMode mode = GaussianMode::FloatingPoint);
 
     /**
      * Applies the Gaussian filter to the entire volume.
@@ -113,10 +186,64 @@ public:
      * axes (X, Y, and Z) sequentially. It achieves this by calling the applyGaussian1DFilter_X, applyGaussian1DFilter_Y,
      * and applyGaussian1DFilter_Z methods in succession, each applying the Gaussian kernel along one axis. The process
      * results in a volume that is uniformly smoothed, reducing noise while preserving important structural information.
+     * 8-bit, 16-bit and float volumes are all supported and keep their sample type. Each pass splits its lines across
+     * all hardware threads.
      *
      * @param volume: A reference to the Volume object representing the 3D data to be filtered.
      */
     void apply(Volume &volume) override;
+
+    /**
+     * Applies the Gaussian filter to a box of a volume.
+     *
+     * Only the box and the kernelSize / 2 voxels around it are read, and only the box is written. Inside the box the
+     * result equals that of apply(Volume &). The recursive mode has no finite reach; it reads 4 sigma around the box,
+     * which makes the result inside the box differ from a full run by well under a grey level.
+     *
+     * @param volume: A reference to the Volume object to be processed.
+     * @param region: The box to filter, which must lie inside the volume.
+     */
+    void apply(Volume &volume, const Region3D &region) override;
+
+    /**
+     * Gets the reach of the filter: kernelSize / 2, or 4 sigma rounded up in recursive mode.
+     */
+    int getReach() const override;
+
+    /**
+     * Describes the filter, e.g. "Gaussian3DFilter(sigma=1,kernelSize=5,mode=1)", with the mode as its enumerator
+     * index.
+     */
+    std::string describe() const override;
+
+    /**
+     * Applies the Gaussian filter to a volume stored in the bricked layout.
+     *
+     * This overload produces exactly the same result as apply(Volume &) but walks the data brick by brick. The X-axis pass
+     * filters rows through the brick-aware run accessors, while the Y- and Z-axis passes gather one brick-wide strip of
+     * rows at a time, so that z-direction filtering reads contiguous brick rows instead of striding through whole slices.
+     *
+     * @param volume: A reference to the BrickedVolume to be filtered in place.
+     */
+    void apply(BrickedVolume &volume);
+
+    /**
+     * Applies the Gaussian filter to a volume streamed from disk.
+     *
+     * This overload filters a stack of slice files without loading the whole volume. Each input slice is read once and
+     * immediately smoothed along the X- and Y-axes; the results are kept in a sliding window of kernelSize slices, and as
+     * soon as every slice needed by an output slice is in the window, the Z-axis pass is computed and the output slice is
+     * written to the output directory as "slice_<index>.png". Peak memory is therefore proportional to
+     * kernelSize * width * height instead of the size of the volume, and the output is identical to loading the volume,
+     * calling apply(Volume &) and saving all x-y slices. The recursive mode needs every slice of a z-line at once and is
+     * therefore not supported here.
+     *
+     * @param input: The stream providing the input slices.
+     * @param outputDirectory: The directory to write the filtered slices into.
+     *
+     * @return: A boolean value indicating the success (true) or failure (false) of the operation.
+     */
+    bool apply(const VolumeStream &input, const std::string &outputDirectory);
 };
 
 #endif //ADVANCED_PROGRAMMING_GROUP_RADIX_SORT_GAUSSIAN3DFILTER_H
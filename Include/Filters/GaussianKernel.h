@@ -0,0 +1,119 @@
+/**
+ * @file GaussianKernel.h
+ *
+ * @brief Selects how the Gaussian filters evaluate their kernels and quantises kernels for integer arithmetic.
+ *
+ * Gaussian2DFilter and Gaussian3DFilter accumulate their weighted sums in floating point by default. The GaussianMode
+ * enumeration lets callers switch 8-bit filtering to a fixed-point mode, in which the kernel weights are quantised to
+ * 16-bit unsigned integers whose sum is an exact power of two and the weighted sums are accumulated in 32-bit integers.
+ * Integer lanes are narrower than double lanes, so the compiler can process several times more samples per vector
+ * instruction, while the quantisation keeps every result within one grey level of the floating-point result. The
+ * GaussianKernel class provides the shared quantisation used by both filters.
+ *
+ * For large sigma the recursive mode replaces the kernel by the third-order recursive filter of Young and van Vliet,
+ * which is run forwards and backwards along each line. Its cost per sample is a handful of multiply-adds whatever the
+ * value of sigma, so heavy smoothing, such as background estimation, costs the same as sigma = 1. The RecursiveGaussian
+ * class holds the recursion coefficients and filters lines in double precision.
+ *
+ * @date Created on October 19, 2026
+ *
+ * @authors
+ * Advanced Programming Group Radix Sort:
+ *   - Benjamin Duncan (edsml-bd1023)
+ *   - Boyang Hu (edsml-bh223)
+ *   - Chawk Chamoun (edsml-cc8915)
+ *   - Mingsheng Cai (acse-sc4623)
+ *   - Moyu Zhang (acse-mz223)
+ *   - Ryan Benney (acse-rgb123)
+ */
+
+#pragma once
+
+#ifndef ADVANCED_PROGRAMMING_GROUP_RADIX_SORT_GAUSSIANKERNEL_H
+#define ADVANCED_PROGRAMMING_GROUP_RADIX_SORT_GAUSSIANKERNEL_H
+
+#include <cstddef>
+#include <vector>
+
+enum class GaussianMode {
+    FloatingPoint, // Weighted sums in double precision
+    FixedPoint, // 16-bit integer weights and 32-bit integer sums, for 8-bit data
+    Recursive // Young-van Vliet recursive filter, whose cost does not depend on sigma
+};
+
+class GaussianKernel {
+public:
+    static constexpr int maxShift = 16; // Weights sum to at most 2^16, so every weight fits in 16 bits
+
+    /**
+     * Quantises normalised kernel weights to 16-bit integers
+     *
+     * Scales the weights by 2^shift and rounds them with the largest-remainder method: every weight is first rounded down,
+     * and the units still missing from the total are given to the weights with the largest fractional parts. The integer
+     * weights therefore sum to exactly 2^shift and each differs from its scaled value by less than one unit, so a weighted
+     * sum of 8-bit samples differs from the exact one by less than 255 * kernelSize / 2^shift. The shift is the largest
+     * value up to maxShift for which every weight still fits in 16 bits.
+     *
+     * @param weights: The kernel weights, which must be non-negative and sum to 1.
+     * @param shift: Receives the number of fractional bits of the quantised weights.
+     *
+     * @return: The quantised weights, in the same order as the input.
+     */
+    static std::vector<unsigned short> quantise(const std::vector<double> &weights, int &shift);
+
+private:
+    /**
+     * Default constructor for the GaussianKernel class.
+     *
+     * The constructor is deleted because the class only provides static helpers.
+     */
+    GaussianKernel() = delete;
+
+    /**
+     * Destructor for the GaussianKernel class.
+     *
+     * The destructor is deleted because the class only provides static helpers.
+     */
+    ~GaussianKernel() = delete;
+};
+
+class RecursiveGaussian {
+private:
+    double b; // Gain applied to the input sample
+    double a[3]; // Feedback weights of the previous three outputs
+    double endMatrix[3][3]; // Maps the last three causal outputs to the first three anti-causal ones past the end
+
+public:
+    static constexpr double minSigma = 0.5; // Below this the recursion no longer approximates a Gaussian
+
+    /**
+     * Constructor for the RecursiveGaussian class.
+     *
+     * Computes the coefficients of the third-order recursion from the 1995 formulas of Young and van Vliet, and the
+     * boundary matrix of Triggs and Sdika that starts the backward pass as if the line continued with a constant value.
+     * The matrix is found once by running the recursion on the decaying tail that follows each of the three possible unit
+     * states, which avoids the closed-form expression while giving the same values to double precision.
+     *
+     * @param sigma: The standard deviation of the Gaussian, in samples.
+     * @throws std::invalid_argument if sigma is smaller than minSigma.
+     */
+    explicit RecursiveGaussian(double sigma);
+
+    /**
+     * Filters a set of parallel lines in place.
+     *
+     * Sample i of line l is stored at samples[i * stride + l], so neighbouring lines are contiguous and every step of the
+     * recursion is a vectorisable loop over the lines. The causal pass starts from the steady state of the first sample
+     * and the anti-causal pass from the exact continuation of the last sample, so a constant line is left unchanged and
+     * the edges behave like replicated borders. With replicateEdges set to false the line is instead continued with zeros.
+     *
+     * @param samples: A pointer to the first sample of the first line.
+     * @param length: The number of samples in each line.
+     * @param stride: The distance, in elements, between consecutive samples of a line.
+     * @param lines: The number of neighbouring lines.
+     * @param replicateEdges: Whether the lines continue with their edge samples (true) or with zeros (false).
+     */
+    void filterLines(double *samples, int length, size_t stride, int lines, bool replicateEdges = true) const;
+};
+
+#endif //ADVANCED_PROGRAMMING_GROUP_RADIX_SORT_GAUSSIANKERNEL_H
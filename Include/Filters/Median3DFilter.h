@@ -28,7 +28,10 @@
 #define ADVANCED_PROGRAMMING_GROUP_RADIX_SORT_MEDIAN3DFILTER_H
 
 #include "Filter.h"
+#include "BrickedVolume.h"
+#include "VolumeStream.h"
 
+#include <string>
 #include <vector>
 
 class Median3DFilter : public IFilter3D {
@@ -53,16 +56,57 @@ private:
     /**
      * Precomputes the offsets for the filter's neighborhood based on the kernel size.
      *
-     * This method calculates the offsets from each voxel within the kernel's neighborhood, taking into account the
-     * dimensions of the volume to ensure that the offsets stay within bounds. The offsets are stored in a vector for
-     * quick access during the filtering process. This precomputation step optimizes the median filtering operation by
-     * avoiding repeated boundary checks for each voxel during the filter application.
+     * This method calculates the offsets from each voxel within the kernel's neighborhood and stores them in a vector
+     * for quick access during the filtering process. It is called once by the constructor, so applying the filter never
+     * modifies it and one filter may be applied to several volumes at the same time.
+     */
+    void precomputeNeighborhoodOffsets();
+
+    /**
+     * Median-filters a block of voxels inside a linear region of the volume.
+     *
+     * The region is a z-major copy of part of the volume that has already been clipped to the volume bounds, so any
+     * neighbour that falls outside the region is also outside the volume and is left out of the histogram, exactly as in
+     * the original whole-volume implementation. The block is given in region coordinates and its results are written to
+     * out in z-major order.
+     *
+     * @param region: A pointer to the region's voxels.
+     * @param regionWidth: The width of the region.
+     * @param regionHeight: The height of the region.
+     * @param regionDepth: The depth of the region.
+     * @param x0: The x-coordinate of the block within the region.
+     * @param y0: The y-coordinate of the block within the region.
+     * @param z0: The z-coordinate of the block within the region.
+     * @param blockWidth: The width of the block to filter.
+     * @param blockHeight: The height of the block to filter.
+     * @param blockDepth: The depth of the block to filter.
+     * @param out: The destination buffer, holding blockWidth * blockHeight * blockDepth voxels.
+     */
+    void filterRegion(const unsigned char *region, int regionWidth, int regionHeight, int regionDepth, int x0, int y0,
+                      int z0, int blockWidth, int blockHeight, int blockDepth, unsigned char *out) const;
+
+    /**
+     * Median-filters a block of 16-bit or float voxels inside a linear region of the volume.
      *
-     * @param width: The width of the volume.
-     * @param height: The height of the volume.
-     * @param depth: The depth of the volume.
+     * Counterpart of filterRegion for sample types that are too wide for a histogram. The in-bounds neighbours of each
+     * voxel are gathered and the element at the median index is found with std::nth_element, which selects the same value
+     * as the histogram search; voxels with too few in-bounds neighbours are left untouched, exactly as in filterRegion.
+     *
+     * @param region: A pointer to the region's voxels.
+     * @param regionWidth: The width of the region.
+     * @param regionHeight: The height of the region.
+     * @param regionDepth: The depth of the region.
+     * @param x0: The x-coordinate of the block within the region.
+     * @param y0: The y-coordinate of the block within the region.
+     * @param z0: The z-coordinate of the block within the region.
+     * @param blockWidth: The width of the block to filter.
+     * @param blockHeight: The height of the block to filter.
+     * @param blockDepth: The depth of the block to filter.
+     * @param out: The destination buffer, holding blockWidth * blockHeight * blockDepth voxels.
      */
-    void precomputeNeighborhoodOffsets(int width, int height, int depth);
+    template<typename T>
+    void selectRegion(const T *region, int regionWidth, int regionHeight, int regionDepth, int x0, int y0, int z0,
+                      int blockWidth, int blockHeight, int blockDepth, T *out) const;
 
 public:
     /**
@@ -86,11 +130,58 @@ public:
      * median filter is a powerful tool for reducing noise in volume data while preserving structural details.
      * This method efficiently computes the median values using precomputed neighborhood offsets to enhance the
      * performance of the filtering operation. Histogram equalization is a critical step in enhancing the contrast
-     * of images and improving their visual quality.
+     * of images and improving their visual quality. 16-bit and float volumes are filtered in their own sample type.
      *
      * @param volume: A reference to a Volume object representing the 3D data to which the median filter will be applied.
      */
     void apply(Volume &volume) override;
+
+    /**
+     * Applies the filter to a box of a volume.
+     *
+     * Only the box and the kernelSize / 2 voxels around it are read, and only the box is written. Inside the box the result
+     * equals that of apply(Volume &), including the handling of the volume border.
+     *
+     * @param volume: A reference to the Volume object to be processed.
+     * @param region: The box to filter, which must lie inside the volume.
+     */
+    void apply(Volume &volume, const Region3D &region) override;
+
+    /**
+     * Gets the reach of the filter, kernelSize / 2.
+     */
+    int getReach() const override;
+
+    /**
+     * Describes the filter, e.g. "Median3DFilter(kernelSize=3)".
+     */
+    std::string describe() const override;
+
+    /**
+     * Applies the median filter to a volume stored in the bricked layout.
+     *
+     * Each brick is processed independently: the brick and its kernel halo are gathered into a small linear region using
+     * the brick-aware run accessors, filtered, and written into a new bricked volume that replaces the input. The result
+     * is identical to apply(Volume &) on the equivalent linear volume.
+     *
+     * @param volume: A reference to the BrickedVolume to be filtered in place.
+     */
+    void apply(BrickedVolume &volume);
+
+    /**
+     * Applies the median filter to a volume streamed from disk.
+     *
+     * This overload filters a stack of slice files while keeping only a sliding window of kernelSize input slices in
+     * memory. Slices are read on demand, and each output slice is computed from the window and written to the output
+     * directory as "slice_<index>.png" as soon as it is final. Peak memory is proportional to kernelSize * width * height,
+     * and the output is identical to loading the volume, calling apply(Volume &) and saving all x-y slices.
+     *
+     * @param input: The stream providing the input slices.
+     * @param outputDirectory: The directory to write the filtered slices into.
+     *
+     * @return: A boolean value indicating the success (true) or failure (false) of the operation.
+     */
+    bool apply(const VolumeStream &input, const std::string &outputDirectory);
 };
 
 #endif //ADVANCED_PROGRAMMING_GROUP_RADIX_SORT_MEDIAN3DFILTER_H
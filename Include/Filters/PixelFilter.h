@@ -224,6 +224,24 @@ public:
      * @throws std::invalid_argument if the filter type is unsupported.
      */
     void apply(Image &image) override;
+
+    /**
+     * Applies the pixel filter to a rectangle of an image.
+     *
+     * Only the rectangle is read and written. Histogram equalisation uses the histogram of the rectangle itself, so the
+     * region is equalised on its own. Grayscale conversion changes the number of channels and cannot be applied to a
+     * region; an error is printed and the image is left unchanged.
+     *
+     * @param image: A reference to the Image object to be processed.
+     * @param region: The rectangle to filter, which must lie inside the image.
+     */
+    void apply(Image &image, const Region2D &region) override;
+
+    /**
+     * Describes the filter with its type, colour space and the brightness and threshold settings. Salt and pepper
+     * noise is random, so it is described by an empty string.
+     */
+    std::string describe() const override;
 };
 
 #endif //ADVANCED_PROGRAMMING_GROUP_RADIX_SORT_PIXELFILTER_H
@@ -28,12 +28,16 @@
 #ifndef ADVANCED_PROGRAMMING_GROUP_RADIX_SORT_IMAGE_H
 #define ADVANCED_PROGRAMMING_GROUP_RADIX_SORT_IMAGE_H
 
+#include "Buffer.h"
+#include "DataType.h"
+
 #include <string>
 
 class Image {
 private:
     int width, height, channels; // Size of the image
-    unsigned char *data; // Image data
+    Buffer data; // Image data, released with the deleter that matches its allocation
+    DataType dataType; // Type of the samples stored in data
 
     /**
      * Private constructor to prevent copy construction.
@@ -71,13 +75,34 @@ public:
      * @param height The height of the image
      * @param channels The number of color channels in the image
      * @param data The image data as an array of unsigned char
+     * @param dataType The type of the samples in data; data holds width * height * channels samples of this type
      */
-    Image(int width, int height, int channels, unsigned char *data);
+    Image(int width, int height, int channels, unsigned char *data, DataType dataType = DataType::UInt8);
+
+    /**
+     * Move constructor for the Image class.
+     *
+     * Takes over the dimensions and data buffer of other without copying any samples. The moved-from image is left empty.
+     *
+     * @param other The Image object to move from
+     */
+    Image(Image &&other) noexcept;
+
+    /**
+     * Move assignment operator for the Image class.
+     *
+     * Releases the current data buffer and takes over the dimensions and data buffer of other.
+     *
+     * @param other The Image object to move from
+     * @return The reference to the assigned Image object
+     */
+    Image &operator=(Image &&other) noexcept;
 
     /**
      * Destructor for the Image class.
      *
-     * The destructor frees the memory allocated for the image data.
+     * The destructor frees the memory allocated for the image data with the function that matches its allocation, i.e.
+     * stbi_image_free for loaded images and the aligned delete for buffers allocated by the filters.
      */
     ~Image();
 
@@ -117,15 +142,49 @@ public:
      */
     unsigned char *getData() const;
 
+    /**
+     * Get the type of the samples stored in the image.
+     *
+     * The 2D filters operate on 8-bit images only and leave images of other types unchanged.
+     *
+     * @return The sample type of the image data
+     */
+    DataType getDataType() const;
+
+    /**
+     * Get the image data as samples of type T.
+     *
+     * T must match the sample type reported by getDataType, i.e. unsigned char, unsigned short or float.
+     *
+     * @return A pointer to the image data
+     */
+    template<typename T>
+    T *getDataAs() const {
+        return reinterpret_cast<T *>(data.getData());
+    }
+
     /**
      * Update the image data.
      *
-     * This member function updates the image data with the specified data.
+     * This member function updates the image data with the specified data. The image takes ownership of data, which must
+     * have been allocated with new unsigned char[] and hold the samples for the current dimensions.
      *
      * @param data The new image data as an array of unsigned char
      */
     void updateData(unsigned char *data);
 
+    /**
+     * Update the image data by taking over a buffer.
+     *
+     * The previous data buffer is released and data is moved into the image, so no samples are copied. Filters allocate
+     * their output as a Buffer and hand it over with this function. The sample type of the image becomes dataType, so
+     * a buffer of another type is never read with the old one.
+     *
+     * @param data The buffer holding the new image data
+     * @param dataType The type of the samples in data
+     */
+    void updateData(Buffer &&data, DataType dataType);
+
     /**
      * Set the width of the image.
      *
@@ -158,13 +217,16 @@ public:
      *
      * This member function of the Image class loads an image from the specified file path into the object's data buffer
      * using the stb_image library. It sets the image's width, height, and channels based on the loaded image's properties.
-     * If the image cannot be loaded, it prints an error message to standard error.
+     * If the image cannot be loaded, it prints an error message to standard error. When a 16-bit or float sample type is
+     * requested, the image is decoded with stbi_load_16 so that 16-bit files keep their full precision; float images
+     * store the 16-bit values divided by 257, i.e. on the same 0 to 255 scale as 8-bit data.
      *
      * @param path: A string representing the path to the image file to be loaded.
+     * @param type: The sample type to store the image as. Defaults to 8-bit.
      *
      * @return: A boolean value indicating the success (true) or failure (false) of loading the image.
      */
-    bool loadFromFile(const std::string &path);
+    bool loadFromFile(const std::string &path, DataType type = DataType::UInt8);
 
     /**
      * Saves the image to a file
@@ -172,6 +234,8 @@ public:
      * This const member function of the Image class attempts to save the current image data to a file at the specified path.
      * It uses the stb_image_write library to write the image in PNG format. Before attempting to save, it checks if the image
      * data buffer is not empty. If there is no data, or if the save operation fails, it prints an error message to standard error.
+     * 16-bit and float images are converted to 8-bit samples when they are written. Missing directories are created
+     * in-process through OutputService::global(), which remembers the directories it has already created.
      *
      * @param path: A string representing the file path where the image should be saved. The image will be saved in PNG format.
      *
@@ -179,6 +243,19 @@ public:
      */
     bool saveToFile(const std::string &path) const;
 
+    /**
+     * Queues the image to be saved to a PNG file in the background.
+     *
+     * The samples are copied, converted to 8 bits if needed, so the image may change or be destroyed right away. The file
+     * is encoded by OutputService::global(); call its flush method to wait for the pending files and collect the ones that
+     * could not be written.
+     *
+     * @param path: The path of the PNG file. Missing directories are created.
+     *
+     * @return: False if the image holds no data, true once the file is queued.
+     */
+    bool saveToFileAsync(const std::string &path) const;
+
 };
 
 #endif //ADVANCED_PROGRAMMING_GROUP_RADIX_SORT_IMAGE_H
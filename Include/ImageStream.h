@@ -0,0 +1,85 @@
+/**
+ * @file ImageStream.h
+ *
+ * @brief Declares the ImageStream class, which filters PNG images too large to hold in memory.
+ *
+ * A neighbourhood filter only needs the rows within its reach to compute a row of output. ImageStream::filterPng
+ * decodes an input PNG with PngReader and keeps a rolling window of rows: each band of output rows is filtered
+ * together with the rows of context around it, written with PngWriter as soon as it is done, and dropped. Memory is
+ * therefore about width * (bandRows + 2 * reach) pixels however tall the image is, where reach is the sum of the
+ * filters' radii.
+ *
+ * Filters are applied through their region-of-interest overloads, which filter a band exactly as a full run would,
+ * including the padding at the top and bottom of the image, so the output is identical to loading the image, applying
+ * the filters in turn and saving it. Decoding the next band, filtering the current one and encoding the previous one
+ * run at the same time.
+ *
+ * @date Created on October 19, 2026
+ *
+ * @authors
+ * Advanced Programming Group Radix Sort:
+ *   - Benjamin Duncan (edsml-bd1023)
+ *   - Boyang Hu (edsml-bh223)
+ *   - Chawk Chamoun (edsml-cc8915)
+ *   - Mingsheng Cai (acse-sc4623)
+ *   - Moyu Zhang (acse-mz223)
+ *   - Ryan Benney (acse-rgb123)
+ */
+
+#pragma once
+
+#ifndef ADVANCED_PROGRAMMING_GROUP_RADIX_SORT_IMAGESTREAM_H
+#define ADVANCED_PROGRAMMING_GROUP_RADIX_SORT_IMAGESTREAM_H
+
+#include "Image.h"
+#include "Region.h"
+
+#include <functional>
+#include <string>
+#include <vector>
+
+// One filter of a streamed chain
+struct StreamFilter {
+    // Rows of context the filter reads on each side of a row: kernelSize / 2, 2 for edge filters and ceil(4 * sigma)
+    // for recursive Gaussian filters
+    int radius;
+    std::function<void(Image &, const Region2D &)> apply; // Filters a region of an image in place
+};
+
+class ImageStream {
+public:
+    static constexpr int defaultBandRows = 32; // Output rows filtered together
+
+    /**
+     * Filters a PNG image band by band and writes the result as a PNG image.
+     *
+     * @param inputPath: The path of the PNG image to read.
+     * @param outputPath: The path of the PNG image to write.
+     * @param filters: The filters to apply, in order, each through its region overload, e.g.
+     * StreamFilter{2, [&](Image &image, const Region2D &region) { box.apply(image, region); }}.
+     * @param channels: The number of channels to filter, 1 to 4, or 0 for the channels of the input. Edge filters
+     * need 1.
+     * @param bandRows: The number of output rows filtered at a time.
+     * @return: A boolean value indicating the success (true) or failure (false) of filtering the image. On failure an
+     * error message is printed to standard error.
+     */
+    static bool filterPng(const std::string &inputPath, const std::string &outputPath,
+                          const std::vector<StreamFilter> &filters, int channels = 0, int bandRows = defaultBandRows);
+
+private:
+    /**
+     * Default constructor for the ImageStream class.
+     *
+     * The constructor is deleted because the class only provides static helpers.
+     */
+    ImageStream() = delete;
+
+    /**
+     * Destructor for the ImageStream class.
+     *
+     * The destructor is deleted because the class only provides static helpers.
+     */
+    ~ImageStream() = delete;
+};
+
+#endif //ADVANCED_PROGRAMMING_GROUP_RADIX_SORT_IMAGESTREAM_H
@@ -0,0 +1,178 @@
+/**
+ * @file Inflate.h
+ *
+ * @brief Declares a self-contained decoder for DEFLATE and gzip streams.
+ *
+ * NRRD and NIfTI volumes are often stored gzip-compressed (encoding: gzip, or .nii.gz files). The Inflate class decodes
+ * them without an external library. It implements the whole of RFC 1951 (stored, fixed-Huffman and dynamic-Huffman
+ * blocks) and the gzip member format of RFC 1952, including the CRC-32 check. Huffman codes of up to 10 bits, which
+ * cover nearly all symbols in practice, are decoded with one table lookup; longer codes are decoded bit by bit.
+ *
+ * Output goes to a caller-provided buffer whose size is known in advance, typically the payload size from the volume
+ * header, so a compressed volume is inflated straight into its Volume buffer. Every length and distance is checked
+ * against the input and output bounds, so corrupt streams are reported rather than overrunning a buffer.
+ *
+ * The InflateStream class decodes the same streams incrementally for readers that consume their output a row at a
+ * time, such as PngReader. It keeps only the 32 KB history that back-references may reach plus a little decoded
+ * output, and takes its input as a list of buffers, so a stream split over several chunks of a mapped file is decoded
+ * in place without first being joined.
+ *
+ * @date Created on October 19, 2026
+ *
+ * @authors
+ * Advanced Programming Group Radix Sort:
+ *   - Benjamin Duncan (edsml-bd1023)
+ *   - Boyang Hu (edsml-bh223)
+ *   - Chawk Chamoun (edsml-cc8915)
+ *   - Mingsheng Cai (acse-sc4623)
+ *   - Moyu Zhang (acse-mz223)
+ *   - Ryan Benney (acse-rgb123)
+ */
+
+#pragma once
+
+#ifndef ADVANCED_PROGRAMMING_GROUP_RADIX_SORT_INFLATE_H
+#define ADVANCED_PROGRAMMING_GROUP_RADIX_SORT_INFLATE_H
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+class Inflate {
+public:
+    /**
+     * Decodes a raw DEFLATE stream.
+     *
+     * @param source: The compressed bytes.
+     * @param size: The number of compressed bytes.
+     * @param out: The destination.
+     * @param outSize: The capacity of the destination.
+     * @param written: Set to the number of bytes decoded.
+     * @param consumed: Set to the number of compressed bytes up to the end of the final block.
+     * @return: True if the stream ended with a final block without exceeding either buffer.
+     */
+    static bool inflate(const unsigned char *source, size_t size, unsigned char *out, size_t outSize, size_t &written,
+                        size_t &consumed);
+
+    /**
+     * Decodes a gzip stream of known decompressed size.
+     *
+     * @param source: The gzip file contents.
+     * @param size: The number of bytes in source.
+     * @param out: The destination, which must hold exactly outSize bytes.
+     * @param outSize: The decompressed size.
+     * @return: True if the stream decoded to exactly outSize bytes and its CRC-32 and length match.
+     */
+    static bool gunzip(const unsigned char *source, size_t size, unsigned char *out, size_t outSize);
+
+    /**
+     * Decodes a gzip stream, sizing the output from the length stored in its trailer.
+     *
+     * @param source: The gzip file contents.
+     * @param size: The number of bytes in source.
+     * @param out: Replaced by the decompressed bytes.
+     * @return: True if the stream decoded and its CRC-32 and length match. Streams of 4 GB or more are rejected.
+     */
+    static bool gunzip(const unsigned char *source, size_t size, std::vector<unsigned char> &out);
+
+    /**
+     * Checks whether bytes start with the gzip signature.
+     */
+    static bool isGzip(const unsigned char *source, size_t size);
+
+    /**
+     * Computes the CRC-32 used by gzip.
+     *
+     * @param data: The bytes.
+     * @param size: The number of bytes.
+     * @param crc: The CRC of the preceding bytes, to continue a running checksum.
+     * @return: The CRC-32 of the preceding bytes followed by data.
+     */
+    static uint32_t crc32(const unsigned char *data, size_t size, uint32_t crc = 0);
+
+private:
+    /**
+     * Default constructor for the Inflate class.
+     *
+     * The constructor is deleted because the class only provides static helpers.
+     */
+    Inflate() = delete;
+
+    /**
+     * Destructor for the Inflate class.
+     *
+     * The destructor is deleted because the class only provides static helpers.
+     */
+    ~Inflate() = delete;
+};
+
+class InflateStream {
+private:
+    struct Decoder;
+    std::unique_ptr<Decoder> decoder; // Decoding state, kept behind a pointer so moves do not invalidate its input
+
+    InflateStream(const InflateStream &) = delete;
+
+    InflateStream &operator=(const InflateStream &) = delete;
+
+public:
+    static constexpr size_t historySize = 32768; // Farthest back-reference of DEFLATE
+
+    /**
+     * Default constructor for the InflateStream class, creating a decoder with no input.
+     */
+    InflateStream();
+
+    /**
+     * Destructor for the InflateStream class.
+     */
+    ~InflateStream();
+
+    /**
+     * Move constructor for the InflateStream class.
+     *
+     * @param other: The stream to move from.
+     */
+    InflateStream(InflateStream &&other) noexcept;
+
+    /**
+     * Move assignment operator for the InflateStream class.
+     *
+     * @param other: The stream to move from.
+     * @return: A reference to this stream.
+     */
+    InflateStream &operator=(InflateStream &&other) noexcept;
+
+    /**
+     * Appends a piece of the raw DEFLATE stream.
+     *
+     * The bytes are not copied and must stay valid until decoding ends. All pieces must be added before a read needs
+     * them; a stream that ends early is reported as failed.
+     *
+     * @param source: The compressed bytes.
+     * @param size: The number of compressed bytes.
+     */
+    void addInput(const unsigned char *source, size_t size);
+
+    /**
+     * Decodes the next bytes of the stream.
+     *
+     * @param out: The destination.
+     * @param size: The number of bytes wanted.
+     * @return: The number of bytes decoded, which is less than size only at the end of the stream or after an error.
+     */
+    size_t read(unsigned char *out, size_t size);
+
+    /**
+     * Checks whether the final block has been decoded and all of its bytes read.
+     */
+    bool isFinished() const;
+
+    /**
+     * Checks whether decoding stopped at corrupt or missing input.
+     */
+    bool hasFailed() const;
+};
+
+#endif //ADVANCED_PROGRAMMING_GROUP_RADIX_SORT_INFLATE_H
@@ -0,0 +1,107 @@
+/**
+ * @file MappedFile.h
+ *
+ * @brief Declares the MappedFile class, which maps files into memory instead of reading them.
+ *
+ * Volume formats that store their samples uncompressed, such as raw NRRD and NIfTI, can be loaded without copying: the
+ * payload is mapped into the address space and the operating system pages it in as it is first touched. A MappedFile
+ * maps a whole file read-only for parsing headers and random access. mapRange maps just the payload as a Buffer that a
+ * Volume can own. That mapping is private and writable, so filters may write into it in place (for example as the spare
+ * of a double-buffered volume) without ever changing the file.
+ *
+ * On systems without mmap the same calls read the file into memory instead.
+ *
+ * @date Created on October 19, 2026
+ *
+ * @authors
+ * Advanced Programming Group Radix Sort:
+ *   - Benjamin Duncan (edsml-bd1023)
+ *   - Boyang Hu (edsml-bh223)
+ *   - Chawk Chamoun (edsml-cc8915)
+ *   - Mingsheng Cai (acse-sc4623)
+ *   - Moyu Zhang (acse-mz223)
+ *   - Ryan Benney (acse-rgb123)
+ */
+
+#pragma once
+
+#ifndef ADVANCED_PROGRAMMING_GROUP_RADIX_SORT_MAPPEDFILE_H
+#define ADVANCED_PROGRAMMING_GROUP_RADIX_SORT_MAPPEDFILE_H
+
+#include "Buffer.h"
+
+#include <cstddef>
+#include <string>
+
+class MappedFile {
+private:
+    Buffer contents; // The mapped (or read) file, or an empty buffer if no file is open
+
+    MappedFile(const MappedFile &) = delete;
+
+    MappedFile &operator=(const MappedFile &) = delete;
+
+public:
+    /**
+     * Default constructor for the MappedFile class, creating a closed file.
+     */
+    MappedFile();
+
+    /**
+     * Move constructor for the MappedFile class.
+     *
+     * @param other: The file to move from, which is left closed.
+     */
+    MappedFile(MappedFile &&other) noexcept;
+
+    /**
+     * Move assignment operator for the MappedFile class.
+     *
+     * @param other: The file to move from, which is left closed.
+     * @return: A reference to this file.
+     */
+    MappedFile &operator=(MappedFile &&other) noexcept;
+
+    /**
+     * Maps a whole file read-only.
+     *
+     * @param path: The path of the file.
+     * @return: A boolean value indicating the success (true) or failure (false) of mapping the file. On failure an
+     * error message is printed to standard error and the file is left closed.
+     */
+    bool open(const std::string &path);
+
+    /**
+     * Unmaps the file.
+     */
+    void close();
+
+    /**
+     * Get a pointer to the first byte of the file.
+     *
+     * @return: The pointer, or nullptr if no file is open or the file is empty.
+     */
+    const unsigned char *getData() const;
+
+    /**
+     * Get the size of the file.
+     *
+     * @return: The size in bytes, or 0 if no file is open.
+     */
+    size_t getSize() const;
+
+    /**
+     * Maps part of a file as a private, writable buffer.
+     *
+     * Writes to the buffer are never written back to the file. The mapping is released when the buffer is destroyed.
+     *
+     * @param path: The path of the file.
+     * @param offset: The first byte of the range.
+     * @param size: The size of the range in bytes.
+     * @return: A buffer that owns the mapping, or an empty buffer if the file cannot be opened or is shorter than the
+     * range, in which case an error message is printed to standard error.
+     */
+    static Buffer mapRange(const std::string &path, size_t offset, size_t size);
+};
+
+#endif //ADVANCED_PROGRAMMING_GROUP_RADIX_SORT_MAPPEDFILE_H
@@ -0,0 +1,175 @@
+/**
+ * @file OutputService.h
+ *
+ * @brief Declares the OutputService class, which creates output directories and encodes PNG files in the background.
+ *
+ * Saving used to start a shell for every file to create its directory, then encode the PNG on the calling thread, so a
+ * batch of thousands of images spent more time creating processes than filtering. The OutputService class creates
+ * directories in-process and remembers the ones it has created, so each directory costs one filesystem call per run.
+ * Files submitted with submitPng are encoded by a small set of worker threads. The queue of waiting files is bounded,
+ * so a fast producer waits for the encoders instead of holding every pending image in memory.
+ *
+ * Every submitted file has its own result: submitPng returns a future that reports whether that file was written, and
+ * flush waits for all submitted files and returns the ones that failed. Failures are also printed to standard error.
+ * Image::saveToFile and the Volume::save overloads go through the shared instance returned by global.
+ *
+ * @date Created on October 19, 2026
+ *
+ * @authors
+ * Advanced Programming Group Radix Sort:
+ *   - Benjamin Duncan (edsml-bd1023)
+ *   - Boyang Hu (edsml-bh223)
+ *   - Chawk Chamoun (edsml-cc8915)
+ *   - Mingsheng Cai (acse-sc4623)
+ *   - Moyu Zhang (acse-mz223)
+ *   - Ryan Benney (acse-rgb123)
+ */
+
+#pragma once
+
+#ifndef ADVANCED_PROGRAMMING_GROUP_RADIX_SORT_OUTPUTSERVICE_H
+#define ADVANCED_PROGRAMMING_GROUP_RADIX_SORT_OUTPUTSERVICE_H
+
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <future>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_set>
+#include <vector>
+
+// A file the service failed to write
+struct OutputError {
+    std::string path; // Path of the file
+    std::string message; // What went wrong
+};
+
+class OutputService {
+private:
+    // A PNG file waiting to be encoded
+    struct Job {
+        std::string path;
+        int width, height, channels;
+        std::vector<unsigned char> pixels;
+        std::promise<bool> result;
+    };
+
+    unsigned int threadCount; // Number of encoder threads
+    size_t queueCapacity; // Most files waiting to be encoded
+    std::vector<std::thread> workers; // Encoder threads, started by the first submitPng
+    std::deque<Job> queue; // Files waiting to be encoded
+    size_t running; // Files being encoded
+    bool stopping; // Set by the destructor to end the workers
+    std::vector<OutputError> errors; // Failures since the last flush
+    mutable std::mutex mutex; // Guards the queue, running, stopping and errors
+    std::condition_variable jobAvailable; // Signalled when a file is queued or the service stops
+    std::condition_variable slotAvailable; // Signalled when a file leaves the queue
+    std::condition_variable idle; // Signalled when the last pending file is done
+
+    std::unordered_set<std::string> createdDirectories; // Directories created or found before
+    std::mutex directoryMutex; // Guards createdDirectories
+
+    /**
+     * Encodes queued files until the service stops.
+     */
+    void work();
+
+    /**
+     * Encodes one file and records a failure.
+     *
+     * @param job: The file to write.
+     * @return: True if the file was written.
+     */
+    bool encode(const Job &job);
+
+public:
+    static constexpr size_t defaultQueueCapacity = 32; // Files waiting before submitPng blocks
+
+    /**
+     * Constructor for the OutputService class.
+     *
+     * No thread is started until the first file is submitted.
+     *
+     * @param threadCount: The number of encoder threads; 0 uses one per hardware thread.
+     * @param queueCapacity: The most files that may wait to be encoded; 0 is treated as 1.
+     */
+    explicit OutputService(unsigned int threadCount = 0, size_t queueCapacity = defaultQueueCapacity);
+
+    /**
+     * Destructor for the OutputService class, which writes every pending file before stopping the threads.
+     */
+    ~OutputService();
+
+    /**
+     * Copy constructor for the OutputService class.
+     *
+     * The copy constructor is deleted because the service owns threads and pending files.
+     */
+    OutputService(const OutputService &) = delete;
+
+    /**
+     * Copy assignment operator for the OutputService class.
+     *
+     * The copy assignment operator is deleted because the service owns threads and pending files.
+     */
+    OutputService &operator=(const OutputService &) = delete;
+
+    /**
+     * Returns the service shared by Image and Volume.
+     *
+     * The shared service is destroyed at program exit, which writes any file still pending.
+     */
+    static OutputService &global();
+
+    /**
+     * Creates a directory and its parents unless they are known to exist. A directory created before is checked again,
+     * and re-created if it has been removed since.
+     *
+     * @param directory: The directory; an empty string stands for the current directory.
+     * @return: True if the directory exists. On failure an error message is printed to standard error.
+     */
+    bool ensureDirectory(const std::string &directory);
+
+    /**
+     * Writes an 8-bit PNG file on the calling thread, creating its directory first.
+     *
+     * @param path: The path of the file.
+     * @param width: The width of the image.
+     * @param height: The height of the image.
+     * @param channels: The number of channels, from 1 to 4.
+     * @param pixels: The interleaved samples, width * height * channels bytes.
+     * @return: A boolean value indicating the success (true) or failure (false) of writing the file.
+     */
+    bool writePng(const std::string &path, int width, int height, int channels, const unsigned char *pixels);
+
+    /**
+     * Queues an 8-bit PNG file to be written by an encoder thread.
+     *
+     * If the queue is full, the call waits until an encoder takes a file from it.
+     *
+     * @param path: The path of the file.
+     * @param width: The width of the image.
+     * @param height: The height of the image.
+     * @param channels: The number of channels, from 1 to 4.
+     * @param pixels: The interleaved samples, width * height * channels bytes, which the service takes over.
+     * @return: A future that becomes true once the file is written, or false if writing it failed.
+     */
+    std::future<bool> submitPng(const std::string &path, int width, int height, int channels,
+                                std::vector<unsigned char> pixels);
+
+    /**
+     * Waits until every submitted file has been written or has failed.
+     *
+     * @return: The files that failed since the previous flush, including files written synchronously by writePng.
+     */
+    std::vector<OutputError> flush();
+
+    /**
+     * Returns the number of submitted files that are queued or being encoded.
+     */
+    size_t getPendingCount() const;
+};
+
+#endif //ADVANCED_PROGRAMMING_GROUP_RADIX_SORT_OUTPUTSERVICE_H
@@ -0,0 +1,69 @@
+/**
+ * @file Parallel.h
+ *
+ * @brief Splits independent loop iterations across hardware threads.
+ *
+ * The filters process many independent lines, rows or slices, and each of them can be computed without looking at the
+ * others. The Parallel class divides such a loop into one contiguous range per hardware thread and runs the ranges
+ * concurrently with std::thread, so the work is shared across cores without changing the order in which any single line
+ * is computed. Results are therefore identical to a serial run.
+ *
+ * @date Created on October 19, 2026
+ *
+ * @authors
+ * Advanced Programming Group Radix Sort:
+ *   - Benjamin Duncan (edsml-bd1023)
+ *   - Boyang Hu (edsml-bh223)
+ *   - Chawk Chamoun (edsml-cc8915)
+ *   - Mingsheng Cai (acse-sc4623)
+ *   - Moyu Zhang (acse-mz223)
+ *   - Ryan Benney (acse-rgb123)
+ */
+
+#pragma once
+
+#ifndef ADVANCED_PROGRAMMING_GROUP_RADIX_SORT_PARALLEL_H
+#define ADVANCED_PROGRAMMING_GROUP_RADIX_SORT_PARALLEL_H
+
+#include <cstddef>
+#include <functional>
+
+class Parallel {
+public:
+    /**
+     * Returns the number of threads used by forRange.
+     *
+     * @return: The number of hardware threads reported by the system, or 1 if it cannot be determined.
+     */
+    static unsigned int threadCount();
+
+    /**
+     * Runs a loop over [0, count) on all hardware threads.
+     *
+     * The range is split into at most threadCount() contiguous chunks of at least minChunk iterations, and the body is
+     * called once per chunk with its half-open range. The calling thread processes the last chunk itself and returns once
+     * every chunk has finished. The body must only write to data owned by its own iterations.
+     *
+     * @param count: The number of iterations.
+     * @param body: The function called with the first and one-past-last iteration of each chunk.
+     * @param minChunk: The smallest number of iterations worth handing to a separate thread.
+     */
+    static void forRange(size_t count, const std::function<void(size_t begin, size_t end)> &body, size_t minChunk = 1);
+
+private:
+    /**
+     * Default constructor for the Parallel class.
+     *
+     * The constructor is deleted because the class only provides static helpers.
+     */
+    Parallel() = delete;
+
+    /**
+     * Destructor for the Parallel class.
+     *
+     * The destructor is deleted because the class only provides static helpers.
+     */
+    ~Parallel() = delete;
+};
+
+#endif //ADVANCED_PROGRAMMING_GROUP_RADIX_SORT_PARALLEL_H
@@ -0,0 +1,176 @@
+/**
+ * @file PngStream.h
+ *
+ * @brief Declares the PngReader and PngWriter classes, which decode and encode PNG files one row at a time.
+ *
+ * Image::loadFromFile and Image::saveToFile hold a whole image in memory, which limits them to images that fit. The
+ * PngReader class maps a PNG file and decodes its rows in order with an InflateStream, so only the current and
+ * previous row are held; the PngWriter class filters and compresses rows as they are written with a DeflateStream and
+ * writes the compressed data in chunks as it fills. Together they let ImageStream filter images far larger than
+ * memory.
+ *
+ * The reader accepts every non-interlaced PNG: grey-scale (1 to 16 bits), grey-scale with alpha, RGB and RGBA (8 or
+ * 16 bits) and palette images (1 to 8 bits), with tRNS transparency. Like Image::loadFromFile it returns 8-bit
+ * samples: 16-bit samples keep their high byte, low bit depths are scaled to 0-255, palette images are expanded to
+ * RGB (RGBA if they have transparency) and a tRNS colour key adds an alpha channel. Interlaced images cannot be read
+ * in row order and are reported as unsupported. The writer stores 8-bit grey-scale, grey-scale with alpha, RGB or
+ * RGBA rows, choosing for each row the PNG filter with the smallest sum of absolute differences, as stb_image_write
+ * does.
+ *
+ * @date Created on October 19, 2026
+ *
+ * @authors
+ * Advanced Programming Group Radix Sort:
+ *   - Benjamin Duncan (edsml-bd1023)
+ *   - Boyang Hu (edsml-bh223)
+ *   - Chawk Chamoun (edsml-cc8915)
+ *   - Mingsheng Cai (acse-sc4623)
+ *   - Moyu Zhang (acse-mz223)
+ *   - Ryan Benney (acse-rgb123)
+ */
+
+#pragma once
+
+#ifndef ADVANCED_PROGRAMMING_GROUP_RADIX_SORT_PNGSTREAM_H
+#define ADVANCED_PROGRAMMING_GROUP_RADIX_SORT_PNGSTREAM_H
+
+#include "Deflate.h"
+#include "Inflate.h"
+#include "MappedFile.h"
+
+#include <cstddef>
+#include <fstream>
+#include <string>
+#include <vector>
+
+class PngReader {
+private:
+    MappedFile file; // The mapped PNG file
+    InflateStream inflater; // Decoder of the concatenated IDAT chunks
+    int width, height; // Size of the image
+    int bitDepth, colourType; // Sample format from the IHDR chunk
+    int sourceChannels; // Channels stored in the file
+    int decodedChannels; // Channels after palette expansion and transparency
+    int channels; // Channels returned by readRow
+    int rowsRead; // Number of rows decoded so far
+    size_t rowBytes; // Bytes of one stored row, without its filter type
+    std::vector<unsigned char> current, previous; // Stored bytes of the row being decoded and the row above
+    std::vector<unsigned char> expanded; // Row as 8-bit samples of decodedChannels channels
+    std::vector<unsigned char> palette; // RGBA palette entries
+    bool hasColourKey; // True if a tRNS chunk names a transparent grey level or colour
+    unsigned int colourKey[3]; // The transparent grey level or colour, at the file bit depth
+
+    /**
+     * Expands the stored row in current to 8-bit samples of decodedChannels channels in expanded.
+     */
+    void expandRow();
+
+public:
+    /**
+     * Default constructor for the PngReader class, creating a closed reader.
+     */
+    PngReader();
+
+    /**
+     * Opens a PNG file and reads its header chunks.
+     *
+     * No row is decoded. If the file cannot be read, is not a PNG file or is interlaced, an error message is printed
+     * to standard error and the reader is left closed.
+     *
+     * @param path: The path of the PNG file.
+     * @param desiredChannels: The number of channels readRow returns, 1 to 4, or 0 for the channels of the file.
+     * Channels are converted as by Image::loadFromFile, with grey-scale computed from RGB as a weighted luma.
+     * @return: A boolean value indicating the success (true) or failure (false) of opening the file.
+     */
+    bool open(const std::string &path, int desiredChannels = 0);
+
+    /**
+     * Checks whether a file is open.
+     */
+    bool isOpen() const;
+
+    /**
+     * @brief Get the width of the image.
+     */
+    int getWidth() const;
+
+    /**
+     * @brief Get the height of the image.
+     */
+    int getHeight() const;
+
+    /**
+     * @brief Get the number of channels of the rows returned by readRow.
+     */
+    int getChannels() const;
+
+    /**
+     * @brief Get the number of rows read so far.
+     */
+    int getRowsRead() const;
+
+    /**
+     * Decodes the next row.
+     *
+     * @param out: The destination, width * channels 8-bit samples.
+     * @return: A boolean value indicating the success (true) or failure (false) of decoding the row. It fails after
+     * the last row and on corrupt data, in which case an error message is printed.
+     */
+    bool readRow(unsigned char *out);
+};
+
+class PngWriter {
+private:
+    std::ofstream file; // The PNG file being written
+    std::string path; // The path of the file, for error messages
+    int width, height, channels; // Size of the image
+    int rowsWritten; // Number of rows written so far
+    std::vector<unsigned char> previous; // The last row written, unfiltered
+    std::vector<unsigned char> filtered; // The current row under each of the five PNG filters, with its filter type
+    std::vector<unsigned char> compressed; // Compressed data not yet written as an IDAT chunk
+    DeflateStream deflater; // Compressor of the filtered rows
+
+    /**
+     * Writes one chunk with its length and CRC.
+     */
+    void writeChunk(const char *type, const unsigned char *data, size_t size);
+
+public:
+    static constexpr size_t chunkSize = 65536; // Compressed bytes per IDAT chunk
+
+    /**
+     * Default constructor for the PngWriter class, creating a closed writer.
+     */
+    PngWriter();
+
+    /**
+     * Creates a PNG file and writes its header.
+     *
+     * The directory of the file is created if needed.
+     *
+     * @param path: The path of the file to write.
+     * @param width: The width of the image.
+     * @param height: The height of the image.
+     * @param channels: The number of 8-bit channels, 1 to 4.
+     * @return: A boolean value indicating the success (true) or failure (false) of creating the file.
+     */
+    bool open(const std::string &path, int width, int height, int channels);
+
+    /**
+     * Filters, compresses and writes the next row.
+     *
+     * @param row: The row, width * channels 8-bit samples.
+     * @return: A boolean value indicating the success (true) or failure (false) of writing the row.
+     */
+    bool writeRow(const unsigned char *row);
+
+    /**
+     * Ends the compressed data and writes the last chunks.
+     *
+     * @return: A boolean value indicating the success (true) or failure (false) of finishing the file. It fails if
+     * fewer rows than the height were written.
+     */
+    bool close();
+};
+
+#endif //ADVANCED_PROGRAMMING_GROUP_RADIX_SORT_PNGSTREAM_H
@@ -0,0 +1,87 @@
+/**
+ * @file ProcessingClient.h
+ *
+ * @brief Declares the ProcessingClient class, which sends requests to a ProcessingServer.
+ *
+ * A client keeps one connection open, so a viewer can ask for slice after slice without reconnecting, and reads each
+ * answer into a ProcessingResponse. The protocol is described in ProcessingServer.h.
+ *
+ * @date Created on October 19, 2026
+ *
+ * @authors
+ * Advanced Programming Group Radix Sort:
+ *   - Benjamin Duncan (edsml-bd1023)
+ *   - Boyang Hu (edsml-bh223)
+ *   - Chawk Chamoun (edsml-cc8915)
+ *   - Mingsheng Cai (acse-sc4623)
+ *   - Moyu Zhang (acse-mz223)
+ *   - Ryan Benney (acse-rgb123)
+ */
+
+#pragma once
+
+#ifndef ADVANCED_PROGRAMMING_GROUP_RADIX_SORT_PROCESSINGCLIENT_H
+#define ADVANCED_PROGRAMMING_GROUP_RADIX_SORT_PROCESSINGCLIENT_H
+
+#include <string>
+#include <vector>
+
+// The answer to one request
+struct ProcessingResponse {
+    bool ok = false; // Whether the server answered OK
+    std::string error; // The message of an ERROR answer
+    int width = 0, height = 0, channels = 0; // Shape of the payload; channels is 0 for text
+    std::vector<unsigned char> data; // The payload
+};
+
+class ProcessingClient {
+private:
+    int connection; // Socket descriptor, or -1 when not connected
+    std::string buffer; // Bytes received but not yet read
+
+    /**
+     * Reads exactly size bytes, first from the buffer and then from the socket.
+     */
+    bool receive(char *data, size_t size);
+
+public:
+    /**
+     * Constructor for the ProcessingClient class, creating a client that is not connected.
+     */
+    ProcessingClient();
+
+    ProcessingClient(const ProcessingClient &) = delete;
+
+    ProcessingClient &operator=(const ProcessingClient &) = delete;
+
+    /**
+     * Destructor for the ProcessingClient class, closing the connection.
+     */
+    ~ProcessingClient();
+
+    /**
+     * Connects to a server, closing any previous connection.
+     *
+     * @param socketPath: The path of the server's Unix domain socket.
+     * @return: A boolean value indicating the success (true) or failure (false) of connecting. On failure an error
+     * message is printed to standard error.
+     */
+    bool connect(const std::string &socketPath);
+
+    /**
+     * Sends a request and waits for its answer.
+     *
+     * @param request: The request line, without a line break.
+     * @param response: Receives the answer.
+     * @return: True if an answer was received, whether OK or ERROR; false if the connection failed, in which case it
+     * is closed.
+     */
+    bool request(const std::string &request, ProcessingResponse &response);
+
+    /**
+     * Closes the connection.
+     */
+    void close();
+};
+
+#endif //ADVANCED_PROGRAMMING_GROUP_RADIX_SORT_PROCESSINGCLIENT_H
@@ -0,0 +1,156 @@
+/**
+ * @file ProcessingServer.h
+ *
+ * @brief Declares the ProcessingServer class, a resident process that serves slices, projections and filtered images.
+ *
+ * Every run of the interactive program loads and decodes its input again, which dominates the time of small requests
+ * such as one slice for a viewer. A ProcessingServer stays running, listens on a Unix domain socket and keeps recently
+ * used volumes and images in memory, evicting the least recently used ones beyond a byte capacity. Connections are
+ * handed to a pool of worker threads through a BoundedQueue, so several clients are served at once; a request is
+ * answered from the cached input, and filtered slices and projections go through a FilteredVolume, so only the slices
+ * a request needs are filtered.
+ *
+ * The protocol is one request per line, with tokens separated by spaces, so paths must not contain spaces:
+ *
+ *   PING
+ *   SLICE <volume> <plane> <index> [filter...]            x-y, x-z or y-z slice, index from 1
+ *   PROJECT <volume> <projector> <begin>:<end>|all [filter...]   MIP, MinIP, AIP or MedIP over x-y slices, from 1
+ *   IMAGE <image> [filter...]
+ *   STATS
+ *   SHUTDOWN
+ *
+ * A volume is a directory of slices or a file read by VolumeFormats, and an image is a file read by Image. Volume
+ * filters are gaussian:<sigma>:<kernelSize> and median:<kernelSize>; image filters are box:<kernelSize>,
+ * gaussian:<sigma>:<kernelSize>, median:<kernelSize>, sobel, prewitt, scharr, roberts, grayscale and
+ * brightness:<change>. Each answer starts with a line "OK <width> <height> <channels> <bytes>" followed by that many
+ * bytes of 8-bit samples, or of text when channels is 0, or is the single line "ERROR <message>".
+ *
+ * @date Created on October 19, 2026
+ *
+ * @authors
+ * Advanced Programming Group Radix Sort:
+ *   - Benjamin Duncan (edsml-bd1023)
+ *   - Boyang Hu (edsml-bh223)
+ *   - Chawk Chamoun (edsml-cc8915)
+ *   - Mingsheng Cai (acse-sc4623)
+ *   - Moyu Zhang (acse-mz223)
+ *   - Ryan Benney (acse-rgb123)
+ */
+
+#pragma once
+
+#ifndef ADVANCED_PROGRAMMING_GROUP_RADIX_SORT_PROCESSINGSERVER_H
+#define ADVANCED_PROGRAMMING_GROUP_RADIX_SORT_PROCESSINGSERVER_H
+
+#include "Image.h"
+#include "Volume.h"
+
+#include <atomic>
+#include <cstddef>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+class ProcessingServer {
+private:
+    // A loaded volume or image
+    struct CachedInput {
+        std::shared_ptr<const Volume> volume; // Set for volumes
+        std::shared_ptr<const Image> image; // Set for images
+        size_t bytes; // Size of the samples
+        std::list<std::string>::iterator position; // Position in recent
+    };
+
+    std::string socketPath; // Path of the listening socket
+    int workers; // Threads serving connections
+    size_t capacityBytes; // Most bytes of inputs kept in memory
+    std::atomic<bool> stopping; // Set by stop to end run
+
+    std::mutex mutex; // Guards the members below
+    std::list<std::string> recent; // Paths of the cached inputs, most recently used first
+    std::unordered_map<std::string, CachedInput> inputs; // Cached inputs by path
+    size_t usedBytes; // Total size of the cached inputs
+    size_t hits, misses; // Requests answered from the cache and requests that loaded their input
+
+    /**
+     * Adds a loaded input to the cache, evicting the least recently used inputs beyond the capacity. Inputs still used
+     * by a request stay alive until the request finishes.
+     */
+    void remember(const std::string &path, CachedInput input);
+
+    /**
+     * Gets a volume from the cache, loading it on a miss.
+     *
+     * @param path: The directory of slices or the volume file.
+     * @param error: Receives the reason when the volume cannot be loaded.
+     * @return: The volume, or nullptr if it cannot be loaded.
+     */
+    std::shared_ptr<const Volume> getVolume(const std::string &path, std::string &error);
+
+    /**
+     * Gets an image from the cache, loading it on a miss, as getVolume does for volumes.
+     */
+    std::shared_ptr<const Image> getImage(const std::string &path, std::string &error);
+
+    /**
+     * Answers one request.
+     *
+     * @param request: The request line without its line break.
+     * @param header: Receives the "OK ..." or "ERROR ..." line, with its line break.
+     * @param payload: Receives the bytes that follow the header.
+     */
+    void handle(const std::string &request, std::string &header, std::vector<unsigned char> &payload);
+
+    /**
+     * Serves the requests of one connection until the client disconnects or the server stops, then closes it.
+     */
+    void serve(int connection);
+
+public:
+    static constexpr size_t defaultCapacityBytes = static_cast<size_t>(1) << 30; // 1 GiB
+
+    /**
+     * Constructor for the ProcessingServer class. The socket is not opened until run is called.
+     *
+     * @param socketPath: The path of the Unix domain socket to listen on; an existing socket there is replaced.
+     * @param workers: The number of connections served at once, at least 1.
+     * @param capacityBytes: The most bytes of volumes and images kept in memory.
+     */
+    explicit ProcessingServer(const std::string &socketPath, int workers = 4,
+                              size_t capacityBytes = defaultCapacityBytes);
+
+    /**
+     * Listens on the socket and serves connections until stop is called or a SHUTDOWN request arrives.
+     *
+     * @return: A boolean value indicating whether the server ran (true) or could not open its socket (false), in
+     * which case an error message is printed to standard error. A file at the socket path that is not a socket is
+     * never removed; run fails instead.
+     */
+    bool run();
+
+    /**
+     * Asks run to return. Requests being answered are finished first; idle connections are closed. May be called
+     * from any thread.
+     */
+    void stop();
+
+    /**
+     * @brief Get the number of requests answered from the cached inputs.
+     */
+    size_t getHits();
+
+    /**
+     * @brief Get the number of requests that loaded their input.
+     */
+    size_t getMisses();
+
+    /**
+     * @brief Get the total size of the cached inputs in bytes.
+     */
+    size_t getCachedBytes();
+};
+
+#endif //ADVANCED_PROGRAMMING_GROUP_RADIX_SORT_PROCESSINGSERVER_H
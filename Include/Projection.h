@@ -28,6 +28,9 @@
 #ifndef ADVANCED_PROGRAMMING_GROUP_RADIX_SORT_PROJECTION_H
 #define ADVANCED_PROGRAMMING_GROUP_RADIX_SORT_PROJECTION_H
 
+#include "BrickedVolume.h"
+#include "VolumeStream.h"
+
 #include <vector>
 
 class Projection {
@@ -114,6 +117,149 @@ public:
      */
     static std::vector<unsigned char>
     medianIntensityProjection(int width, int height, int depth, const unsigned char *data);
+
+    /**
+     * Computes the Maximum Intensity Projection (MIP) of a 16-bit or float 3D volume
+     *
+     * Counterpart of maximumIntensityProjection for unsigned short and float samples. All linear projections share a
+     * single templated implementation that is compiled separately for each sample type, so the inner loops work directly
+     * on the native samples and can be vectorised by the compiler for each of them. The template is instantiated for
+     * unsigned short and float; 8-bit volumes use the non-template overload.
+     *
+     * @param width: The width of the volume.
+     * @param height: The height of the volume.
+     * @param depth: The depth of the volume.
+     * @param data: A pointer to the volume's samples.
+     *
+     * @return: A vector of samples representing the 2D MIP image.
+     */
+    template<typename T>
+    static std::vector<T> maximumIntensityProjection(int width, int height, int depth, const T *data);
+
+    /**
+     * Computes the Minimum Intensity Projection (MinIP) of a 16-bit or float 3D volume
+     *
+     * @param width: The width of the volume.
+     * @param height: The height of the volume.
+     * @param depth: The depth of the volume.
+     * @param data: A pointer to the volume's samples.
+     *
+     * @return: A vector of samples representing the 2D MinIP image.
+     */
+    template<typename T>
+    static std::vector<T> minimumIntensityProjection(int width, int height, int depth, const T *data);
+
+    /**
+     * Computes the Average Intensity Projection (AIP) of a 16-bit or float 3D volume
+     *
+     * 16-bit sums are accumulated in unsigned long and divided with truncation, as for 8-bit volumes, while float sums
+     * are accumulated in double precision and the average is not rounded.
+     *
+     * @param width: The width of the volume.
+     * @param height: The height of the volume.
+     * @param depth: The depth of the volume.
+     * @param data: A pointer to the volume's samples.
+     *
+     * @return: A vector of samples representing the 2D AIP image.
+     */
+    template<typename T>
+    static std::vector<T> averageIntensityProjection(int width, int height, int depth, const T *data);
+
+    /**
+     * Computes the Median Intensity Projection (MedIP) of a 16-bit or float 3D volume
+     *
+     * Selects the same (lower) median element as the 8-bit version, using std::nth_element.
+     *
+     * @param width: The width of the volume.
+     * @param height: The height of the volume.
+     * @param depth: The depth of the volume.
+     * @param data: A pointer to the volume's samples.
+     *
+     * @return: A vector of samples representing the 2D MedIP image.
+     */
+    template<typename T>
+    static std::vector<T> medianIntensityProjection(int width, int height, int depth, const T *data);
+
+    /**
+     * Computes the Maximum Intensity Projection (MIP) of a bricked 3D volume
+     *
+     * Brick-aware counterpart of maximumIntensityProjection. The volume is visited one brick at a time so that every voxel is
+     * read from contiguous memory, and the result is identical to the projection of the equivalent linear volume.
+     *
+     * @param volume: The bricked volume to project.
+     *
+     * @return: A vector of unsigned char representing the 2D MIP image.
+     */
+    static std::vector<unsigned char> maximumIntensityProjection(const BrickedVolume &volume);
+
+    /**
+     * Computes the Minimum Intensity Projection (MinIP) of a bricked 3D volume
+     *
+     * Brick-aware counterpart of minimumIntensityProjection, visiting the volume one brick at a time.
+     *
+     * @param volume: The bricked volume to project.
+     *
+     * @return: A vector of unsigned char representing the 2D MinIP image.
+     */
+    static std::vector<unsigned char> minimumIntensityProjection(const BrickedVolume &volume);
+
+    /**
+     * Computes the Average Intensity Projection (AIP) of a bricked 3D volume
+     *
+     * Brick-aware counterpart of averageIntensityProjection, visiting the volume one brick at a time.
+     *
+     * @param volume: The bricked volume to project.
+     *
+     * @return: A vector of unsigned char representing the 2D AIP image.
+     */
+    static std::vector<unsigned char> averageIntensityProjection(const BrickedVolume &volume);
+
+    /**
+     * Computes the Median Intensity Projection (MedIP) of a bricked 3D volume
+     *
+     * Brick-aware counterpart of medianIntensityProjection. For every column of bricks the z-columns of its pixels are
+     * gathered brick by brick into a small tile, so each brick is read once instead of once per pixel, and the median of
+     * each column is then found with the quickselect algorithm exactly as in the linear version.
+     *
+     * @param volume: The bricked volume to project.
+     *
+     * @return: A vector of unsigned char representing the 2D MedIP image.
+     */
+    static std::vector<unsigned char> medianIntensityProjection(const BrickedVolume &volume);
+
+    /**
+     * Computes the Maximum Intensity Projection (MIP) of a volume streamed from disk
+     *
+     * Reads the slices of the stream one at a time and folds each of them into the projection, so only a single slice and
+     * the projection itself are held in memory. The result is identical to the projection of the loaded volume.
+     *
+     * @param volume: The stream providing the slices.
+     *
+     * @return: A vector of unsigned char representing the 2D MIP image, or an empty vector if a slice cannot be read.
+     */
+    static std::vector<unsigned char> maximumIntensityProjection(const VolumeStream &volume);
+
+    /**
+     * Computes the Minimum Intensity Projection (MinIP) of a volume streamed from disk
+     *
+     * Streaming counterpart of minimumIntensityProjection that holds only one slice in memory at a time.
+     *
+     * @param volume: The stream providing the slices.
+     *
+     * @return: A vector of unsigned char representing the 2D MinIP image, or an empty vector if a slice cannot be read.
+     */
+    static std::vector<unsigned char> minimumIntensityProjection(const VolumeStream &volume);
+
+    /**
+     * Computes the Average Intensity Projection (AIP) of a volume streamed from disk
+     *
+     * Streaming counterpart of averageIntensityProjection that holds only one slice and the running sums in memory.
+     *
+     * @param volume: The stream providing the slices.
+     *
+     * @return: A vector of unsigned char representing the 2D AIP image, or an empty vector if a slice cannot be read.
+     */
+    static std::vector<unsigned char> averageIntensityProjection(const VolumeStream &volume);
 };
 
 #endif //ADVANCED_PROGRAMMING_GROUP_RADIX_SORT_PROJECTION_H
@@ -0,0 +1,142 @@
+/**
+ * @file ProjectionIndex.h
+ *
+ * @brief Declares the ProjectionIndex class, which answers slab projections of a volume without rereading the slab.
+ *
+ * Scrubbing the begin and end of a range projection recomputes MIP, MinIP or AIP over every slice of the slab each time,
+ * so the cost grows with the slab thickness. A ProjectionIndex is built once and then answers any [begin, end] slab in
+ * time that does not depend on the thickness. The slices are grouped into blocks of blockSize slices. For every block it
+ * stores the running sum of all slices before it, so the sum over any run of whole blocks is the difference of two
+ * images. It also keeps a sparse table of the per-block maxima and minima, whose level k holds the maximum and minimum
+ * over 2^k consecutive blocks, so any run of whole blocks is covered by two overlapping entries. The at most
+ * 2 * (blockSize - 1) slices at the ends of a slab that do not fill a whole block are read from the volume itself.
+ *
+ * A query therefore reads O(width * height * blockSize) samples. The index needs about (1 + log2(depth / blockSize)) /
+ * blockSize times the volume size for each of the maxima and minima, plus one sum image per block; a block size of 1
+ * keeps a sum image and sparse table entry for every slice. The index views the volume samples, which must neither
+ * change nor be freed while it is in use.
+ *
+ * @date Created on October 19, 2026
+ *
+ * @authors
+ * Advanced Programming Group Radix Sort:
+ *   - Benjamin Duncan (edsml-bd1023)
+ *   - Boyang Hu (edsml-bh223)
+ *   - Chawk Chamoun (edsml-cc8915)
+ *   - Mingsheng Cai (acse-sc4623)
+ *   - Moyu Zhang (acse-mz223)
+ *   - Ryan Benney (acse-rgb123)
+ */
+
+#pragma once
+
+#ifndef ADVANCED_PROGRAMMING_GROUP_RADIX_SORT_PROJECTIONINDEX_H
+#define ADVANCED_PROGRAMMING_GROUP_RADIX_SORT_PROJECTIONINDEX_H
+
+#include <cstddef>
+#include <type_traits>
+#include <vector>
+
+template<typename T>
+class ProjectionIndex {
+public:
+    // Type of the running sums; integer samples are summed exactly, float samples in double precision
+    using Sum = std::conditional_t<std::is_floating_point_v<T>, double, unsigned long>;
+
+    static constexpr int defaultBlockSize = 16; // Slices per block
+
+private:
+    int width, height, depth; // Size of the indexed volume
+    int blockSize; // Slices per block
+    int blockCount; // Number of whole blocks in the volume
+    const T *data; // Samples of the volume, which stay owned by the caller
+    std::vector<Sum> prefixSums; // Image b holds the sum of the slices before block b, blockCount + 1 images
+    std::vector<std::vector<T>> maxima; // Level k holds the maxima of 2^k consecutive blocks starting at each block
+    std::vector<std::vector<T>> minima; // Level k holds the minima of 2^k consecutive blocks starting at each block
+
+    /**
+     * Checks a slab and splits it into whole blocks and loose slices.
+     *
+     * @param begin: The zero-based index of the first slice of the slab.
+     * @param end: The zero-based index of the last slice of the slab.
+     * @param firstBlock: Set to the first whole block inside the slab.
+     * @param lastBlock: Set to one past the last whole block inside the slab, or to firstBlock if there is none.
+     * @return: True if the slab lies within the volume.
+     */
+    bool splitSlab(int begin, int end, int &firstBlock, int &lastBlock) const;
+
+    /**
+     * Shared implementation of maximum and minimum.
+     *
+     * @param begin: The zero-based index of the first slice of the slab.
+     * @param end: The zero-based index of the last slice of the slab.
+     * @param table: The sparse table of maxima or minima.
+     * @param keepMaximum: Whether the projection keeps the largest or the smallest sample.
+     * @return: The projection, or an empty vector if the slab is invalid.
+     */
+    std::vector<T> extremum(int begin, int end, const std::vector<std::vector<T>> &table, bool keepMaximum) const;
+
+public:
+    /**
+     * Default constructor for the ProjectionIndex class, creating an empty index.
+     */
+    ProjectionIndex();
+
+    /**
+     * Constructor for the ProjectionIndex class, which builds the index of a volume.
+     *
+     * The per-block images are computed in one pass over the volume, split across hardware threads.
+     *
+     * @param width: The width of the volume.
+     * @param height: The height of the volume.
+     * @param depth: The depth of the volume.
+     * @param data: A pointer to the volume's samples, which must outlive the index.
+     * @param blockSize: The number of slices per block.
+     * @throws std::invalid_argument if blockSize is less than 1, or data is null for a non-empty volume.
+     */
+    ProjectionIndex(int width, int height, int depth, const T *data, int blockSize = defaultBlockSize);
+
+    /**
+     * Returns the number of slices per block.
+     */
+    int getBlockSize() const;
+
+    /**
+     * Returns the number of bytes held by the index, not counting the volume it views.
+     */
+    size_t getMemoryUsage() const;
+
+    /**
+     * Computes the Maximum Intensity Projection of the slices begin to end.
+     *
+     * @param begin: The zero-based index of the first slice of the slab.
+     * @param end: The zero-based index of the last slice of the slab.
+     * @return: The same image as Projection::maximumIntensityProjection over the slab, or an empty vector if the slab
+     * is not within 0 <= begin <= end < depth.
+     */
+    std::vector<T> maximum(int begin, int end) const;
+
+    /**
+     * Computes the Minimum Intensity Projection of the slices begin to end.
+     *
+     * @param begin: The zero-based index of the first slice of the slab.
+     * @param end: The zero-based index of the last slice of the slab.
+     * @return: The same image as Projection::minimumIntensityProjection over the slab, or an empty vector if the slab
+     * is not within 0 <= begin <= end < depth.
+     */
+    std::vector<T> minimum(int begin, int end) const;
+
+    /**
+     * Computes the Average Intensity Projection of the slices begin to end.
+     *
+     * Integer samples are averaged with truncation, exactly as Projection::averageIntensityProjection does. Float
+     * averages are the difference of two double-precision running sums and may differ from it in the last bits.
+     *
+     * @param begin: The zero-based index of the first slice of the slab.
+     * @param end: The zero-based index of the last slice of the slab.
+     * @return: The average image, or an empty vector if the slab is not within 0 <= begin <= end < depth.
+     */
+    std::vector<T> average(int begin, int end) const;
+};
+
+#endif //ADVANCED_PROGRAMMING_GROUP_RADIX_SORT_PROJECTIONINDEX_H
@@ -0,0 +1,117 @@
+/**
+ * @file ProjectionKernels.h
+ *
+ * @brief Declares the vectorised inner loops of the 8-bit z-projections and selects them at runtime.
+ *
+ * A z-projection combines every slice of a volume with a 2D accumulator, so its inner loop runs over one contiguous row
+ * band of a slice at a time. For 8-bit volumes the ProjectionKernels class provides that loop for the maximum, the
+ * minimum and the sum, written with SSE2, AVX2 and AVX-512 intrinsics. The widest instruction set supported by the
+ * processor is detected once, and every call is dispatched to the matching kernel, so a single binary runs at full speed
+ * on new machines and still works on old ones. Sums are accumulated in 16-bit lanes, which hold twice as many samples per
+ * register as 32-bit lanes; 257 slices of 255 add up to exactly 65535, so callers flush the partial sums into wider
+ * totals at least every flushInterval slices.
+ *
+ * @date Created on October 19, 2026
+ *
+ * @authors
+ * Advanced Programming Group Radix Sort:
+ *   - Benjamin Duncan (edsml-bd1023)
+ *   - Boyang Hu (edsml-bh223)
+ *   - Chawk Chamoun (edsml-cc8915)
+ *   - Mingsheng Cai (acse-sc4623)
+ *   - Moyu Zhang (acse-mz223)
+ *   - Ryan Benney (acse-rgb123)
+ */
+
+#pragma once
+
+#ifndef ADVANCED_PROGRAMMING_GROUP_RADIX_SORT_PROJECTIONKERNELS_H
+#define ADVANCED_PROGRAMMING_GROUP_RADIX_SORT_PROJECTIONKERNELS_H
+
+#include <cstddef>
+
+enum class SimdLevel {
+    Scalar, // Portable loops
+    SSE2, // 128-bit registers
+    AVX2, // 256-bit registers
+    AVX512 // 512-bit registers, with the AVX-512BW byte and word instructions
+};
+
+class ProjectionKernels {
+public:
+    static constexpr int flushInterval = 257; // Most 8-bit slices a 16-bit partial sum can hold without overflowing
+
+    /**
+     * Returns the widest instruction set supported by the processor.
+     *
+     * @return: The detected level; Scalar on processors other than x86.
+     */
+    static SimdLevel detectedLevel();
+
+    /**
+     * Returns the instruction set the kernels currently dispatch to.
+     *
+     * @return: The active level, which is the detected level unless it has been lowered with setLevel.
+     */
+    static SimdLevel getLevel();
+
+    /**
+     * Selects the instruction set the kernels dispatch to.
+     *
+     * Levels above the detected level are clamped to it. This is used to compare the kernels against each other.
+     *
+     * @param level: The requested level.
+     */
+    static void setLevel(SimdLevel level);
+
+    /**
+     * Returns the name of an instruction set level, e.g. "avx2".
+     */
+    static const char *levelName(SimdLevel level);
+
+    /**
+     * Replaces every accumulator sample by the maximum of itself and the matching source sample.
+     *
+     * @param accumulator: The running maximum, count samples long.
+     * @param source: The samples of one slice band.
+     * @param count: The number of samples.
+     */
+    static void maxInto(unsigned char *accumulator, const unsigned char *source, size_t count);
+
+    /**
+     * Replaces every accumulator sample by the minimum of itself and the matching source sample.
+     *
+     * @param accumulator: The running minimum, count samples long.
+     * @param source: The samples of one slice band.
+     * @param count: The number of samples.
+     */
+    static void minInto(unsigned char *accumulator, const unsigned char *source, size_t count);
+
+    /**
+     * Adds 8-bit samples to 16-bit partial sums.
+     *
+     * The sums wrap around on overflow, so they must be flushed at least every flushInterval calls.
+     *
+     * @param partialSums: The partial sums, count values long.
+     * @param source: The samples of one slice band.
+     * @param count: The number of samples.
+     */
+    static void addInto(unsigned short *partialSums, const unsigned char *source, size_t count);
+
+private:
+    /**
+     * Default constructor for the ProjectionKernels class.
+     *
+     * The constructor is deleted because the class only provides static helpers.
+     */
+    ProjectionKernels() = delete;
+
+    /**
+     * Destructor for the ProjectionKernels class.
+     *
+     * The destructor is deleted because the class only provides static helpers.
+     */
+    ~ProjectionKernels() = delete;
+};
+
+#endif //ADVANCED_PROGRAMMING_GROUP_RADIX_SORT_PROJECTIONKERNELS_H
@@ -0,0 +1,167 @@
+/**
+ * @file Pyramid.h
+ *
+ * @brief Declares multi-resolution pyramids of images and volumes for fast previews.
+ *
+ * Viewers mostly show a downsampled preview, yet every operation otherwise runs on the full-resolution data. The
+ * ImagePyramid and VolumePyramid classes keep a chain of levels, each half the size of the level below it along every
+ * axis, down to a single pixel or voxel. Level 0 is the original image or volume. The other levels are built lazily,
+ * from the level below, the first time they are requested, so a preview at 1/8 scale costs three reductions and the
+ * levels that are never viewed cost nothing. Every level is an ordinary Image or Volume, so Projection, Slice and the
+ * filters run on a chosen level exactly as on the full-resolution data.
+ *
+ * Two reductions are provided. DownsampleMode::Box averages each 2x2 (2x2x2) block. DownsampleMode::Gaussian weights
+ * the four nearest samples along each axis by 1-3-3-1, a binomial approximation of a Gaussian that suppresses the
+ * aliasing box averaging leaves in fine periodic structure. Odd sizes round up and repeat the edge samples. Integer
+ * samples are rounded to nearest. The reductions are split across hardware threads.
+ *
+ * @date Created on October 19, 2026
+ *
+ * @authors
+ * Advanced Programming Group Radix Sort:
+ *   - Benjamin Duncan (edsml-bd1023)
+ *   - Boyang Hu (edsml-bh223)
+ *   - Chawk Chamoun (edsml-cc8915)
+ *   - Mingsheng Cai (acse-sc4623)
+ *   - Moyu Zhang (acse-mz223)
+ *   - Ryan Benney (acse-rgb123)
+ */
+
+#pragma once
+
+#ifndef ADVANCED_PROGRAMMING_GROUP_RADIX_SORT_PYRAMID_H
+#define ADVANCED_PROGRAMMING_GROUP_RADIX_SORT_PYRAMID_H
+
+#include "Image.h"
+#include "Volume.h"
+
+#include <memory>
+#include <vector>
+
+// Filter used to halve a level
+enum class DownsampleMode {
+    Box, // Mean of each 2x2 or 2x2x2 block
+    Gaussian // 1-3-3-1 binomial weights along each axis
+};
+
+class ImagePyramid {
+private:
+    Image &base; // Level 0, owned by the caller
+    DownsampleMode mode; // Filter used to build the other levels
+    std::vector<std::unique_ptr<Image>> levels; // Levels 1 and up; null until built
+
+public:
+    /**
+     * Constructor for the ImagePyramid class.
+     *
+     * No level is built until it is requested. The base image must outlive the pyramid.
+     *
+     * @param base: The full-resolution image, used as level 0.
+     * @param mode: The filter used to halve each level.
+     */
+    explicit ImagePyramid(Image &base, DownsampleMode mode = DownsampleMode::Box);
+
+    /**
+     * Returns the number of levels, from the base image down to a single pixel.
+     */
+    int getLevelCount() const;
+
+    /**
+     * Returns a level, building it and any missing level below it first.
+     *
+     * The returned image may be filtered or saved like any other. Levels are built from the level below as it is at that
+     * time, so after changing a level call invalidate to rebuild the ones above it.
+     *
+     * @param level: The level, from 0 for the base image to getLevelCount() - 1.
+     * @return: The image of the level.
+     * @throws std::out_of_range if level is not a valid level.
+     */
+    Image &getLevel(int level);
+
+    /**
+     * Checks whether a level has been built.
+     *
+     * @param level: The level.
+     * @return: True for level 0 and for every level that has been built and not invalidated since.
+     */
+    bool isLevelBuilt(int level) const;
+
+    /**
+     * Drops every built level from firstLevel upwards, so they are rebuilt from the current data when requested.
+     *
+     * @param firstLevel: The lowest level to drop; levels below 1 are treated as 1.
+     */
+    void invalidate(int firstLevel = 1);
+
+    /**
+     * Halves an image along both axes.
+     *
+     * @param source: The image to reduce. 8-bit, 16-bit and float samples with any number of channels are supported.
+     * @param mode: The filter used for the reduction.
+     * @return: An image of (width + 1) / 2 by (height + 1) / 2 pixels with the same channels and sample type, or an
+     * empty image if source holds no data.
+     */
+    static Image downsample(const Image &source, DownsampleMode mode = DownsampleMode::Box);
+};
+
+class VolumePyramid {
+private:
+    Volume &base; // Level 0, owned by the caller
+    DownsampleMode mode; // Filter used to build the other levels
+    std::vector<std::unique_ptr<Volume>> levels; // Levels 1 and up; null until built
+
+public:
+    /**
+     * Constructor for the VolumePyramid class.
+     *
+     * No level is built until it is requested. The base volume must outlive the pyramid.
+     *
+     * @param base: The full-resolution volume, used as level 0.
+     * @param mode: The filter used to halve each level.
+     */
+    explicit VolumePyramid(Volume &base, DownsampleMode mode = DownsampleMode::Box);
+
+    /**
+     * Returns the number of levels, from the base volume down to a single voxel.
+     */
+    int getLevelCount() const;
+
+    /**
+     * Returns a level, building it and any missing level below it first.
+     *
+     * The returned volume may be filtered, sliced, projected or saved like any other. Levels are built from the level
+     * below as it is at that time, so after changing a level call invalidate to rebuild the ones above it.
+     *
+     * @param level: The level, from 0 for the base volume to getLevelCount() - 1.
+     * @return: The volume of the level.
+     * @throws std::out_of_range if level is not a valid level.
+     */
+    Volume &getLevel(int level);
+
+    /**
+     * Checks whether a level has been built.
+     *
+     * @param level: The level.
+     * @return: True for level 0 and for every level that has been built and not invalidated since.
+     */
+    bool isLevelBuilt(int level) const;
+
+    /**
+     * Drops every built level from firstLevel upwards, so they are rebuilt from the current data when requested.
+     *
+     * @param firstLevel: The lowest level to drop; levels below 1 are treated as 1.
+     */
+    void invalidate(int firstLevel = 1);
+
+    /**
+     * Halves a volume along all three axes.
+     *
+     * @param source: The volume to reduce, with 8-bit, 16-bit or float samples.
+     * @param mode: The filter used for the reduction.
+     * @return: A volume of (width + 1) / 2 by (height + 1) / 2 by (depth + 1) / 2 voxels with the same sample type, which
+     * owns its data, or an empty volume if source holds no data.
+     */
+    static Volume downsample(const Volume &source, DownsampleMode mode = DownsampleMode::Box);
+};
+
+#endif //ADVANCED_PROGRAMMING_GROUP_RADIX_SORT_PYRAMID_H
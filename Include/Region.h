@@ -0,0 +1,114 @@
+/**
+ * @file Region.h
+ *
+ * @brief Declares regions of interest and the helper that runs a filter on a region of an image or volume.
+ *
+ * Filtering the whole of a large image or volume is wasted work when only a region around a feature is needed. The
+ * Region2D and Region3D structs describe an axis-aligned rectangle or box, and the ROI overloads of the filters pass them
+ * to the Region class. It copies the region plus a halo of the filter's reach on every side into a temporary image or
+ * volume, runs the filter on that crop, and writes back only the region. Inside the image the halo holds the real
+ * neighbours, so the region is filtered exactly as it would be in a full run. Where the halo reaches the edge of the
+ * image it is cut off, so the crop edge is the image edge and the filter pads it with its own PaddingType, again as in a
+ * full run. The cost is that of filtering the region plus its halo.
+ *
+ * @date Created on October 19, 2026
+ *
+ * @authors
+ * Advanced Programming Group Radix Sort:
+ *   - Benjamin Duncan (edsml-bd1023)
+ *   - Boyang Hu (edsml-bh223)
+ *   - Chawk Chamoun (edsml-cc8915)
+ *   - Mingsheng Cai (acse-sc4623)
+ *   - Moyu Zhang (acse-mz223)
+ *   - Ryan Benney (acse-rgb123)
+ */
+
+#pragma once
+
+#ifndef ADVANCED_PROGRAMMING_GROUP_RADIX_SORT_REGION_H
+#define ADVANCED_PROGRAMMING_GROUP_RADIX_SORT_REGION_H
+
+#include "Image.h"
+#include "Volume.h"
+
+#include <functional>
+
+// Axis-aligned rectangle of an image, in pixels
+struct Region2D {
+    int x, y; // Top-left pixel
+    int width, height; // Size of the region
+};
+
+// Axis-aligned box of a volume, in voxels
+struct Region3D {
+    int x, y, z; // Voxel with the smallest coordinates
+    int width, height, depth; // Size of the region
+};
+
+class Region {
+public:
+    /**
+     * Checks that a region is non-empty and lies inside an image.
+     *
+     * @param region: The region.
+     * @param image: The image.
+     * @return: True if the region is valid for the image.
+     */
+    static bool isValid(const Region2D &region, const Image &image);
+
+    /**
+     * Checks that a region is non-empty and lies inside a volume.
+     *
+     * @param region: The region.
+     * @param volume: The volume.
+     * @return: True if the region is valid for the volume.
+     */
+    static bool isValid(const Region3D &region, const Volume &volume);
+
+    /**
+     * Runs a filter on a region of an image.
+     *
+     * The filter is applied to a copy of the region extended by halo pixels on every side, clipped to the image, and only
+     * the region is copied back. Pixels outside the region are neither changed nor, beyond the halo, read. If the region is
+     * invalid, or the filter changes the size, channels or sample type of the crop, an error is printed and the image is
+     * left unchanged.
+     *
+     * @param image: The image to filter.
+     * @param region: The region to filter.
+     * @param halo: The farthest distance, in pixels, from which the filter reads neighbours.
+     * @param filter: Applies the filter to the crop in place.
+     */
+    static void apply(Image &image, const Region2D &region, int halo, const std::function<void(Image &)> &filter);
+
+    /**
+     * Runs a filter on a region of a volume.
+     *
+     * The filter is applied to a copy of the region extended by halo voxels on every side, clipped to the volume, and only
+     * the region is copied back. Voxels outside the region are neither changed nor, beyond the halo, read. The projection
+     * index of the volume is dropped. If the region is invalid, or the filter changes the size or sample type of the crop,
+     * an error is printed and the volume is left unchanged.
+     *
+     * @param volume: The volume to filter.
+     * @param region: The region to filter.
+     * @param halo: The farthest distance, in voxels, from which the filter reads neighbours.
+     * @param filter: Applies the filter to the crop in place.
+     */
+    static void apply(Volume &volume, const Region3D &region, int halo, const std::function<void(Volume &)> &filter);
+
+private:
+    /**
+     * Default constructor for the Region class.
+     *
+     * The constructor is deleted because the class only provides static helpers.
+     */
+    Region() = delete;
+
+    /**
+     * Destructor for the Region class.
+     *
+     * The destructor is deleted because the class only provides static helpers.
+     */
+    ~Region() = delete;
+};
+
+#endif //ADVANCED_PROGRAMMING_GROUP_RADIX_SORT_REGION_H
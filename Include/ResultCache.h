@@ -0,0 +1,241 @@
+/**
+ * @file ResultCache.h
+ *
+ * @brief Declares the ResultCache class, an on-disk cache of intermediate volumes and images keyed by their content.
+ *
+ * Filter chains are often rerun on the same input while only their last stages are tuned. A ResultCache stores the
+ * result of every stage of a chain under a 64-bit key derived from the input and the stages that produced it: the key
+ * of the input is a hash of its samples and shape, or of a manifest of its files, and each stage extends the key of its
+ * input with its description, such as IFilter3D::describe(). Running a chain looks for the longest prefix of the chain
+ * whose result is cached, loads it and only computes the stages after it, so rerunning a five-stage chain whose last
+ * stage changed loads the fourth result and runs one filter.
+ *
+ * Entries are raw files, a short header followed by the samples, so loading one is a single read. The cache keeps the
+ * total size of its entries within a capacity by deleting the least recently used entries; the order is kept in the
+ * files' modification times, so it survives between runs. Entries are written to a temporary file and renamed, so
+ * several processes can share a directory without reading half-written entries.
+ *
+ * @date Created on October 19, 2026
+ *
+ * @authors
+ * Advanced Programming Group Radix Sort:
+ *   - Benjamin Duncan (edsml-bd1023)
+ *   - Boyang Hu (edsml-bh223)
+ *   - Chawk Chamoun (edsml-cc8915)
+ *   - Mingsheng Cai (acse-sc4623)
+ *   - Moyu Zhang (acse-mz223)
+ *   - Ryan Benney (acse-rgb123)
+ */
+
+#pragma once
+
+#ifndef ADVANCED_PROGRAMMING_GROUP_RADIX_SORT_RESULTCACHE_H
+#define ADVANCED_PROGRAMMING_GROUP_RADIX_SORT_RESULTCACHE_H
+
+#include "Buffer.h"
+#include "Image.h"
+#include "Volume.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <list>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+// One stage of a cached chain
+template<typename Data>
+struct CachedStage {
+    std::string description; // Names the stage and every parameter that affects its output; empty if not reproducible
+    std::function<void(Data &)> apply; // Processes the data in place
+};
+
+class ResultCache {
+private:
+    // Shape of a cached volume or image
+    struct Shape {
+        std::uint32_t kind; // 0 for a volume, 1 for an image
+        std::int32_t width, height, depthOrChannels;
+        std::uint32_t dataType;
+    };
+
+    // A cached result
+    struct Entry {
+        size_t bytes; // Size of the file
+        std::list<std::uint64_t>::iterator position; // Position in recent
+    };
+
+    std::string directory; // Directory holding the entries
+    size_t capacityBytes; // Most bytes kept
+    size_t usedBytes; // Total size of the entries
+    std::list<std::uint64_t> recent; // Keys of the entries, most recently used first
+    std::unordered_map<std::uint64_t, Entry> entries; // Entries by key
+    std::mutex mutex; // Guards the index above
+
+    /**
+     * Gets the path of the file of an entry, its key as 16 hexadecimal digits with the extension ".raw".
+     */
+    std::string pathOf(std::uint64_t key) const;
+
+    /**
+     * Deletes the least recently used entries while the total size exceeds the capacity. The caller holds mutex.
+     *
+     * @param keep: The number of most recently used entries never deleted, so that an entry just used stays.
+     */
+    void evict(size_t keep);
+
+    /**
+     * Reads an entry.
+     *
+     * @param key: The key of the entry.
+     * @param shape: Receives the shape of the cached data.
+     * @param data: Receives the samples.
+     * @return: True if the entry was found and read; a missing or damaged file, including one whose header does not
+     * match its size, is dropped from the index.
+     */
+    bool read(std::uint64_t key, Shape &shape, Buffer &data);
+
+    /**
+     * Writes an entry and deletes the least recently used entries beyond the capacity.
+     *
+     * @param key: The key of the entry.
+     * @param shape: The shape of the data.
+     * @param data: The samples.
+     * @param bytes: The number of bytes of samples.
+     * @return: A boolean value indicating the success (true) or failure (false) of writing the entry. Data larger
+     * than the capacity is not stored.
+     */
+    bool write(std::uint64_t key, const Shape &shape, const unsigned char *data, size_t bytes);
+
+    /**
+     * Runs a chain of stages, starting from the longest prefix whose result is cached.
+     */
+    template<typename Data>
+    size_t runStages(Data &data, std::uint64_t inputKey, const std::vector<CachedStage<Data>> &stages);
+
+public:
+    static constexpr size_t defaultCapacityBytes = static_cast<size_t>(4) << 30; // 4 GiB
+
+    /**
+     * Constructor for the ResultCache class, opening or creating a cache directory.
+     *
+     * Entries already in the directory are indexed, least recently used first by modification time, and the oldest are
+     * deleted if they exceed the capacity.
+     *
+     * @param directory: The directory holding the entries, created if needed.
+     * @param capacityBytes: The most bytes of entries to keep.
+     */
+    explicit ResultCache(const std::string &directory, size_t capacityBytes = defaultCapacityBytes);
+
+    /**
+     * Hashes a block of memory.
+     *
+     * The hash is the 64-bit MurmurHash2 of the bytes, which reads eight bytes per step.
+     *
+     * @param data: The bytes to hash.
+     * @param size: The number of bytes.
+     * @param seed: The seed, e.g. the hash of preceding data.
+     * @return: The hash.
+     */
+    static std::uint64_t hash(const void *data, size_t size, std::uint64_t seed = 0);
+
+    /**
+     * Computes the key of a volume from its shape, sample type and samples. The samples are hashed in 1 MiB chunks on
+     * all hardware threads.
+     */
+    static std::uint64_t keyOf(const Volume &volume);
+
+    /**
+     * Computes the key of an image from its shape, sample type and samples.
+     */
+    static std::uint64_t keyOf(const Image &image);
+
+    /**
+     * Computes the key of an input from a manifest of its files, without reading them.
+     *
+     * @param paths: The files of the input, in order.
+     * @return: A hash of every path with the size and modification time of its file, so that changing a file changes
+     * the key.
+     */
+    static std::uint64_t keyOfFiles(const std::vector<std::string> &paths);
+
+    /**
+     * Computes the key of the result of a stage.
+     *
+     * @param key: The key of the stage's input.
+     * @param description: The description of the stage.
+     * @return: The key of the stage's output.
+     */
+    static std::uint64_t extend(std::uint64_t key, const std::string &description);
+
+    /**
+     * Creates a stage from a filter, described by its describe method and applied to the whole volume or image.
+     *
+     * @param filter: The filter. It is not copied and must outlive the stage.
+     */
+    template<typename Data, typename Filter>
+    static CachedStage<Data> stage(Filter &filter) {
+        return {filter.describe(), [&filter](Data &data) { filter.apply(data); }};
+    }
+
+    /**
+     * Loads a cached volume.
+     *
+     * @param key: The key of the volume.
+     * @param volume: Replaced by the cached volume if it is found.
+     * @return: True if the volume was found, which marks it as the most recently used entry.
+     */
+    bool load(std::uint64_t key, Volume &volume);
+
+    /**
+     * Loads a cached image, as load(key, volume) does for volumes.
+     */
+    bool load(std::uint64_t key, Image &image);
+
+    /**
+     * Stores a volume, replacing any entry with the same key.
+     *
+     * @param key: The key of the volume.
+     * @param volume: The volume.
+     * @return: A boolean value indicating the success (true) or failure (false) of storing the volume. On failure an
+     * error message is printed to standard error.
+     */
+    bool store(std::uint64_t key, const Volume &volume);
+
+    /**
+     * Stores an image, as store(key, volume) does for volumes.
+     */
+    bool store(std::uint64_t key, const Image &image);
+
+    /**
+     * Runs a chain of stages on a volume, skipping the stages whose result is cached.
+     *
+     * The result of every stage that is computed is stored, so that later runs can resume from it. A stage with an
+     * empty description is not reproducible, so it and every stage after it are always computed and never stored.
+     *
+     * @param volume: The input, replaced by the output of the last stage.
+     * @param inputKey: The key of the input.
+     * @param stages: The stages, in order.
+     * @return: The number of leading stages whose result was loaded instead of computed.
+     */
+    size_t run(Volume &volume, std::uint64_t inputKey, const std::vector<CachedStage<Volume>> &stages);
+
+    /**
+     * Runs a chain of stages on an image, as run does for volumes.
+     */
+    size_t run(Image &image, std::uint64_t inputKey, const std::vector<CachedStage<Image>> &stages);
+
+    /**
+     * @brief Get the total size of the entries in bytes.
+     */
+    size_t getUsedBytes();
+
+    /**
+     * @brief Get the number of entries.
+     */
+    size_t getEntryCount();
+};
+
+#endif //ADVANCED_PROGRAMMING_GROUP_RADIX_SORT_RESULTCACHE_H
@@ -29,6 +29,7 @@
 #define ADVANCED_PROGRAMMING_GROUP_RADIX_SORT_SLICE_H
 
 #include "Volume.h"
+#include "BrickedVolume.h"
 
 #include <vector>
 #include <string>
@@ -59,6 +60,42 @@ public:
     getPlaneSlice(int width, int height, int depth, const unsigned char *data, const std::string &plane,
                   int sliceIndex);
 
+    /**
+     * Retrieves a specific slice from a 16-bit or float 3D volume
+     *
+     * Counterpart of getPlaneSlice for volumes stored as unsigned short or float samples, with the same validation rules and
+     * layout. The template is instantiated for unsigned short and float; 8-bit volumes use the non-template overload.
+     *
+     * @param width: The width of the volume.
+     * @param height: The height of the volume.
+     * @param depth: The depth of the volume.
+     * @param data: A pointer to the volume's samples.
+     * @param plane: A string specifying the plane of the slice ('x-y', 'x-z', 'y-z').
+     * @param sliceIndex: An integer indicating the index of the slice to retrieve, starting from 1.
+     *
+     * @return: A vector containing the samples of the requested slice. Returns an empty vector if an error occurs.
+     */
+    template<typename T>
+    static std::vector<T>
+    getPlaneSlice(int width, int height, int depth, const T *data, const std::string &plane, int sliceIndex);
+
+    /**
+     * Retrieves a specific slice from a bricked 3D volume
+     *
+     * This overload extracts the same slice as getPlaneSlice for a volume stored in the bricked layout. Rows along the x-axis
+     * are copied one brick row at a time, and 'y-z' slices are gathered brick by brick so that only the bricks intersecting
+     * the requested plane are touched. The result is laid out exactly as for the linear overload, and the same validation
+     * rules and error messages apply.
+     *
+     * @param volume: The bricked volume to slice.
+     * @param plane: A string specifying the plane of the slice ('x-y', 'x-z', 'y-z').
+     * @param sliceIndex: An integer indicating the index of the slice to retrieve, starting from 1.
+     *
+     * @return: A vector of unsigned char containing the data of the requested slice. Returns an empty vector if an error occurs.
+     */
+    static std::vector<unsigned char>
+    getPlaneSlice(const BrickedVolume &volume, const std::string &plane, int sliceIndex);
+
 private:
     /**
      * Default constructor for the Slice class.
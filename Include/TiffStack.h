@@ -0,0 +1,149 @@
+/**
+ * @file TiffStack.h
+ *
+ * @brief Declares the TiffStack class, which reads multi-page TIFF files as volumes.
+ *
+ * Microscopy and micro-CT scanners usually write a stack as a single multi-page TIFF file, one page per x-y slice. A
+ * TiffStack maps the file into memory and indexes its pages when it is opened. Pages may be stored in strips or tiles,
+ * uncompressed or compressed with PackBits or LZW (with or without horizontal differencing), in either byte order.
+ *
+ * Every strip or tile is decoded independently, so load decodes the strips of all pages in parallel and writes each
+ * one straight to its place in the Volume buffer, and readPage decodes just the strips of one page for jobs that only
+ * need a slice.
+ *
+ * Pages must hold one grey-scale sample per pixel (black or white is zero) of unsigned 8-bit, unsigned 16-bit or
+ * 32-bit float data; colour, palette and signed pages and other compressions are reported as unsupported.
+ *
+ * @date Created on October 19, 2026
+ *
+ * @authors
+ * Advanced Programming Group Radix Sort:
+ *   - Benjamin Duncan (edsml-bd1023)
+ *   - Boyang Hu (edsml-bh223)
+ *   - Chawk Chamoun (edsml-cc8915)
+ *   - Mingsheng Cai (acse-sc4623)
+ *   - Moyu Zhang (acse-mz223)
+ *   - Ryan Benney (acse-rgb123)
+ */
+
+#pragma once
+
+#ifndef ADVANCED_PROGRAMMING_GROUP_RADIX_SORT_TIFFSTACK_H
+#define ADVANCED_PROGRAMMING_GROUP_RADIX_SORT_TIFFSTACK_H
+
+#include "MappedFile.h"
+#include "Volume.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+class TiffStack {
+private:
+    // Layout of one page and the location of its strips or tiles
+    struct Page {
+        int width, height; // Size of the page
+        DataType dataType; // Type of the samples
+        int compression; // noCompression, lzwCompression or packBitsCompression
+        bool predictor; // True if rows are stored as differences between neighbouring samples
+        bool whiteIsZero; // True if samples are stored inverted
+        int segmentWidth, segmentHeight; // Size of a tile, or the page width and rows per strip
+        int segmentsAcross; // Number of tiles per row of tiles, or 1 for strips
+        std::vector<uint32_t> offsets; // Start of every strip or tile in the file
+        std::vector<uint32_t> byteCounts; // Stored size of every strip or tile
+    };
+
+    MappedFile file; // The mapped file
+    bool bigEndian; // True if the file is in Motorola byte order
+    std::vector<Page> pages; // Pages in file order
+
+    /**
+     * Reads the directory of one page.
+     *
+     * @param offset: The position of the directory in the file.
+     * @param page: Filled with the layout of the page.
+     * @param next: Set to the position of the next directory, or 0 after the last page.
+     * @return: True if the directory describes a supported page; otherwise an error message is printed.
+     */
+    bool readDirectory(size_t offset, Page &page, size_t &next) const;
+
+    /**
+     * Decodes one strip or tile into its place in a page.
+     *
+     * @param page: The page that holds the strip or tile.
+     * @param segment: The index of the strip or tile.
+     * @param out: The first sample of the page, width * height samples.
+     * @param scratch: Working memory for tiles that overhang the page.
+     * @return: True if the strip or tile decoded to its full size.
+     */
+    bool decodeSegment(const Page &page, size_t segment, unsigned char *out, std::vector<unsigned char> &scratch) const;
+
+public:
+    static constexpr int noCompression = 1; // TIFF compression tag value of uncompressed data
+    static constexpr int lzwCompression = 5; // TIFF compression tag value of LZW
+    static constexpr int packBitsCompression = 32773; // TIFF compression tag value of PackBits
+
+    /**
+     * Default constructor for the TiffStack class, creating a closed file.
+     */
+    TiffStack();
+
+    /**
+     * Opens a TIFF file and indexes its pages.
+     *
+     * No page is decoded. If the file cannot be read, is not a TIFF file, or holds a page this class cannot decode,
+     * an error message is printed to standard error and the file is left closed.
+     *
+     * @param path: The path of the .tif or .tiff file.
+     * @return: A boolean value indicating the success (true) or failure (false) of opening the file.
+     */
+    bool open(const std::string &path);
+
+    /**
+     * Checks whether a file is open.
+     */
+    bool isOpen() const;
+
+    /**
+     * @brief Get the number of pages, i.e. the depth of the volume.
+     */
+    int getPageCount() const;
+
+    /**
+     * @brief Get the width of the first page.
+     */
+    int getWidth() const;
+
+    /**
+     * @brief Get the height of the first page.
+     */
+    int getHeight() const;
+
+    /**
+     * @brief Get the sample type of the first page.
+     */
+    DataType getDataType() const;
+
+    /**
+     * Decodes one page, with its strips or tiles decoded in parallel.
+     *
+     * @param index: The zero-based index of the page.
+     * @param out: The destination, width * height samples of the page x fastest.
+     * @return: A boolean value indicating the success (true) or failure (false) of decoding the page.
+     */
+    bool readPage(int index, unsigned char *out) const;
+
+    /**
+     * Decodes every page into a volume, one page per x-y slice.
+     *
+     * The strips or tiles of all pages are decoded in parallel straight into the volume buffer. All pages must have
+     * the size and sample type of the first page.
+     *
+     * @param volume: Replaced by the loaded volume on success and left unchanged on failure.
+     * @return: A boolean value indicating the success (true) or failure (false) of loading the volume.
+     */
+    bool load(Volume &volume) const;
+};
+
+#endif //ADVANCED_PROGRAMMING_GROUP_RADIX_SORT_TIFFSTACK_H
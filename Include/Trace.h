@@ -0,0 +1,214 @@
+/**
+ * @file Trace.h
+ *
+ * @brief Records per-stage timings of filters, projections, loads and saves as Chrome trace events.
+ *
+ * Every apply, load, save and projection, as well as the individual passes of the 3D filters, opens a TRACE_SCOPE that
+ * measures its wall time together with the number of bytes it reads and writes. Parallel loops additionally record one
+ * event per worker chunk and the utilisation of the threads they used, defined as the busy time of the chunks divided
+ * by the number of threads times the wall time of the loop. The events can be inspected in code with Trace::getEvents
+ * or written as a Chrome trace JSON file, which chrome://tracing and Perfetto display as a timeline with one lane per
+ * thread.
+ *
+ * Tracing is off by default, and a disabled scope costs a single relaxed atomic load. It is switched on with
+ * Trace::setEnabled or, without changing the program, by setting the MDIP_TRACE environment variable to a file name:
+ * the trace is then recorded from start-up and written to that file when the program exits. Configuring with
+ * -DMDIP_TRACING=OFF removes the scopes at compile time.
+ *
+ * @date Created on October 19, 2026
+ *
+ * @authors
+ * Advanced Programming Group Radix Sort:
+ *   - Benjamin Duncan (edsml-bd1023)
+ *   - Boyang Hu (edsml-bh223)
+ *   - Chawk Chamoun (edsml-cc8915)
+ *   - Mingsheng Cai (acse-sc4623)
+ *   - Moyu Zhang (acse-mz223)
+ *   - Ryan Benney (acse-rgb123)
+ */
+
+#pragma once
+
+#ifndef ADVANCED_PROGRAMMING_GROUP_RADIX_SORT_TRACE_H
+#define ADVANCED_PROGRAMMING_GROUP_RADIX_SORT_TRACE_H
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <ostream>
+#include <string>
+#include <vector>
+
+// One completed stage
+struct TraceEvent {
+    const char *name; // Stage name, a string literal
+    const char *category; // "filter", "projection", "io" or "parallel"
+    long long startNs; // Start time since the first traced event, in nanoseconds
+    long long durationNs; // Wall time of the stage, in nanoseconds
+    size_t bytes; // Bytes read and written by the stage, 0 if unknown
+    unsigned int threadId; // Small sequential id of the recording thread
+    unsigned int threads; // Threads used by a parallel loop, 0 otherwise
+    double utilisation; // Busy fraction of those threads, 0 otherwise
+};
+
+class Trace {
+public:
+    /**
+     * Enables or disables recording.
+     *
+     * @param enable: Whether scopes opened from now on are recorded.
+     */
+    static void setEnabled(bool enable);
+
+    /**
+     * Returns whether scopes are currently recorded.
+     *
+     * @return: True if tracing is enabled.
+     */
+    static bool isEnabled() {
+#ifdef MDIP_DISABLE_TRACING
+        return false;
+#else
+        return enabled.load(std::memory_order_relaxed);
+#endif
+    }
+
+    /**
+     * Discards all recorded events.
+     */
+    static void clear();
+
+    /**
+     * Returns a copy of the recorded events, in the order in which the stages finished.
+     *
+     * @return: The recorded events.
+     */
+    static std::vector<TraceEvent> getEvents();
+
+    /**
+     * Writes the recorded events in the Chrome trace event format.
+     *
+     * Each event becomes a complete ("X") event with its bytes, thread count and utilisation as arguments.
+     *
+     * @param out: The stream to write the JSON document to.
+     */
+    static void writeChromeTrace(std::ostream &out);
+
+    /**
+     * Writes the recorded events to a Chrome trace JSON file.
+     *
+     * @param path: The file to write.
+     *
+     * @return: A boolean value indicating the success (true) or failure (false) of the operation.
+     */
+    static bool saveChromeTrace(const std::string &path);
+
+    /**
+     * Adds a completed event; used by ScopedTimer.
+     *
+     * @param event: The event to store.
+     */
+    static void record(const TraceEvent &event);
+
+    /**
+     * Converts a time point to nanoseconds since the trace epoch.
+     *
+     * @param time: A steady clock time point.
+     *
+     * @return: The number of nanoseconds since the first call of this function.
+     */
+    static long long sinceEpoch(std::chrono::steady_clock::time_point time);
+
+    /**
+     * Returns the small sequential id of the calling thread.
+     *
+     * @return: 0 for the first thread that asks, 1 for the second, and so on.
+     */
+    static unsigned int currentThreadId();
+
+private:
+    static std::atomic<bool> enabled; // Whether scopes are recorded
+
+    /**
+     * Default constructor for the Trace class.
+     *
+     * The constructor is deleted because the class only provides static helpers.
+     */
+    Trace() = delete;
+
+    /**
+     * Destructor for the Trace class.
+     *
+     * The destructor is deleted because the class only provides static helpers.
+     */
+    ~Trace() = delete;
+};
+
+class ScopedTimer {
+private:
+    bool active; // Whether tracing was enabled when the scope opened
+    const char *name; // Stage name
+    const char *category; // Stage category
+    size_t bytes; // Bytes read and written by the stage
+    unsigned int threads; // Threads used, for parallel loops
+    double utilisation; // Busy fraction of those threads
+    std::chrono::steady_clock::time_point start; // Time at which the scope opened
+
+public:
+    /**
+     * Opens a timed scope.
+     *
+     * Nothing is measured when tracing is disabled.
+     *
+     * @param name: The stage name; must be a string literal or otherwise outlive the trace.
+     * @param category: The stage category; must also outlive the trace.
+     * @param bytes: The number of bytes the stage reads and writes.
+     */
+    ScopedTimer(const char *name, const char *category, size_t bytes = 0)
+            : active(Trace::isEnabled()), name(name), category(category), bytes(bytes), threads(0), utilisation(0.0) {
+        if (active) {
+            start = std::chrono::steady_clock::now();
+        }
+    }
+
+    /**
+     * Closes the scope and records its event.
+     */
+    ~ScopedTimer() {
+        if (active) {
+            finish();
+        }
+    }
+
+    ScopedTimer(const ScopedTimer &) = delete;
+    ScopedTimer &operator=(const ScopedTimer &) = delete;
+
+    /**
+     * Records the thread usage of a parallel loop.
+     *
+     * @param threadCount: The number of threads that ran the loop.
+     * @param busyFraction: Their busy time divided by threadCount times the wall time.
+     */
+    void setUtilisation(unsigned int threadCount, double busyFraction) {
+        threads = threadCount;
+        utilisation = busyFraction;
+    }
+
+private:
+    /**
+     * Measures the elapsed time and records the event.
+     */
+    void finish();
+};
+
+#define MDIP_TRACE_CONCAT_IMPL(a, b) a##b
+#define MDIP_TRACE_CONCAT(a, b) MDIP_TRACE_CONCAT_IMPL(a, b)
+
+// Times the rest of the enclosing block: TRACE_SCOPE(name, category[, bytes])
+#ifdef MDIP_DISABLE_TRACING
+#define TRACE_SCOPE(...) ((void) 0)
+#else
+#define TRACE_SCOPE(...) ScopedTimer MDIP_TRACE_CONCAT(traceScope, __LINE__)(__VA_ARGS__)
+#endif
+
+#endif //ADVANCED_PROGRAMMING_GROUP_RADIX_SORT_TRACE_H
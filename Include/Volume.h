@@ -29,6 +29,10 @@
 #ifndef ADVANCED_PROGRAMMING_GROUP_RADIX_SORT_VOLUME_H
 #define ADVANCED_PROGRAMMING_GROUP_RADIX_SORT_VOLUME_H
 
+#include "Buffer.h"
+#include "DataType.h"
+#include "ProjectionIndex.h"
+
 #include <vector>
 #include <optional>
 #include <variant>
@@ -37,7 +41,12 @@
 class Volume {
 private:
     int width, height, depth; // Size of the volume
-    unsigned char *data; // Volume data
+    Buffer data; // Volume data, either owned by the volume or a view of memory owned by the caller
+    Buffer spare; // Second buffer of the ping-pong pair, kept between filters in double-buffer mode
+    bool doubleBuffering; // Whether buffers replaced by updateData are kept as the spare
+    DataType dataType; // Type of the samples stored in data
+    std::variant<std::monostate, ProjectionIndex<unsigned char>, ProjectionIndex<unsigned short>,
+            ProjectionIndex<float>> projectionIndex; // Slab projection index, empty until buildProjectionIndex is called
 
     /**
      * @brief Load volume data from a single file.
@@ -59,6 +68,41 @@ private:
      */
     Volume &operator=(const Volume &) = delete;
 
+    /**
+     * @brief Replace the volume data with samples of the given type.
+     *
+     * Shared implementation of the updateData overloads. The existing buffer is reused when it already holds samples of
+     * the same size; otherwise a new buffer is allocated for the new type.
+     *
+     * @param newData A pointer to the new samples.
+     * @param count The number of samples, which must equal width * height * depth.
+     * @param type The type of the new samples.
+     */
+    void assignData(const void *newData, size_t count, DataType type);
+
+    /**
+     * @brief Extract a slice and convert it to 8-bit samples for saving.
+     *
+     * @param plane The plane of the slice ('x-y', 'x-z', 'y-z').
+     * @param sliceIndex The index of the slice, starting from 1.
+     *
+     * @return The 8-bit slice, or an empty vector if the slice is invalid.
+     */
+    std::vector<unsigned char> getSliceUInt8(const std::string &plane, int sliceIndex) const;
+
+    /**
+     * @brief Compute a z-projection over a range of slices and convert it to 8-bit samples for saving.
+     *
+     * The projection is computed in the volume's own sample type, so no precision is lost before the final conversion.
+     *
+     * @param projector The projection to compute ('MIP', 'MinIP', 'AIP' or 'MedIP').
+     * @param begin The zero-based index of the first slice of the range.
+     * @param end The zero-based index of the last slice of the range.
+     *
+     * @return The 8-bit projection, or an empty vector if the projector is invalid.
+     */
+    std::vector<unsigned char> getProjectionUInt8(const std::string &projector, int begin, int end) const;
+
 public:
     /**
      * @brief Default constructor for the Volume class.
@@ -81,7 +125,8 @@ public:
     /**
      * @brief Constructor for the Volume class.
      *
-     * This constructor initializes a Volume object with the specified width, height, depth, and data.
+     * This constructor initializes a Volume object with the specified width, height, depth, and data. The volume only
+     * views data, which stays owned by the caller and must outlive the volume; filters write their results into it.
      *
      * @param width The width of the volume.
      * @param height The height of the volume.
@@ -90,10 +135,47 @@ public:
      */
     Volume(int width, int height, int depth, unsigned char *data);
 
+    /**
+     * @brief Constructor for the Volume class taking over a buffer.
+     *
+     * The volume takes ownership of data, which must hold width * height * depth samples of the given type. This lets
+     * functions build a volume in a buffer and return it by value without copying the samples.
+     *
+     * @param width The width of the volume.
+     * @param height The height of the volume.
+     * @param depth The depth of the volume.
+     * @param data The buffer holding the volume data.
+     * @param dataType The type of the samples in data.
+     * @throws std::invalid_argument if the buffer size does not match the dimensions, or if the dimensions are negative
+     * or their size in bytes overflows.
+     */
+    Volume(int width, int height, int depth, Buffer &&data, DataType dataType = DataType::UInt8);
+
+    /**
+     * @brief Move constructor for the Volume class.
+     *
+     * Takes over the dimensions and data buffer of other without copying any samples. The moved-from volume is left
+     * empty.
+     *
+     * @param other The volume to move from.
+     */
+    Volume(Volume &&other) noexcept;
+
+    /**
+     * @brief Move assignment operator for the Volume class.
+     *
+     * Releases the current data buffer and takes over the dimensions and data buffer of other.
+     *
+     * @param other The volume to move from.
+     *
+     * @return The assigned volume.
+     */
+    Volume &operator=(Volume &&other) noexcept;
+
     /**
      * @brief Destructor for the Volume class.
      *
-     * This destructor deallocates the memory used by the volume data.
+     * This destructor deallocates the memory used by the volume data if the volume owns it.
      */
     ~Volume();
 
@@ -133,10 +215,30 @@ public:
      */
     unsigned char *getData() const;
 
+    /**
+     * @brief Get the type of the samples stored in the volume.
+     *
+     * @return The sample type of the volume data.
+     */
+    DataType getDataType() const;
+
+    /**
+     * @brief Get the volume data as samples of type T.
+     *
+     * T must match the sample type reported by getDataType, i.e. unsigned char, unsigned short or float.
+     *
+     * @return A pointer to the volume data.
+     */
+    template<typename T>
+    T *getDataAs() const {
+        return reinterpret_cast<T *>(data.getData());
+    }
+
     /**
      * @brief Get the voxel value at the specified coordinates.
      *
-     * This function returns the voxel value at the specified coordinates.
+     * This function returns the voxel value at the specified coordinates. 16-bit and float samples are converted to 8
+     * bits as for display; use getDataAs to read them at full precision.
      *
      * @param x The x-coordinate of the voxel.
      * @param y The y-coordinate of the voxel.
@@ -189,21 +291,132 @@ public:
      */
     void updateData(const std::vector<unsigned char> &newData);
 
+    /**
+     * Updates the volume data with 16-bit or float samples
+     *
+     * Typed counterpart of updateData. The sample type of the volume becomes the element type of newData, so filters can
+     * write back their results without converting to 8 bits.
+     *
+     * @param newData: A constant reference to a vector of unsigned short or float samples, width * height * depth long.
+     *
+     * @return: None
+     */
+    template<typename T>
+    void updateData(const std::vector<T> &newData) {
+        assignData(newData.data(), newData.size(), DataTypeTraits<T>::type);
+    }
+
+    /**
+     * Updates the volume data by taking over a buffer
+     *
+     * Hands the result of a filter to the volume without copying it: the volume swaps newData in and releases its old
+     * buffer, or keeps it as the spare in double-buffer mode. A volume that views memory owned by the caller cannot give
+     * that memory away, so in that case the samples are copied into it and newData becomes the spare instead. If the size
+     * of newData does not match width * height * depth samples of the given type, an error is printed and the volume is
+     * left unchanged.
+     *
+     * @param newData: The buffer holding the new samples; it is left empty.
+     * @param type: The type of the samples in newData.
+     *
+     * @return: None
+     */
+    void updateData(Buffer &&newData, DataType type);
+
+    /**
+     * Returns a buffer for a filter to write its result into
+     *
+     * The buffer is large enough for width * height * depth samples of the given type. In double-buffer mode it is the
+     * spare buffer left by the previous filter, so successive filters alternate between the same two buffers; otherwise,
+     * or if the spare does not fit, it comes from BufferPool::global. Its contents are undefined.
+     *
+     * @param type: The sample type the filter will write.
+     *
+     * @return: The output buffer, to be handed back with updateData(Buffer &&, DataType).
+     *
+     * @throws std::bad_alloc if the buffer cannot be allocated or its size does not fit in size_t.
+     */
+    Buffer takeSpareBuffer(DataType type);
+
+    /**
+     * Enables or disables double-buffer mode
+     *
+     * In double-buffer mode the volume owns a ping-pong pair: updateData(Buffer &&, DataType) keeps the buffer it replaces
+     * and takeSpareBuffer hands it to the next filter, so a chain of filters runs without allocating after the first one.
+     * Disabling the mode releases the spare buffer.
+     *
+     * @param enabled: Whether to keep the replaced buffer between filters.
+     *
+     * @return: None
+     */
+    void setDoubleBuffering(bool enabled);
+
+    /**
+     * Checks whether double-buffer mode is enabled
+     *
+     * @return: True if replaced buffers are kept as the spare.
+     */
+    bool isDoubleBuffering() const;
+
+    /**
+     * Builds an index that answers slab projections without rereading the slab
+     *
+     * After the index is built, range projections with the 'MIP', 'MinIP' and 'AIP' projectors are answered from the
+     * per-block sums, maxima and minima of the index, so scrubbing the begin and end of a thick slab no longer reads every
+     * slice of it. The index is dropped whenever the volume data or dimensions change through the Volume interface; after
+     * writing to the samples through getData, call buildProjectionIndex again or clearProjectionIndex.
+     *
+     * @param blockSize: The number of slices per block; see ProjectionIndex for the trade-off between memory and speed.
+     *
+     * @return: None
+     * @throws std::invalid_argument if blockSize is less than 1.
+     */
+    void buildProjectionIndex(int blockSize = ProjectionIndex<unsigned char>::defaultBlockSize);
+
+    /**
+     * Drops the slab projection index and releases its memory
+     *
+     * @return: None
+     */
+    void clearProjectionIndex();
+
+    /**
+     * Checks whether a slab projection index has been built
+     *
+     * @return: True if range projections are answered from the index.
+     */
+    bool hasProjectionIndex() const;
+
+    /**
+     * Returns the slab projection index for samples of type T
+     *
+     * @return: A pointer to the index, or a null pointer if no index has been built or T is not the sample type.
+     */
+    template<typename T>
+    const ProjectionIndex<T> *getProjectionIndex() const {
+        return std::get_if<ProjectionIndex<T>>(&projectionIndex);
+    }
+
     /**
      * Loads a 3D volume from multiple image files
      *
      * This member function of the Volume class loads a series of images from the specified file paths to construct a 3D
-     * volume. The images are assumed to have the same dimensions and number of channels. The function initializes the
-     * volume's depth based on the number of paths provided, checks if at least one path is provided, and then loads each
-     * image in sequence. The images are concatenated into a single data buffer representing the 3D volume. If any image
-     * fails to load, or if memory allocation for the entire volume data fails, it prints an error message to standard error
-     * and cleans up any allocated resources.
+     * volume. The size of the first image, read from its header, sets the width and height, and the volume buffer is
+     * allocated once for all slices. The slices are then decoded in parallel, each worker holding one decoded slice at a
+     * time, and copied into place. Every slice is decoded as single-channel data, so grey, grey-alpha, RGB and RGBA
+     * images all give one sample per voxel; colour is reduced to luma by stb_image and alpha is dropped. If any image
+     * fails to load or differs in size from the first, it prints an error message to standard error and leaves the volume
+     * unchanged.
+     *
+     * When a 16-bit or float sample type is requested, every slice is decoded as single-channel data with stbi_load_16
+     * so that 12- and 16-bit images keep their full precision; 8-bit files are widened by stb_image. Float volumes store
+     * the 16-bit values divided by 257, i.e. on the same 0 to 255 scale as 8-bit data.
      *
      * @param paths: A vector of strings representing the paths to the image files that comprise the volume.
+     * @param type: The sample type to store the volume as. Defaults to 8-bit.
      *
      * @return: A boolean value indicating the success (true) or failure (false) of loading the volume.
      */
-    bool loadFromFiles(const std::vector<std::string> &paths);
+    bool loadFromFiles(const std::vector<std::string> &paths, DataType type = DataType::UInt8);
 
     /**
      * Loads a 3D volume from image files located in a specified directory
@@ -215,10 +428,11 @@ public:
      * or contains no image files, the function prints an error message and returns false.
      *
      * @param directoryPath: A string representing the path to the directory containing the image files to be loaded.
+     * @param type: The sample type to store the volume as. Defaults to 8-bit.
      *
      * @return: A boolean value indicating the success (true) or failure (false) of loading the volume from the directory.
      */
-    bool loadFromDirectory(const std::string &directoryPath);
+    bool loadFromDirectory(const std::string &directoryPath, DataType type = DataType::UInt8);
 
     /**
      * Saves all slices along a specified plane to files
@@ -227,7 +441,8 @@ public:
      * function first checks if the plane is valid, if the output directory exists, and if the plane is valid. If any of these checks
      * fail, it prints an error message and returns. If the output directory does not exist, the function attempts to create it. It then
      * iterates through all slices along the specified plane, extracts each slice from the volume's data, saves the result to a file in the
-     * specified directory, and uses the stb_image_write library to write the slice data to a PNG file.
+     * specified directory, and uses the stb_image_write library to write the slice data to a PNG file. Like every save overload,
+     * 16-bit and float volumes are converted to 8-bit samples only when the PNG is written.
      *
      * @param path: A string representing the path to the directory where the slices will be saved.
      * @param plane: A string representing the plane along which the slices will be extracted. Valid planes are 'x-y', 'x-z', and 'y-z'.
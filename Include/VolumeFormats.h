@@ -0,0 +1,122 @@
+/**
+ * @file VolumeFormats.h
+ *
+ * @brief Declares readers and writers for the NRRD and NIfTI-1 volume formats.
+ *
+ * Volumes produced by other tools usually come as a single NRRD or NIfTI file rather than a directory of PNG slices.
+ * The VolumeFormats class loads and saves both formats directly:
+ *   - NRRD (.nrrd with an attached header, or .nhdr with a detached data file), raw or gzip encoding, little or big
+ *     endian.
+ *   - NIfTI-1 single-file images (.nii) and their gzip-compressed form (.nii.gz).
+ *
+ * Samples may be unsigned 8-bit, unsigned 16-bit or 32-bit float, matching the Volume sample types. A little-endian raw
+ * payload whose offset suits its sample alignment is mapped into memory with MappedFile instead of being read, so
+ * loading costs a header parse and one mmap however large the volume is. Any other payload is read, byte-swapped or
+ * inflated with the bundled gzip decoder straight into the Volume buffer. Writers store raw little-endian payloads.
+ *
+ * Spacing, orientation and NIfTI intensity scaling are not represented by Volume and are ignored when loading; the
+ * writers store unit spacing and no scaling.
+ *
+ * @date Created on October 19, 2026
+ *
+ * @authors
+ * Advanced Programming Group Radix Sort:
+ *   - Benjamin Duncan (edsml-bd1023)
+ *   - Boyang Hu (edsml-bh223)
+ *   - Chawk Chamoun (edsml-cc8915)
+ *   - Mingsheng Cai (acse-sc4623)
+ *   - Moyu Zhang (acse-mz223)
+ *   - Ryan Benney (acse-rgb123)
+ */
+
+#pragma once
+
+#ifndef ADVANCED_PROGRAMMING_GROUP_RADIX_SORT_VOLUMEFORMATS_H
+#define ADVANCED_PROGRAMMING_GROUP_RADIX_SORT_VOLUMEFORMATS_H
+
+#include "Volume.h"
+
+#include <string>
+
+class VolumeFormats {
+public:
+    /**
+     * Loads a volume from a NRRD or NIfTI file, or a multi-page TIFF file through TiffStack, chosen by the file
+     * extension.
+     *
+     * @param path: The path of a .nrrd, .nhdr, .nii, .nii.gz, .tif or .tiff file.
+     * @param volume: Replaced by the loaded volume on success.
+     * @return: A boolean value indicating the success (true) or failure (false) of loading the volume.
+     */
+    static bool load(const std::string &path, Volume &volume);
+
+    /**
+     * Saves a volume as a NRRD or NIfTI file, chosen by the file extension.
+     *
+     * @param volume: The volume to save.
+     * @param path: The path of a .nrrd or .nii file.
+     * @return: A boolean value indicating the success (true) or failure (false) of saving the volume.
+     */
+    static bool save(const Volume &volume, const std::string &path);
+
+    /**
+     * Loads a volume from a NRRD file.
+     *
+     * The header must describe a 2D or 3D array of uchar/uint8, ushort/uint16 or float samples with raw or gzip
+     * encoding. Detached data files named by a "data file" field are resolved relative to the header.
+     *
+     * @param path: The path of the .nrrd or .nhdr file.
+     * @param volume: Replaced by the loaded volume on success.
+     * @return: A boolean value indicating the success (true) or failure (false) of loading the volume. On failure an
+     * error message is printed to standard error and the volume is left unchanged.
+     */
+    static bool loadNrrd(const std::string &path, Volume &volume);
+
+    /**
+     * Saves a volume as a NRRD file with an attached header and a raw little-endian payload.
+     *
+     * @param volume: The volume to save.
+     * @param path: The path of the file to write.
+     * @return: A boolean value indicating the success (true) or failure (false) of saving the volume.
+     */
+    static bool saveNrrd(const Volume &volume, const std::string &path);
+
+    /**
+     * Loads a volume from a NIfTI-1 single-file image.
+     *
+     * The image must have 2 or 3 dimensions (further dimensions of size 1 are accepted) and datatype DT_UINT8,
+     * DT_UINT16 or DT_FLOAT32. Files ending in .gz are inflated first.
+     *
+     * @param path: The path of the .nii or .nii.gz file.
+     * @param volume: Replaced by the loaded volume on success.
+     * @return: A boolean value indicating the success (true) or failure (false) of loading the volume. On failure an
+     * error message is printed to standard error and the volume is left unchanged.
+     */
+    static bool loadNifti(const std::string &path, Volume &volume);
+
+    /**
+     * Saves a volume as an uncompressed NIfTI-1 single-file image.
+     *
+     * @param volume: The volume to save.
+     * @param path: The path of the file to write.
+     * @return: A boolean value indicating the success (true) or failure (false) of saving the volume.
+     */
+    static bool saveNifti(const Volume &volume, const std::string &path);
+
+private:
+    /**
+     * Default constructor for the VolumeFormats class.
+     *
+     * The constructor is deleted because the class only provides static helpers.
+     */
+    VolumeFormats() = delete;
+
+    /**
+     * Destructor for the VolumeFormats class.
+     *
+     * The destructor is deleted because the class only provides static helpers.
+     */
+    ~VolumeFormats() = delete;
+};
+
+#endif //ADVANCED_PROGRAMMING_GROUP_RADIX_SORT_VOLUMEFORMATS_H
@@ -0,0 +1,133 @@
+/**
+ * @file VolumePipeline.h
+ *
+ * @brief Declares the VolumePipeline class, which filters slice stacks with decoding, filtering and encoding overlapped.
+ *
+ * A volume job run serially loads every slice, then filters, then encodes every output, so it takes as long as the
+ * three steps added together. Operations whose output slices only depend on the input slices within a fixed reach, such
+ * as the region overloads of the 3D filters, can instead be run one z-slab at a time. A VolumePipeline runs three
+ * stages concurrently, each with its own worker threads: decode workers read a slab and its context slices from a
+ * VolumeStream, compute workers apply the operations to it, and encode workers write its slices as PNG files. The
+ * stages are connected by BoundedQueues, so while one slab is being encoded the next is filtered and a later one is
+ * decoded, and the job takes about as long as its slowest stage.
+ *
+ * The queues give backpressure: a stage that runs ahead waits for a free place downstream, so at most
+ * getSlabLimit() slabs are held at once however deep the stack is. Each slab is filtered with the reach of the
+ * operations around it, through the same shrinking regions as FilteredVolume, so the output slices are identical to
+ * loading the whole stack, applying the operations and saving every x-y slice.
+ *
+ * @date Created on October 19, 2026
+ *
+ * @authors
+ * Advanced Programming Group Radix Sort:
+ *   - Benjamin Duncan (edsml-bd1023)
+ *   - Boyang Hu (edsml-bh223)
+ *   - Chawk Chamoun (edsml-cc8915)
+ *   - Mingsheng Cai (acse-sc4623)
+ *   - Moyu Zhang (acse-mz223)
+ *   - Ryan Benney (acse-rgb123)
+ */
+
+#pragma once
+
+#ifndef ADVANCED_PROGRAMMING_GROUP_RADIX_SORT_VOLUMEPIPELINE_H
+#define ADVANCED_PROGRAMMING_GROUP_RADIX_SORT_VOLUMEPIPELINE_H
+
+#include "Region.h"
+#include "Volume.h"
+#include "VolumeStream.h"
+#include "Filters/Filter.h"
+
+#include <cstddef>
+#include <functional>
+#include <string>
+#include <vector>
+
+// One operation of a pipeline
+struct SlabOperation {
+    int reach; // Slices of context the operation reads on each side of a slice, e.g. IFilter3D::getReach()
+    std::function<void(Volume &, const Region3D &)> apply; // Processes a region of a volume in place
+};
+
+// Slab size, worker counts and queue lengths of a pipeline
+struct PipelineOptions {
+    int slabDepth = 8; // Output slices per slab
+    int decodeWorkers = 2; // Threads reading slabs
+    int computeWorkers = 1; // Threads applying the operations, which are themselves multi-threaded
+    int encodeWorkers = 2; // Threads writing slices
+    int queueSlabs = 2; // Slabs each queue holds before its producers wait
+};
+
+class VolumePipeline {
+private:
+    PipelineOptions options;
+    std::vector<SlabOperation> operations; // Applied in order
+    int peakSlabs; // Most slabs held at once during the last run
+    double decodeSeconds, computeSeconds, encodeSeconds; // Time spent in each stage during the last run
+
+public:
+    /**
+     * Constructor for the VolumePipeline class, creating a pipeline with no operations.
+     *
+     * @param options: The slab size, worker counts and queue lengths. Every value must be at least 1, otherwise
+     * std::invalid_argument is thrown.
+     */
+    explicit VolumePipeline(const PipelineOptions &options = {});
+
+    /**
+     * Appends a 3D filter to the pipeline, applied through its region overload.
+     *
+     * @param filter: The filter. It is not copied and must outlive the pipeline. A filter used by several compute
+     * workers is applied to several slabs at the same time.
+     * @return: A reference to this pipeline, so that operations can be chained.
+     */
+    VolumePipeline &addFilter(IFilter3D &filter);
+
+    /**
+     * Appends an operation to the pipeline.
+     *
+     * @param operation: The operation, with a non-negative reach; otherwise std::invalid_argument is thrown.
+     * @return: A reference to this pipeline, so that operations can be chained.
+     */
+    VolumePipeline &addOperation(const SlabOperation &operation);
+
+    /**
+     * Filters a slice stack and writes every output slice.
+     *
+     * Slices are written as "slice_<index>.png" in the output directory, with index starting from 1, as by
+     * VolumeStream::writeSlice. Slabs finish out of order, so the files are written out of order.
+     *
+     * @param input: The slice stack to read.
+     * @param outputDirectory: The directory to write the slices in, which is created if needed.
+     * @return: A boolean value indicating the success (true) or failure (false) of the job. When a slice cannot be
+     * read or written every stage stops and an error message is printed; slices already written are left in place.
+     */
+    bool run(const VolumeStream &input, const std::string &outputDirectory);
+
+    /**
+     * @brief Get the most slabs that can be held at once: one per worker plus the capacity of both queues.
+     */
+    int getSlabLimit() const;
+
+    /**
+     * @brief Get the most slabs that were held at once during the last run.
+     */
+    int getPeakSlabs() const;
+
+    /**
+     * @brief Get the time the decode workers of the last run spent reading, summed over the workers.
+     */
+    double getDecodeSeconds() const;
+
+    /**
+     * @brief Get the time the compute workers of the last run spent applying the operations, summed over the workers.
+     */
+    double getComputeSeconds() const;
+
+    /**
+     * @brief Get the time the encode workers of the last run spent writing, summed over the workers.
+     */
+    double getEncodeSeconds() const;
+};
+
+#endif //ADVANCED_PROGRAMMING_GROUP_RADIX_SORT_VOLUMEPIPELINE_H
@@ -0,0 +1,122 @@
+/**
+ * @file VolumeStream.h
+ *
+ * @brief Provides on-demand, slice-by-slice access to volumes stored as a stack of image files.
+ *
+ * The VolumeStream class describes a volume whose x-y slices live in individual image files without loading them into
+ * memory. Slices are decoded only when they are requested, which allows the streaming overloads of Gaussian3DFilter,
+ * Median3DFilter and Projection to process stacks that are far larger than the available memory while keeping only a
+ * sliding window of slices resident. The class mirrors the loading conventions of Volume: slice files are ordered with
+ * the same sort used by Volume::loadFromDirectory, every slice must share the dimensions of the first one, and slices are
+ * read as single-channel grayscale data.
+ *
+ * @date Created on October 19, 2026
+ *
+ * @authors
+ * Advanced Programming Group Radix Sort:
+ *   - Benjamin Duncan (edsml-bd1023)
+ *   - Boyang Hu (edsml-bh223)
+ *   - Chawk Chamoun (edsml-cc8915)
+ *   - Mingsheng Cai (acse-sc4623)
+ *   - Moyu Zhang (acse-mz223)
+ *   - Ryan Benney (acse-rgb123)
+ */
+
+#pragma once
+
+#ifndef ADVANCED_PROGRAMMING_GROUP_RADIX_SORT_VOLUMESTREAM_H
+#define ADVANCED_PROGRAMMING_GROUP_RADIX_SORT_VOLUMESTREAM_H
+
+#include <string>
+#include <vector>
+
+class VolumeStream {
+private:
+    int width, height, depth; // Size of the volume
+    std::vector<std::string> paths; // Slice files, one per z index
+
+public:
+    /**
+     * @brief Default constructor for the VolumeStream class.
+     *
+     * Creates an empty stream; call openFiles or openDirectory before reading slices.
+     */
+    VolumeStream();
+
+    /**
+     * Opens a stack of slice files
+     *
+     * Records the slice paths in the given order and reads the header of the first file to determine the width and height
+     * of the volume. No pixel data is decoded. If no paths are provided or the first slice cannot be read, an error message
+     * is printed to standard error and the stream is left empty.
+     *
+     * @param paths: A vector of strings representing the paths to the slice files, ordered by z.
+     *
+     * @return: A boolean value indicating the success (true) or failure (false) of opening the stack.
+     */
+    bool openFiles(const std::vector<std::string> &paths);
+
+    /**
+     * Opens all slice files located in a directory
+     *
+     * Collects the regular files in the directory, sorts them with the same ordering as Volume::loadFromDirectory and
+     * opens them with openFiles.
+     *
+     * @param directoryPath: A string representing the path to the directory containing the slice files.
+     *
+     * @return: A boolean value indicating the success (true) or failure (false) of opening the stack.
+     */
+    bool openDirectory(const std::string &directoryPath);
+
+    /**
+     * @brief Get the width of the volume.
+     *
+     * @return The width of the volume.
+     */
+    int getWidth() const;
+
+    /**
+     * @brief Get the height of the volume.
+     *
+     * @return The height of the volume.
+     */
+    int getHeight() const;
+
+    /**
+     * @brief Get the depth of the volume.
+     *
+     * @return The depth of the volume.
+     */
+    int getDepth() const;
+
+    /**
+     * Decodes a single x-y slice
+     *
+     * Loads the slice at the given zero-based z index as single-channel data into the provided buffer. The slice must have
+     * the same width and height as the first slice of the stack; otherwise an error is printed and false is returned.
+     *
+     * @param z: The zero-based index of the slice to read.
+     * @param out: The destination buffer, which must hold width * height bytes.
+     *
+     * @return: A boolean value indicating the success (true) or failure (false) of reading the slice.
+     */
+    bool readSlice(int z, unsigned char *out) const;
+
+    /**
+     * Writes a single x-y slice to a PNG file
+     *
+     * Saves a slice using the same naming scheme as Volume::save for the x-y plane ("slice_<index>.png", where index starts
+     * from 1), creating the output directory if it does not exist yet.
+     *
+     * @param directoryPath: The directory to write the slice into.
+     * @param z: The zero-based index of the slice, used to name the file.
+     * @param width: The width of the slice.
+     * @param height: The height of the slice.
+     * @param data: The slice data, width * height bytes.
+     *
+     * @return: A boolean value indicating the success (true) or failure (false) of writing the slice.
+     */
+    static bool writeSlice(const std::string &directoryPath, int z, int width, int height, const unsigned char *data);
+};
+
+#endif //ADVANCED_PROGRAMMING_GROUP_RADIX_SORT_VOLUMESTREAM_H
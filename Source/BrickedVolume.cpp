@@ -0,0 +1,152 @@
+/**
+ * @file BrickedVolume.cpp
+ *
+ * @brief Implements the bricked storage layout for 3D volumetric data.
+ *
+ * This file implements the conversion between the linear z-major layout used by Volume and the bricked layout of
+ * BrickedVolume, together with the run-based accessors used by Slice, Projection and the 3D filters. Brick slots are
+ * computed once at construction time; for Morton ordering the bricks are ranked by their interleaved brick coordinates,
+ * which keeps bricks that are close in space close in memory without wasting storage on partially filled Morton ranges.
+ *
+ * @date Created on October 19, 2026
+ *
+ * @authors
+ * Advanced Programming Group Radix Sort:
+ *   - Benjamin Duncan (edsml-bd1023)
+ *   - Boyang Hu (edsml-bh223)
+ *   - Chawk Chamoun (edsml-cc8915)
+ *   - Mingsheng Cai (acse-sc4623)
+ *   - Moyu Zhang (acse-mz223)
+ *   - Ryan Benney (acse-rgb123)
+ */
+
+#include "BrickedVolume.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <numeric>
+#include <stdexcept>
+
+namespace {
+    // Spreads the lower 10 bits of v so that there are two zero bits between each of them
+    std::uint32_t spreadBits(std::uint32_t v) {
+        v &= 0x3ff;
+        v = (v | (v << 16)) & 0x030000ff;
+        v = (v | (v << 8)) & 0x0300f00f;
+        v = (v | (v << 4)) & 0x030c30c3;
+        v = (v | (v << 2)) & 0x09249249;
+        return v;
+    }
+
+    std::uint32_t mortonCode(int x, int y, int z) {
+        return spreadBits(x) | (spreadBits(y) << 1) | (spreadBits(z) << 2);
+    }
+}
+
+BrickedVolume::BrickedVolume(int width, int height, int depth, int brickSize, BrickOrder brickOrder)
+        : width(width), height(height), depth(depth), brickOrder(brickOrder) {
+    initialiseLayout(brickSize);
+}
+
+BrickedVolume::BrickedVolume(const Volume &volume, int brickSize, BrickOrder brickOrder)
+        : width(volume.getWidth()), height(volume.getHeight()), depth(volume.getDepth()), brickOrder(brickOrder) {
+    if (volume.getDataType() != DataType::UInt8) {
+        throw std::invalid_argument("Bricked volumes only support 8-bit samples.");
+    }
+    initialiseLayout(brickSize);
+    if (volume.getData()) {
+        copyFromLinear(volume.getData());
+    }
+}
+
+void BrickedVolume::initialiseLayout(int brickSize) {
+    // Validate the brick size
+    if (brickSize <= 0 || (brickSize & (brickSize - 1)) != 0) {
+        throw std::invalid_argument("Brick size must be a positive power of two.");
+    }
+    if (width < 0 || height < 0 || depth < 0) {
+        throw std::invalid_argument("Volume dimensions must not be negative.");
+    }
+
+    this->brickSize = brickSize;
+    brickShift = 0;
+    while ((1 << brickShift) < brickSize) {
+        ++brickShift;
+    }
+
+    bricksX = (width + brickSize - 1) / brickSize;
+    bricksY = (height + brickSize - 1) / brickSize;
+    bricksZ = (depth + brickSize - 1) / brickSize;
+    int brickCount = bricksX * bricksY * bricksZ;
+
+    // Assign every brick a slot in memory
+    brickSlots.resize(brickCount);
+    std::iota(brickSlots.begin(), brickSlots.end(), 0);
+    if (brickOrder == BrickOrder::Morton && brickCount > 1) {
+        if (bricksX > 1024 || bricksY > 1024 || bricksZ > 1024) {
+            throw std::invalid_argument("Morton brick order supports at most 1024 bricks per axis.");
+        }
+        // Rank the bricks by their Morton code; the rank becomes the slot
+        std::vector<int> order(brickCount);
+        std::iota(order.begin(), order.end(), 0);
+        auto codeOf = [this](int brick) {
+            return mortonCode(brick % bricksX, (brick / bricksX) % bricksY, brick / (bricksX * bricksY));
+        };
+        std::sort(order.begin(), order.end(), [&](int a, int b) { return codeOf(a) < codeOf(b); });
+        for (int slot = 0; slot < brickCount; ++slot) {
+            brickSlots[order[slot]] = slot;
+        }
+    }
+
+    data.assign(static_cast<std::size_t>(brickCount) << (3 * brickShift), 0);
+}
+
+const unsigned char *BrickedVolume::getBrick(int bx, int by, int bz) const {
+    int brick = (bz * bricksY + by) * bricksX + bx;
+    return data.data() + (static_cast<std::size_t>(brickSlots[brick]) << (3 * brickShift));
+}
+
+void BrickedVolume::readSpanX(int x, int y, int z, int count, unsigned char *out) const {
+    // Copy one contiguous brick row at a time
+    while (count > 0) {
+        int run = std::min(count, brickSize - (x & (brickSize - 1)));
+        std::memcpy(out, data.data() + voxelOffset(x, y, z), run);
+        out += run;
+        x += run;
+        count -= run;
+    }
+}
+
+void BrickedVolume::writeSpanX(int x, int y, int z, int count, const unsigned char *in) {
+    // Copy one contiguous brick row at a time
+    while (count > 0) {
+        int run = std::min(count, brickSize - (x & (brickSize - 1)));
+        std::memcpy(data.data() + voxelOffset(x, y, z), in, run);
+        in += run;
+        x += run;
+        count -= run;
+    }
+}
+
+void BrickedVolume::copyToLinear(unsigned char *out) const {
+    for (int z = 0; z < depth; ++z) {
+        for (int y = 0; y < height; ++y) {
+            readSpanX(0, y, z, width, out + (static_cast<std::size_t>(z) * height + y) * width);
+        }
+    }
+}
+
+void BrickedVolume::copyFromLinear(const unsigned char *in) {
+    for (int z = 0; z < depth; ++z) {
+        for (int y = 0; y < height; ++y) {
+            writeSpanX(0, y, z, width, in + (static_cast<std::size_t>(z) * height + y) * width);
+        }
+    }
+}
+
+std::vector<unsigned char> BrickedVolume::toLinear() const {
+    std::vector<unsigned char> linear(static_cast<std::size_t>(width) * height * depth);
+    copyToLinear(linear.data());
+    return linear;
+}
@@ -0,0 +1,102 @@
+/**
+ * @file Buffer.cpp
+ *
+ * @brief Implements the Buffer class, which owns or views the sample memory of images and volumes.
+ *
+ * Owning buffers allocate through the aligned form of operator new, so the allocations are counted by the benchmark
+ * suite like any other heap allocation, and release their memory through the deleter stored with the pointer.
+ *
+ * @date Created on October 19, 2026
+ *
+ * @authors
+ * Advanced Programming Group Radix Sort:
+ *   - Benjamin Duncan (edsml-bd1023)
+ *   - Boyang Hu (edsml-bh223)
+ *   - Chawk Chamoun (edsml-cc8915)
+ *   - Mingsheng Cai (acse-sc4623)
+ *   - Moyu Zhang (acse-mz223)
+ *   - Ryan Benney (acse-rgb123)
+ */
+
+#include "Buffer.h"
+
+#include <cstdlib>
+#include <new>
+#include <utility>
+
+Buffer::Buffer() : data(nullptr), size(0), deleter(nullptr) {}
+
+Buffer::Buffer(size_t size) : data(nullptr), size(size), deleter(nullptr) {
+    if (size > 0) {
+        data = static_cast<unsigned char *>(::operator new[](size, std::align_val_t{alignment}));
+        deleter = freeAligned;
+    }
+}
+
+Buffer::Buffer(void *data, size_t size, Deleter deleter)
+        : data(static_cast<unsigned char *>(data)), size(size), deleter(data ? deleter : nullptr) {}
+
+Buffer::Buffer(Buffer &&other) noexcept: data(other.data), size(other.size), deleter(other.deleter) {
+    other.data = nullptr;
+    other.size = 0;
+    other.deleter = nullptr;
+}
+
+Buffer &Buffer::operator=(Buffer &&other) noexcept {
+    if (this != &other) {
+        reset();
+        swap(other);
+    }
+    return *this;
+}
+
+Buffer::~Buffer() {
+    reset();
+}
+
+Buffer Buffer::view(void *data, size_t size) {
+    return Buffer(data, size, nullptr);
+}
+
+void Buffer::freeAligned(void *data) {
+    ::operator delete[](data, std::align_val_t{alignment});
+}
+
+void Buffer::freeArray(void *data) {
+    delete[] static_cast<unsigned char *>(data);
+}
+
+void Buffer::freeMalloc(void *data) {
+    std::free(data);
+}
+
+unsigned char *Buffer::getData() const {
+    return data;
+}
+
+size_t Buffer::getSize() const {
+    return size;
+}
+
+bool Buffer::isEmpty() const {
+    return data == nullptr;
+}
+
+bool Buffer::ownsData() const {
+    return deleter != nullptr;
+}
+
+void Buffer::swap(Buffer &other) noexcept {
+    std::swap(data, other.data);
+    std::swap(size, other.size);
+    std::swap(deleter, other.deleter);
+}
+
+void Buffer::reset() {
+    if (deleter) {
+        deleter(data);
+    }
+    data = nullptr;
+    size = 0;
+    deleter = nullptr;
+}
@@ -0,0 +1,165 @@
+/**
+ * @file BufferPool.cpp
+ *
+ * @brief Implements the BufferPool class, a thread-safe cache of aligned buffers for filter outputs and scratch memory.
+ *
+ * Each block starts with a 64-byte header that records the owning pool and the size class of the block, followed by the
+ * data handed out to the caller. The header keeps the data 64-byte aligned and lets the deleter of a pooled Buffer, which
+ * is a plain function pointer, find its way back to the right free list. Blocks are freed outside the lock, because
+ * returning large blocks to the operating system can take a while.
+ *
+ * @date Created on October 19, 2026
+ *
+ * @authors
+ * Advanced Programming Group Radix Sort:
+ *   - Benjamin Duncan (edsml-bd1023)
+ *   - Boyang Hu (edsml-bh223)
+ *   - Chawk Chamoun (edsml-cc8915)
+ *   - Mingsheng Cai (acse-sc4623)
+ *   - Moyu Zhang (acse-mz223)
+ *   - Ryan Benney (acse-rgb123)
+ */
+
+#include "BufferPool.h"
+
+#include <algorithm>
+#include <bit>
+#include <limits>
+#include <new>
+
+namespace {
+    // Bookkeeping stored in front of the data of every block
+    struct BlockHeader {
+        BufferPool *pool;
+        size_t capacity;
+    };
+
+    static_assert(sizeof(BlockHeader) <= Buffer::alignment, "The block header must fit in front of aligned data.");
+
+    unsigned char *allocateBlock(size_t capacity) {
+        return static_cast<unsigned char *>(
+                ::operator new[](capacity + Buffer::alignment, std::align_val_t{Buffer::alignment}));
+    }
+
+    void freeBlock(unsigned char *block) {
+        ::operator delete[](block, std::align_val_t{Buffer::alignment});
+    }
+}
+
+BufferPool::BufferPool(size_t cacheLimit) : cacheLimit(cacheLimit), stats{} {}
+
+BufferPool::~BufferPool() {
+    trim();
+}
+
+BufferPool &BufferPool::global() {
+    // Deliberately leaked so that buffers released during static destruction still find their pool
+    static BufferPool *pool = new BufferPool();
+    return *pool;
+}
+
+size_t BufferPool::sizeClass(size_t size) {
+    if (size <= minSizeClass) {
+        return minSizeClass;
+    }
+    // Four classes per power of two: round up to a quarter of the largest power of two below the size
+    size_t step = std::bit_floor(size - 1) / 4;
+    if (size - 1 > std::numeric_limits<size_t>::max() - step) {
+        throw std::bad_alloc();
+    }
+    return (size + step - 1) / step * step;
+}
+
+Buffer BufferPool::acquire(size_t size) {
+    if (size == 0) {
+        return Buffer();
+    }
+    size_t capacity = sizeClass(size);
+
+    unsigned char *block = nullptr;
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        ++stats.requests;
+        auto found = freeLists.find(capacity);
+        if (found != freeLists.end() && !found->second.empty()) {
+            block = found->second.back();
+            found->second.pop_back();
+            stats.bytesCached -= capacity;
+            ++stats.hits;
+        }
+        stats.bytesInUse += capacity;
+        stats.peakBytesInUse = std::max(stats.peakBytesInUse, stats.bytesInUse);
+    }
+
+    if (!block) {
+        try {
+            block = allocateBlock(capacity);
+        } catch (...) {
+            std::lock_guard<std::mutex> lock(mutex);
+            stats.bytesInUse -= capacity;
+            throw;
+        }
+        *reinterpret_cast<BlockHeader *>(block) = {this, capacity};
+    }
+    return Buffer(block + Buffer::alignment, size, release);
+}
+
+void BufferPool::release(void *data) {
+    unsigned char *block = static_cast<unsigned char *>(data) - Buffer::alignment;
+    const auto &header = *reinterpret_cast<BlockHeader *>(block);
+    header.pool->recycle(block, header.capacity);
+}
+
+void BufferPool::recycle(unsigned char *block, size_t capacity) {
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        stats.bytesInUse -= capacity;
+        if (stats.bytesCached + capacity <= cacheLimit) {
+            freeLists[capacity].push_back(block);
+            stats.bytesCached += capacity;
+            return;
+        }
+    }
+    freeBlock(block);
+}
+
+void BufferPool::trim() {
+    evict(0);
+}
+
+void BufferPool::setCacheLimit(size_t limit) {
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        cacheLimit = limit;
+    }
+    evict(limit);
+}
+
+void BufferPool::evict(size_t target) {
+    std::vector<unsigned char *> evicted;
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        for (auto &[capacity, blocks]: freeLists) {
+            while (stats.bytesCached > target && !blocks.empty()) {
+                evicted.push_back(blocks.back());
+                blocks.pop_back();
+                stats.bytesCached -= capacity;
+            }
+        }
+    }
+    for (unsigned char *block: evicted) {
+        freeBlock(block);
+    }
+}
+
+BufferPoolStats BufferPool::getStats() const {
+    std::lock_guard<std::mutex> lock(mutex);
+    return stats;
+}
+
+void BufferPool::resetStats() {
+    std::lock_guard<std::mutex> lock(mutex);
+    stats.requests = 0;
+    stats.hits = 0;
+    stats.peakBytesInUse = stats.bytesInUse;
+}
@@ -0,0 +1,558 @@
+/**
+ * @file ChunkedVolumeFile.cpp
+ *
+ * @brief Implements the chunked volume file format and its built-in LZ codec.
+ *
+ * The codec finds matches through a 4096-entry hash table of the last position of every 4-byte sequence, and skips
+ * ahead faster the longer it goes without a match, so incompressible data costs little. Back-references that overlap
+ * their own output, as in runs of a single value, are expanded by copying the repeated pattern in doubling steps.
+ *
+ * The file is read through one stream whose seeks and reads are serialised, while decompression and copying run in
+ * parallel, so reading is limited by decoding rather than by the lock.
+ *
+ * @date Created on October 19, 2026
+ *
+ * @authors
+ * Advanced Programming Group Radix Sort:
+ *   - Benjamin Duncan (edsml-bd1023)
+ *   - Boyang Hu (edsml-bh223)
+ *   - Chawk Chamoun (edsml-cc8915)
+ *   - Mingsheng Cai (acse-sc4623)
+ *   - Moyu Zhang (acse-mz223)
+ *   - Ryan Benney (acse-rgb123)
+ */
+
+#include "ChunkedVolumeFile.h"
+#include "BufferPool.h"
+#include "Parallel.h"
+#include "Trace.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+#include <initializer_list>
+#include <iostream>
+
+namespace {
+    constexpr size_t minMatch = 4; // Shortest back-reference
+    constexpr size_t maxOffset = 65535; // Farthest back-reference
+    constexpr int hashBits = 12; // log2 of the hash table size
+    constexpr char magic[8] = {'M', 'D', 'I', 'P', 'C', 'V', 'F', '1'}; // First bytes of every file
+    constexpr size_t headerSize = 28; // Bytes before the chunk index
+    constexpr size_t entrySize = 16; // Bytes per chunk index entry
+    constexpr unsigned char lzCodec = 1; // Codec identifier of ChunkCodec
+
+    uint32_t read32(const unsigned char *p) {
+        uint32_t value;
+        std::memcpy(&value, p, sizeof(value));
+        return value;
+    }
+
+    uint32_t hash(uint32_t value) {
+        return (value * 2654435761u) >> (32 - hashBits);
+    }
+
+    // Appends a length that did not fit in its token nibble as a run of 255s and a remainder
+    void writeLength(std::vector<unsigned char> &out, size_t value) {
+        for (; value >= 255; value -= 255) {
+            out.push_back(255);
+        }
+        out.push_back(static_cast<unsigned char>(value));
+    }
+
+    // Reads the continuation of a length; false if the input ends first
+    bool readLength(const unsigned char *source, size_t size, size_t &position, size_t &value) {
+        unsigned char byte;
+        do {
+            if (position >= size) {
+                return false;
+            }
+            byte = source[position++];
+            value += byte;
+        } while (byte == 255);
+        return true;
+    }
+
+    // Appends one literal run, followed by a back-reference unless matchLength is 0
+    void writeSequence(std::vector<unsigned char> &out, const unsigned char *literals, size_t literalLength,
+                       size_t offset, size_t matchLength) {
+        size_t matchCode = matchLength ? matchLength - minMatch : 0;
+        out.push_back(static_cast<unsigned char>((std::min<size_t>(literalLength, 15) << 4) |
+                                                 std::min<size_t>(matchCode, 15)));
+        if (literalLength >= 15) {
+            writeLength(out, literalLength - 15);
+        }
+        out.insert(out.end(), literals, literals + literalLength);
+        if (!matchLength) {
+            return;
+        }
+        out.push_back(static_cast<unsigned char>(offset & 0xFF));
+        out.push_back(static_cast<unsigned char>(offset >> 8));
+        if (matchCode >= 15) {
+            writeLength(out, matchCode - 15);
+        }
+    }
+
+    // Little-endian integer fields of the header and index
+    void put(std::vector<unsigned char> &out, uint64_t value, int bytes) {
+        for (int i = 0; i < bytes; ++i) {
+            out.push_back(static_cast<unsigned char>(value >> (8 * i)));
+        }
+    }
+
+    uint64_t get(const unsigned char *p, int bytes) {
+        uint64_t value = 0;
+        for (int i = 0; i < bytes; ++i) {
+            value |= static_cast<uint64_t>(p[i]) << (8 * i);
+        }
+        return value;
+    }
+
+    // Chunk position and size along one axis
+    struct ChunkSpan {
+        int begin, size;
+    };
+
+    ChunkSpan chunkSpan(int chunk, int chunkSize, int extent) {
+        int begin = chunk * chunkSize;
+        return {begin, std::min(chunkSize, extent - begin)};
+    }
+
+    int chunksAlong(int extent, int chunkSize) {
+        return static_cast<int>((static_cast<int64_t>(extent) + chunkSize - 1) / chunkSize);
+    }
+
+    // Whether the product of the factors fits in size_t
+    bool fitsInMemory(std::initializer_list<uint64_t> factors) {
+        size_t product = 1;
+        for (uint64_t factor: factors) {
+            if (factor != 0 && product > SIZE_MAX / factor) {
+                return false;
+            }
+            product *= factor;
+        }
+        return true;
+    }
+}
+
+void ChunkCodec::compress(const unsigned char *source, size_t size, std::vector<unsigned char> &out) {
+    out.clear();
+    out.reserve(size + size / 255 + 16);
+    uint32_t table[1 << hashBits] = {}; // Position + 1 of the last sequence with each hash, 0 if none
+    size_t anchor = 0, position = 0, misses = 0;
+
+    while (position + minMatch <= size) {
+        uint32_t value = read32(source + position);
+        uint32_t &slot = table[hash(value)];
+        size_t candidate = slot;
+        slot = static_cast<uint32_t>(position + 1);
+
+        if (!candidate || position - (candidate - 1) > maxOffset || read32(source + candidate - 1) != value) {
+            // Skip ahead faster through data that does not compress
+            position += 1 + (misses++ >> 6);
+            continue;
+        }
+
+        size_t reference = candidate - 1, length = minMatch;
+        while (position + length + sizeof(uint64_t) <= size) {
+            uint64_t a, b;
+            std::memcpy(&a, source + reference + length, sizeof(a));
+            std::memcpy(&b, source + position + length, sizeof(b));
+            if (a != b) {
+                length += __builtin_ctzll(a ^ b) / 8;
+                break;
+            }
+            length += sizeof(uint64_t);
+        }
+        if (position + length + sizeof(uint64_t) > size) {
+            while (position + length < size && source[reference + length] == source[position + length]) {
+                ++length;
+            }
+        }
+
+        writeSequence(out, source + anchor, position - anchor, position - reference, length);
+        position += length;
+        anchor = position;
+        misses = 0;
+    }
+    if (anchor < size || size == 0) {
+        writeSequence(out, source + anchor, size - anchor, 0, 0);
+    }
+}
+
+bool ChunkCodec::decompress(const unsigned char *source, size_t size, unsigned char *out, size_t outSize) {
+    size_t in = 0, written = 0;
+    while (in < size) {
+        unsigned char token = source[in++];
+
+        size_t literalLength = token >> 4;
+        if (literalLength == 15 && !readLength(source, size, in, literalLength)) {
+            return false;
+        }
+        if (literalLength > size - in || literalLength > outSize - written) {
+            return false;
+        }
+        if (literalLength > 0) {
+            std::memcpy(out + written, source + in, literalLength);
+        }
+        in += literalLength;
+        written += literalLength;
+        if (in == size) {
+            break;
+        }
+
+        if (size - in < 2) {
+            return false;
+        }
+        size_t offset = source[in] | (source[in + 1] << 8);
+        in += 2;
+        size_t matchLength = token & 15;
+        if (matchLength == 15 && !readLength(source, size, in, matchLength)) {
+            return false;
+        }
+        matchLength += minMatch;
+        if (offset == 0 || offset > written || matchLength > outSize - written) {
+            return false;
+        }
+
+        // The pattern before the output repeats with period offset, so each copy may double in size
+        const unsigned char *pattern = out + written - offset;
+        unsigned char *destination = out + written;
+        for (size_t left = matchLength; left;) {
+            size_t count = std::min(left, static_cast<size_t>(destination - pattern));
+            std::memcpy(destination, pattern, count);
+            destination += count;
+            left -= count;
+        }
+        written += matchLength;
+    }
+    return written == outSize;
+}
+
+void ChunkCodec::shuffle(const unsigned char *source, size_t count, size_t sampleSize, unsigned char *out) {
+    for (size_t i = 0; i < count; ++i) {
+        for (size_t b = 0; b < sampleSize; ++b) {
+            out[b * count + i] = source[i * sampleSize + b];
+        }
+    }
+}
+
+void ChunkCodec::unshuffle(const unsigned char *source, size_t count, size_t sampleSize, unsigned char *out) {
+    for (size_t i = 0; i < count; ++i) {
+        for (size_t b = 0; b < sampleSize; ++b) {
+            out[i * sampleSize + b] = source[b * count + i];
+        }
+    }
+}
+
+ChunkedVolumeFile::ChunkedVolumeFile() : width(0), height(0), depth(0), chunkSize(0), dataType(DataType::UInt8) {}
+
+bool ChunkedVolumeFile::save(const Volume &volume, const std::string &path, int chunkSize) {
+    if (!volume.getData() || volume.getWidth() <= 0 || volume.getHeight() <= 0 || volume.getDepth() <= 0) {
+        std::cerr << "Error: Cannot save an empty volume as a chunked file." << std::endl;
+        return false;
+    }
+    if (chunkSize < 1 || chunkSize > maxChunkSize) {
+        std::cerr << "Error: The chunk size must be between 1 and " << maxChunkSize << "." << std::endl;
+        return false;
+    }
+
+    int width = volume.getWidth(), height = volume.getHeight(), depth = volume.getDepth();
+    size_t sampleSize = bytesPerSample(volume.getDataType());
+    int chunksX = chunksAlong(width, chunkSize), chunksY = chunksAlong(height, chunkSize);
+    size_t chunkCount = static_cast<size_t>(chunksX) * chunksY * chunksAlong(depth, chunkSize);
+    TRACE_SCOPE("ChunkedVolumeFile::save", "io", static_cast<size_t>(width) * height * depth * sampleSize);
+
+    std::vector<std::vector<unsigned char>> stored(chunkCount);
+    std::vector<uint32_t> flags(chunkCount, 0);
+    Parallel::forRange(chunkCount, [&](size_t begin, size_t end) {
+        std::vector<unsigned char> voxels, shuffled;
+        for (size_t chunk = begin; chunk < end; ++chunk) {
+            ChunkSpan x = chunkSpan(static_cast<int>(chunk % chunksX), chunkSize, width);
+            ChunkSpan y = chunkSpan(static_cast<int>(chunk / chunksX % chunksY), chunkSize, height);
+            ChunkSpan z = chunkSpan(static_cast<int>(chunk / chunksX / chunksY), chunkSize, depth);
+            size_t row = x.size * sampleSize, count = static_cast<size_t>(x.size) * y.size * z.size;
+
+            voxels.resize(count * sampleSize);
+            unsigned char *target = voxels.data();
+            for (int k = z.begin; k < z.begin + z.size; ++k) {
+                for (int j = y.begin; j < y.begin + y.size; ++j, target += row) {
+                    std::memcpy(target, volume.getData() + ((static_cast<size_t>(k) * height + j) * width + x.begin) *
+                                                           sampleSize, row);
+                }
+            }
+
+            const unsigned char *input = voxels.data();
+            if (sampleSize > 1) {
+                shuffled.resize(voxels.size());
+                ChunkCodec::shuffle(voxels.data(), count, sampleSize, shuffled.data());
+                input = shuffled.data();
+            }
+            ChunkCodec::compress(input, voxels.size(), stored[chunk]);
+            if (stored[chunk].size() >= voxels.size()) {
+                stored[chunk] = voxels;
+                flags[chunk] = rawChunk;
+            }
+        }
+    });
+
+    std::vector<unsigned char> head(magic, magic + sizeof(magic));
+    put(head, width, 4);
+    put(head, height, 4);
+    put(head, depth, 4);
+    put(head, chunkSize, 4);
+    put(head, static_cast<uint64_t>(volume.getDataType()), 1);
+    put(head, lzCodec, 1);
+    put(head, 0, 2);
+    uint64_t offset = headerSize + chunkCount * entrySize;
+    for (size_t chunk = 0; chunk < chunkCount; ++chunk) {
+        put(head, offset, 8);
+        put(head, stored[chunk].size(), 4);
+        put(head, flags[chunk], 4);
+        offset += stored[chunk].size();
+    }
+
+    std::ofstream out(path, std::ios::binary | std::ios::trunc);
+    if (!out) {
+        std::cerr << "Error: Cannot open " << path << " for writing." << std::endl;
+        return false;
+    }
+    out.write(reinterpret_cast<const char *>(head.data()), static_cast<std::streamsize>(head.size()));
+    for (const auto &chunk: stored) {
+        out.write(reinterpret_cast<const char *>(chunk.data()), static_cast<std::streamsize>(chunk.size()));
+    }
+    if (!out) {
+        std::cerr << "Error: Failed to write " << path << "." << std::endl;
+        return false;
+    }
+    return true;
+}
+
+bool ChunkedVolumeFile::open(const std::string &path) {
+    std::lock_guard<std::mutex> lock(fileMutex);
+    file.close();
+    file.clear();
+    index.clear();
+    width = height = depth = chunkSize = 0;
+
+    file.open(path, std::ios::binary);
+    if (!file) {
+        std::cerr << "Error: Cannot open chunked volume file " << path << "." << std::endl;
+        return false;
+    }
+    file.seekg(0, std::ios::end);
+    uint64_t fileSize = static_cast<uint64_t>(file.tellg());
+    file.seekg(0);
+
+    unsigned char head[headerSize];
+    if (!file.read(reinterpret_cast<char *>(head), headerSize) || std::memcmp(head, magic, sizeof(magic)) != 0) {
+        std::cerr << "Error: " << path << " is not a chunked volume file." << std::endl;
+        file.close();
+        return false;
+    }
+    uint64_t w = get(head + 8, 4), h = get(head + 12, 4), d = get(head + 16, 4), c = get(head + 20, 4);
+    uint64_t type = head[24];
+    if (w < 1 || h < 1 || d < 1 || c < 1 || w > INT32_MAX || h > INT32_MAX || d > INT32_MAX || c > maxChunkSize ||
+        type > static_cast<uint64_t>(DataType::Float32) || head[25] != lzCodec ||
+        !fitsInMemory({w, h, d, bytesPerSample(static_cast<DataType>(type))})) {
+        std::cerr << "Error: " << path << " has an invalid or unsupported chunked volume header." << std::endl;
+        file.close();
+        return false;
+    }
+
+    // Each factor is below 2^31 and the volume fits in memory, so the chunk count cannot overflow; the index size is
+    // compared by division so that it cannot wrap either
+    int chunksX = chunksAlong(static_cast<int>(w), static_cast<int>(c));
+    int chunksY = chunksAlong(static_cast<int>(h), static_cast<int>(c));
+    int chunksZ = chunksAlong(static_cast<int>(d), static_cast<int>(c));
+    size_t chunkCount = static_cast<size_t>(chunksX) * chunksY * chunksZ;
+    if (fileSize < headerSize || chunkCount > (fileSize - headerSize) / entrySize) {
+        std::cerr << "Error: The chunk index of " << path << " is truncated." << std::endl;
+        file.close();
+        return false;
+    }
+
+    std::vector<unsigned char> entries(chunkCount * entrySize);
+    file.read(reinterpret_cast<char *>(entries.data()), static_cast<std::streamsize>(entries.size()));
+    size_t sampleSize = bytesPerSample(static_cast<DataType>(type));
+    index.resize(chunkCount);
+    for (size_t chunk = 0; chunk < chunkCount; ++chunk) {
+        const unsigned char *entry = entries.data() + chunk * entrySize;
+        index[chunk] = {get(entry, 8), static_cast<uint32_t>(get(entry + 8, 4)),
+                        static_cast<uint32_t>(get(entry + 12, 4))};
+
+        ChunkSpan x = chunkSpan(static_cast<int>(chunk % chunksX), static_cast<int>(c), static_cast<int>(w));
+        ChunkSpan y = chunkSpan(static_cast<int>(chunk / chunksX % chunksY), static_cast<int>(c), static_cast<int>(h));
+        ChunkSpan z = chunkSpan(static_cast<int>(chunk / chunksX / chunksY), static_cast<int>(c), static_cast<int>(d));
+        size_t bytes = static_cast<size_t>(x.size) * y.size * z.size * sampleSize;
+        const ChunkEntry &e = index[chunk];
+        if (!file || e.offset > fileSize || e.size > fileSize - e.offset || (e.flags & rawChunk && e.size != bytes)) {
+            std::cerr << "Error: The chunk index of " << path << " is corrupt." << std::endl;
+            index.clear();
+            file.close();
+            return false;
+        }
+    }
+
+    width = static_cast<int>(w);
+    height = static_cast<int>(h);
+    depth = static_cast<int>(d);
+    chunkSize = static_cast<int>(c);
+    dataType = static_cast<DataType>(type);
+    return true;
+}
+
+bool ChunkedVolumeFile::isOpen() const {
+    return !index.empty();
+}
+
+int ChunkedVolumeFile::getWidth() const {
+    return width;
+}
+
+int ChunkedVolumeFile::getHeight() const {
+    return height;
+}
+
+int ChunkedVolumeFile::getDepth() const {
+    return depth;
+}
+
+int ChunkedVolumeFile::getChunkSize() const {
+    return chunkSize;
+}
+
+DataType ChunkedVolumeFile::getDataType() const {
+    return dataType;
+}
+
+size_t ChunkedVolumeFile::getStoredSize() const {
+    size_t total = 0;
+    for (const auto &entry: index) {
+        total += entry.size;
+    }
+    return total;
+}
+
+bool ChunkedVolumeFile::decodeChunk(size_t chunk, std::vector<unsigned char> &out) const {
+    int chunksX = chunksAlong(width, chunkSize), chunksY = chunksAlong(height, chunkSize);
+    ChunkSpan x = chunkSpan(static_cast<int>(chunk % chunksX), chunkSize, width);
+    ChunkSpan y = chunkSpan(static_cast<int>(chunk / chunksX % chunksY), chunkSize, height);
+    ChunkSpan z = chunkSpan(static_cast<int>(chunk / chunksX / chunksY), chunkSize, depth);
+    size_t sampleSize = bytesPerSample(dataType), count = static_cast<size_t>(x.size) * y.size * z.size;
+    const ChunkEntry &entry = index[chunk];
+
+    std::vector<unsigned char> stored(entry.size);
+    {
+        std::lock_guard<std::mutex> lock(fileMutex);
+        file.clear();
+        file.seekg(static_cast<std::streamoff>(entry.offset));
+        file.read(reinterpret_cast<char *>(stored.data()), entry.size);
+        if (!file) {
+            std::cerr << "Error: Failed to read chunk " << chunk << " of the chunked volume file." << std::endl;
+            return false;
+        }
+    }
+
+    out.resize(count * sampleSize);
+    if (entry.flags & rawChunk) {
+        std::memcpy(out.data(), stored.data(), out.size());
+        return true;
+    }
+    if (sampleSize == 1) {
+        if (ChunkCodec::decompress(stored.data(), stored.size(), out.data(), out.size())) {
+            return true;
+        }
+    } else {
+        std::vector<unsigned char> shuffled(out.size());
+        if (ChunkCodec::decompress(stored.data(), stored.size(), shuffled.data(), shuffled.size())) {
+            ChunkCodec::unshuffle(shuffled.data(), count, sampleSize, out.data());
+            return true;
+        }
+    }
+    std::cerr << "Error: Chunk " << chunk << " of the chunked volume file is corrupt." << std::endl;
+    return false;
+}
+
+bool ChunkedVolumeFile::readRegion(const Region3D &region, unsigned char *out) const {
+    if (!isOpen()) {
+        std::cerr << "Error: No chunked volume file is open." << std::endl;
+        return false;
+    }
+    if (region.width <= 0 || region.height <= 0 || region.depth <= 0 || region.x < 0 || region.y < 0 ||
+        region.z < 0 || region.x + region.width > width || region.y + region.height > height ||
+        region.z + region.depth > depth) {
+        std::cerr << "Error: The region must be non-empty and lie inside the volume." << std::endl;
+        return false;
+    }
+
+    size_t sampleSize = bytesPerSample(dataType);
+    TRACE_SCOPE("ChunkedVolumeFile::readRegion", "io",
+                static_cast<size_t>(region.width) * region.height * region.depth * sampleSize);
+
+    // Only the chunks overlapping the region are decoded
+    int chunksX = chunksAlong(width, chunkSize), chunksY = chunksAlong(height, chunkSize);
+    std::vector<size_t> chunks;
+    for (int cz = region.z / chunkSize; cz <= (region.z + region.depth - 1) / chunkSize; ++cz) {
+        for (int cy = region.y / chunkSize; cy <= (region.y + region.height - 1) / chunkSize; ++cy) {
+            for (int cx = region.x / chunkSize; cx <= (region.x + region.width - 1) / chunkSize; ++cx) {
+                chunks.push_back((static_cast<size_t>(cz) * chunksY + cy) * chunksX + cx);
+            }
+        }
+    }
+
+    std::atomic<bool> success = true;
+    Parallel::forRange(chunks.size(), [&](size_t begin, size_t end) {
+        std::vector<unsigned char> voxels;
+        for (size_t i = begin; i < end && success; ++i) {
+            size_t chunk = chunks[i];
+            if (!decodeChunk(chunk, voxels)) {
+                success = false;
+                return;
+            }
+            ChunkSpan x = chunkSpan(static_cast<int>(chunk % chunksX), chunkSize, width);
+            ChunkSpan y = chunkSpan(static_cast<int>(chunk / chunksX % chunksY), chunkSize, height);
+            ChunkSpan z = chunkSpan(static_cast<int>(chunk / chunksX / chunksY), chunkSize, depth);
+
+            // Overlap of the chunk and the region
+            int x0 = std::max(x.begin, region.x), x1 = std::min(x.begin + x.size, region.x + region.width);
+            int y0 = std::max(y.begin, region.y), y1 = std::min(y.begin + y.size, region.y + region.height);
+            int z0 = std::max(z.begin, region.z), z1 = std::min(z.begin + z.size, region.z + region.depth);
+            size_t row = (x1 - x0) * sampleSize;
+            for (int k = z0; k < z1; ++k) {
+                for (int j = y0; j < y1; ++j) {
+                    const unsigned char *source = voxels.data() +
+                            ((static_cast<size_t>(k - z.begin) * y.size + (j - y.begin)) * x.size + (x0 - x.begin)) *
+                            sampleSize;
+                    unsigned char *target = out +
+                            ((static_cast<size_t>(k - region.z) * region.height + (j - region.y)) * region.width +
+                             (x0 - region.x)) * sampleSize;
+                    std::memcpy(target, source, row);
+                }
+            }
+        }
+    });
+    return success;
+}
+
+bool ChunkedVolumeFile::readSlices(int begin, int end, unsigned char *out) const {
+    if (isOpen() && (begin < 0 || end < begin || end >= depth)) {
+        std::cerr << "Error: The slice range must lie within 0 <= begin <= end < depth." << std::endl;
+        return false;
+    }
+    return readRegion({0, 0, begin, width, height, end - begin + 1}, out);
+}
+
+bool ChunkedVolumeFile::load(Volume &volume) const {
+    if (!isOpen()) {
+        std::cerr << "Error: No chunked volume file is open." << std::endl;
+        return false;
+    }
+    Buffer data = BufferPool::global().acquire(static_cast<size_t>(width) * height * depth * bytesPerSample(dataType));
+    if (!readRegion({0, 0, 0, width, height, depth}, data.getData())) {
+        return false;
+    }
+    volume = Volume(width, height, depth, std::move(data), dataType);
+    return true;
+}
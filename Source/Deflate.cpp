@@ -0,0 +1,205 @@
+/**
+ * @file Deflate.cpp
+ *
+ * @brief Implements the incremental zlib encoder.
+ *
+ * Every position is entered in a hash table of its first three bytes, whose entries are chained to earlier positions
+ * with the same hash. A short walk of the chain finds the longest earlier match within the window, which is coded as
+ * a length and distance; positions without a match of at least three bytes are coded as literals. The whole stream
+ * is one fixed-Huffman block, closed by an empty final block when the stream ends.
+ *
+ * @date Created on October 19, 2026
+ *
+ * @authors
+ * Advanced Programming Group Radix Sort:
+ *   - Benjamin Duncan (edsml-bd1023)
+ *   - Boyang Hu (edsml-bh223)
+ *   - Chawk Chamoun (edsml-cc8915)
+ *   - Mingsheng Cai (acse-sc4623)
+ *   - Moyu Zhang (acse-mz223)
+ *   - Ryan Benney (acse-rgb123)
+ */
+
+#include "Deflate.h"
+
+#include <algorithm>
+#include <iterator>
+
+namespace {
+    constexpr int hashBits = 15; // log2 of the hash table size
+    constexpr int maxChain = 16; // Earlier positions tried per match search
+    constexpr size_t minMatch = 3; // Shortest back-reference of DEFLATE
+    constexpr uint32_t adlerModulus = 65521;
+
+    // Base lengths and extra bits of length symbols 257 to 285
+    constexpr uint16_t lengthBase[29] = {3, 4, 5, 6, 7, 8, 9, 10, 11, 13, 15, 17, 19, 23, 27, 31, 35, 43, 51, 59, 67,
+                                         83, 99, 115, 131, 163, 195, 227, 258};
+    constexpr uint8_t lengthExtra[29] = {0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 2, 2, 3, 3, 3, 3, 4, 4, 4, 4, 5, 5,
+                                         5, 5, 0};
+
+    // Base distances and extra bits of distance symbols 0 to 29
+    constexpr uint16_t distanceBase[30] = {1, 2, 3, 4, 5, 7, 9, 13, 17, 25, 33, 49, 65, 97, 129, 193, 257, 385, 513,
+                                           769, 1025, 1537, 2049, 3073, 4097, 6145, 8193, 12289, 16385, 24577};
+    constexpr uint8_t distanceExtra[30] = {0, 0, 0, 0, 1, 1, 2, 2, 3, 3, 4, 4, 5, 5, 6, 6, 7, 7, 8, 8, 9, 9, 10, 10, 11,
+                                           11, 12, 12, 13, 13};
+
+    // Huffman codes are sent most significant bit first into a least-significant-first bit stream
+    uint32_t reverse(uint32_t code, int length) {
+        uint32_t reversed = 0;
+        for (int b = 0; b < length; ++b) {
+            reversed |= ((code >> b) & 1) << (length - 1 - b);
+        }
+        return reversed;
+    }
+
+    uint32_t hash(const unsigned char *p) {
+        uint32_t value = static_cast<uint32_t>(p[0]) << 16 | static_cast<uint32_t>(p[1]) << 8 | p[2];
+        return (value * 2654435761u) >> (32 - hashBits);
+    }
+}
+
+DeflateStream::DeflateStream() : windowStart(0), encoded(0), head(size_t(1) << hashBits, 0),
+                                 previous(historySize, 0), bits(0), bitCount(0), adlerA(1), adlerB(0),
+                                 started(false) {}
+
+void DeflateStream::putBits(uint32_t value, int count, std::vector<unsigned char> &out) {
+    bits |= static_cast<uint64_t>(value) << bitCount;
+    bitCount += count;
+    while (bitCount >= 8) {
+        out.push_back(static_cast<unsigned char>(bits));
+        bits >>= 8;
+        bitCount -= 8;
+    }
+}
+
+void DeflateStream::putSymbol(int symbol, std::vector<unsigned char> &out) {
+    if (symbol < 144) {
+        putBits(reverse(0x30 + symbol, 8), 8, out);
+    } else if (symbol < 256) {
+        putBits(reverse(0x190 + symbol - 144, 9), 9, out);
+    } else if (symbol < 280) {
+        putBits(reverse(symbol - 256, 7), 7, out);
+    } else {
+        putBits(reverse(0xC0 + symbol - 280, 8), 8, out);
+    }
+}
+
+void DeflateStream::encodeUpTo(size_t end, std::vector<unsigned char> &out) {
+    size_t total = windowStart + window.size();
+    auto at = [&](size_t position) { return window.data() + (position - windowStart); };
+    auto insert = [&](size_t position) {
+        uint32_t h = hash(at(position));
+        previous[position % historySize] = head[h];
+        head[h] = position + 1;
+    };
+
+    size_t position = encoded;
+    while (position < end) {
+        size_t bestLength = 0, bestDistance = 0;
+        if (total - position >= minMatch) {
+            size_t limit = std::min(maxMatch, total - position);
+            const unsigned char *current = at(position);
+            size_t candidate = head[hash(current)];
+            for (int step = 0; step < maxChain && candidate; ++step) {
+                size_t earlier = candidate - 1;
+                if (earlier < windowStart || earlier >= position || position - earlier > historySize) {
+                    break;
+                }
+                const unsigned char *match = at(earlier);
+                size_t length = 0;
+                while (length < limit && match[length] == current[length]) {
+                    ++length;
+                }
+                if (length > bestLength) {
+                    bestLength = length;
+                    bestDistance = position - earlier;
+                    if (length == limit) {
+                        break;
+                    }
+                }
+                size_t next = previous[earlier % historySize];
+                if (next == 0 || next - 1 >= earlier) {
+                    break;
+                }
+                candidate = next;
+            }
+            insert(position);
+        }
+
+        if (bestLength < minMatch) {
+            putSymbol(*at(position), out);
+            ++position;
+            continue;
+        }
+        int lengthSymbol = static_cast<int>(std::upper_bound(std::begin(lengthBase), std::end(lengthBase),
+                                                             bestLength) - std::begin(lengthBase)) - 1;
+        putSymbol(257 + lengthSymbol, out);
+        putBits(static_cast<uint32_t>(bestLength - lengthBase[lengthSymbol]), lengthExtra[lengthSymbol], out);
+        int distanceSymbol = static_cast<int>(std::upper_bound(std::begin(distanceBase), std::end(distanceBase),
+                                                               bestDistance) - std::begin(distanceBase)) - 1;
+        putBits(reverse(distanceSymbol, 5), 5, out);
+        putBits(static_cast<uint32_t>(bestDistance - distanceBase[distanceSymbol]), distanceExtra[distanceSymbol], out);
+        for (size_t skipped = position + 1; skipped < position + bestLength; ++skipped) {
+            if (total - skipped >= minMatch) {
+                insert(skipped);
+            }
+        }
+        position += bestLength;
+    }
+    encoded = position;
+}
+
+void DeflateStream::write(const unsigned char *data, size_t size, std::vector<unsigned char> &out) {
+    if (!started) {
+        // zlib header for a 32 KB window with no preset dictionary, then a non-final fixed-Huffman block
+        out.push_back(0x78);
+        out.push_back(0x01);
+        putBits(0, 1, out);
+        putBits(1, 2, out);
+        started = true;
+    }
+    for (size_t done = 0; done < size;) {
+        // Adler-32 sums stay below 2^32 for 5552 bytes between reductions
+        size_t count = std::min<size_t>(size - done, 5552);
+        for (size_t i = 0; i < count; ++i) {
+            adlerA += data[done + i];
+            adlerB += adlerA;
+        }
+        adlerA %= adlerModulus;
+        adlerB %= adlerModulus;
+        done += count;
+    }
+
+    window.insert(window.end(), data, data + size);
+    size_t total = windowStart + window.size();
+    if (total > encoded + maxMatch) {
+        encodeUpTo(total - maxMatch, out);
+    }
+
+    // Drop input that has been encoded and is out of reach of later matches
+    if (encoded > windowStart + 4 * historySize) {
+        size_t drop = encoded - historySize - windowStart;
+        window.erase(window.begin(), window.begin() + static_cast<long>(drop));
+        windowStart += drop;
+    }
+}
+
+void DeflateStream::finish(std::vector<unsigned char> &out) {
+    write(nullptr, 0, out);
+    encodeUpTo(windowStart + window.size(), out);
+    putSymbol(256, out);
+
+    // An empty final block ends the stream
+    putBits(1, 1, out);
+    putBits(1, 2, out);
+    putSymbol(256, out);
+    if (bitCount > 0) {
+        putBits(0, 8 - bitCount, out);
+    }
+    for (int shift: {8, 0}) {
+        out.push_back(static_cast<unsigned char>(adlerB >> shift));
+    }
+    for (int shift: {8, 0}) {
+        out.push_back(static_cast<unsigned char>(adlerA >> shift));
+    }
+}
@@ -0,0 +1,411 @@
+/**
+ * @file FilteredVolume.cpp
+ *
+ * @brief Implements the lazy filtered view of a volume.
+ *
+ * A request for a box of the filtered volume copies the box plus the summed reach of the filters from the source into
+ * a working volume. The filters then run on shrinking boxes: the first filter covers the requested box plus the reach
+ * of all later filters, and each later filter covers less, so every filter only reads voxels the previous one has
+ * finished. Where the working volume is cut inside the source, the cut lies beyond what any filter reads; where it
+ * meets the border of the source, the filters see the same border as a full run.
+ *
+ * Fused projections give each thread a contiguous run of slabs and a partial projection of its own. A slab is filtered
+ * into a scratch buffer and folded into the partial projection slice by slice, with the SIMD kernels for 8-bit samples,
+ * and the partial projections are merged once every thread has finished. Averages are kept as sums until the merge,
+ * so every projection equals that of the fully filtered volume.
+ *
+ * @date Created on October 19, 2026
+ *
+ * @authors
+ * Advanced Programming Group Radix Sort:
+ *   - Benjamin Duncan (edsml-bd1023)
+ *   - Boyang Hu (edsml-bh223)
+ *   - Chawk Chamoun (edsml-cc8915)
+ *   - Mingsheng Cai (acse-sc4623)
+ *   - Moyu Zhang (acse-mz223)
+ *   - Ryan Benney (acse-rgb123)
+ */
+
+#include "FilteredVolume.h"
+#include "BufferPool.h"
+#include "OutputService.h"
+#include "Parallel.h"
+#include "Projection.h"
+#include "ProjectionKernels.h"
+#include "Trace.h"
+
+#include <algorithm>
+#include <cstring>
+#include <iostream>
+#include <limits>
+#include <mutex>
+#include <type_traits>
+
+namespace {
+    // Converts samples of the given type to 8-bit samples for saving
+    std::vector<unsigned char> toUInt8(DataType type, const unsigned char *data, size_t count) {
+        std::vector<unsigned char> converted(count);
+        if (type == DataType::UInt16) {
+            auto samples = reinterpret_cast<const unsigned short *>(data);
+            std::transform(samples, samples + count, converted.begin(), DataTypeTraits<unsigned short>::toUInt8);
+        } else if (type == DataType::Float32) {
+            auto samples = reinterpret_cast<const float *>(data);
+            std::transform(samples, samples + count, converted.begin(), DataTypeTraits<float>::toUInt8);
+        } else {
+            std::copy(data, data + count, converted.begin());
+        }
+        return converted;
+    }
+
+    // Projects a slab in its own sample type, returning an empty vector for an unknown projector
+    template<typename T>
+    std::vector<T> project(const std::string &projector, int width, int height, int depth, const T *samples) {
+        if (projector == "MIP") {
+            return Projection::maximumIntensityProjection(width, height, depth, samples);
+        } else if (projector == "MinIP") {
+            return Projection::minimumIntensityProjection(width, height, depth, samples);
+        } else if (projector == "AIP") {
+            return Projection::averageIntensityProjection(width, height, depth, samples);
+        } else if (projector == "MedIP") {
+            return Projection::medianIntensityProjection(width, height, depth, samples);
+        }
+        return std::vector<T>();
+    }
+}
+
+FilteredVolume::FilteredVolume(const Volume &source, size_t cacheSlices) : source(source), reach(0),
+                                                                           cacheSlices(cacheSlices),
+                                                                           computedSlices(0) {}
+
+FilteredVolume &FilteredVolume::addFilter(IFilter3D &filter) {
+    filters.push_back(&filter);
+    reach += filter.getReach();
+    recent.clear();
+    cache.clear();
+    return *this;
+}
+
+int FilteredVolume::getWidth() const {
+    return source.getWidth();
+}
+
+int FilteredVolume::getHeight() const {
+    return source.getHeight();
+}
+
+int FilteredVolume::getDepth() const {
+    return source.getDepth();
+}
+
+DataType FilteredVolume::getDataType() const {
+    return source.getDataType();
+}
+
+size_t FilteredVolume::getComputedSlices() const {
+    return computedSlices;
+}
+
+void FilteredVolume::compute(const Region3D &box, unsigned char *out) const {
+    // The box plus the reach of the whole chain, clipped to the volume
+    int x0 = std::max(0, box.x - reach), y0 = std::max(0, box.y - reach), z0 = std::max(0, box.z - reach);
+    int x1 = std::min(source.getWidth(), box.x + box.width + reach);
+    int y1 = std::min(source.getHeight(), box.y + box.height + reach);
+    int z1 = std::min(source.getDepth(), box.z + box.depth + reach);
+    size_t sampleSize = bytesPerSample(source.getDataType());
+    size_t sourceRow = source.getWidth() * sampleSize, sourceSlice = sourceRow * source.getHeight();
+    size_t workRow = (x1 - x0) * sampleSize, workSlice = workRow * (y1 - y0);
+    TRACE_SCOPE("FilteredVolume::compute", "filter", workSlice * (z1 - z0));
+
+    Buffer workData = BufferPool::global().acquire(workSlice * (z1 - z0));
+    for (int z = z0; z < z1; ++z) {
+        for (int y = y0; y < y1; ++y) {
+            std::memcpy(workData.getData() + (z - z0) * workSlice + (y - y0) * workRow,
+                        source.getData() + z * sourceSlice + y * sourceRow + x0 * sampleSize, workRow);
+        }
+    }
+    Volume work(x1 - x0, y1 - y0, z1 - z0, std::move(workData), source.getDataType());
+
+    int remaining = reach;
+    for (IFilter3D *filter: filters) {
+        remaining -= filter->getReach();
+        int fx0 = std::max(x0, box.x - remaining), fx1 = std::min(x1, box.x + box.width + remaining);
+        int fy0 = std::max(y0, box.y - remaining), fy1 = std::min(y1, box.y + box.height + remaining);
+        int fz0 = std::max(z0, box.z - remaining), fz1 = std::min(z1, box.z + box.depth + remaining);
+        filter->apply(work, {fx0 - x0, fy0 - y0, fz0 - z0, fx1 - fx0, fy1 - fy0, fz1 - fz0});
+    }
+
+    size_t boxRow = box.width * sampleSize;
+    for (int z = box.z; z < box.z + box.depth; ++z) {
+        for (int y = box.y; y < box.y + box.height; ++y) {
+            std::memcpy(out + ((z - box.z) * static_cast<size_t>(box.height) + (y - box.y)) * boxRow,
+                        work.getData() + (z - z0) * workSlice + (y - y0) * workRow + (box.x - x0) * sampleSize,
+                        boxRow);
+        }
+    }
+}
+
+void FilteredVolume::remember(int z, const unsigned char *samples) {
+    if (cacheSlices == 0) {
+        return;
+    }
+    size_t sliceBytes = static_cast<size_t>(source.getWidth()) * source.getHeight() *
+                        bytesPerSample(source.getDataType());
+    Buffer slice(sliceBytes);
+    std::memcpy(slice.getData(), samples, sliceBytes);
+    recent.push_front(z);
+    cache.insert_or_assign(z, std::make_pair(std::move(slice), recent.begin()));
+    while (cache.size() > cacheSlices) {
+        cache.erase(recent.back());
+        recent.pop_back();
+    }
+}
+
+template<typename T>
+std::vector<T> FilteredVolume::projectSlabs(const std::string &projector, int begin, int end, int slabDepth) const {
+    // Use unsigned long for integer sums to avoid overflow, and double for float samples, as Projection does
+    using Sum = std::conditional_t<std::is_floating_point_v<T>, double, unsigned long>;
+    size_t slicePixels = static_cast<size_t>(source.getWidth()) * source.getHeight();
+    bool maximum = projector == "MIP", average = projector == "AIP";
+    T initial = maximum ? std::numeric_limits<T>::lowest() : std::numeric_limits<T>::max();
+
+    std::mutex mutex;
+    std::vector<std::vector<T>> extremes; // Partial MIP or MinIP of each thread
+    std::vector<std::vector<Sum>> sums; // Partial sums of each thread for the AIP
+    size_t slabs = (static_cast<size_t>(end - begin) + slabDepth - 1) / slabDepth;
+    Parallel::forRange(slabs, [&](size_t first, size_t last) {
+        std::vector<T> extreme(average ? 0 : slicePixels, initial);
+        std::vector<Sum> sum(average ? slicePixels : 0, 0);
+        std::vector<unsigned short> partial(average && std::is_same_v<T, unsigned char> ? slicePixels : 0, 0);
+        int partialSlices = 0;
+        Buffer slab = BufferPool::global().acquire(slicePixels * slabDepth * sizeof(T));
+        for (size_t s = first; s < last; ++s) {
+            int z0 = begin + static_cast<int>(s) * slabDepth, z1 = std::min(end, z0 + slabDepth);
+            compute({0, 0, z0, source.getWidth(), source.getHeight(), z1 - z0}, slab.getData());
+            for (int z = 0; z < z1 - z0; ++z) {
+                const T *slice = reinterpret_cast<const T *>(slab.getData()) + z * slicePixels;
+                if constexpr (std::is_same_v<T, unsigned char>) {
+                    if (average) {
+                        // 8-bit samples go into 16-bit partial sums, moved into the full sums before they overflow
+                        ProjectionKernels::addInto(partial.data(), slice, slicePixels);
+                        if (++partialSlices == ProjectionKernels::flushInterval) {
+                            for (size_t i = 0; i < slicePixels; ++i) {
+                                sum[i] += partial[i];
+                                partial[i] = 0;
+                            }
+                            partialSlices = 0;
+                        }
+                    } else if (maximum) {
+                        ProjectionKernels::maxInto(extreme.data(), slice, slicePixels);
+                    } else {
+                        ProjectionKernels::minInto(extreme.data(), slice, slicePixels);
+                    }
+                } else {
+                    for (size_t i = 0; i < slicePixels; ++i) {
+                        if (average) {
+                            sum[i] += slice[i];
+                        } else {
+                            extreme[i] = maximum ? std::max(extreme[i], slice[i]) : std::min(extreme[i], slice[i]);
+                        }
+                    }
+                }
+            }
+        }
+        for (size_t i = 0; i < partial.size(); ++i) {
+            sum[i] += partial[i];
+        }
+
+        std::lock_guard<std::mutex> lock(mutex);
+        extremes.push_back(std::move(extreme));
+        sums.push_back(std::move(sum));
+    });
+
+    // Merge the partial projections
+    std::vector<T> projection(slicePixels);
+    for (size_t i = 0; i < slicePixels; ++i) {
+        if (average) {
+            Sum total = 0;
+            for (const auto &sum: sums) {
+                total += sum[i];
+            }
+            projection[i] = static_cast<T>(total / (end - begin));
+        } else {
+            T value = initial;
+            for (const auto &extreme: extremes) {
+                value = maximum ? std::max(value, extreme[i]) : std::min(value, extreme[i]);
+            }
+            projection[i] = value;
+        }
+    }
+    return projection;
+}
+
+bool FilteredVolume::getSlab(int begin, int end, Volume &out) {
+    if (!source.getData()) {
+        std::cerr << "Error: The filtered volume has no data." << std::endl;
+        return false;
+    }
+    if (begin < 0 || begin >= end || end > source.getDepth()) {
+        std::cerr << "Error: Invalid slab specified. Please ensure 0 <= begin < end <= depth." << std::endl;
+        return false;
+    }
+    int width = source.getWidth(), height = source.getHeight();
+    size_t sliceBytes = static_cast<size_t>(width) * height * bytesPerSample(source.getDataType());
+    TRACE_SCOPE("FilteredVolume::getSlab", "filter", sliceBytes * (end - begin));
+
+    Buffer slab(sliceBytes * (end - begin));
+    for (int z = begin; z < end;) {
+        auto cached = cache.find(z);
+        if (cached != cache.end()) {
+            std::memcpy(slab.getData() + (z - begin) * sliceBytes, cached->second.first.getData(), sliceBytes);
+            recent.splice(recent.begin(), recent, cached->second.second);
+            ++z;
+            continue;
+        }
+
+        // Filter the whole run of missing slices at once, so their halos are shared
+        int runEnd = z + 1;
+        while (runEnd < end && !cache.count(runEnd)) {
+            ++runEnd;
+        }
+        unsigned char *run = slab.getData() + (z - begin) * sliceBytes;
+        compute({0, 0, z, width, height, runEnd - z}, run);
+        computedSlices += runEnd - z;
+        for (int slice = z; slice < runEnd; ++slice) {
+            remember(slice, run + (slice - z) * sliceBytes);
+        }
+        z = runEnd;
+    }
+    out = Volume(width, height, end - begin, std::move(slab), source.getDataType());
+    return true;
+}
+
+std::vector<unsigned char> FilteredVolume::getSliceUInt8(const std::string &plane, int sliceIndex) {
+    int width = source.getWidth(), height = source.getHeight(), depth = source.getDepth();
+    if (plane != "x-y" && plane != "x-z" && plane != "y-z") {
+        std::cerr << "Invalid plane specified. Valid planes are 'x-y', 'x-z', and 'y-z'." << std::endl;
+        return {};
+    }
+    if (sliceIndex < 1 || sliceIndex > (plane == "x-y" ? depth : (plane == "x-z" ? height : width))) {
+        std::cerr << "Invalid slice index specified." << std::endl;
+        return {};
+    }
+
+    if (plane == "x-y") {
+        Volume slice;
+        if (!getSlab(sliceIndex - 1, sliceIndex, slice)) {
+            return {};
+        }
+        return toUInt8(slice.getDataType(), slice.getData(), static_cast<size_t>(width) * height);
+    }
+    if (!source.getData()) {
+        std::cerr << "Error: The filtered volume has no data." << std::endl;
+        return {};
+    }
+
+    // A box one voxel thick is laid out exactly as the slice, with z as its rows
+    Region3D box = plane == "x-z" ? Region3D{0, sliceIndex - 1, 0, width, 1, depth}
+                                  : Region3D{sliceIndex - 1, 0, 0, 1, height, depth};
+    size_t count = static_cast<size_t>(box.width) * box.height * box.depth;
+    Buffer samples = BufferPool::global().acquire(count * bytesPerSample(source.getDataType()));
+    compute(box, samples.getData());
+    return toUInt8(source.getDataType(), samples.getData(), count);
+}
+
+std::vector<unsigned char> FilteredVolume::getProjectionUInt8(const std::string &projector, int begin, int end,
+                                                              int slabDepth) {
+    if (projector != "MIP" && projector != "MinIP" && projector != "AIP" && projector != "MedIP") {
+        std::cerr << "Invalid projector specified. Valid projectors are 'MIP', 'MinIP', 'AIP', and 'MedIP'."
+                  << std::endl;
+        return {};
+    }
+    if (projector == "MedIP") {
+        Volume slab;
+        if (!getSlab(begin, end, slab)) {
+            return {};
+        }
+        int width = slab.getWidth(), height = slab.getHeight(), depth = slab.getDepth();
+        switch (slab.getDataType()) {
+            case DataType::UInt16: {
+                auto projection = project(projector, width, height, depth, slab.getDataAs<unsigned short>());
+                return toUInt8(DataType::UInt16, reinterpret_cast<const unsigned char *>(projection.data()),
+                               projection.size());
+            }
+            case DataType::Float32: {
+                auto projection = project(projector, width, height, depth, slab.getDataAs<float>());
+                return toUInt8(DataType::Float32, reinterpret_cast<const unsigned char *>(projection.data()),
+                               projection.size());
+            }
+            default:
+                return project(projector, width, height, depth, slab.getData());
+        }
+    }
+
+    if (!source.getData()) {
+        std::cerr << "Error: The filtered volume has no data." << std::endl;
+        return {};
+    }
+    if (begin < 0 || begin >= end || end > source.getDepth() || slabDepth < 1) {
+        std::cerr << "Error: Invalid projection range specified. Please ensure 0 <= begin < end <= depth." << std::endl;
+        return {};
+    }
+    size_t slicePixels = static_cast<size_t>(source.getWidth()) * source.getHeight();
+    TRACE_SCOPE("FilteredVolume::getProjectionUInt8", "projection",
+                slicePixels * (end - begin + 1) * bytesPerSample(source.getDataType()));
+    switch (source.getDataType()) {
+        case DataType::UInt16: {
+            auto projection = projectSlabs<unsigned short>(projector, begin, end, slabDepth);
+            return toUInt8(DataType::UInt16, reinterpret_cast<const unsigned char *>(projection.data()),
+                           projection.size());
+        }
+        case DataType::Float32: {
+            auto projection = projectSlabs<float>(projector, begin, end, slabDepth);
+            return toUInt8(DataType::Float32, reinterpret_cast<const unsigned char *>(projection.data()),
+                           projection.size());
+        }
+        default:
+            return projectSlabs<unsigned char>(projector, begin, end, slabDepth);
+    }
+}
+
+void FilteredVolume::save(const std::string &path, const std::string &plane, int sliceIndex) {
+    auto sliceData = getSliceUInt8(plane, sliceIndex);
+    if (sliceData.empty() || !OutputService::global().ensureDirectory(path)) {
+        return;
+    }
+    int sliceWidth = plane == "y-z" ? source.getHeight() : source.getWidth();
+    int sliceHeight = plane == "x-y" ? source.getHeight() : source.getDepth();
+    std::string fullPath = path + "/slice_" + std::to_string(sliceIndex) + ".png";
+    OutputService::global().writePng(fullPath, sliceWidth, sliceHeight, 1, sliceData.data());
+}
+
+void FilteredVolume::save(const std::string &path, const std::string &plane, const std::string &projector) {
+    if (plane != "x-y") {
+        std::cerr << "Invalid plane specified. Valid planes are 'x-y'." << std::endl;
+        return;
+    }
+    auto projectionData = getProjectionUInt8(projector, 0, source.getDepth());
+    if (projectionData.empty() || !OutputService::global().ensureDirectory(path)) {
+        return;
+    }
+    std::string fullPath = path + "/" + projector + ".png";
+    OutputService::global().writePng(fullPath, source.getWidth(), source.getHeight(), 1, projectionData.data());
+}
+
+void FilteredVolume::save(const std::string &path, const std::string &plane, const std::string &projector,
+                          int begin, int end) {
+    if (plane != "x-y") {
+        std::cerr << "Currently, range-based projection is only supported for the x-y plane." << std::endl;
+        return;
+    }
+    if (begin > end || begin < 1 || end > source.getDepth()) {
+        std::cerr << "Invalid range specified. Please ensure 1 <= begin <= end <= depth." << std::endl;
+        return;
+    }
+    auto projectionData = getProjectionUInt8(projector, begin - 1, end);
+    if (projectionData.empty() || !OutputService::global().ensureDirectory(path)) {
+        return;
+    }
+    std::string fullPath =
+            path + "/" + projector + "_range_" + std::to_string(begin) + "_" + std::to_string(end) + ".png";
+    OutputService::global().writePng(fullPath, source.getWidth(), source.getHeight(), 1, projectionData.data());
+}
@@ -24,10 +24,14 @@
  */
 
 #include "Filters/Box2DFilter.h"
+#include "Trace.h"
+#include "BufferPool.h"
 #include "Filters/Padding.h"
 
+#include <iostream>
 #include <stdexcept>
 #include <numeric>  // For std::accumulate
+#include <utility>
 
 Box2DFilter::Box2DFilter(int kernelSize, PaddingType paddingType) : kernelSize(kernelSize), paddingType(paddingType) {
     // Validate the kernel size
@@ -37,11 +41,20 @@ Box2DFilter::Box2DFilter(int kernelSize, PaddingType paddingType) : kernelSize(k
 }
 
 void Box2DFilter::apply(Image &image) const {
+    // 2D filters work on 8-bit samples
+    if (image.getDataType() != DataType::UInt8) {
+        std::cerr << "Box filter only supports 8-bit images." << std::endl;
+        return;
+    }
+    TRACE_SCOPE("Box2DFilter::apply", "filter",
+                static_cast<size_t>(image.getWidth()) * image.getHeight() * image.getChannels() * 2);
+
     int width = image.getWidth();
     int height = image.getHeight();
     int channels = image.getChannels();
     unsigned char *originalData = image.getData();
-    unsigned char *blurredData = new unsigned char[width * height * channels];
+    Buffer blurred = BufferPool::global().acquire(static_cast<size_t>(width) * height * channels);
+    unsigned char *blurredData = blurred.getData();
 
     // Apply the box filter to each pixel in the image
     for (int y = 0; y < height; ++y) {
@@ -54,5 +67,14 @@ void Box2DFilter::apply(Image &image) const {
         }
     }
 
-    image.updateData(blurredData);
+    image.updateData(std::move(blurred), DataType::UInt8);
+}
+
+void Box2DFilter::apply(Image &image, const Region2D &region) const {
+    Region::apply(image, region, kernelSize / 2, [this](Image &crop) { apply(crop); });
+}
+
+std::string Box2DFilter::describe() const {
+    return "Box2DFilter(kernelSize=" + std::to_string(kernelSize) + ",padding=" +
+           std::to_string(static_cast<int>(paddingType)) + ")";
 }
@@ -24,9 +24,12 @@
  */
 
 #include "Filters/EdgeFilter.h"
+#include "Trace.h"
+#include "BufferPool.h"
 
 #include <cmath>
 #include <iostream>
+#include <utility>
 
 EdgeFilter::EdgeFilter(FilterType filterType, PaddingType paddingType) : filterType(filterType),
                                                                          paddingType(paddingType) {}
@@ -37,6 +40,14 @@ bool EdgeFilter::isGrayscale(const Image &image) const {
 }
 
 void EdgeFilter::apply(Image &image) {
+    // 2D filters work on 8-bit samples
+    if (image.getDataType() != DataType::UInt8) {
+        std::cerr << "Edge detection only supports 8-bit images." << std::endl;
+        return;
+    }
+    TRACE_SCOPE("EdgeFilter::apply", "filter",
+                static_cast<size_t>(image.getWidth()) * image.getHeight() * image.getChannels() * 2);
+
     // Check if the image is in grayscale
     if (!isGrayscale(image)) {
         std::cerr << "Image must be in grayscale to apply edge detection." << std::endl;
@@ -63,10 +74,16 @@ void EdgeFilter::apply(Image &image) {
     }
 }
 
+void EdgeFilter::apply(Image &image, const Region2D &region) {
+    // Each kernel tap reads the padded window around a neighbour, so the kernels reach two pixels from the centre
+    Region::apply(image, region, 2, [this](Image &crop) { apply(crop); });
+}
+
 void EdgeFilter::applySobel(Image &image) const {
     int width = image.getWidth();
     int height = image.getHeight();
-    auto *data = new unsigned char[width * height];
+    Buffer edges = BufferPool::global().acquire(static_cast<size_t>(width) * height);
+    auto *data = edges.getData();
 
     // Sobel kernels
     const std::vector<std::vector<int>> Gx = {{-1, 0, 1},
@@ -94,13 +111,14 @@ void EdgeFilter::applySobel(Image &image) const {
         }
     }
 
-    image.updateData(data);
+    image.updateData(std::move(edges), DataType::UInt8);
 }
 
 void EdgeFilter::applyPrewitt(Image &image) const {
     int width = image.getWidth();
     int height = image.getHeight();
-    auto *data = new unsigned char[width * height];
+    Buffer edges = BufferPool::global().acquire(static_cast<size_t>(width) * height);
+    auto *data = edges.getData();
 
     // Prewitt kernels
     const std::vector<std::vector<int>> Gx = {{-1, 0, 1},
@@ -128,13 +146,14 @@ void EdgeFilter::applyPrewitt(Image &image) const {
         }
     }
 
-    image.updateData(data);
+    image.updateData(std::move(edges), DataType::UInt8);
 }
 
 void EdgeFilter::applyScharr(Image &image) const {
     int width = image.getWidth();
     int height = image.getHeight();
-    auto *data = new unsigned char[width * height];
+    Buffer edges = BufferPool::global().acquire(static_cast<size_t>(width) * height);
+    auto *data = edges.getData();
 
     // Scharr kernels
     const std::vector<std::vector<int>> Gx = {{-3,  0, 3},
@@ -162,14 +181,15 @@ void EdgeFilter::applyScharr(Image &image) const {
         }
     }
 
-    image.updateData(data);
+    image.updateData(std::move(edges), DataType::UInt8);
 }
 
 void EdgeFilter::applyRoberts(Image &image) const {
     int width = image.getWidth();
     int height = image.getHeight();
     auto *originalData = image.getData();
-    auto *data = new unsigned char[width * height];
+    Buffer edges = BufferPool::global().acquire(static_cast<size_t>(width) * height);
+    auto *data = edges.getData();
 
     // Initialize the data array with zeros
     std::fill_n(data, width * height, 0);
@@ -195,5 +215,10 @@ void EdgeFilter::applyRoberts(Image &image) const {
     }
 
     // Update the image data with the edge-detected version
-    image.updateData(data);
+    image.updateData(std::move(edges), DataType::UInt8);
+}
+
+std::string EdgeFilter::describe() const {
+    return "EdgeFilter(type=" + std::to_string(static_cast<int>(filterType)) + ",padding=" +
+           std::to_string(static_cast<int>(paddingType)) + ")";
 }
@@ -25,15 +25,31 @@
 
 #include "Filters/Gaussian3DFilter.h"
 #include "Volume.h"
+#include "Parallel.h"
+#include "Trace.h"
+#include "BufferPool.h"
 
+#include <algorithm>
 #include <cmath>
+#include <iomanip>
 #include <iostream>
+#include <sstream>
+#include <type_traits>
+#include <utility>
 
-Gaussian3DFilter::Gaussian3DFilter(double sigma, int kernelSize) : sigma(sigma), kernelSize(kernelSize) {
+Gaussian3DFilter::Gaussian3DFilter(double sigma, int kernelSize, GaussianMode mode)
+        : sigma(sigma), kernelSize(kernelSize), mode(mode), fixedShift(0) {
     // Validate the kernel size
     if (kernelSize % 2 == 0) {
         throw std::invalid_argument("Kernel size must be an odd number.");
     }
+
+    // The kernel is the same for every pass, so compute it once
+    kernel = computeGaussian1DKernel();
+    fixedKernel = GaussianKernel::quantise(kernel, fixedShift);
+    if (mode == GaussianMode::Recursive) {
+        recursive.emplace(sigma);
+    }
 }
 
 std::vector<double> Gaussian3DFilter::computeGaussian1DKernel() const {
@@ -57,102 +73,301 @@ std::vector<double> Gaussian3DFilter::computeGaussian1DKernel() const {
     return kernel;
 }
 
-void Gaussian3DFilter::applyGaussian1DFilter_X(std::vector<unsigned char> &data, int width, int height, int depth) {
-    // Compute the 1D Gaussian kernel
-    auto kernel = computeGaussian1DKernel();
-    int halfSize = kernelSize / 2;
-    std::vector<unsigned char> temp(data.size(), 0);
+template<typename T>
+void Gaussian3DFilter::convolveTaps(const T *const *taps, T *out, int lines) const {
+    int tapCount = static_cast<int>(kernel.size());
 
-    for (int z = 0; z < depth; ++z) {
-        for (int y = 0; y < height; ++y) {
-            for (int x = 0; x < width; ++x) {
-                double weightedSum = 0.0;
-                for (int k = -halfSize; k <= halfSize; ++k) {
-                    int xk = std::max(0, std::min(x + k, width - 1));
-                    weightedSum +=
-                            static_cast<double>(data[z * width * height + y * width + xk]) * kernel[k + halfSize];
+    if constexpr (std::is_same_v<T, unsigned char>) {
+        if (mode == GaussianMode::FixedPoint) {
+            // Integer sums start at half a unit so that the final shift rounds to nearest
+            unsigned int rounding = fixedShift > 0 ? 1u << (fixedShift - 1) : 0u;
+            unsigned int weightedSum[accumulatorBlock];
+            for (int l0 = 0; l0 < lines; l0 += accumulatorBlock) {
+                int count = std::min(accumulatorBlock, lines - l0);
+                std::fill(weightedSum, weightedSum + count, rounding);
+                for (int k = 0; k < tapCount; ++k) {
+                    const unsigned char *sample = taps[k] + l0;
+                    unsigned int weight = fixedKernel[k];
+                    for (int l = 0; l < count; ++l) {
+                        weightedSum[l] += sample[l] * weight;
+                    }
+                }
+                for (int l = 0; l < count; ++l) {
+                    out[l0 + l] = static_cast<unsigned char>(weightedSum[l] >> fixedShift);
                 }
-                temp[z * width * height + y * width + x] =
-                        static_cast<unsigned char>(std::max(0.0, std::min(255.0, std::round(weightedSum))));
             }
+            return;
         }
     }
 
-    data = std::move(temp);
+    double weightedSum[accumulatorBlock];
+    for (int l0 = 0; l0 < lines; l0 += accumulatorBlock) {
+        int count = std::min(accumulatorBlock, lines - l0);
+        std::fill(weightedSum, weightedSum + count, 0.0);
+        for (int k = 0; k < tapCount; ++k) {
+            const T *sample = taps[k] + l0;
+            double weight = kernel[k];
+            for (int l = 0; l < count; ++l) {
+                weightedSum[l] += static_cast<double>(sample[l]) * weight;
+            }
+        }
+        for (int l = 0; l < count; ++l) {
+            out[l0 + l] = DataTypeTraits<T>::fromDouble(weightedSum[l]);
+        }
+    }
 }
 
-void Gaussian3DFilter::applyGaussian1DFilter_Y(std::vector<unsigned char> &data, int width, int height, int depth) {
-    // Compute the 1D Gaussian kernel
-    auto kernel = computeGaussian1DKernel();
-    int halfSize = kernelSize / 2;
-    std::vector<unsigned char> temp(data.size(), 0);
-
-    for (int z = 0; z < depth; ++z) {
-        for (int x = 0; x < width; ++x) {
-            for (int y = 0; y < height; ++y) {
-                double weightedSum = 0.0;
-                for (int k = -halfSize; k <= halfSize; ++k) {
-                    int yk = std::max(0, std::min(y + k, height - 1));
-                    weightedSum +=
-                            static_cast<double>(data[z * height * width + yk * width + x]) * kernel[k + halfSize];
+template<typename T>
+void Gaussian3DFilter::convolveLines(const T *src, T *dst, int length, size_t sampleStride, int lines) const {
+    if (recursive) {
+        // Gather a block of lines into double precision, run the recursion over them and convert back
+        Buffer blockBuffer = BufferPool::global().acquire(
+                static_cast<size_t>(length) * std::min(lines, recursiveBlock) * sizeof(double));
+        auto *buffer = reinterpret_cast<double *>(blockBuffer.getData());
+        for (int l0 = 0; l0 < lines; l0 += recursiveBlock) {
+            int count = std::min(recursiveBlock, lines - l0);
+            for (int i = 0; i < length; ++i) {
+                std::copy(src + i * sampleStride + l0, src + i * sampleStride + l0 + count, &buffer[i * count]);
+            }
+            recursive->filterLines(buffer, length, count, count);
+            for (int i = 0; i < length; ++i) {
+                for (int l = 0; l < count; ++l) {
+                    dst[i * sampleStride + l0 + l] = DataTypeTraits<T>::fromDouble(buffer[i * count + l]);
                 }
-                temp[z * height * width + y * width + x] =
-                        static_cast<unsigned char>(std::max(0.0, std::min(255.0, std::round(weightedSum))));
             }
         }
+        return;
     }
 
-    data = std::move(temp);
+    int halfSize = static_cast<int>(kernel.size()) / 2;
+    std::vector<const T *> taps(kernel.size());
+
+    for (int i = 0; i < length; ++i) {
+        for (int k = -halfSize; k <= halfSize; ++k) {
+            // Replicate the edge samples when the kernel runs off either end of the line
+            int ik = std::max(0, std::min(i + k, length - 1));
+            taps[k + halfSize] = src + ik * sampleStride;
+        }
+        convolveTaps(taps.data(), dst + i * sampleStride, lines);
+    }
 }
 
-void Gaussian3DFilter::applyGaussian1DFilter_Z(std::vector<unsigned char> &data, int width, int height, int depth) {
-    // Compute the 1D Gaussian kernel
-    auto kernel = computeGaussian1DKernel();
-    int halfSize = kernelSize / 2;
-    std::vector<unsigned char> temp(data.size(), 0);
+template<typename T>
+void Gaussian3DFilter::applyGaussian1DFilter_X(const T *src, T *dst, int width, int height, int depth) {
+    // Every row is an independent line of contiguous samples
+    Parallel::forRange(static_cast<size_t>(height) * depth, [&](size_t begin, size_t end) {
+        for (size_t row = begin; row < end; ++row) {
+            convolveLines(src + row * width, dst + row * width, width, 1, 1);
+        }
+    });
+}
 
-    for (int z = 0; z < depth; ++z) {
-        for (int y = 0; y < height; ++y) {
-            for (int x = 0; x < width; ++x) {
-                double weightedSum = 0.0;
-                for (int k = -halfSize; k <= halfSize; ++k) {
-                    int zk = std::max(0, std::min(z + k, depth - 1));
-                    weightedSum +=
-                            static_cast<double>(data[zk * height * width + y * width + x]) * kernel[k + halfSize];
-                }
-                temp[z * height * width + y * width + x] =
-                        static_cast<unsigned char>(std::max(0.0, std::min(255.0, std::round(weightedSum))));
+template<typename T>
+void Gaussian3DFilter::applyGaussian1DFilter_Y(const T *src, T *dst, int width, int height, int depth) {
+    // Convolve whole rows at once so that every read is contiguous, one x-y plane per task
+    Parallel::forRange(depth, [&](size_t begin, size_t end) {
+        for (size_t z = begin; z < end; ++z) {
+            size_t plane = z * width * height;
+            for (int x = 0; x < width; x += lineBlock) {
+                convolveLines(src + plane + x, dst + plane + x, height, width, std::min(lineBlock, width - x));
             }
         }
-    }
+    });
+}
 
-    data = std::move(temp);
+template<typename T>
+void Gaussian3DFilter::applyGaussian1DFilter_Z(const T *src, T *dst, int width, int height, int depth) {
+    // Convolve blocks of z-columns at once so that every read is contiguous, splitting the columns across threads
+    size_t sliceSize = static_cast<size_t>(width) * height;
+    Parallel::forRange(sliceSize, [&](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; i += lineBlock) {
+            int lines = static_cast<int>(std::min<size_t>(lineBlock, end - i));
+            convolveLines(src + i, dst + i, depth, sliceSize, lines);
+        }
+    }, recursiveBlock);
 }
 
 void Gaussian3DFilter::apply(Volume &volume) {
+    // Dispatch to the passes compiled for the volume's sample type
+    switch (volume.getDataType()) {
+        case DataType::UInt16:
+            filterVolume<unsigned short>(volume);
+            break;
+        case DataType::Float32:
+            filterVolume<float>(volume);
+            break;
+        default:
+            filterVolume<unsigned char>(volume);
+            break;
+    }
+}
+
+void Gaussian3DFilter::apply(Volume &volume, const Region3D &region) {
+    Region::apply(volume, region, getReach(), [this](Volume &crop) { apply(crop); });
+}
+
+int Gaussian3DFilter::getReach() const {
+    // The recursive filter has no finite reach; beyond 4 sigma its weights are negligible
+    return mode == GaussianMode::Recursive ? static_cast<int>(std::ceil(4.0 * sigma)) : kernelSize / 2;
+}
+
+template<typename T>
+void Gaussian3DFilter::filterVolume(Volume &volume) {
     int width = volume.getWidth();
     int height = volume.getHeight();
     int depth = volume.getDepth();
+    size_t passBytes = static_cast<size_t>(width) * height * depth * sizeof(T) * 2;
+    TRACE_SCOPE("Gaussian3DFilter::apply", "filter", passBytes * 3);
 
-    // Get the original data
-    const unsigned char *originalData = volume.getData();
-
-    // Copy the original data to a new vector
-    std::vector<unsigned char> data(originalData, originalData + width * height * depth);
+    // The passes run volume -> scratch -> volume -> scratch, and the scratch buffer then becomes the volume's data
+    T *data = volume.getDataAs<T>();
+    Buffer scratchBuffer = volume.takeSpareBuffer(DataTypeTraits<T>::type);
+    T *scratch = reinterpret_cast<T *>(scratchBuffer.getData());
 
     std::cout << "Applying Gaussian filter on X-axis..." << std::endl;
-    applyGaussian1DFilter_X(data, width, height, depth);
+    {
+        TRACE_SCOPE("Gaussian3DFilter X pass", "filter", passBytes);
+        applyGaussian1DFilter_X(data, scratch, width, height, depth);
+    }
     std::cout << "Completed X-axis filtering." << std::endl;
 
     std::cout << "Applying Gaussian filter on Y-axis..." << std::endl;
-    applyGaussian1DFilter_Y(data, width, height, depth);
+    {
+        TRACE_SCOPE("Gaussian3DFilter Y pass", "filter", passBytes);
+        applyGaussian1DFilter_Y(scratch, data, width, height, depth);
+    }
     std::cout << "Completed Y-axis filtering." << std::endl;
 
     std::cout << "Applying Gaussian filter on Z-axis..." << std::endl;
-    applyGaussian1DFilter_Z(data, width, height, depth);
+    {
+        TRACE_SCOPE("Gaussian3DFilter Z pass", "filter", passBytes);
+        applyGaussian1DFilter_Z(data, scratch, width, height, depth);
+    }
     std::cout << "Completed Z-axis filtering." << std::endl;
 
-    volume.updateData(data);
+    volume.updateData(std::move(scratchBuffer), DataTypeTraits<T>::type);
+
+    std::cout << "Gaussian 3D Filter application completed." << std::endl;
+}
+
+void Gaussian3DFilter::apply(BrickedVolume &volume) {
+    int width = volume.getWidth();
+    int height = volume.getHeight();
+    int depth = volume.getDepth();
+    int brickSize = volume.getBrickSize();
+    TRACE_SCOPE("Gaussian3DFilter::apply bricked", "filter", static_cast<size_t>(width) * height * depth * 6);
+
+    // Lines are filtered in place: each tile is read completely before it is written back
+    std::vector<unsigned char> line(width), filteredLine(width);
+    std::vector<unsigned char> tile(static_cast<size_t>(brickSize) * std::max(height, depth));
+    std::vector<unsigned char> filteredTile(tile.size());
+
+    std::cout << "Applying Gaussian filter on X-axis..." << std::endl;
+    for (int z = 0; z < depth; ++z) {
+        for (int y = 0; y < height; ++y) {
+            volume.readSpanX(0, y, z, width, line.data());
+            convolveLines(line.data(), filteredLine.data(), width, 1, 1);
+            volume.writeSpanX(0, y, z, width, filteredLine.data());
+        }
+    }
+    std::cout << "Completed X-axis filtering." << std::endl;
+
+    // Along y and z, gather one brick-wide strip of rows and convolve all of its columns together
+    std::cout << "Applying Gaussian filter on Y-axis..." << std::endl;
+    for (int z = 0; z < depth; ++z) {
+        for (int x = 0; x < width; x += brickSize) {
+            int lines = std::min(brickSize, width - x);
+            for (int y = 0; y < height; ++y) {
+                volume.readSpanX(x, y, z, lines, &tile[y * lines]);
+            }
+            convolveLines(tile.data(), filteredTile.data(), height, lines, lines);
+            for (int y = 0; y < height; ++y) {
+                volume.writeSpanX(x, y, z, lines, &filteredTile[y * lines]);
+            }
+        }
+    }
+    std::cout << "Completed Y-axis filtering." << std::endl;
+
+    std::cout << "Applying Gaussian filter on Z-axis..." << std::endl;
+    for (int y = 0; y < height; ++y) {
+        for (int x = 0; x < width; x += brickSize) {
+            int lines = std::min(brickSize, width - x);
+            for (int z = 0; z < depth; ++z) {
+                volume.readSpanX(x, y, z, lines, &tile[z * lines]);
+            }
+            convolveLines(tile.data(), filteredTile.data(), depth, lines, lines);
+            for (int z = 0; z < depth; ++z) {
+                volume.writeSpanX(x, y, z, lines, &filteredTile[z * lines]);
+            }
+        }
+    }
+    std::cout << "Completed Z-axis filtering." << std::endl;
 
     std::cout << "Gaussian 3D Filter application completed." << std::endl;
 }
+
+bool Gaussian3DFilter::apply(const VolumeStream &input, const std::string &outputDirectory) {
+    int width = input.getWidth();
+    int height = input.getHeight();
+    int depth = input.getDepth();
+    if (depth == 0) {
+        std::cerr << "Error: No slices available for streaming Gaussian filter." << std::endl;
+        return false;
+    }
+    if (recursive) {
+        std::cerr << "Error: The recursive Gaussian mode cannot be streamed." << std::endl;
+        return false;
+    }
+    TRACE_SCOPE("Gaussian3DFilter::apply streamed", "filter", static_cast<size_t>(width) * height * depth * 6);
+
+    int halfSize = kernelSize / 2;
+    size_t sliceSize = static_cast<size_t>(width) * height;
+
+    // Sliding window of slices that have already been filtered along X and Y
+    int windowSize = std::min(kernelSize, depth);
+    std::vector<std::vector<unsigned char>> window(windowSize, std::vector<unsigned char>(sliceSize));
+    std::vector<unsigned char> slice(sliceSize), rowFiltered(sliceSize), output(sliceSize);
+    std::vector<const unsigned char *> taps(kernelSize);
+    int loaded = 0;
+
+    std::cout << "Applying streaming Gaussian filter to " << depth << " slices..." << std::endl;
+    for (int z = 0; z < depth; ++z) {
+        // Read every slice that the Z-axis kernel of this output slice reaches
+        while (loaded < depth && loaded <= z + halfSize) {
+            if (!input.readSlice(loaded, slice.data())) {
+                return false;
+            }
+            for (int y = 0; y < height; ++y) {
+                convolveLines(&slice[y * width], &rowFiltered[y * width], width, 1, 1);
+            }
+            unsigned char *filtered = window[loaded % windowSize].data();
+            for (int x = 0; x < width; x += lineBlock) {
+                convolveLines(&rowFiltered[x], filtered + x, height, width, std::min(lineBlock, width - x));
+            }
+            ++loaded;
+        }
+
+        // Z-axis pass over the window, summing in the same order as applyGaussian1DFilter_Z
+        for (int k = -halfSize; k <= halfSize; ++k) {
+            int zk = std::max(0, std::min(z + k, depth - 1));
+            taps[k + halfSize] = window[zk % windowSize].data();
+        }
+        convolveTaps(taps.data(), output.data(), static_cast<int>(sliceSize));
+
+        // The output slice is final, so write it straight away
+        if (!VolumeStream::writeSlice(outputDirectory, z, width, height, output.data())) {
+            return false;
+        }
+    }
+
+    std::cout << "Streaming Gaussian 3D Filter application completed." << std::endl;
+    return true;
+}
+
+std::string Gaussian3DFilter::describe() const {
+    // Sigma is written with enough digits to tell every pair of doubles apart
+    std::ostringstream description;
+    description << std::setprecision(17) << "Gaussian3DFilter(sigma=" << sigma << ",kernelSize=" << kernelSize
+                << ",mode=" << static_cast<int>(mode) << ")";
+    return description.str();
+}
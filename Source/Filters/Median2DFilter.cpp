@@ -24,11 +24,15 @@
  */
 
 #include "Filters/Median2DFilter.h"
+#include "Trace.h"
+#include "BufferPool.h"
 #include "Filters/Padding.h"
 #include "Algorithm.h"
 
 #include <vector>
+#include <iostream>
 #include <stdexcept>
+#include <utility>
 
 Median2DFilter::Median2DFilter(int kernelSize, PaddingType paddingType) : kernelSize(kernelSize), paddingType(paddingType) {
     // Validate kernel size
@@ -38,13 +42,22 @@ Median2DFilter::Median2DFilter(int kernelSize, PaddingType paddingType) : kernel
 }
 
 void Median2DFilter::apply(Image &image) const {
+    // 2D filters work on 8-bit samples
+    if (image.getDataType() != DataType::UInt8) {
+        std::cerr << "Median filter only supports 8-bit images." << std::endl;
+        return;
+    }
+    TRACE_SCOPE("Median2DFilter::apply", "filter",
+                static_cast<size_t>(image.getWidth()) * image.getHeight() * image.getChannels() * 2);
+
     int width = image.getWidth();
     int height = image.getHeight();
     int channels = image.getChannels();
     unsigned char* originalData = image.getData();
 
     // Allocate memory for filtered image data
-    unsigned char* filteredData = new unsigned char[width * height * channels];
+    Buffer filtered = BufferPool::global().acquire(static_cast<size_t>(width) * height * channels);
+    unsigned char* filteredData = filtered.getData();
 
     // Apply median filter to each pixel in the image
     for (int y = 0; y < height; ++y) {
@@ -56,7 +69,11 @@ void Median2DFilter::apply(Image &image) const {
         }
     }
 
-    image.updateData(filteredData);
+    image.updateData(std::move(filtered), DataType::UInt8);
+}
+
+void Median2DFilter::apply(Image &image, const Region2D &region) const {
+    Region::apply(image, region, kernelSize / 2, [this](Image &crop) { apply(crop); });
 }
 
 unsigned char Median2DFilter::median(std::vector<unsigned char>& window) {
@@ -73,3 +90,8 @@ unsigned char Median2DFilter::median(std::vector<unsigned char>& window) {
         return Algorithm::quickSelect(window, 0, size - 1, size / 2);
     }
 }
+
+std::string Median2DFilter::describe() const {
+    return "Median2DFilter(kernelSize=" + std::to_string(kernelSize) + ",padding=" +
+           std::to_string(static_cast<int>(paddingType)) + ")";
+}
@@ -24,9 +24,12 @@
  */
 
 #include "Filters/Median3DFilter.h"
+#include "Trace.h"
 #include "Algorithm.h"
 
+#include <algorithm>
 #include <iostream>
+#include <utility>
 #include <vector>
 
 Median3DFilter::Median3DFilter(int kernelSize) : kernelSize(kernelSize) {
@@ -34,21 +37,20 @@ Median3DFilter::Median3DFilter(int kernelSize) : kernelSize(kernelSize) {
     if (kernelSize % 2 == 0) {
         throw std::invalid_argument("Kernel size must be an odd number.");
     }
+    precomputeNeighborhoodOffsets();
 }
 
-void Median3DFilter::precomputeNeighborhoodOffsets(int width, int height, int depth) {
+void Median3DFilter::precomputeNeighborhoodOffsets() {
     // Calculate the offset for the neighborhood
     int offset = kernelSize / 2;
     neighborhoodOffsets.clear();
 
-    // Iterate through each possible offset within the kernel's neighborhood
+    // Iterate through each possible offset within the kernel's neighborhood; neighbours outside the volume are skipped
+    // when the offsets are applied
     for (int dz = -offset; dz <= offset; ++dz) {
         for (int dy = -offset; dy <= offset; ++dy) {
             for (int dx = -offset; dx <= offset; ++dx) {
-                // Ensure we're within bounds when applying offsets
-                if (dx >= -width && dx < width && dy >= -height && dy < height && dz >= -depth && dz < depth) {
-                    neighborhoodOffsets.push_back({dx, dy, dz});
-                }
+                neighborhoodOffsets.push_back({dx, dy, dz});
             }
         }
     }
@@ -68,22 +70,16 @@ unsigned char Median3DFilter::calculateMedian(std::vector<unsigned char>& neighb
     }
 }
 
-void Median3DFilter::apply(Volume& volume) {
-    std::cout << "Applying median filter with histogram optimization..." << std::endl;
-    precomputeNeighborhoodOffsets(volume.getWidth(), volume.getHeight(), volume.getDepth());
-
-    int width = volume.getWidth();
-    int height = volume.getHeight();
-    int depth = volume.getDepth();
-    std::vector<unsigned char> filteredData(width * height * depth, 0);
-
+void Median3DFilter::filterRegion(const unsigned char *region, int regionWidth, int regionHeight, int regionDepth,
+                                  int x0, int y0, int z0, int blockWidth, int blockHeight, int blockDepth,
+                                  unsigned char *out) const {
     // Initialize histogram
     std::vector<int> histogram(256, 0);
     int medianIdx = (kernelSize * kernelSize * kernelSize) / 2;
 
-    for (int z = 0; z < depth; ++z) {
-        for (int y = 0; y < height; ++y) {
-            for (int x = 0; x < width; ++x) {
+    for (int z = z0; z < z0 + blockDepth; ++z) {
+        for (int y = y0; y < y0 + blockHeight; ++y) {
+            for (int x = x0; x < x0 + blockWidth; ++x) {
                 std::fill(histogram.begin(), histogram.end(), 0);
 
                 // Build histogram for current neighborhood
@@ -92,8 +88,8 @@ void Median3DFilter::apply(Volume& volume) {
                     int ny = y + offset[1];
                     int nz = z + offset[2];
 
-                    if (nx >= 0 && nx < width && ny >= 0 && ny < height && nz >= 0 && nz < depth) {
-                        int voxelValue = volume.getData()[nz * width * height + ny * width + nx];
+                    if (nx >= 0 && nx < regionWidth && ny >= 0 && ny < regionHeight && nz >= 0 && nz < regionDepth) {
+                        int voxelValue = region[(static_cast<size_t>(nz) * regionHeight + ny) * regionWidth + nx];
                         histogram[voxelValue]++;
                     }
                 }
@@ -103,14 +99,202 @@ void Median3DFilter::apply(Volume& volume) {
                 for (int i = 0; i < 256; ++i) {
                     count += histogram[i];
                     if (count > medianIdx) {
-                        filteredData[z * width * height + y * width + x] = i;
+                        out[(static_cast<size_t>(z - z0) * blockHeight + (y - y0)) * blockWidth + (x - x0)] = i;
                         break;
                     }
                 }
             }
         }
     }
+}
+
+template<typename T>
+void Median3DFilter::selectRegion(const T *region, int regionWidth, int regionHeight, int regionDepth, int x0, int y0,
+                                  int z0, int blockWidth, int blockHeight, int blockDepth, T *out) const {
+    std::vector<T> neighborhood;
+    neighborhood.reserve(neighborhoodOffsets.size());
+    size_t medianIdx = (kernelSize * kernelSize * kernelSize) / 2;
+
+    for (int z = z0; z < z0 + blockDepth; ++z) {
+        for (int y = y0; y < y0 + blockHeight; ++y) {
+            for (int x = x0; x < x0 + blockWidth; ++x) {
+                neighborhood.clear();
+
+                // Gather the in-bounds neighbours of the current voxel
+                for (const auto& offset : neighborhoodOffsets) {
+                    int nx = x + offset[0];
+                    int ny = y + offset[1];
+                    int nz = z + offset[2];
+
+                    if (nx >= 0 && nx < regionWidth && ny >= 0 && ny < regionHeight && nz >= 0 && nz < regionDepth) {
+                        neighborhood.push_back(region[(static_cast<size_t>(nz) * regionHeight + ny) * regionWidth + nx]);
+                    }
+                }
+
+                // Select the element at the median index, as the histogram search does for 8-bit voxels
+                if (neighborhood.size() > medianIdx) {
+                    std::nth_element(neighborhood.begin(), neighborhood.begin() + medianIdx, neighborhood.end());
+                    out[(static_cast<size_t>(z - z0) * blockHeight + (y - y0)) * blockWidth + (x - x0)] =
+                            neighborhood[medianIdx];
+                }
+            }
+        }
+    }
+}
+
+void Median3DFilter::apply(Volume& volume) {
+    TRACE_SCOPE("Median3DFilter::apply", "filter",
+                static_cast<size_t>(volume.getWidth()) * volume.getHeight() * volume.getDepth() *
+                bytesPerSample(volume.getDataType()) * 2);
+
+    int width = volume.getWidth();
+    int height = volume.getHeight();
+    int depth = volume.getDepth();
+    size_t size = static_cast<size_t>(width) * height * depth;
+
+    // The output goes to a spare buffer; voxels without enough in-bounds neighbours are left at zero as before
+    size_t bytes = size * bytesPerSample(volume.getDataType());
+    Buffer filtered = volume.takeSpareBuffer(volume.getDataType());
+    std::fill_n(filtered.getData(), bytes, 0);
+
+    // Wider sample types are filtered by selection instead of a 256-bin histogram
+    if (volume.getDataType() == DataType::UInt16) {
+        std::cout << "Applying median filter to 16-bit volume..." << std::endl;
+        selectRegion(volume.getDataAs<unsigned short>(), width, height, depth, 0, 0, 0, width, height, depth,
+                     reinterpret_cast<unsigned short *>(filtered.getData()));
+        volume.updateData(std::move(filtered), DataType::UInt16);
+        std::cout << "Median filter applied." << std::endl;
+        return;
+    }
+    if (volume.getDataType() == DataType::Float32) {
+        std::cout << "Applying median filter to float volume..." << std::endl;
+        selectRegion(volume.getDataAs<float>(), width, height, depth, 0, 0, 0, width, height, depth,
+                     reinterpret_cast<float *>(filtered.getData()));
+        volume.updateData(std::move(filtered), DataType::Float32);
+        std::cout << "Median filter applied." << std::endl;
+        return;
+    }
+
+    std::cout << "Applying median filter with histogram optimization..." << std::endl;
+    filterRegion(volume.getData(), width, height, depth, 0, 0, 0, width, height, depth, filtered.getData());
+
+    volume.updateData(std::move(filtered), DataType::UInt8);
+    std::cout << "Median filter applied with histogram optimization." << std::endl;
+}
+
+void Median3DFilter::apply(Volume &volume, const Region3D &region) {
+    Region::apply(volume, region, getReach(), [this](Volume &crop) { apply(crop); });
+}
+
+int Median3DFilter::getReach() const {
+    return kernelSize / 2;
+}
+
+void Median3DFilter::apply(BrickedVolume& volume) {
+    TRACE_SCOPE("Median3DFilter::apply bricked", "filter",
+                static_cast<size_t>(volume.getWidth()) * volume.getHeight() * volume.getDepth() * 2);
+    std::cout << "Applying median filter with histogram optimization..." << std::endl;
+
+    int width = volume.getWidth();
+    int height = volume.getHeight();
+    int depth = volume.getDepth();
+    int brickSize = volume.getBrickSize();
+    int offset = kernelSize / 2;
+    BrickedVolume filtered(width, height, depth, brickSize, volume.getBrickOrder());
+
+    std::vector<unsigned char> region;
+    std::vector<unsigned char> block(static_cast<size_t>(brickSize) * brickSize * brickSize);
+
+    for (int bz = 0; bz < volume.getBricksZ(); ++bz) {
+        for (int by = 0; by < volume.getBricksY(); ++by) {
+            for (int bx = 0; bx < volume.getBricksX(); ++bx) {
+                // Output extent of this brick
+                int x0 = bx * brickSize, y0 = by * brickSize, z0 = bz * brickSize;
+                int blockWidth = std::min(brickSize, width - x0);
+                int blockHeight = std::min(brickSize, height - y0);
+                int blockDepth = std::min(brickSize, depth - z0);
+
+                // Gather the brick plus its kernel halo, clipped to the volume bounds
+                int rx0 = std::max(0, x0 - offset), rx1 = std::min(width, x0 + blockWidth + offset);
+                int ry0 = std::max(0, y0 - offset), ry1 = std::min(height, y0 + blockHeight + offset);
+                int rz0 = std::max(0, z0 - offset), rz1 = std::min(depth, z0 + blockDepth + offset);
+                int regionWidth = rx1 - rx0, regionHeight = ry1 - ry0, regionDepth = rz1 - rz0;
+                region.resize(static_cast<size_t>(regionWidth) * regionHeight * regionDepth);
+                for (int z = rz0; z < rz1; ++z) {
+                    for (int y = ry0; y < ry1; ++y) {
+                        volume.readSpanX(rx0, y, z, regionWidth,
+                                         &region[(static_cast<size_t>(z - rz0) * regionHeight + (y - ry0)) * regionWidth]);
+                    }
+                }
+
+                // Voxels whose neighbourhood never reaches the median index stay zero, as in the linear version
+                std::fill(block.begin(), block.end(), 0);
+                filterRegion(region.data(), regionWidth, regionHeight, regionDepth, x0 - rx0, y0 - ry0, z0 - rz0,
+                             blockWidth, blockHeight, blockDepth, block.data());
+
+                for (int z = 0; z < blockDepth; ++z) {
+                    for (int y = 0; y < blockHeight; ++y) {
+                        filtered.writeSpanX(x0, y0 + y, z0 + z, blockWidth,
+                                            &block[(static_cast<size_t>(z) * blockHeight + y) * blockWidth]);
+                    }
+                }
+            }
+        }
+    }
 
-    volume.updateData(filteredData);
+    volume = std::move(filtered);
     std::cout << "Median filter applied with histogram optimization." << std::endl;
-}
\ No newline at end of file
+}
+
+bool Median3DFilter::apply(const VolumeStream &input, const std::string &outputDirectory) {
+    int width = input.getWidth();
+    int height = input.getHeight();
+    int depth = input.getDepth();
+    if (depth == 0) {
+        std::cerr << "Error: No slices available for streaming median filter." << std::endl;
+        return false;
+    }
+    TRACE_SCOPE("Median3DFilter::apply streamed", "filter", static_cast<size_t>(width) * height * depth * 2);
+
+    std::cout << "Applying streaming median filter to " << depth << " slices..." << std::endl;
+
+    int offset = kernelSize / 2;
+    size_t sliceSize = static_cast<size_t>(width) * height;
+
+    // Sliding window of raw input slices
+    int windowSize = std::min(kernelSize, depth);
+    std::vector<std::vector<unsigned char>> window(windowSize, std::vector<unsigned char>(sliceSize));
+    std::vector<unsigned char> region(sliceSize * windowSize), output(sliceSize);
+    int loaded = 0;
+
+    for (int z = 0; z < depth; ++z) {
+        // Read every slice that the kernel of this output slice reaches
+        while (loaded < depth && loaded <= z + offset) {
+            if (!input.readSlice(loaded, window[loaded % windowSize].data())) {
+                return false;
+            }
+            ++loaded;
+        }
+
+        // Stack the slices in reach into a region clipped to the volume bounds and filter its middle slice
+        int rz0 = std::max(0, z - offset), rz1 = std::min(depth, z + offset + 1);
+        for (int zk = rz0; zk < rz1; ++zk) {
+            std::copy(window[zk % windowSize].begin(), window[zk % windowSize].end(),
+                      region.begin() + (zk - rz0) * sliceSize);
+        }
+        std::fill(output.begin(), output.end(), 0);
+        filterRegion(region.data(), width, height, rz1 - rz0, 0, 0, z - rz0, width, height, 1, output.data());
+
+        // The output slice is final, so write it straight away
+        if (!VolumeStream::writeSlice(outputDirectory, z, width, height, output.data())) {
+            return false;
+        }
+    }
+
+    std::cout << "Streaming median filter applied." << std::endl;
+    return true;
+}
+
+std::string Median3DFilter::describe() const {
+    return "Median3DFilter(kernelSize=" + std::to_string(kernelSize) + ")";
+}
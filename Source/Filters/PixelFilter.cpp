@@ -23,11 +23,16 @@
  */
 
 #include "Filters/PixelFilter.h"
+#include "Trace.h"
+#include "BufferPool.h"
 #include <algorithm>
 #include <cmath>
+#include <iomanip>
 #include <iostream>
+#include <sstream>
 #include <ctime>
 #include <cstdlib>
+#include <utility>
 
 PixelFilter::PixelFilter(const std::string &type, const std::optional<int> &brightness,
                          const std::string &space, int threshold, double percentage) :
@@ -47,6 +52,14 @@ PixelFilter::PixelFilter(const std::string &type, const std::optional<int> &brig
 }
 
 void PixelFilter::apply(Image &image) {
+    // 2D filters work on 8-bit samples
+    if (image.getDataType() != DataType::UInt8) {
+        std::cerr << "Pixel filters only support 8-bit images." << std::endl;
+        return;
+    }
+    TRACE_SCOPE("PixelFilter::apply", "filter",
+                static_cast<size_t>(image.getWidth()) * image.getHeight() * image.getChannels() * 2);
+
     // Implement the pixel-level image filtering operations
     if (filterType == "Grayscale") {
         // Grayscale conversion
@@ -68,6 +81,11 @@ void PixelFilter::apply(Image &image) {
     }
 }
 
+void PixelFilter::apply(Image &image, const Region2D &region) {
+    // Pixel operations read no neighbours
+    Region::apply(image, region, 0, [this](Image &crop) { apply(crop); });
+}
+
 void PixelFilter::convertToGrayscale(Image &image) {
     // Implement the conversion of an RGB image to grayscale
     int width = image.getWidth();
@@ -77,7 +95,9 @@ void PixelFilter::convertToGrayscale(Image &image) {
 
     if (channels < 3) return; // If the image is already grayscale, return directly
 
-    unsigned char *newData = new unsigned char[width * height]; // Allocate memory for the new grayscale image data
+    // Take memory for the new grayscale image data from the shared pool
+    Buffer grey = BufferPool::global().acquire(static_cast<size_t>(width) * height);
+    unsigned char *newData = grey.getData();
     for (int i = 0; i < width * height; i++) {
         int index = i * channels;
         unsigned char r = data[index];
@@ -87,7 +107,7 @@ void PixelFilter::convertToGrayscale(Image &image) {
         newData[i] = static_cast<unsigned char>(0.2126 * r + 0.7152 * g + 0.0722 * b);
     }
 
-    image.updateData(newData); // Update the image data
+    image.updateData(std::move(grey), DataType::UInt8); // Update the image data
     image.setChannels(1); // Update the number of channels
 }
 
@@ -98,7 +118,8 @@ void PixelFilter::adjustBrightness(Image &image) {
     unsigned char *originalData = image.getData();
 
     // Create a temporary buffer to store the modified pixel values
-    unsigned char *tempData = new unsigned char[width * height * channels];
+    Buffer adjusted = BufferPool::global().acquire(static_cast<size_t>(width) * height * channels);
+    unsigned char *tempData = adjusted.getData();
 
     for (int i = 0; i < width * height * channels; i++) {
         int value = static_cast<int>(originalData[i]) + brightness; // Adjust brightness
@@ -107,7 +128,7 @@ void PixelFilter::adjustBrightness(Image &image) {
     }
 
     // Update the image data with the modified pixel values
-    image.updateData(tempData);
+    image.updateData(std::move(adjusted), DataType::UInt8);
 }
 
 void PixelFilter::thresholdPixel(Image &image) {
@@ -361,3 +382,14 @@ void PixelFilter::HSLtoRGB(float h, float s, float l, float &r, float &g, float
         b = hue2rgb(p, q, h - 1.f / 3.f);
     }
 }
+
+std::string PixelFilter::describe() const {
+    // Noise is seeded from the clock, so no two applications give the same result
+    if (filterType == "SaltAndPepperNoise") {
+        return "";
+    }
+    std::ostringstream description;
+    description << std::setprecision(17) << "PixelFilter(type=" << filterType << ",brightness=" << brightness
+                << ",space=" << space << ",threshold=" << threshold << ",percentage=" << percentage << ")";
+    return description.str();
+}
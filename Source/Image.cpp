@@ -23,35 +23,81 @@
  */
 
 #include "Image.h"
+#include "OutputService.h"
+#include "Trace.h"
 #include "stb_image.h"
-#include "stb_image_write.h"
 
+#include <algorithm>
 #include <iostream>
 #include <filesystem>
 #include <cstring>
+#include <utility>
+#include <vector>
 
 #define STB_IMAGE_WRITE_IMPLEMENTATION
 #define STB_IMAGE_IMPLEMENTATION
 
 namespace fs = std::filesystem;
 
-Image::Image() : width(0), height(0), channels(0), data(nullptr) {}
+namespace {
+    // Converts 16-bit and float samples to the 8-bit samples PNG files hold
+    std::vector<unsigned char> toUInt8(const Image &image) {
+        size_t count = static_cast<size_t>(image.getWidth()) * image.getHeight() * image.getChannels();
+        std::vector<unsigned char> converted(count);
+        if (image.getDataType() == DataType::UInt16) {
+            const unsigned short *samples = image.getDataAs<unsigned short>();
+            std::transform(samples, samples + count, converted.begin(), DataTypeTraits<unsigned short>::toUInt8);
+        } else {
+            const float *samples = image.getDataAs<float>();
+            std::transform(samples, samples + count, converted.begin(), DataTypeTraits<float>::toUInt8);
+        }
+        return converted;
+    }
+
+    // Size of a file in bytes for tracing, or 0 if it cannot be read
+    size_t traceFileSize(const std::string &path) {
+        std::error_code error;
+        auto size = fs::file_size(path, error);
+        return error ? 0 : static_cast<size_t>(size);
+    }
+
+    // Releases buffers returned by stb_image
+    void freeStbImage(void *data) {
+        stbi_image_free(data);
+    }
+}
+
+Image::Image() : width(0), height(0), channels(0), dataType(DataType::UInt8) {}
 
-Image::Image(int width, int height, int channels, unsigned char *data)
-        : width(width), height(height), channels(channels), data(nullptr) {
+Image::Image(int width, int height, int channels, unsigned char *data, DataType dataType)
+        : width(width), height(height), channels(channels), dataType(dataType) {
     if (data != nullptr) {
-        this->data = new unsigned char[width * height * channels];
-        memcpy(this->data, data, width * height * channels);
+        size_t size = static_cast<size_t>(width) * height * channels * bytesPerSample(dataType);
+        this->data = Buffer(size);
+        memcpy(this->data.getData(), data, size);
     }
 }
 
-Image::~Image() {
-    // Free image data memory
-    if (data) {
-        stbi_image_free(data);
+Image::Image(Image &&other) noexcept
+        : width(other.width), height(other.height), channels(other.channels), data(std::move(other.data)),
+          dataType(other.dataType) {
+    other.width = other.height = other.channels = 0;
+}
+
+Image &Image::operator=(Image &&other) noexcept {
+    if (this != &other) {
+        width = std::exchange(other.width, 0);
+        height = std::exchange(other.height, 0);
+        channels = std::exchange(other.channels, 0);
+        data = std::move(other.data);
+        dataType = other.dataType;
     }
+    return *this;
 }
 
+// The buffer releases the image data with the deleter that matches its allocation
+Image::~Image() = default;
+
 int Image::getWidth() const {
     return width;
 }
@@ -65,15 +111,22 @@ int Image::getChannels() const {
 }
 
 unsigned char *Image::getData() const {
-    return data;
+    return data.getData();
+}
+
+DataType Image::getDataType() const {
+    return dataType;
 }
 
 void Image::updateData(unsigned char *data) {
-    // Free existing image data memory
-    if (this->data) {
-        delete[] this->data;
-    }
-    this->data = data;
+    // Adopt the new[] allocation; the previous buffer is released by the move assignment
+    size_t size = static_cast<size_t>(width) * height * channels * bytesPerSample(dataType);
+    this->data = Buffer(data, size, Buffer::freeArray);
+}
+
+void Image::updateData(Buffer &&data, DataType dataType) {
+    this->data = std::move(data);
+    this->dataType = dataType;
 }
 
 void Image::setWidth(int width) {
@@ -88,41 +141,77 @@ void Image::setChannels(int channels) {
     this->channels = channels;
 }
 
-bool Image::loadFromFile(const std::string &path) {
+bool Image::loadFromFile(const std::string &path, DataType type) {
     // Check if the image exists
     if (!fs::exists(path)) {
         std::cerr << "Error: Image file does not exist: " << path << std::endl;
         return false;
     }
+    TRACE_SCOPE("Image::loadFromFile", "io", Trace::isEnabled() ? traceFileSize(path) : 0);
+
+    if (type == DataType::UInt8) {
+        unsigned char *pixels = stbi_load(path.c_str(), &width, &height, &channels, 0);
+        dataType = DataType::UInt8;
+        if (!pixels) {
+            std::cerr << "Error loading image: " << path << std::endl;
+            return false;
+        }
+        data = Buffer(pixels, static_cast<size_t>(width) * height * channels, freeStbImage);
+        return true;
+    }
 
-    data = stbi_load(path.c_str(), &width, &height, &channels, 0);
-    if (!data) {
+    // Decode wider samples with the 16-bit loader so that no precision is lost
+    unsigned short *samples = stbi_load_16(path.c_str(), &width, &height, &channels, 0);
+    if (!samples) {
         std::cerr << "Error loading image: " << path << std::endl;
         return false;
     }
+    dataType = type;
+    size_t count = static_cast<size_t>(width) * height * channels;
+    if (type == DataType::UInt16) {
+        data = Buffer(samples, count * sizeof(unsigned short), freeStbImage);
+        return true;
+    }
+
+    // Float images use the 8-bit intensity scale
+    Buffer values(count * sizeof(float));
+    auto *floats = reinterpret_cast<float *>(values.getData());
+    for (size_t i = 0; i < count; ++i) {
+        floats[i] = samples[i] / 257.0f;
+    }
+    stbi_image_free(samples);
+    data = std::move(values);
     return true;
 }
 
 bool Image::saveToFile(const std::string &path) const {
     // Check if image data exists
-    if (!data) {
+    if (data.isEmpty()) {
         std::cerr << "Error: No data to save" << std::endl;
         return false;
     }
+    TRACE_SCOPE("Image::saveToFile", "io", static_cast<size_t>(width) * height * channels * bytesPerSample(dataType));
 
-    // Check if folder exists, if not create it
-    size_t found = path.find_last_of("/\\");
-    if (found != std::string::npos) {
-        std::string folder = path.substr(0, found);
-        std::string command = "mkdir -p " + folder;
-        system(command.c_str());
+    // PNG output is 8-bit, so wider samples are converted first
+    if (dataType == DataType::UInt8) {
+        return OutputService::global().writePng(path, width, height, channels, data.getData());
     }
+    std::vector<unsigned char> converted = toUInt8(*this);
+    return OutputService::global().writePng(path, width, height, channels, converted.data());
+}
 
-    int success = stbi_write_png(path.c_str(), width, height, channels, data, width * channels);
-    if (!success) {
-        std::cerr << "Failed to save image to: " << path << std::endl;
+bool Image::saveToFileAsync(const std::string &path) const {
+    if (data.isEmpty()) {
+        std::cerr << "Error: No data to save" << std::endl;
         return false;
     }
 
+    std::vector<unsigned char> pixels;
+    if (dataType == DataType::UInt8) {
+        pixels.assign(data.getData(), data.getData() + static_cast<size_t>(width) * height * channels);
+    } else {
+        pixels = toUInt8(*this);
+    }
+    OutputService::global().submitPng(path, width, height, channels, std::move(pixels));
     return true;
 }
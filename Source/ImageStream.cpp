@@ -0,0 +1,133 @@
+/**
+ * @file ImageStream.cpp
+ *
+ * @brief Implements band-by-band filtering of PNG images.
+ *
+ * Input rows are kept in a window that holds the rows of one band plus their context. Each band is copied from the
+ * window into a working image, so the window can be refilled with the next band's rows on a second thread while the
+ * filters run. The filters run on shrinking row ranges: the first filter covers the band plus the reach of all later
+ * filters, and each later filter covers less, so every filter reads only rows the previous one has finished. The
+ * finished band is copied out and encoded on a third thread while the next band is filtered.
+ *
+ * @date Created on October 19, 2026
+ *
+ * @authors
+ * Advanced Programming Group Radix Sort:
+ *   - Benjamin Duncan (edsml-bd1023)
+ *   - Boyang Hu (edsml-bh223)
+ *   - Chawk Chamoun (edsml-cc8915)
+ *   - Mingsheng Cai (acse-sc4623)
+ *   - Moyu Zhang (acse-mz223)
+ *   - Ryan Benney (acse-rgb123)
+ */
+
+#include "ImageStream.h"
+#include "PngStream.h"
+#include "Trace.h"
+
+#include <algorithm>
+#include <cstring>
+#include <future>
+#include <iostream>
+
+bool ImageStream::filterPng(const std::string &inputPath, const std::string &outputPath,
+                            const std::vector<StreamFilter> &filters, int channels, int bandRows) {
+    int reach = 0;
+    for (const auto &filter: filters) {
+        if (filter.radius < 0 || !filter.apply) {
+            std::cerr << "Error: Every streamed filter needs a non-negative radius and a function." << std::endl;
+            return false;
+        }
+        reach += filter.radius;
+    }
+    if (bandRows < 1) {
+        std::cerr << "Error: Images must be streamed in bands of at least one row." << std::endl;
+        return false;
+    }
+
+    PngReader reader;
+    if (!reader.open(inputPath, channels)) {
+        return false;
+    }
+    int width = reader.getWidth(), height = reader.getHeight();
+    channels = reader.getChannels();
+    size_t rowBytes = static_cast<size_t>(width) * channels;
+    TRACE_SCOPE("ImageStream::filterPng", "io", rowBytes * height);
+    PngWriter writer;
+    if (!writer.open(outputPath, width, height, channels)) {
+        return false;
+    }
+
+    // Rows [windowFirst, windowFirst + windowCount) of the input
+    size_t windowRows = std::min<size_t>(static_cast<size_t>(bandRows) + 2 * static_cast<size_t>(reach), height);
+    std::vector<unsigned char> window(windowRows * rowBytes);
+    int windowFirst = 0, windowCount = 0;
+    auto contextBegin = [&](int row) { return std::max(0, row - reach); };
+    auto contextEnd = [&](int row) { return std::min(height, row + reach); };
+    auto advance = [&](int first, int end) {
+        int drop = std::min(first - windowFirst, windowCount);
+        std::memmove(window.data(), window.data() + drop * rowBytes, (windowCount - drop) * rowBytes);
+        windowFirst += drop;
+        windowCount -= drop;
+        for (; windowFirst + windowCount < end; ++windowCount) {
+            if (!reader.readRow(window.data() + windowCount * rowBytes)) {
+                return false;
+            }
+        }
+        return true;
+    };
+
+    Image work(width, static_cast<int>(windowRows), channels, nullptr);
+    work.updateData(Buffer(windowRows * rowBytes), DataType::UInt8);
+    std::vector<unsigned char> output(static_cast<size_t>(bandRows) * rowBytes);
+    auto encode = [&](int count) {
+        for (int row = 0; row < count; ++row) {
+            if (!writer.writeRow(output.data() + row * rowBytes)) {
+                return false;
+            }
+        }
+        return true;
+    };
+
+    std::future<bool> decoding, encoding;
+    bool ok = advance(0, contextEnd(std::min(height, bandRows)));
+    for (int begin = 0; ok && begin < height; begin += bandRows) {
+        int end = std::min(height, begin + bandRows);
+        int first = contextBegin(begin), last = contextEnd(end);
+        if (decoding.valid() && !decoding.get()) {
+            ok = false;
+            break;
+        }
+        std::memcpy(work.getData(), window.data() + (first - windowFirst) * rowBytes, (last - first) * rowBytes);
+        work.setHeight(last - first);
+        if (end < height) {
+            decoding = std::async(std::launch::async, advance, contextBegin(end),
+                                  contextEnd(std::min(height, end + bandRows)));
+        }
+
+        int remaining = reach;
+        for (const auto &filter: filters) {
+            remaining -= filter.radius;
+            int top = std::max(first, begin - remaining), bottom = std::min(last, end + remaining);
+            filter.apply(work, {0, top - first, width, bottom - top});
+        }
+
+        if (encoding.valid() && !encoding.get()) {
+            ok = false;
+            break;
+        }
+        std::memcpy(output.data(), work.getData() + (begin - first) * rowBytes, (end - begin) * rowBytes);
+        encoding = std::async(std::launch::async, encode, end - begin);
+    }
+    if (decoding.valid()) {
+        decoding.wait();
+    }
+    if (encoding.valid() && !encoding.get()) {
+        ok = false;
+    }
+    if (!ok) {
+        std::cerr << "Error: Filtering " << inputPath << " into " << outputPath << " failed." << std::endl;
+        return false;
+    }
+    return writer.close();
+}
@@ -0,0 +1,645 @@
+/**
+ * @file Inflate.cpp
+ *
+ * @brief Implements the DEFLATE and gzip decoder.
+ *
+ * Bits are read least significant first through a 64-bit buffer that is refilled a byte at a time. Each Huffman table
+ * keeps the canonical code counts and symbols for bit-by-bit decoding, plus a 1024-entry lookup indexed by the next 10
+ * input bits that holds the symbol and code length of every code no longer than that.
+ *
+ * @date Created on October 19, 2026
+ *
+ * @authors
+ * Advanced Programming Group Radix Sort:
+ *   - Benjamin Duncan (edsml-bd1023)
+ *   - Boyang Hu (edsml-bh223)
+ *   - Chawk Chamoun (edsml-cc8915)
+ *   - Mingsheng Cai (acse-sc4623)
+ *   - Moyu Zhang (acse-mz223)
+ *   - Ryan Benney (acse-rgb123)
+ */
+
+#include "Inflate.h"
+
+#include <algorithm>
+#include <array>
+#include <cstring>
+
+namespace {
+    constexpr int maxCodeLength = 15; // Longest Huffman code in DEFLATE
+    constexpr int fastBits = 10; // Codes up to this length are decoded with one lookup
+
+    // Base lengths and extra bits of length symbols 257 to 285
+    constexpr uint16_t lengthBase[29] = {3, 4, 5, 6, 7, 8, 9, 10, 11, 13, 15, 17, 19, 23, 27, 31, 35, 43, 51, 59, 67,
+                                         83, 99, 115, 131, 163, 195, 227, 258};
+    constexpr uint8_t lengthExtra[29] = {0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 2, 2, 3, 3, 3, 3, 4, 4, 4, 4, 5, 5,
+                                         5, 5, 0};
+
+    // Base distances and extra bits of distance symbols 0 to 29
+    constexpr uint16_t distanceBase[30] = {1, 2, 3, 4, 5, 7, 9, 13, 17, 25, 33, 49, 65, 97, 129, 193, 257, 385, 513,
+                                           769, 1025, 1537, 2049, 3073, 4097, 6145, 8193, 12289, 16385, 24577};
+    constexpr uint8_t distanceExtra[30] = {0, 0, 0, 0, 1, 1, 2, 2, 3, 3, 4, 4, 5, 5, 6, 6, 7, 7, 8, 8, 9, 9, 10, 10, 11,
+                                           11, 12, 12, 13, 13};
+
+    // Order in which the code length code lengths are stored
+    constexpr uint8_t codeLengthOrder[19] = {16, 17, 18, 0, 8, 7, 9, 6, 10, 5, 11, 4, 12, 3, 13, 2, 14, 1, 15};
+
+    // Location of one piece of a stream that is split over several buffers, such as the IDAT chunks of a PNG file
+    using Span = std::pair<const unsigned char *, size_t>;
+
+    class BitReader {
+    private:
+        const unsigned char *source;
+        size_t size, position;
+        uint64_t bits; // Unread bits, least significant first
+        int count; // Number of unread bits in bits
+        const std::vector<Span> *spans; // Pieces that follow source, or nullptr for a single buffer
+        size_t nextSpan; // Index in spans of the piece after source
+
+        // Moves to the next non-empty piece; false at the end of the stream
+        bool advance() {
+            while (spans && nextSpan < spans->size()) {
+                const Span &span = (*spans)[nextSpan++];
+                if (span.second) {
+                    source = span.first;
+                    size = span.second;
+                    position = 0;
+                    return true;
+                }
+            }
+            return false;
+        }
+
+    public:
+        BitReader(const unsigned char *source, size_t size) : source(source), size(size), position(0), bits(0),
+                                                              count(0), spans(nullptr), nextSpan(0) {}
+
+        explicit BitReader(const std::vector<Span> &pieces) : source(nullptr), size(0), position(0), bits(0),
+                                                             count(0), spans(&pieces), nextSpan(0) {}
+
+        void refill() {
+            while (count <= 56 && (position < size || advance())) {
+                bits |= static_cast<uint64_t>(source[position++]) << count;
+                count += 8;
+            }
+        }
+
+        bool read(int n, uint32_t &value) {
+            if (count < n) {
+                refill();
+                if (count < n) {
+                    return false;
+                }
+            }
+            value = static_cast<uint32_t>(bits & ((uint64_t(1) << n) - 1));
+            bits >>= n;
+            count -= n;
+            return true;
+        }
+
+        uint64_t peek() const {
+            return bits;
+        }
+
+        int available() const {
+            return count;
+        }
+
+        void skip(int n) {
+            bits >>= n;
+            count -= n;
+        }
+
+        // Drops the bits up to the next byte boundary
+        void alignToByte() {
+            skip(count % 8);
+        }
+
+        // Copies whole bytes after alignToByte, first from the bit buffer and then straight from the input
+        bool copyBytes(unsigned char *out, size_t length) {
+            for (; length && count >= 8; --length) {
+                *out++ = static_cast<unsigned char>(bits);
+                skip(8);
+            }
+            while (length) {
+                if (position == size && !advance()) {
+                    return false;
+                }
+                size_t piece = std::min(length, size - position);
+                std::memcpy(out, source + position, piece);
+                position += piece;
+                out += piece;
+                length -= piece;
+            }
+            return true;
+        }
+
+        // Input bytes used so far; the partly read byte at the end of a stream counts as used
+        size_t consumed() const {
+            return position - count / 8;
+        }
+    };
+
+    class Huffman {
+    private:
+        uint16_t counts[maxCodeLength + 1]; // Number of codes of each length
+        uint16_t symbols[288]; // Symbols ordered by code
+        uint16_t fast[1 << fastBits]; // Symbol << 4 | length for the next fastBits bits, 0 if the code is longer
+
+    public:
+        // Builds the code from the length of each symbol's code; false if the lengths over-subscribe the code space
+        bool build(const uint8_t *lengths, int symbolCount) {
+            std::fill(std::begin(counts), std::end(counts), 0);
+            std::fill(std::begin(fast), std::end(fast), 0);
+            for (int s = 0; s < symbolCount; ++s) {
+                ++counts[lengths[s]];
+            }
+            counts[0] = 0;
+
+            int left = 1;
+            for (int length = 1; length <= maxCodeLength; ++length) {
+                left = (left << 1) - counts[length];
+                if (left < 0) {
+                    return false;
+                }
+            }
+
+            uint16_t offsets[maxCodeLength + 2] = {};
+            uint32_t nextCode[maxCodeLength + 1] = {};
+            uint32_t code = 0;
+            for (int length = 1; length <= maxCodeLength; ++length) {
+                offsets[length + 1] = offsets[length] + counts[length];
+                code = (code + counts[length - 1]) << 1;
+                nextCode[length] = code;
+            }
+            for (int s = 0; s < symbolCount; ++s) {
+                int length = lengths[s];
+                if (!length) {
+                    continue;
+                }
+                symbols[offsets[length]++] = static_cast<uint16_t>(s);
+                uint32_t canonical = nextCode[length]++;
+                if (length <= fastBits) {
+                    // Codes are stored most significant bit first, so the lookup index is the reversed code
+                    uint32_t reversed = 0;
+                    for (int b = 0; b < length; ++b) {
+                        reversed |= ((canonical >> b) & 1) << (length - 1 - b);
+                    }
+                    for (uint32_t index = reversed; index < (1u << fastBits); index += 1u << length) {
+                        fast[index] = static_cast<uint16_t>(s << 4 | length);
+                    }
+                }
+            }
+            return true;
+        }
+
+        // Decodes one symbol; -1 if the input ends or holds no valid code
+        int decode(BitReader &reader) const {
+            if (reader.available() < maxCodeLength) {
+                reader.refill();
+            }
+            uint16_t entry = fast[reader.peek() & ((1u << fastBits) - 1)];
+            if (entry && (entry & 15) <= reader.available()) {
+                reader.skip(entry & 15);
+                return entry >> 4;
+            }
+
+            int code = 0, first = 0, index = 0;
+            for (int length = 1; length <= maxCodeLength; ++length) {
+                uint32_t bit;
+                if (!reader.read(1, bit)) {
+                    return -1;
+                }
+                code |= static_cast<int>(bit);
+                int count = counts[length];
+                if (code - first < count) {
+                    return symbols[index + code - first];
+                }
+                index += count;
+                first = (first + count) << 1;
+                code <<= 1;
+            }
+            return -1;
+        }
+    };
+
+    // Reads the code lengths of a dynamic block and builds its literal/length and distance codes
+    bool readDynamicCodes(BitReader &reader, Huffman &literals, Huffman &distances) {
+        uint32_t literalCount, distanceCount, codeLengthCount;
+        if (!reader.read(5, literalCount) || !reader.read(5, distanceCount) || !reader.read(4, codeLengthCount)) {
+            return false;
+        }
+        literalCount += 257;
+        distanceCount += 1;
+        codeLengthCount += 4;
+        if (literalCount > 286 || distanceCount > 30) {
+            return false;
+        }
+
+        uint8_t codeLengthLengths[19] = {};
+        for (uint32_t i = 0; i < codeLengthCount; ++i) {
+            uint32_t length;
+            if (!reader.read(3, length)) {
+                return false;
+            }
+            codeLengthLengths[codeLengthOrder[i]] = static_cast<uint8_t>(length);
+        }
+        Huffman codeLengths;
+        if (!codeLengths.build(codeLengthLengths, 19)) {
+            return false;
+        }
+
+        uint8_t lengths[286 + 30] = {};
+        for (uint32_t i = 0; i < literalCount + distanceCount;) {
+            int symbol = codeLengths.decode(reader);
+            if (symbol < 0) {
+                return false;
+            }
+            if (symbol < 16) {
+                lengths[i++] = static_cast<uint8_t>(symbol);
+                continue;
+            }
+            uint32_t repeat;
+            uint8_t value = 0;
+            if (symbol == 16) {
+                if (i == 0 || !reader.read(2, repeat)) {
+                    return false;
+                }
+                value = lengths[i - 1];
+                repeat += 3;
+            } else if (symbol == 17) {
+                if (!reader.read(3, repeat)) {
+                    return false;
+                }
+                repeat += 3;
+            } else {
+                if (!reader.read(7, repeat)) {
+                    return false;
+                }
+                repeat += 11;
+            }
+            if (i + repeat > literalCount + distanceCount) {
+                return false;
+            }
+            std::fill(lengths + i, lengths + i + repeat, value);
+            i += repeat;
+        }
+        if (lengths[256] == 0) {
+            return false;
+        }
+        return literals.build(lengths, static_cast<int>(literalCount)) &&
+               distances.build(lengths + literalCount, static_cast<int>(distanceCount));
+    }
+
+    // Builds the literal/length and distance codes of fixed-Huffman blocks
+    void buildFixedCodes(Huffman &literals, Huffman &distances) {
+        uint8_t lengths[288];
+        std::fill(lengths, lengths + 144, 8);
+        std::fill(lengths + 144, lengths + 256, 9);
+        std::fill(lengths + 256, lengths + 280, 7);
+        std::fill(lengths + 280, lengths + 288, 8);
+        uint8_t distanceLengths[30];
+        std::fill(distanceLengths, distanceLengths + 30, 5);
+        literals.build(lengths, 288);
+        distances.build(distanceLengths, 30);
+    }
+
+    // Decodes the symbols of a Huffman-coded block until its end-of-block symbol
+    bool decodeBlock(BitReader &reader, const Huffman &literals, const Huffman &distances, unsigned char *out,
+                     size_t outSize, size_t &written) {
+        while (true) {
+            int symbol = literals.decode(reader);
+            if (symbol < 0) {
+                return false;
+            }
+            if (symbol < 256) {
+                if (written == outSize) {
+                    return false;
+                }
+                out[written++] = static_cast<unsigned char>(symbol);
+                continue;
+            }
+            if (symbol == 256) {
+                return true;
+            }
+
+            symbol -= 257;
+            if (symbol >= 29) {
+                return false;
+            }
+            uint32_t extra;
+            if (!reader.read(lengthExtra[symbol], extra)) {
+                return false;
+            }
+            size_t length = lengthBase[symbol] + extra;
+
+            int distanceSymbol = distances.decode(reader);
+            if (distanceSymbol < 0 || distanceSymbol >= 30 || !reader.read(distanceExtra[distanceSymbol], extra)) {
+                return false;
+            }
+            size_t distance = distanceBase[distanceSymbol] + extra;
+            if (distance > written || length > outSize - written) {
+                return false;
+            }
+
+            // The bytes before the output repeat with period distance, so each copy may double in size
+            const unsigned char *pattern = out + written - distance;
+            unsigned char *destination = out + written;
+            for (size_t left = length; left;) {
+                size_t count = std::min(left, static_cast<size_t>(destination - pattern));
+                std::memcpy(destination, pattern, count);
+                destination += count;
+                left -= count;
+            }
+            written += length;
+        }
+    }
+
+    const std::array<uint32_t, 256> &crcTable() {
+        static const std::array<uint32_t, 256> table = []() {
+            std::array<uint32_t, 256> entries{};
+            for (uint32_t n = 0; n < 256; ++n) {
+                uint32_t c = n;
+                for (int k = 0; k < 8; ++k) {
+                    c = c & 1 ? 0xEDB88320u ^ (c >> 1) : c >> 1;
+                }
+                entries[n] = c;
+            }
+            return entries;
+        }();
+        return table;
+    }
+
+    uint32_t readLittle32(const unsigned char *p) {
+        return static_cast<uint32_t>(p[0]) | static_cast<uint32_t>(p[1]) << 8 | static_cast<uint32_t>(p[2]) << 16 |
+               static_cast<uint32_t>(p[3]) << 24;
+    }
+}
+
+bool Inflate::inflate(const unsigned char *source, size_t size, unsigned char *out, size_t outSize, size_t &written,
+                      size_t &consumed) {
+    BitReader reader(source, size);
+    written = 0;
+    consumed = 0;
+    Huffman literals, distances;
+    bool fixedBuilt = false;
+    Huffman fixedLiterals, fixedDistances;
+
+    uint32_t final = 0;
+    while (!final) {
+        uint32_t type;
+        if (!reader.read(1, final) || !reader.read(2, type)) {
+            return false;
+        }
+
+        if (type == 0) {
+            // Stored block: byte-aligned length, its one's complement, then the bytes
+            reader.alignToByte();
+            uint32_t length, complement;
+            if (!reader.read(16, length) || !reader.read(16, complement) || (length ^ 0xFFFF) != complement ||
+                length > outSize - written || !reader.copyBytes(out + written, length)) {
+                return false;
+            }
+            written += length;
+        } else if (type == 1) {
+            if (!fixedBuilt) {
+                buildFixedCodes(fixedLiterals, fixedDistances);
+                fixedBuilt = true;
+            }
+            if (!decodeBlock(reader, fixedLiterals, fixedDistances, out, outSize, written)) {
+                return false;
+            }
+        } else if (type == 2) {
+            if (!readDynamicCodes(reader, literals, distances) ||
+                !decodeBlock(reader, literals, distances, out, outSize, written)) {
+                return false;
+            }
+        } else {
+            return false;
+        }
+    }
+    consumed = reader.consumed();
+    return true;
+}
+
+bool Inflate::isGzip(const unsigned char *source, size_t size) {
+    return size >= 2 && source[0] == 0x1F && source[1] == 0x8B;
+}
+
+bool Inflate::gunzip(const unsigned char *source, size_t size, unsigned char *out, size_t outSize) {
+    // Member header: signature, method 8 (deflate), flags, then optional fields
+    if (size < 18 || !isGzip(source, size) || source[2] != 8) {
+        return false;
+    }
+    unsigned char flags = source[3];
+    size_t position = 10;
+    if (flags & 4) {
+        if (position + 2 > size) {
+            return false;
+        }
+        position += 2 + (source[position] | source[position + 1] << 8);
+    }
+    for (unsigned char field: {8, 16}) {
+        if (flags & field) {
+            while (position < size && source[position] != 0) {
+                ++position;
+            }
+            ++position;
+        }
+    }
+    if (flags & 2) {
+        position += 2;
+    }
+    if (position > size) {
+        return false;
+    }
+
+    size_t written, consumed;
+    if (!inflate(source + position, size - position, out, outSize, written, consumed) || written != outSize) {
+        return false;
+    }
+    position += consumed;
+    if (size - position < 8) {
+        return false;
+    }
+    return readLittle32(source + position) == crc32(out, outSize) &&
+           readLittle32(source + position + 4) == static_cast<uint32_t>(outSize);
+}
+
+bool Inflate::gunzip(const unsigned char *source, size_t size, std::vector<unsigned char> &out) {
+    if (size < 18) {
+        return false;
+    }
+    out.resize(readLittle32(source + size - 4));
+    return gunzip(source, size, out.data(), out.size());
+}
+
+uint32_t Inflate::crc32(const unsigned char *data, size_t size, uint32_t crc) {
+    const auto &table = crcTable();
+    crc = ~crc;
+    for (size_t i = 0; i < size; ++i) {
+        crc = table[(crc ^ data[i]) & 0xFF] ^ (crc >> 8);
+    }
+    return ~crc;
+}
+
+// Decoding state that persists between calls to read, so a block can be left and resumed at any output byte
+struct InflateStream::Decoder {
+    enum class Mode {
+        blockHeader, // Before the header of the next block
+        stored, // Inside a stored block
+        coded, // Inside a fixed- or dynamic-Huffman block
+        finished, // After the final block
+        failed // After an error in the stream
+    };
+
+    std::vector<Span> pieces; // The compressed stream, in order
+    BitReader reader;
+    Mode mode = Mode::blockHeader;
+    bool finalBlock = false; // True once the header of the final block has been read
+    size_t storedLeft = 0; // Bytes of the current stored block not yet copied
+    size_t matchLength = 0, matchDistance = 0; // Remainder of a back-reference cut short by a full window
+    Huffman literals, distances; // Codes of the current block
+    std::vector<unsigned char> window; // Up to historySize bytes of history, then decoded bytes not yet read
+    size_t decoded = 0; // Bytes of window in use
+    size_t returned = 0; // Bytes of window already handed to the caller, always at least the history kept
+
+    Decoder() : reader(pieces), window(4 * historySize) {}
+
+    void endBlock() {
+        mode = finalBlock ? Mode::finished : Mode::blockHeader;
+    }
+
+    // Decodes into window until it is full or the stream ends
+    void fill() {
+        while (decoded < window.size() && mode != Mode::finished && mode != Mode::failed) {
+            size_t space = window.size() - decoded;
+            if (mode == Mode::blockHeader) {
+                uint32_t final, type;
+                if (!reader.read(1, final) || !reader.read(2, type)) {
+                    mode = Mode::failed;
+                    break;
+                }
+                finalBlock = final != 0;
+                if (type == 0) {
+                    reader.alignToByte();
+                    uint32_t length, complement;
+                    if (!reader.read(16, length) || !reader.read(16, complement) || (length ^ 0xFFFF) != complement) {
+                        mode = Mode::failed;
+                        break;
+                    }
+                    storedLeft = length;
+                    mode = Mode::stored;
+                    if (storedLeft == 0) {
+                        endBlock();
+                    }
+                } else if (type == 1) {
+                    buildFixedCodes(literals, distances);
+                    mode = Mode::coded;
+                } else if (type == 2 && readDynamicCodes(reader, literals, distances)) {
+                    mode = Mode::coded;
+                } else {
+                    mode = Mode::failed;
+                }
+            } else if (mode == Mode::stored) {
+                size_t count = std::min(storedLeft, space);
+                if (!reader.copyBytes(window.data() + decoded, count)) {
+                    mode = Mode::failed;
+                    break;
+                }
+                decoded += count;
+                storedLeft -= count;
+                if (storedLeft == 0) {
+                    endBlock();
+                }
+            } else if (matchLength) {
+                // The bytes before the output repeat with period distance, so each copy may double in size
+                size_t count = std::min(matchLength, space);
+                const unsigned char *pattern = window.data() + decoded - matchDistance;
+                unsigned char *destination = window.data() + decoded;
+                for (size_t left = count; left;) {
+                    size_t piece = std::min(left, static_cast<size_t>(destination - pattern));
+                    std::memcpy(destination, pattern, piece);
+                    destination += piece;
+                    left -= piece;
+                }
+                decoded += count;
+                matchLength -= count;
+            } else {
+                int symbol = literals.decode(reader);
+                if (symbol < 256) {
+                    if (symbol < 0) {
+                        mode = Mode::failed;
+                        break;
+                    }
+                    window[decoded++] = static_cast<unsigned char>(symbol);
+                    continue;
+                }
+                if (symbol == 256) {
+                    endBlock();
+                    continue;
+                }
+                symbol -= 257;
+                uint32_t extra;
+                if (symbol >= 29 || !reader.read(lengthExtra[symbol], extra)) {
+                    mode = Mode::failed;
+                    break;
+                }
+                size_t length = lengthBase[symbol] + extra;
+                int distanceSymbol = distances.decode(reader);
+                if (distanceSymbol < 0 || distanceSymbol >= 30 ||
+                    !reader.read(distanceExtra[distanceSymbol], extra) ||
+                    distanceBase[distanceSymbol] + extra > decoded) {
+                    mode = Mode::failed;
+                    break;
+                }
+                matchLength = length;
+                matchDistance = distanceBase[distanceSymbol] + extra;
+            }
+        }
+    }
+};
+
+InflateStream::InflateStream() : decoder(std::make_unique<Decoder>()) {}
+
+InflateStream::~InflateStream() = default;
+
+InflateStream::InflateStream(InflateStream &&other) noexcept = default;
+
+InflateStream &InflateStream::operator=(InflateStream &&other) noexcept = default;
+
+void InflateStream::addInput(const unsigned char *source, size_t size) {
+    decoder->pieces.emplace_back(source, size);
+}
+
+size_t InflateStream::read(unsigned char *out, size_t size) {
+    Decoder &state = *decoder;
+    size_t produced = 0;
+    while (produced < size) {
+        if (state.returned < state.decoded) {
+            size_t count = std::min(size - produced, state.decoded - state.returned);
+            std::memcpy(out + produced, state.window.data() + state.returned, count);
+            state.returned += count;
+            produced += count;
+            continue;
+        }
+        if (state.mode == Decoder::Mode::finished || state.mode == Decoder::Mode::failed) {
+            break;
+        }
+        if (state.decoded == state.window.size()) {
+            // Keep the last historySize bytes for back-references and make room after them
+            std::memmove(state.window.data(), state.window.data() + state.decoded - historySize, historySize);
+            state.decoded = state.returned = historySize;
+        }
+        state.fill();
+    }
+    return produced;
+}
+
+bool InflateStream::isFinished() const {
+    return decoder->mode == Decoder::Mode::finished && decoder->returned == decoder->decoded;
+}
+
+bool InflateStream::hasFailed() const {
+    return decoder->mode == Decoder::Mode::failed;
+}
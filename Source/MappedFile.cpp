@@ -0,0 +1,150 @@
+/**
+ * @file MappedFile.cpp
+ *
+ * @brief Implements memory-mapped file access.
+ *
+ * mmap needs offsets aligned to the page size, so a range is mapped from the page boundary below it and the buffer
+ * points into the mapping. The buffer deleter only receives that pointer, so the start and length of every live mapping
+ * are kept in a small table for munmap.
+ *
+ * @date Created on October 19, 2026
+ *
+ * @authors
+ * Advanced Programming Group Radix Sort:
+ *   - Benjamin Duncan (edsml-bd1023)
+ *   - Boyang Hu (edsml-bh223)
+ *   - Chawk Chamoun (edsml-cc8915)
+ *   - Mingsheng Cai (acse-sc4623)
+ *   - Moyu Zhang (acse-mz223)
+ *   - Ryan Benney (acse-rgb123)
+ */
+
+#include "MappedFile.h"
+
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <utility>
+
+#if defined(__unix__) || defined(__APPLE__)
+#define MAPPED_FILE_MMAP 1
+#include <fcntl.h>
+#include <mutex>
+#include <sys/mman.h>
+#include <unistd.h>
+#include <unordered_map>
+#endif
+
+namespace {
+#ifdef MAPPED_FILE_MMAP
+    // Start and length of a mapping
+    struct Mapping {
+        void *base;
+        size_t length;
+    };
+
+    // Live mappings by the pointer handed out in their buffer; never destroyed, like the buffers that may outlive it
+    std::mutex &mappingMutex() {
+        static auto *mutex = new std::mutex();
+        return *mutex;
+    }
+
+    std::unordered_map<void *, Mapping> &mappings() {
+        static auto *table = new std::unordered_map<void *, Mapping>();
+        return *table;
+    }
+
+    void unmap(void *data) {
+        Mapping mapping;
+        {
+            std::lock_guard<std::mutex> lock(mappingMutex());
+            auto it = mappings().find(data);
+            if (it == mappings().end()) {
+                return;
+            }
+            mapping = it->second;
+            mappings().erase(it);
+        }
+        munmap(mapping.base, mapping.length);
+    }
+#endif
+}
+
+MappedFile::MappedFile() = default;
+
+MappedFile::MappedFile(MappedFile &&other) noexcept: contents(std::move(other.contents)) {}
+
+MappedFile &MappedFile::operator=(MappedFile &&other) noexcept {
+    contents = std::move(other.contents);
+    return *this;
+}
+
+bool MappedFile::open(const std::string &path) {
+    close();
+    std::error_code error;
+    auto size = std::filesystem::file_size(path, error);
+    if (error) {
+        std::cerr << "Error: Cannot open " << path << ": " << error.message() << std::endl;
+        return false;
+    }
+    if (size == 0) {
+        std::cerr << "Error: " << path << " is empty." << std::endl;
+        return false;
+    }
+    contents = mapRange(path, 0, static_cast<size_t>(size));
+    return !contents.isEmpty();
+}
+
+void MappedFile::close() {
+    contents = Buffer();
+}
+
+const unsigned char *MappedFile::getData() const {
+    return contents.getData();
+}
+
+size_t MappedFile::getSize() const {
+    return contents.getSize();
+}
+
+Buffer MappedFile::mapRange(const std::string &path, size_t offset, size_t size) {
+    std::error_code error;
+    auto fileSize = std::filesystem::file_size(path, error);
+    if (error || size == 0 || offset > fileSize || size > fileSize - offset) {
+        std::cerr << "Error: " << path << " does not hold " << size << " bytes at offset " << offset << "."
+                  << std::endl;
+        return Buffer();
+    }
+
+#ifdef MAPPED_FILE_MMAP
+    int descriptor = ::open(path.c_str(), O_RDONLY);
+    if (descriptor < 0) {
+        std::cerr << "Error: Cannot open " << path << "." << std::endl;
+        return Buffer();
+    }
+    size_t page = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+    size_t start = offset - offset % page, length = size + offset % page;
+    void *base = mmap(nullptr, length, PROT_READ | PROT_WRITE, MAP_PRIVATE, descriptor, static_cast<off_t>(start));
+    ::close(descriptor);
+    if (base == MAP_FAILED) {
+        std::cerr << "Error: Cannot map " << path << " into memory." << std::endl;
+        return Buffer();
+    }
+
+    unsigned char *data = static_cast<unsigned char *>(base) + offset % page;
+    {
+        std::lock_guard<std::mutex> lock(mappingMutex());
+        mappings()[data] = {base, length};
+    }
+    return Buffer(data, size, unmap);
+#else
+    std::ifstream file(path, std::ios::binary);
+    Buffer contents(size);
+    file.seekg(static_cast<std::streamoff>(offset));
+    if (!file.read(reinterpret_cast<char *>(contents.getData()), static_cast<std::streamsize>(size))) {
+        std::cerr << "Error: Cannot read " << path << "." << std::endl;
+        return Buffer();
+    }
+    return contents;
+#endif
+}
@@ -0,0 +1,161 @@
+/**
+ * @file OutputService.cpp
+ *
+ * @brief Implements the output service that creates directories and encodes PNG files on worker threads.
+ *
+ * Directories are created with std::filesystem, and a directory is remembered only after it exists, so a failed
+ * attempt is retried by the next file. Queued files are encoded in the order they were submitted. A worker records the
+ * outcome of each file in its promise before it counts the file as done, so flush never returns while a result is still
+ * missing.
+ *
+ * @date Created on October 19, 2026
+ *
+ * @authors
+ * Advanced Programming Group Radix Sort:
+ *   - Benjamin Duncan (edsml-bd1023)
+ *   - Boyang Hu (edsml-bh223)
+ *   - Chawk Chamoun (edsml-cc8915)
+ *   - Mingsheng Cai (acse-sc4623)
+ *   - Moyu Zhang (acse-mz223)
+ *   - Ryan Benney (acse-rgb123)
+ */
+
+#include "OutputService.h"
+#include "Parallel.h"
+#include "Trace.h"
+#include "stb_image_write.h"
+
+#include <filesystem>
+#include <iostream>
+
+namespace fs = std::filesystem;
+
+OutputService::OutputService(unsigned int threadCount, size_t queueCapacity)
+        : threadCount(threadCount ? threadCount : Parallel::threadCount()),
+          queueCapacity(queueCapacity ? queueCapacity : 1), running(0), stopping(false) {}
+
+OutputService::~OutputService() {
+    {
+        std::unique_lock<std::mutex> lock(mutex);
+        idle.wait(lock, [this]() { return queue.empty() && running == 0; });
+        stopping = true;
+    }
+    jobAvailable.notify_all();
+    for (auto &worker: workers) {
+        worker.join();
+    }
+}
+
+OutputService &OutputService::global() {
+    static OutputService service;
+    return service;
+}
+
+bool OutputService::ensureDirectory(const std::string &directory) {
+    if (directory.empty()) {
+        return true;
+    }
+
+    // A known directory is still checked with one stat, since it may have been removed since it was created
+    std::lock_guard<std::mutex> lock(directoryMutex);
+    if (createdDirectories.count(directory) && fs::is_directory(directory)) {
+        return true;
+    }
+    std::error_code error;
+    fs::create_directories(directory, error);
+    if (!fs::is_directory(directory)) {
+        std::cerr << "Error: Failed to create output directory " << directory;
+        if (error) {
+            std::cerr << ": " << error.message();
+        }
+        std::cerr << std::endl;
+        return false;
+    }
+    createdDirectories.insert(directory);
+    return true;
+}
+
+bool OutputService::writePng(const std::string &path, int width, int height, int channels,
+                             const unsigned char *pixels) {
+    TRACE_SCOPE("OutputService::writePng", "io", static_cast<size_t>(width) * height * channels);
+
+    std::string message;
+    if (!pixels || width <= 0 || height <= 0 || channels < 1 || channels > 4) {
+        message = "invalid image";
+    } else if (!ensureDirectory(fs::path(path).parent_path().string())) {
+        message = "cannot create directory";
+    } else if (!stbi_write_png(path.c_str(), width, height, channels, pixels, width * channels)) {
+        message = "PNG encoding or writing failed";
+    }
+    if (message.empty()) {
+        return true;
+    }
+
+    std::cerr << "Failed to save image to: " << path << " (" << message << ")" << std::endl;
+    std::lock_guard<std::mutex> lock(mutex);
+    errors.push_back({path, message});
+    return false;
+}
+
+std::future<bool> OutputService::submitPng(const std::string &path, int width, int height, int channels,
+                                           std::vector<unsigned char> pixels) {
+    std::unique_lock<std::mutex> lock(mutex);
+    if (workers.empty()) {
+        for (unsigned int i = 0; i < threadCount; ++i) {
+            workers.emplace_back(&OutputService::work, this);
+        }
+    }
+    slotAvailable.wait(lock, [this]() { return queue.size() < queueCapacity; });
+
+    queue.push_back({path, width, height, channels, std::move(pixels), std::promise<bool>()});
+    std::future<bool> result = queue.back().result.get_future();
+    lock.unlock();
+    jobAvailable.notify_one();
+    return result;
+}
+
+void OutputService::work() {
+    while (true) {
+        std::unique_lock<std::mutex> lock(mutex);
+        jobAvailable.wait(lock, [this]() { return stopping || !queue.empty(); });
+        if (queue.empty()) {
+            return;
+        }
+        Job job = std::move(queue.front());
+        queue.pop_front();
+        ++running;
+        lock.unlock();
+        slotAvailable.notify_one();
+
+        job.result.set_value(encode(job));
+
+        lock.lock();
+        --running;
+        if (queue.empty() && running == 0) {
+            idle.notify_all();
+        }
+    }
+}
+
+bool OutputService::encode(const Job &job) {
+    if (job.pixels.size() != static_cast<size_t>(job.width) * job.height * job.channels) {
+        std::cerr << "Failed to save image to: " << job.path << " (pixel count does not match the size)" << std::endl;
+        std::lock_guard<std::mutex> lock(mutex);
+        errors.push_back({job.path, "pixel count does not match the size"});
+        return false;
+    }
+    return writePng(job.path, job.width, job.height, job.channels, job.pixels.data());
+}
+
+std::vector<OutputError> OutputService::flush() {
+    std::unique_lock<std::mutex> lock(mutex);
+    idle.wait(lock, [this]() { return queue.empty() && running == 0; });
+    std::vector<OutputError> failed;
+    failed.swap(errors);
+    return failed;
+}
+
+size_t OutputService::getPendingCount() const {
+    std::lock_guard<std::mutex> lock(mutex);
+    return queue.size() + running;
+}
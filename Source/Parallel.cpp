@@ -0,0 +1,89 @@
+/**
+ * @file Parallel.cpp
+ *
+ * @brief Implements the thread-based parallel loop helper.
+ *
+ * This file implements Parallel::forRange, which divides a loop into contiguous chunks and runs them on separate
+ * std::thread workers, with the calling thread taking the final chunk. When tracing is enabled, each loop records the
+ * busy time of its chunks and the resulting thread utilisation.
+ *
+ * @date Created on October 19, 2026
+ *
+ * @authors
+ * Advanced Programming Group Radix Sort:
+ *   - Benjamin Duncan (edsml-bd1023)
+ *   - Boyang Hu (edsml-bh223)
+ *   - Chawk Chamoun (edsml-cc8915)
+ *   - Mingsheng Cai (acse-sc4623)
+ *   - Moyu Zhang (acse-mz223)
+ *   - Ryan Benney (acse-rgb123)
+ */
+
+#include "Parallel.h"
+#include "Trace.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <vector>
+
+unsigned int Parallel::threadCount() {
+    return std::max(1u, std::thread::hardware_concurrency());
+}
+
+void Parallel::forRange(size_t count, const std::function<void(size_t begin, size_t end)> &body, size_t minChunk) {
+    if (count == 0) {
+        return;
+    }
+
+    // When tracing, time every chunk on its own thread and sum the busy time for the utilisation of the loop
+    bool tracing = Trace::isEnabled();
+    ScopedTimer region("Parallel::forRange", "parallel");
+    auto regionStart = std::chrono::steady_clock::now();
+    std::atomic<long long> busyNs{0};
+    auto runChunk = [&](size_t begin, size_t end) {
+        if (!tracing) {
+            body(begin, end);
+            return;
+        }
+        ScopedTimer chunkTimer("Parallel chunk", "parallel");
+        auto start = std::chrono::steady_clock::now();
+        body(begin, end);
+        auto elapsed = std::chrono::steady_clock::now() - start;
+        busyNs += std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count();
+    };
+
+    // Use no more threads than there are chunks worth splitting off
+    minChunk = std::max<size_t>(minChunk, 1);
+    size_t chunks = std::min<size_t>(threadCount(), (count + minChunk - 1) / minChunk);
+    if (chunks <= 1) {
+        chunks = 1;
+        runChunk(0, count);
+    } else {
+        // Spread the remainder over the first chunks so that their sizes differ by at most one
+        std::vector<std::thread> workers;
+        workers.reserve(chunks - 1);
+        size_t begin = 0;
+        for (size_t i = 0; i < chunks; ++i) {
+            size_t end = begin + count / chunks + (i < count % chunks ? 1 : 0);
+            if (i + 1 == chunks) {
+                runChunk(begin, end);
+            } else {
+                workers.emplace_back(runChunk, begin, end);
+            }
+            begin = end;
+        }
+
+        for (auto &worker: workers) {
+            worker.join();
+        }
+    }
+
+    if (tracing) {
+        auto wallNs = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                std::chrono::steady_clock::now() - regionStart).count();
+        region.setUtilisation(static_cast<unsigned int>(chunks),
+                              wallNs > 0 ? static_cast<double>(busyNs) / (static_cast<double>(chunks) * wallNs) : 1.0);
+    }
+}
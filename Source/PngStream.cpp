@@ -0,0 +1,462 @@
+/**
+ * @file PngStream.cpp
+ *
+ * @brief Implements the row-at-a-time PNG reader and writer.
+ *
+ * The reader walks the chunk list once when the file is opened, keeping the header, palette and transparency and
+ * handing the IDAT chunks to an InflateStream in place. Each readRow then inflates exactly one filtered row, undoes its
+ * filter against the previous row, expands its samples to 8 bits and converts the channels.
+ *
+ * The writer tries the five PNG filters on every row, compresses the one with the smallest sum of absolute values
+ * and writes an IDAT chunk whenever chunkSize compressed bytes have accumulated.
+ *
+ * @date Created on October 19, 2026
+ *
+ * @authors
+ * Advanced Programming Group Radix Sort:
+ *   - Benjamin Duncan (edsml-bd1023)
+ *   - Boyang Hu (edsml-bh223)
+ *   - Chawk Chamoun (edsml-cc8915)
+ *   - Mingsheng Cai (acse-sc4623)
+ *   - Moyu Zhang (acse-mz223)
+ *   - Ryan Benney (acse-rgb123)
+ */
+
+#include "PngStream.h"
+#include "OutputService.h"
+
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <filesystem>
+#include <iostream>
+#include <limits>
+
+namespace fs = std::filesystem;
+
+namespace {
+    constexpr unsigned char signature[8] = {0x89, 'P', 'N', 'G', '\r', '\n', 0x1A, '\n'};
+
+    uint32_t readBig32(const unsigned char *p) {
+        return static_cast<uint32_t>(p[0]) << 24 | static_cast<uint32_t>(p[1]) << 16 |
+               static_cast<uint32_t>(p[2]) << 8 | p[3];
+    }
+
+    void putBig32(unsigned char *p, uint32_t value) {
+        p[0] = static_cast<unsigned char>(value >> 24);
+        p[1] = static_cast<unsigned char>(value >> 16);
+        p[2] = static_cast<unsigned char>(value >> 8);
+        p[3] = static_cast<unsigned char>(value);
+    }
+
+    int paeth(int a, int b, int c) {
+        int p = a + b - c, pa = std::abs(p - a), pb = std::abs(p - b), pc = std::abs(p - c);
+        return pa <= pb && pa <= pc ? a : pb <= pc ? b : c;
+    }
+
+    // Weighted luma of an RGB colour, as computed by stb_image
+    unsigned char luma(const unsigned char *rgb) {
+        return static_cast<unsigned char>((rgb[0] * 77 + rgb[1] * 150 + rgb[2] * 29) >> 8);
+    }
+
+    // Converts pixels between 1 to 4 channels the way stb_image does
+    void convertChannels(const unsigned char *in, int inChannels, unsigned char *out, int outChannels, size_t count) {
+        for (size_t i = 0; i < count; ++i, in += inChannels, out += outChannels) {
+            bool colour = inChannels >= 3;
+            unsigned char grey = colour ? luma(in) : in[0];
+            unsigned char alpha = inChannels == 2 ? in[1] : inChannels == 4 ? in[3] : 255;
+            switch (outChannels) {
+                case 1:
+                    out[0] = grey;
+                    break;
+                case 2:
+                    out[0] = grey;
+                    out[1] = alpha;
+                    break;
+                default:
+                    for (int c = 0; c < 3; ++c) {
+                        out[c] = colour ? in[c] : in[0];
+                    }
+                    if (outChannels == 4) {
+                        out[3] = alpha;
+                    }
+                    break;
+            }
+        }
+    }
+}
+
+PngReader::PngReader() : width(0), height(0), bitDepth(0), colourType(0), sourceChannels(0), decodedChannels(0),
+                         channels(0), rowsRead(0), rowBytes(0), hasColourKey(false), colourKey{0, 0, 0} {}
+
+bool PngReader::open(const std::string &path, int desiredChannels) {
+    width = height = 0;
+    if (desiredChannels < 0 || desiredChannels > 4) {
+        std::cerr << "Error: Cannot read PNG rows with " << desiredChannels << " channels." << std::endl;
+        return false;
+    }
+    if (!file.open(path)) {
+        return false;
+    }
+    auto fail = [&](const std::string &message) {
+        std::cerr << "Error: " << path << " " << message << std::endl;
+        file.close();
+        width = height = 0;
+        return false;
+    };
+    const unsigned char *data = file.getData();
+    size_t size = file.getSize();
+    if (size < 8 || std::memcmp(data, signature, 8) != 0) {
+        return fail("is not a PNG file.");
+    }
+
+    // Walk the chunks: the header first, then the palette, transparency and image data in any order up to IEND
+    std::vector<std::pair<const unsigned char *, size_t>> imageData;
+    palette.assign(256 * 4, 255);
+    size_t paletteSize = 0;
+    hasColourKey = false;
+    bool ended = false;
+    for (size_t position = 8; !ended;) {
+        if (size - position < 12) {
+            return fail("ends before its IEND chunk.");
+        }
+        size_t length = readBig32(data + position);
+        const unsigned char *type = data + position + 4;
+        const unsigned char *content = data + position + 8;
+        if (length > size - position - 12) {
+            return fail("has a chunk that runs past the end of the file.");
+        }
+        bool isHeader = std::memcmp(type, "IHDR", 4) == 0;
+        if ((position == 8) != isHeader) {
+            return fail("does not start with an IHDR chunk.");
+        }
+        if (isHeader) {
+            if (length != 13) {
+                return fail("has an invalid IHDR chunk.");
+            }
+            uint32_t w = readBig32(content), h = readBig32(content + 4);
+            bitDepth = content[8];
+            colourType = content[9];
+            if (w == 0 || h == 0 || w > static_cast<uint32_t>(std::numeric_limits<int>::max()) ||
+                h > static_cast<uint32_t>(std::numeric_limits<int>::max())) {
+                return fail("has an invalid size.");
+            }
+            width = static_cast<int>(w);
+            height = static_cast<int>(h);
+            bool validDepth;
+            switch (colourType) {
+                case 0: validDepth = bitDepth == 1 || bitDepth == 2 || bitDepth == 4 || bitDepth == 8 || bitDepth == 16;
+                    break;
+                case 3: validDepth = bitDepth == 1 || bitDepth == 2 || bitDepth == 4 || bitDepth == 8;
+                    break;
+                case 2:
+                case 4:
+                case 6: validDepth = bitDepth == 8 || bitDepth == 16;
+                    break;
+                default: validDepth = false;
+            }
+            if (!validDepth || content[10] != 0 || content[11] != 0) {
+                return fail("has an unsupported colour type or bit depth.");
+            }
+            if (content[12] != 0) {
+                return fail("is interlaced; interlaced PNG files cannot be read row by row.");
+            }
+        } else if (std::memcmp(type, "PLTE", 4) == 0) {
+            if (length % 3 != 0 || length > 256 * 3) {
+                return fail("has an invalid palette.");
+            }
+            paletteSize = length / 3;
+            for (size_t i = 0; i < paletteSize; ++i) {
+                std::memcpy(&palette[i * 4], content + i * 3, 3);
+            }
+        } else if (std::memcmp(type, "tRNS", 4) == 0) {
+            if (colourType == 3) {
+                for (size_t i = 0; i < length && i < 256; ++i) {
+                    palette[i * 4 + 3] = content[i];
+                }
+                hasColourKey = length > 0;
+            } else if ((colourType == 0 && length == 2) || (colourType == 2 && length == 6)) {
+                for (size_t c = 0; c < length / 2; ++c) {
+                    colourKey[c] = static_cast<unsigned int>(content[2 * c]) << 8 | content[2 * c + 1];
+                }
+                hasColourKey = true;
+            }
+        } else if (std::memcmp(type, "IDAT", 4) == 0) {
+            imageData.emplace_back(content, length);
+        } else if (std::memcmp(type, "IEND", 4) == 0) {
+            ended = true;
+        }
+        position += length + 12;
+    }
+    if (imageData.empty()) {
+        return fail("has no image data.");
+    }
+    if (colourType == 3 && paletteSize == 0) {
+        return fail("has no palette.");
+    }
+
+    // Skip the two-byte zlib header, which may itself be split between chunks
+    unsigned char header[2];
+    size_t headerBytes = 0;
+    for (auto &piece: imageData) {
+        while (headerBytes < 2 && piece.second > 0) {
+            header[headerBytes++] = *piece.first++;
+            --piece.second;
+        }
+    }
+    if (headerBytes < 2 || (header[0] & 0x0F) != 8 || (header[0] << 8 | header[1]) % 31 != 0 || (header[1] & 0x20)) {
+        return fail("has an invalid zlib header.");
+    }
+    inflater = InflateStream();
+    for (const auto &piece: imageData) {
+        inflater.addInput(piece.first, piece.second);
+    }
+
+    static constexpr int channelsOfType[7] = {1, 0, 3, 1, 2, 0, 4};
+    sourceChannels = channelsOfType[colourType];
+    decodedChannels = colourType == 3 ? (hasColourKey ? 4 : 3) : sourceChannels + (hasColourKey ? 1 : 0);
+    channels = desiredChannels ? desiredChannels : decodedChannels;
+    rowBytes = (static_cast<size_t>(width) * sourceChannels * bitDepth + 7) / 8;
+    current.assign(rowBytes + 1, 0);
+    previous.assign(rowBytes + 1, 0);
+    expanded.resize(static_cast<size_t>(width) * decodedChannels);
+    rowsRead = 0;
+    return true;
+}
+
+bool PngReader::isOpen() const {
+    return width > 0;
+}
+
+int PngReader::getWidth() const {
+    return width;
+}
+
+int PngReader::getHeight() const {
+    return height;
+}
+
+int PngReader::getChannels() const {
+    return channels;
+}
+
+int PngReader::getRowsRead() const {
+    return rowsRead;
+}
+
+void PngReader::expandRow() {
+    const unsigned char *row = current.data() + 1;
+    unsigned char *out = expanded.data();
+    if (bitDepth == 8 && colourType != 3 && !hasColourKey) {
+        std::memcpy(out, row, rowBytes);
+        return;
+    }
+
+    unsigned int mask = (1u << std::min(bitDepth, 8)) - 1;
+    unsigned int scale = colourType == 0 && bitDepth < 8 ? 255 / mask : 1;
+    for (size_t x = 0; x < static_cast<size_t>(width); ++x) {
+        bool transparent = hasColourKey && colourType != 3;
+        for (int c = 0; c < sourceChannels; ++c) {
+            size_t index = x * sourceChannels + c;
+            unsigned int value;
+            if (bitDepth == 16) {
+                value = static_cast<unsigned int>(row[2 * index]) << 8 | row[2 * index + 1];
+            } else if (bitDepth == 8) {
+                value = row[index];
+            } else {
+                size_t bit = index * bitDepth;
+                value = (row[bit / 8] >> (8 - bitDepth - bit % 8)) & mask;
+            }
+            if (c < 3 && value != colourKey[c]) {
+                transparent = false;
+            }
+            if (colourType == 3) {
+                std::memcpy(out, &palette[value * 4], decodedChannels);
+                out += decodedChannels;
+            } else {
+                *out++ = static_cast<unsigned char>(bitDepth == 16 ? value >> 8 : value * scale);
+            }
+        }
+        if (hasColourKey && colourType != 3) {
+            *out++ = transparent ? 0 : 255;
+        }
+    }
+}
+
+bool PngReader::readRow(unsigned char *out) {
+    if (rowsRead >= height) {
+        std::cerr << "Error: No PNG rows are left to read." << std::endl;
+        return false;
+    }
+    std::swap(current, previous);
+    if (inflater.read(current.data(), rowBytes + 1) != rowBytes + 1) {
+        std::cerr << "Error: The PNG image data ends or is corrupt at row " << rowsRead << "." << std::endl;
+        rowsRead = height;
+        return false;
+    }
+
+    // Undo the row filter; a and c are the bytes one pixel to the left in this row and the row above
+    unsigned char *row = current.data() + 1;
+    const unsigned char *above = previous.data() + 1;
+    size_t step = std::max(1, sourceChannels * bitDepth / 8);
+    switch (current[0]) {
+        case 0:
+            break;
+        case 1:
+            for (size_t i = step; i < rowBytes; ++i) {
+                row[i] = static_cast<unsigned char>(row[i] + row[i - step]);
+            }
+            break;
+        case 2:
+            for (size_t i = 0; i < rowBytes; ++i) {
+                row[i] = static_cast<unsigned char>(row[i] + above[i]);
+            }
+            break;
+        case 3:
+            for (size_t i = 0; i < rowBytes; ++i) {
+                int left = i >= step ? row[i - step] : 0;
+                row[i] = static_cast<unsigned char>(row[i] + ((left + above[i]) >> 1));
+            }
+            break;
+        case 4:
+            for (size_t i = 0; i < rowBytes; ++i) {
+                int left = i >= step ? row[i - step] : 0, corner = i >= step ? above[i - step] : 0;
+                row[i] = static_cast<unsigned char>(row[i] + paeth(left, above[i], corner));
+            }
+            break;
+        default:
+            std::cerr << "Error: Row " << rowsRead << " of the PNG image has an invalid filter type." << std::endl;
+            rowsRead = height;
+            return false;
+    }
+
+    expandRow();
+    if (channels == decodedChannels) {
+        std::memcpy(out, expanded.data(), expanded.size());
+    } else {
+        convertChannels(expanded.data(), decodedChannels, out, channels, static_cast<size_t>(width));
+    }
+    ++rowsRead;
+    return true;
+}
+
+PngWriter::PngWriter() : width(0), height(0), channels(0), rowsWritten(0) {}
+
+void PngWriter::writeChunk(const char *type, const unsigned char *data, size_t size) {
+    unsigned char header[8];
+    putBig32(header, static_cast<uint32_t>(size));
+    std::memcpy(header + 4, type, 4);
+    uint32_t crc = Inflate::crc32(header + 4, 4);
+    crc = Inflate::crc32(data, size, crc);
+    unsigned char trailer[4];
+    putBig32(trailer, crc);
+    file.write(reinterpret_cast<const char *>(header), 8);
+    file.write(reinterpret_cast<const char *>(data), static_cast<std::streamsize>(size));
+    file.write(reinterpret_cast<const char *>(trailer), 4);
+}
+
+bool PngWriter::open(const std::string &path, int width, int height, int channels) {
+    if (width <= 0 || height <= 0 || channels < 1 || channels > 4) {
+        std::cerr << "Error: Cannot write a " << width << "x" << height << " PNG image with " << channels
+                  << " channels." << std::endl;
+        return false;
+    }
+    if (!OutputService::global().ensureDirectory(fs::path(path).parent_path().string())) {
+        return false;
+    }
+    file = std::ofstream(path, std::ios::binary);
+    if (!file) {
+        std::cerr << "Error: Failed to create " << path << "." << std::endl;
+        return false;
+    }
+    this->path = path;
+    this->width = width;
+    this->height = height;
+    this->channels = channels;
+    rowsWritten = 0;
+    size_t rowBytes = static_cast<size_t>(width) * channels;
+    previous.assign(rowBytes, 0);
+    filtered.resize(5 * (rowBytes + 1));
+    compressed.clear();
+    deflater = DeflateStream();
+
+    static constexpr unsigned char colourTypes[5] = {0, 0, 4, 2, 6};
+    unsigned char header[13] = {};
+    putBig32(header, static_cast<uint32_t>(width));
+    putBig32(header + 4, static_cast<uint32_t>(height));
+    header[8] = 8;
+    header[9] = colourTypes[channels];
+    file.write(reinterpret_cast<const char *>(signature), 8);
+    writeChunk("IHDR", header, sizeof(header));
+    return static_cast<bool>(file);
+}
+
+bool PngWriter::writeRow(const unsigned char *row) {
+    if (!file.is_open() || rowsWritten >= height) {
+        std::cerr << "Error: No PNG rows are left to write." << std::endl;
+        return false;
+    }
+    size_t rowBytes = static_cast<size_t>(width) * channels;
+    size_t step = static_cast<size_t>(channels);
+    const unsigned char *above = previous.data();
+
+    // Filter the row every way and keep the filter whose output looks smallest as signed bytes
+    size_t best = 0;
+    long bestScore = std::numeric_limits<long>::max();
+    for (int type = 0; type < 5; ++type) {
+        unsigned char *out = filtered.data() + type * (rowBytes + 1);
+        out[0] = static_cast<unsigned char>(type);
+        long score = 0;
+        for (size_t i = 0; i < rowBytes; ++i) {
+            int left = i >= step ? row[i - step] : 0, corner = i >= step ? above[i - step] : 0;
+            int predicted = type == 0 ? 0 : type == 1 ? left : type == 2 ? above[i] :
+                                                                type == 3 ? (left + above[i]) >> 1 :
+                                                                paeth(left, above[i], corner);
+            auto value = static_cast<unsigned char>(row[i] - predicted);
+            out[i + 1] = value;
+            score += std::abs(static_cast<signed char>(value));
+        }
+        if (score < bestScore) {
+            bestScore = score;
+            best = static_cast<size_t>(type);
+        }
+    }
+    deflater.write(filtered.data() + best * (rowBytes + 1), rowBytes + 1, compressed);
+    std::memcpy(previous.data(), row, rowBytes);
+    ++rowsWritten;
+
+    if (compressed.size() >= chunkSize) {
+        size_t whole = compressed.size() / chunkSize * chunkSize;
+        for (size_t offset = 0; offset < whole; offset += chunkSize) {
+            writeChunk("IDAT", compressed.data() + offset, chunkSize);
+        }
+        compressed.erase(compressed.begin(), compressed.begin() + static_cast<long>(whole));
+    }
+    if (!file) {
+        std::cerr << "Error: Failed to write " << path << "." << std::endl;
+        return false;
+    }
+    return true;
+}
+
+bool PngWriter::close() {
+    if (!file.is_open()) {
+        return false;
+    }
+    if (rowsWritten != height) {
+        std::cerr << "Error: Only " << rowsWritten << " of " << height << " rows were written to " << path << "."
+                  << std::endl;
+        file.close();
+        return false;
+    }
+    deflater.finish(compressed);
+    writeChunk("IDAT", compressed.data(), compressed.size());
+    writeChunk("IEND", nullptr, 0);
+    compressed.clear();
+    file.close();
+    if (!file) {
+        std::cerr << "Error: Failed to write " << path << "." << std::endl;
+        return false;
+    }
+    return true;
+}
@@ -0,0 +1,139 @@
+/**
+ * @file ProcessingClient.cpp
+ *
+ * @brief Implements the ProcessingClient class.
+ *
+ * @date Created on October 19, 2026
+ *
+ * @authors
+ * Advanced Programming Group Radix Sort:
+ *   - Benjamin Duncan (edsml-bd1023)
+ *   - Boyang Hu (edsml-bh223)
+ *   - Chawk Chamoun (edsml-cc8915)
+ *   - Mingsheng Cai (acse-sc4623)
+ *   - Moyu Zhang (acse-mz223)
+ *   - Ryan Benney (acse-rgb123)
+ */
+
+#include "ProcessingClient.h"
+
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <iostream>
+#include <sstream>
+
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+ProcessingClient::ProcessingClient() : connection(-1) {}
+
+ProcessingClient::~ProcessingClient() {
+    close();
+}
+
+bool ProcessingClient::connect(const std::string &socketPath) {
+    close();
+    sockaddr_un address{};
+    if (socketPath.empty() || socketPath.size() >= sizeof(address.sun_path)) {
+        std::cerr << "Error: Invalid socket path " << socketPath << std::endl;
+        return false;
+    }
+    address.sun_family = AF_UNIX;
+    std::strncpy(address.sun_path, socketPath.c_str(), sizeof(address.sun_path) - 1);
+
+    connection = socket(AF_UNIX, SOCK_STREAM, 0);
+    if (connection < 0 || ::connect(connection, reinterpret_cast<sockaddr *>(&address), sizeof(address)) < 0) {
+        std::cerr << "Error: Cannot connect to " << socketPath << ": " << std::strerror(errno) << std::endl;
+        close();
+        return false;
+    }
+    return true;
+}
+
+bool ProcessingClient::receive(char *data, size_t size) {
+    if (size == 0) {
+        return true;
+    }
+    size_t buffered = std::min(size, buffer.size());
+    std::memcpy(data, buffer.data(), buffered);
+    buffer.erase(0, buffered);
+    for (size_t done = buffered; done < size;) {
+        ssize_t received = recv(connection, data + done, size - done, 0);
+        if (received < 0 && errno == EINTR) {
+            continue;
+        }
+        if (received <= 0) {
+            return false;
+        }
+        done += static_cast<size_t>(received);
+    }
+    return true;
+}
+
+bool ProcessingClient::request(const std::string &request, ProcessingResponse &response) {
+    response = ProcessingResponse();
+    if (connection < 0) {
+        std::cerr << "Error: The client is not connected." << std::endl;
+        return false;
+    }
+
+    std::string line = request + "\n";
+    for (size_t sent = 0; sent < line.size();) {
+        ssize_t count = send(connection, line.data() + sent, line.size() - sent, MSG_NOSIGNAL);
+        if (count < 0 && errno == EINTR) {
+            continue;
+        }
+        if (count <= 0) {
+            close();
+            return false;
+        }
+        sent += static_cast<size_t>(count);
+    }
+
+    // Read the header line; the payload may arrive in the same chunk, so the rest stays in the buffer
+    size_t newline;
+    char chunk[4096];
+    while ((newline = buffer.find('\n')) == std::string::npos) {
+        ssize_t received = recv(connection, chunk, sizeof(chunk), 0);
+        if (received < 0 && errno == EINTR) {
+            continue;
+        }
+        if (received <= 0) {
+            close();
+            return false;
+        }
+        buffer.append(chunk, static_cast<size_t>(received));
+    }
+    std::string header = buffer.substr(0, newline);
+    buffer.erase(0, newline + 1);
+
+    if (header.rfind("ERROR ", 0) == 0) {
+        response.error = header.substr(6);
+        return true;
+    }
+    std::istringstream fields(header);
+    std::string status;
+    size_t bytes = 0;
+    if (!(fields >> status >> response.width >> response.height >> response.channels >> bytes) || status != "OK") {
+        std::cerr << "Error: Unexpected answer " << header << std::endl;
+        close();
+        return false;
+    }
+    response.data.resize(bytes);
+    if (!receive(reinterpret_cast<char *>(response.data.data()), bytes)) {
+        close();
+        return false;
+    }
+    response.ok = true;
+    return true;
+}
+
+void ProcessingClient::close() {
+    if (connection >= 0) {
+        ::close(connection);
+    }
+    connection = -1;
+    buffer.clear();
+}
@@ -0,0 +1,416 @@
+/**
+ * @file ProcessingServer.cpp
+ *
+ * @brief Implements the resident processing server.
+ *
+ * The accepting thread waits for connections with poll and a short timeout, so that stop only has to set a flag, and
+ * hands every connection to the worker pool. A worker reads requests from its connection into a buffer, answers each
+ * complete line in turn and keeps the connection until the client closes it. Inputs are loaded outside the cache lock,
+ * so a slow load does not hold up requests for other inputs; two requests missing the same input at once both load it
+ * and the second copy is dropped.
+ *
+ * @date Created on October 19, 2026
+ *
+ * @authors
+ * Advanced Programming Group Radix Sort:
+ *   - Benjamin Duncan (edsml-bd1023)
+ *   - Boyang Hu (edsml-bh223)
+ *   - Chawk Chamoun (edsml-cc8915)
+ *   - Mingsheng Cai (acse-sc4623)
+ *   - Moyu Zhang (acse-mz223)
+ *   - Ryan Benney (acse-rgb123)
+ */
+
+#include "ProcessingServer.h"
+#include "BoundedQueue.h"
+#include "FilteredVolume.h"
+#include "Trace.h"
+#include "VolumeFormats.h"
+#include "Filters/Box2DFilter.h"
+#include "Filters/EdgeFilter.h"
+#include "Filters/Gaussian2DFilter.h"
+#include "Filters/Gaussian3DFilter.h"
+#include "Filters/Median2DFilter.h"
+#include "Filters/Median3DFilter.h"
+#include "Filters/PixelFilter.h"
+
+#include <cerrno>
+#include <cstring>
+#include <exception>
+#include <filesystem>
+#include <functional>
+#include <iostream>
+#include <sstream>
+#include <stdexcept>
+#include <thread>
+
+#include <poll.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+namespace {
+    constexpr int pollMilliseconds = 100; // Longest wait before the stop flag is checked again
+    constexpr size_t maxRequestBytes = 64 * 1024; // Longest request line accepted
+
+    std::vector<std::string> split(const std::string &text, char separator) {
+        std::vector<std::string> tokens;
+        std::string token;
+        std::istringstream stream(text);
+        while (std::getline(stream, token, separator)) {
+            if (!token.empty()) {
+                tokens.push_back(token);
+            }
+        }
+        return tokens;
+    }
+
+    // Parses gaussian:<sigma>:<kernelSize> and median:<kernelSize>; throws std::invalid_argument for anything else
+    std::vector<std::unique_ptr<IFilter3D>> parseVolumeFilters(const std::vector<std::string> &specs) {
+        std::vector<std::unique_ptr<IFilter3D>> filters;
+        for (const auto &spec: specs) {
+            auto fields = split(spec, ':');
+            if (fields.size() == 3 && fields[0] == "gaussian") {
+                filters.push_back(std::make_unique<Gaussian3DFilter>(std::stod(fields[1]), std::stoi(fields[2])));
+            } else if (fields.size() == 2 && fields[0] == "median") {
+                filters.push_back(std::make_unique<Median3DFilter>(std::stoi(fields[1])));
+            } else {
+                throw std::invalid_argument("Unknown volume filter " + spec);
+            }
+        }
+        return filters;
+    }
+
+    // Parses the image filters listed in ProcessingServer.h; throws std::invalid_argument for anything else
+    std::vector<std::function<void(Image &)>> parseImageFilters(const std::vector<std::string> &specs) {
+        std::vector<std::function<void(Image &)>> filters;
+        for (const auto &spec: specs) {
+            auto fields = split(spec, ':');
+            const std::string &name = fields.empty() ? spec : fields[0];
+            if (fields.size() == 2 && name == "box") {
+                auto filter = std::make_shared<Box2DFilter>(std::stoi(fields[1]));
+                filters.emplace_back([filter](Image &image) { filter->apply(image); });
+            } else if (fields.size() == 3 && name == "gaussian") {
+                auto filter = std::make_shared<Gaussian2DFilter>(std::stoi(fields[2]), std::stod(fields[1]));
+                filters.emplace_back([filter](Image &image) { filter->apply(image); });
+            } else if (fields.size() == 2 && name == "median") {
+                auto filter = std::make_shared<Median2DFilter>(std::stoi(fields[1]));
+                filters.emplace_back([filter](Image &image) { filter->apply(image); });
+            } else if (fields.size() == 1 && (name == "sobel" || name == "prewitt" || name == "scharr" ||
+                                              name == "roberts")) {
+                FilterType type = name == "sobel" ? FilterType::Sobel : name == "prewitt" ? FilterType::Prewitt :
+                                  name == "scharr" ? FilterType::Scharr : FilterType::Roberts;
+                auto filter = std::make_shared<EdgeFilter>(type);
+                filters.emplace_back([filter](Image &image) { filter->apply(image); });
+            } else if (fields.size() == 1 && name == "grayscale") {
+                auto filter = std::make_shared<PixelFilter>("Grayscale");
+                filters.emplace_back([filter](Image &image) { filter->apply(image); });
+            } else if (fields.size() == 2 && name == "brightness") {
+                auto filter = std::make_shared<PixelFilter>("Brightness", std::stoi(fields[1]));
+                filters.emplace_back([filter](Image &image) { filter->apply(image); });
+            } else {
+                throw std::invalid_argument("Unknown image filter " + spec);
+            }
+        }
+        return filters;
+    }
+
+    std::string okHeader(int width, int height, int channels, size_t bytes) {
+        return "OK " + std::to_string(width) + " " + std::to_string(height) + " " + std::to_string(channels) + " " +
+               std::to_string(bytes) + "\n";
+    }
+
+    bool sendAll(int connection, const void *data, size_t size) {
+        const auto *bytes = static_cast<const char *>(data);
+        while (size > 0) {
+            ssize_t sent = send(connection, bytes, size, MSG_NOSIGNAL);
+            if (sent < 0 && errno == EINTR) {
+                continue;
+            }
+            if (sent <= 0) {
+                return false;
+            }
+            bytes += sent;
+            size -= static_cast<size_t>(sent);
+        }
+        return true;
+    }
+}
+
+ProcessingServer::ProcessingServer(const std::string &socketPath, int workers, size_t capacityBytes)
+        : socketPath(socketPath), workers(workers), capacityBytes(capacityBytes), stopping(false), usedBytes(0),
+          hits(0), misses(0) {
+    if (workers < 1) {
+        throw std::invalid_argument("A processing server needs at least one worker.");
+    }
+    if (socketPath.empty() || socketPath.size() >= sizeof(sockaddr_un::sun_path)) {
+        throw std::invalid_argument("The socket path must be non-empty and shorter than " +
+                                    std::to_string(sizeof(sockaddr_un::sun_path)) + " characters.");
+    }
+}
+
+void ProcessingServer::remember(const std::string &path, CachedInput input) {
+    std::lock_guard<std::mutex> lock(mutex);
+    if (inputs.find(path) != inputs.end()) {
+        return;
+    }
+    recent.push_front(path);
+    input.position = recent.begin();
+    usedBytes += input.bytes;
+    inputs[path] = std::move(input);
+
+    // The input just added is kept even if it is larger than the capacity
+    while (usedBytes > capacityBytes && recent.size() > 1) {
+        usedBytes -= inputs[recent.back()].bytes;
+        inputs.erase(recent.back());
+        recent.pop_back();
+    }
+}
+
+std::shared_ptr<const Volume> ProcessingServer::getVolume(const std::string &path, std::string &error) {
+    std::string key = "volume:" + path;
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        auto input = inputs.find(key);
+        if (input != inputs.end()) {
+            ++hits;
+            recent.splice(recent.begin(), recent, input->second.position);
+            return input->second.volume;
+        }
+        ++misses;
+    }
+
+    auto volume = std::make_shared<Volume>();
+    bool loaded = std::filesystem::is_directory(path) ? volume->loadFromDirectory(path)
+                                                      : VolumeFormats::load(path, *volume);
+    if (!loaded || !volume->getData()) {
+        error = "Cannot load the volume " + path;
+        return nullptr;
+    }
+    size_t bytes = static_cast<size_t>(volume->getWidth()) * volume->getHeight() * volume->getDepth() *
+                   bytesPerSample(volume->getDataType());
+    remember(key, {volume, nullptr, bytes, {}});
+    return volume;
+}
+
+std::shared_ptr<const Image> ProcessingServer::getImage(const std::string &path, std::string &error) {
+    std::string key = "image:" + path;
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        auto input = inputs.find(key);
+        if (input != inputs.end()) {
+            ++hits;
+            recent.splice(recent.begin(), recent, input->second.position);
+            return input->second.image;
+        }
+        ++misses;
+    }
+
+    auto image = std::make_shared<Image>();
+    if (!image->loadFromFile(path) || !image->getData()) {
+        error = "Cannot load the image " + path;
+        return nullptr;
+    }
+    size_t bytes = static_cast<size_t>(image->getWidth()) * image->getHeight() * image->getChannels() *
+                   bytesPerSample(image->getDataType());
+    remember(key, {nullptr, image, bytes, {}});
+    return image;
+}
+
+void ProcessingServer::handle(const std::string &request, std::string &header, std::vector<unsigned char> &payload) {
+    TRACE_SCOPE("ProcessingServer::handle", "io", request.size());
+    payload.clear();
+    auto tokens = split(request, ' ');
+    std::string command = tokens.empty() ? "" : tokens[0];
+    std::string error;
+    try {
+        if (command == "PING" && tokens.size() == 1) {
+            header = okHeader(0, 0, 0, 0);
+        } else if (command == "STATS" && tokens.size() == 1) {
+            std::lock_guard<std::mutex> lock(mutex);
+            std::string text = "hits=" + std::to_string(hits) + " misses=" + std::to_string(misses) + " inputs=" +
+                               std::to_string(inputs.size()) + " bytes=" + std::to_string(usedBytes);
+            payload.assign(text.begin(), text.end());
+            header = okHeader(0, 0, 0, payload.size());
+        } else if (command == "SHUTDOWN" && tokens.size() == 1) {
+            stop();
+            header = okHeader(0, 0, 0, 0);
+        } else if ((command == "SLICE" || command == "PROJECT") && tokens.size() >= 4) {
+            // Parse everything before loading, so malformed requests fail fast
+            auto filters = parseVolumeFilters({tokens.begin() + 4, tokens.end()});
+            int sliceIndex = command == "SLICE" ? std::stoi(tokens[3]) : 0;
+            auto volume = getVolume(tokens[1], error);
+            if (volume) {
+                FilteredVolume view(*volume);
+                for (auto &filter: filters) {
+                    view.addFilter(*filter);
+                }
+                int width = volume->getWidth(), height = volume->getHeight(), depth = volume->getDepth();
+                if (command == "SLICE") {
+                    const std::string &plane = tokens[2];
+                    payload = view.getSliceUInt8(plane, sliceIndex);
+                    if (payload.empty()) {
+                        error = "Invalid plane or slice index";
+                    } else {
+                        header = okHeader(plane == "y-z" ? height : width, plane == "x-y" ? height : depth, 1,
+                                          payload.size());
+                    }
+                } else {
+                    int begin = 0, end = depth;
+                    if (tokens[3] != "all") {
+                        auto range = split(tokens[3], ':');
+                        if (range.size() != 2) {
+                            throw std::invalid_argument("The range must be <begin>:<end> or all");
+                        }
+                        begin = std::stoi(range[0]) - 1;
+                        end = std::stoi(range[1]);
+                    }
+                    payload = view.getProjectionUInt8(tokens[2], begin, end);
+                    if (payload.empty()) {
+                        error = "Invalid projector or range";
+                    } else {
+                        header = okHeader(width, height, 1, payload.size());
+                    }
+                }
+            }
+        } else if (command == "IMAGE" && tokens.size() >= 2) {
+            auto filters = parseImageFilters({tokens.begin() + 2, tokens.end()});
+            auto image = getImage(tokens[1], error);
+            if (image) {
+                Image work(image->getWidth(), image->getHeight(), image->getChannels(), image->getData(),
+                           image->getDataType());
+                for (const auto &filter: filters) {
+                    filter(work);
+                }
+                size_t bytes = static_cast<size_t>(work.getWidth()) * work.getHeight() * work.getChannels() *
+                               bytesPerSample(work.getDataType());
+                payload.assign(work.getData(), work.getData() + bytes);
+                header = okHeader(work.getWidth(), work.getHeight(), work.getChannels(), bytes);
+            }
+        } else {
+            error = "Unknown or malformed request";
+        }
+    } catch (const std::exception &exception) {
+        error = exception.what();
+    }
+    if (!error.empty()) {
+        payload.clear();
+        header = "ERROR " + error + "\n";
+    }
+}
+
+void ProcessingServer::serve(int connection) {
+    std::string buffer, header;
+    std::vector<unsigned char> payload;
+    char chunk[4096];
+    while (!stopping) {
+        size_t newline = buffer.find('\n');
+        if (newline == std::string::npos) {
+            if (buffer.size() > maxRequestBytes) {
+                break;
+            }
+            pollfd descriptor{connection, POLLIN, 0};
+            int ready = poll(&descriptor, 1, pollMilliseconds);
+            if (ready < 0 && errno != EINTR) {
+                break;
+            }
+            if (ready <= 0) {
+                continue;
+            }
+            ssize_t received = recv(connection, chunk, sizeof(chunk), 0);
+            if (received <= 0) {
+                break;
+            }
+            buffer.append(chunk, static_cast<size_t>(received));
+            continue;
+        }
+
+        std::string request = buffer.substr(0, newline);
+        buffer.erase(0, newline + 1);
+        if (!request.empty() && request.back() == '\r') {
+            request.pop_back();
+        }
+        handle(request, header, payload);
+        if (!sendAll(connection, header.data(), header.size()) ||
+            !sendAll(connection, payload.data(), payload.size())) {
+            break;
+        }
+    }
+    close(connection);
+}
+
+bool ProcessingServer::run() {
+    // A socket left by an earlier run is replaced, but any other file at the path is left alone
+    struct stat existing{};
+    if (lstat(socketPath.c_str(), &existing) == 0 && !S_ISSOCK(existing.st_mode)) {
+        std::cerr << "Error: " << socketPath << " exists and is not a socket." << std::endl;
+        return false;
+    }
+    int listener = socket(AF_UNIX, SOCK_STREAM, 0);
+    if (listener < 0) {
+        std::cerr << "Error: Cannot create a socket: " << std::strerror(errno) << std::endl;
+        return false;
+    }
+    sockaddr_un address{};
+    address.sun_family = AF_UNIX;
+    std::strncpy(address.sun_path, socketPath.c_str(), sizeof(address.sun_path) - 1);
+    unlink(socketPath.c_str());
+    if (bind(listener, reinterpret_cast<sockaddr *>(&address), sizeof(address)) < 0 || listen(listener, 64) < 0) {
+        std::cerr << "Error: Cannot listen on " << socketPath << ": " << std::strerror(errno) << std::endl;
+        close(listener);
+        return false;
+    }
+    std::cout << "Processing server listening on " << socketPath << " with " << workers << " workers." << std::endl;
+
+    // Waits for a free worker once every worker is busy and the queue is full
+    BoundedQueue<int> connections(static_cast<size_t>(workers) * 4);
+    std::vector<std::thread> pool;
+    for (int i = 0; i < workers; ++i) {
+        pool.emplace_back([this, &connections]() {
+            int connection;
+            while (connections.pop(connection)) {
+                serve(connection);
+            }
+        });
+    }
+
+    while (!stopping) {
+        pollfd descriptor{listener, POLLIN, 0};
+        if (poll(&descriptor, 1, pollMilliseconds) <= 0) {
+            continue;
+        }
+        int connection = accept(listener, nullptr, nullptr);
+        if (connection >= 0 && !connections.push(connection)) {
+            close(connection);
+        }
+    }
+
+    connections.close();
+    for (auto &worker: pool) {
+        worker.join();
+    }
+    close(listener);
+    unlink(socketPath.c_str());
+    std::cout << "Processing server stopped." << std::endl;
+    return true;
+}
+
+void ProcessingServer::stop() {
+    stopping = true;
+}
+
+size_t ProcessingServer::getHits() {
+    std::lock_guard<std::mutex> lock(mutex);
+    return hits;
+}
+
+size_t ProcessingServer::getMisses() {
+    std::lock_guard<std::mutex> lock(mutex);
+    return misses;
+}
+
+size_t ProcessingServer::getCachedBytes() {
+    std::lock_guard<std::mutex> lock(mutex);
+    return usedBytes;
+}
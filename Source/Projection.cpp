@@ -26,102 +26,419 @@
 
 #include "Projection.h"
 #include "Algorithm.h"
+#include "Parallel.h"
+#include "ProjectionKernels.h"
+#include "Trace.h"
 
-std::vector<unsigned char> Projection::maximumIntensityProjection(int width, int height, int depth, const unsigned char* data) {
-    // If the volume is empty (including empty data pointer), return an empty MIP image
-    if (width == 0 || height == 0 || depth == 0 || !data) {
-        return std::vector<unsigned char>();
+#include <algorithm>
+#include <limits>
+#include <type_traits>
+
+namespace {
+    // Visits every voxel of a bricked volume one brick at a time, passing the projected pixel index and the voxel value
+    template<typename Visitor>
+    void forEachBrickVoxel(const BrickedVolume &volume, Visitor visit) {
+        int width = volume.getWidth();
+        int height = volume.getHeight();
+        int depth = volume.getDepth();
+        int brickSize = volume.getBrickSize();
+
+        for (int bz = 0; bz < volume.getBricksZ(); ++bz) {
+            int zEnd = std::min(brickSize, depth - bz * brickSize);
+            for (int by = 0; by < volume.getBricksY(); ++by) {
+                int yEnd = std::min(brickSize, height - by * brickSize);
+                for (int bx = 0; bx < volume.getBricksX(); ++bx) {
+                    int xEnd = std::min(brickSize, width - bx * brickSize);
+                    const unsigned char *brick = volume.getBrick(bx, by, bz);
+                    for (int lz = 0; lz < zEnd; ++lz) {
+                        for (int ly = 0; ly < yEnd; ++ly) {
+                            const unsigned char *row = brick + (lz * brickSize + ly) * brickSize;
+                            int pixel = (by * brickSize + ly) * width + bx * brickSize;
+                            for (int lx = 0; lx < xEnd; ++lx) {
+                                visit(pixel + lx, row[lx]);
+                            }
+                        }
+                    }
+                }
+            }
+        }
     }
+    // Number of projected pixels processed together; the accumulators of one band stay in the L1 or L2 cache
+    constexpr size_t bandPixels = 16384;
 
-    // Initialize the MIP image with zeros
-    std::vector<unsigned char> mip(width * height, 0); // Initialize with 0s
+    // Splits a slice into bands of consecutive pixels and hands them to the hardware threads, calling
+    // body(begin, end) once per band. Every slice of a band is read before moving on, so each thread streams through the
+    // volume while its accumulators stay in cache.
+    template<typename Body>
+    void forEachBand(int width, int height, Body body) {
+        size_t slicePixels = static_cast<size_t>(width) * height;
+        size_t bands = (slicePixels + bandPixels - 1) / bandPixels;
+        Parallel::forRange(bands, [&](size_t first, size_t last) {
+            for (size_t band = first; band < last; ++band) {
+                body(band * bandPixels, std::min(slicePixels, (band + 1) * bandPixels));
+            }
+        });
+    }
 
-    // Iterate through the volume and update the MIP image
-    for (int z = 0; z < depth; ++z) {
-        for (int y = 0; y < height; ++y) {
-            for (int x = 0; x < width; ++x) {
-                int index = z * width * height + y * width + x;
-                mip[y * width + x] = std::max(mip[y * width + x], data[index]);
+    // Shared implementation of the linear MIP overloads
+    template<typename T>
+    std::vector<T> maximumProjection(int width, int height, int depth, const T *data) {
+        TRACE_SCOPE("Projection::maximumIntensityProjection", "projection",
+                    static_cast<size_t>(width) * height * (depth + 1) * sizeof(T));
+        // If the volume is empty (including empty data pointer), return an empty MIP image
+        if (width == 0 || height == 0 || depth == 0 || !data) {
+            return std::vector<T>();
+        }
+
+        // Initialize the MIP image with the lowest value of the sample type
+        size_t slicePixels = static_cast<size_t>(width) * height;
+        std::vector<T> mip(slicePixels, std::numeric_limits<T>::lowest());
+
+        // Fold every slice of a band into the MIP image, using the SIMD kernels for 8-bit samples
+        forEachBand(width, height, [&](size_t begin, size_t end) {
+            T *result = mip.data() + begin;
+            for (int z = 0; z < depth; ++z) {
+                const T *slice = data + z * slicePixels + begin;
+                if constexpr (std::is_same_v<T, unsigned char>) {
+                    ProjectionKernels::maxInto(result, slice, end - begin);
+                } else {
+                    for (size_t i = 0; i < end - begin; ++i) {
+                        result[i] = std::max(result[i], slice[i]);
+                    }
+                }
             }
+        });
+
+        return mip;
+    }
+
+    // Shared implementation of the linear MinIP overloads
+    template<typename T>
+    std::vector<T> minimumProjection(int width, int height, int depth, const T *data) {
+        TRACE_SCOPE("Projection::minimumIntensityProjection", "projection",
+                    static_cast<size_t>(width) * height * (depth + 1) * sizeof(T));
+        // If the volume is empty (including empty data pointer), return an empty MinIP image
+        if (width == 0 || height == 0 || depth == 0 || !data) {
+            return std::vector<T>();
         }
+
+        // Initialize the MinIP image with the maximum value of the sample type
+        size_t slicePixels = static_cast<size_t>(width) * height;
+        std::vector<T> minip(slicePixels, std::numeric_limits<T>::max());
+
+        // Fold every slice of a band into the MinIP image, using the SIMD kernels for 8-bit samples
+        forEachBand(width, height, [&](size_t begin, size_t end) {
+            T *result = minip.data() + begin;
+            for (int z = 0; z < depth; ++z) {
+                const T *slice = data + z * slicePixels + begin;
+                if constexpr (std::is_same_v<T, unsigned char>) {
+                    ProjectionKernels::minInto(result, slice, end - begin);
+                } else {
+                    for (size_t i = 0; i < end - begin; ++i) {
+                        result[i] = std::min(result[i], slice[i]);
+                    }
+                }
+            }
+        });
+
+        return minip;
     }
 
-    return mip;
-}
+    // Shared implementation of the linear AIP overloads; integer samples are averaged with truncation
+    template<typename T>
+    std::vector<T> averageProjection(int width, int height, int depth, const T *data) {
+        TRACE_SCOPE("Projection::averageIntensityProjection", "projection",
+                    static_cast<size_t>(width) * height * (depth + 1) * sizeof(T));
+        // If the volume is empty (including empty data pointer), return an empty AIP image
+        if (width == 0 || height == 0 || depth == 0 || !data) {
+            return std::vector<T>();
+        }
 
-std::vector<unsigned char> Projection::minimumIntensityProjection(int width, int height, int depth, const unsigned char* data) {
-    // If the volume is empty (including empty data pointer), return an empty MIP image
-    if (width == 0 || height == 0 || depth == 0 || !data) {
-        return std::vector<unsigned char>();
+        // Use unsigned long for integer sums to avoid overflow, and double for float samples
+        using Sum = std::conditional_t<std::is_floating_point_v<T>, double, unsigned long>;
+        size_t slicePixels = static_cast<size_t>(width) * height;
+        std::vector<T> aip(slicePixels);
+
+        forEachBand(width, height, [&](size_t begin, size_t end) {
+            size_t count = end - begin;
+            std::vector<Sum> sum(count, 0);
+            if constexpr (std::is_same_v<T, unsigned char>) {
+                // Add 8-bit samples into 16-bit partial sums with the SIMD kernels, and move them into the full sums
+                // before they can overflow
+                std::vector<unsigned short> partial(count, 0);
+                for (int z0 = 0; z0 < depth; z0 += ProjectionKernels::flushInterval) {
+                    int z1 = std::min(depth, z0 + ProjectionKernels::flushInterval);
+                    for (int z = z0; z < z1; ++z) {
+                        ProjectionKernels::addInto(partial.data(), data + z * slicePixels + begin, count);
+                    }
+                    for (size_t i = 0; i < count; ++i) {
+                        sum[i] += partial[i];
+                        partial[i] = 0;
+                    }
+                }
+            } else {
+                for (int z = 0; z < depth; ++z) {
+                    const T *slice = data + z * slicePixels + begin;
+                    for (size_t i = 0; i < count; ++i) {
+                        sum[i] += slice[i];
+                    }
+                }
+            }
+
+            for (size_t i = 0; i < count; ++i) {
+                aip[begin + i] = static_cast<T>(sum[i] / depth);
+            }
+        });
+
+        return aip;
     }
 
-    // Initialize the MinIP image with maximum intensity values
-    std::vector<unsigned char> minip(width * height, 255); // Initialize with max value for unsigned char
+    // Shared implementation of the linear MedIP overloads
+    template<typename T>
+    std::vector<T> medianProjection(int width, int height, int depth, const T *data) {
+        TRACE_SCOPE("Projection::medianIntensityProjection", "projection",
+                    static_cast<size_t>(width) * height * (depth + 1) * sizeof(T));
+        // If the volume is empty (including empty data pointer), return an empty MedIP image
+        if (width == 0 || height == 0 || depth == 0 || !data) {
+            return std::vector<T>();
+        }
+
+        std::vector<T> mip(width * height);
+        std::vector<T> pixelValues(depth);
+        int midIndex = (depth % 2 == 0) ? (depth / 2) - 1 : depth / 2;
 
-    // Iterate through the volume and update the MinIP image
-    for (int z = 0; z < depth; ++z) {
         for (int y = 0; y < height; ++y) {
             for (int x = 0; x < width; ++x) {
-                int index = z * width * height + y * width + x;
-                minip[y * width + x] = std::min(minip[y * width + x], data[index]);
+                // Collect pixel values along the z-axis
+                for (int z = 0; z < depth; ++z) {
+                    size_t index = (static_cast<size_t>(z) * height + y) * width + x;
+                    pixelValues[z] = data[index];
+                }
+
+                // Use quickSelect to find the median of 8-bit samples, and nth_element for the wider types
+                if constexpr (std::is_same_v<T, unsigned char>) {
+                    mip[y * width + x] = Algorithm::quickSelect(pixelValues, 0, depth - 1, midIndex);
+                } else {
+                    std::nth_element(pixelValues.begin(), pixelValues.begin() + midIndex, pixelValues.end());
+                    mip[y * width + x] = pixelValues[midIndex];
+                }
             }
         }
+
+        return mip;
     }
+}
 
-    return minip;
+
+std::vector<unsigned char> Projection::maximumIntensityProjection(int width, int height, int depth, const unsigned char *data) {
+    return maximumProjection(width, height, depth, data);
+}
+
+template<typename T>
+std::vector<T> Projection::maximumIntensityProjection(int width, int height, int depth, const T *data) {
+    return maximumProjection(width, height, depth, data);
+}
+
+template std::vector<unsigned short> Projection::maximumIntensityProjection(int, int, int, const unsigned short *);
+template std::vector<float> Projection::maximumIntensityProjection(int, int, int, const float *);
+
+std::vector<unsigned char> Projection::minimumIntensityProjection(int width, int height, int depth, const unsigned char *data) {
+    return minimumProjection(width, height, depth, data);
+}
+
+template<typename T>
+std::vector<T> Projection::minimumIntensityProjection(int width, int height, int depth, const T *data) {
+    return minimumProjection(width, height, depth, data);
+}
+
+template std::vector<unsigned short> Projection::minimumIntensityProjection(int, int, int, const unsigned short *);
+template std::vector<float> Projection::minimumIntensityProjection(int, int, int, const float *);
+
+std::vector<unsigned char> Projection::averageIntensityProjection(int width, int height, int depth, const unsigned char *data) {
+    return averageProjection(width, height, depth, data);
+}
+
+template<typename T>
+std::vector<T> Projection::averageIntensityProjection(int width, int height, int depth, const T *data) {
+    return averageProjection(width, height, depth, data);
+}
+
+template std::vector<unsigned short> Projection::averageIntensityProjection(int, int, int, const unsigned short *);
+template std::vector<float> Projection::averageIntensityProjection(int, int, int, const float *);
+
+std::vector<unsigned char> Projection::medianIntensityProjection(int width, int height, int depth, const unsigned char *data) {
+    return medianProjection(width, height, depth, data);
+}
+
+template<typename T>
+std::vector<T> Projection::medianIntensityProjection(int width, int height, int depth, const T *data) {
+    return medianProjection(width, height, depth, data);
 }
 
-std::vector<unsigned char> Projection::averageIntensityProjection(int width, int height, int depth, const unsigned char* data) {
-    // If the volume is empty (including empty data pointer), return an empty MIP image
-    if (width == 0 || height == 0 || depth == 0 || !data) {
+template std::vector<unsigned short> Projection::medianIntensityProjection(int, int, int, const unsigned short *);
+template std::vector<float> Projection::medianIntensityProjection(int, int, int, const float *);
+
+std::vector<unsigned char> Projection::maximumIntensityProjection(const BrickedVolume &volume) {
+    TRACE_SCOPE("Projection::maximumIntensityProjection bricked", "projection",
+                static_cast<size_t>(volume.getWidth()) * volume.getHeight() * (volume.getDepth() + 1));
+    if (volume.getWidth() == 0 || volume.getHeight() == 0 || volume.getDepth() == 0) {
         return std::vector<unsigned char>();
     }
 
-    // Initialize the sum vector to accumulate intensity values
-    std::vector<unsigned long> sum(width * height, 0); // Use unsigned long for sum to avoid overflow
-    std::vector<unsigned char> aip(width * height);
+    std::vector<unsigned char> mip(volume.getWidth() * volume.getHeight(), 0);
+    forEachBrickVoxel(volume, [&mip](int pixel, unsigned char value) {
+        mip[pixel] = std::max(mip[pixel], value);
+    });
+    return mip;
+}
 
-    for (int z = 0; z < depth; ++z) {
-        for (int y = 0; y < height; ++y) {
-            for (int x = 0; x < width; ++x) {
-                int index = z * width * height + y * width + x;
-                sum[y * width + x] += data[index];
-            }
-        }
+std::vector<unsigned char> Projection::minimumIntensityProjection(const BrickedVolume &volume) {
+    TRACE_SCOPE("Projection::minimumIntensityProjection bricked", "projection",
+                static_cast<size_t>(volume.getWidth()) * volume.getHeight() * (volume.getDepth() + 1));
+    if (volume.getWidth() == 0 || volume.getHeight() == 0 || volume.getDepth() == 0) {
+        return std::vector<unsigned char>();
     }
 
-    for (size_t i = 0; i < sum.size(); ++i) {
-        aip[i] = static_cast<unsigned char>(sum[i] / depth);
+    std::vector<unsigned char> minip(volume.getWidth() * volume.getHeight(), 255);
+    forEachBrickVoxel(volume, [&minip](int pixel, unsigned char value) {
+        minip[pixel] = std::min(minip[pixel], value);
+    });
+    return minip;
+}
+
+std::vector<unsigned char> Projection::averageIntensityProjection(const BrickedVolume &volume) {
+    TRACE_SCOPE("Projection::averageIntensityProjection bricked", "projection",
+                static_cast<size_t>(volume.getWidth()) * volume.getHeight() * (volume.getDepth() + 1));
+    if (volume.getWidth() == 0 || volume.getHeight() == 0 || volume.getDepth() == 0) {
+        return std::vector<unsigned char>();
     }
 
+    std::vector<unsigned long> sum(volume.getWidth() * volume.getHeight(), 0);
+    forEachBrickVoxel(volume, [&sum](int pixel, unsigned char value) {
+        sum[pixel] += value;
+    });
+
+    std::vector<unsigned char> aip(sum.size());
+    for (size_t i = 0; i < sum.size(); ++i) {
+        aip[i] = static_cast<unsigned char>(sum[i] / volume.getDepth());
+    }
     return aip;
 }
 
-std::vector<unsigned char> Projection::medianIntensityProjection(int width, int height, int depth, const unsigned char* data) {
-    // If the volume is empty (including empty data pointer), return an empty MIP image
-    if (width == 0 || height == 0 || depth == 0 || !data) {
+std::vector<unsigned char> Projection::medianIntensityProjection(const BrickedVolume &volume) {
+    TRACE_SCOPE("Projection::medianIntensityProjection bricked", "projection",
+                static_cast<size_t>(volume.getWidth()) * volume.getHeight() * (volume.getDepth() + 1));
+    int width = volume.getWidth();
+    int height = volume.getHeight();
+    int depth = volume.getDepth();
+    if (width == 0 || height == 0 || depth == 0) {
         return std::vector<unsigned char>();
     }
 
-    // Initialize the MIP image with zeros
+    int brickSize = volume.getBrickSize();
+    int midIndex = (depth % 2 == 0) ? (depth / 2) - 1 : depth / 2;
     std::vector<unsigned char> mip(width * height);
+    std::vector<unsigned char> tile(static_cast<size_t>(brickSize) * brickSize * depth);
     std::vector<unsigned char> pixelValues(depth);
 
-    for (int y = 0; y < height; ++y) {
-        for (int x = 0; x < width; ++x) {
-            // Collect pixel values along the z-axis
-            for (int z = 0; z < depth; ++z) {
-                int index = z * width * height + y * width + x;
-                pixelValues[z] = data[index];
-            }
+    for (int by = 0; by < volume.getBricksY(); ++by) {
+        int yEnd = std::min(brickSize, height - by * brickSize);
+        for (int bx = 0; bx < volume.getBricksX(); ++bx) {
+            int xEnd = std::min(brickSize, width - bx * brickSize);
 
-            // Use quickSelect to find the median
-            int midIndex = (depth % 2 == 0) ? (depth / 2) - 1 : depth / 2;
-            unsigned char median = Algorithm::quickSelect(pixelValues, 0, depth - 1, midIndex);
+            // Gather the z-columns of this column of bricks, one brick at a time
+            for (int bz = 0; bz < volume.getBricksZ(); ++bz) {
+                int zEnd = std::min(brickSize, depth - bz * brickSize);
+                const unsigned char *brick = volume.getBrick(bx, by, bz);
+                for (int lz = 0; lz < zEnd; ++lz) {
+                    for (int ly = 0; ly < yEnd; ++ly) {
+                        for (int lx = 0; lx < xEnd; ++lx) {
+                            tile[(static_cast<size_t>(ly) * brickSize + lx) * depth + bz * brickSize + lz] =
+                                    brick[(lz * brickSize + ly) * brickSize + lx];
+                        }
+                    }
+                }
+            }
 
-            mip[y * width + x] = median;
+            // Use quickSelect to find the median of each column
+            for (int ly = 0; ly < yEnd; ++ly) {
+                for (int lx = 0; lx < xEnd; ++lx) {
+                    const unsigned char *column = &tile[(static_cast<size_t>(ly) * brickSize + lx) * depth];
+                    std::copy(column, column + depth, pixelValues.begin());
+                    mip[(by * brickSize + ly) * width + bx * brickSize + lx] =
+                            Algorithm::quickSelect(pixelValues, 0, depth - 1, midIndex);
+                }
+            }
         }
     }
 
     return mip;
 }
+
+std::vector<unsigned char> Projection::maximumIntensityProjection(const VolumeStream &volume) {
+    TRACE_SCOPE("Projection::maximumIntensityProjection streamed", "projection",
+                static_cast<size_t>(volume.getWidth()) * volume.getHeight() * (volume.getDepth() + 1));
+    size_t sliceSize = static_cast<size_t>(volume.getWidth()) * volume.getHeight();
+    if (sliceSize == 0 || volume.getDepth() == 0) {
+        return std::vector<unsigned char>();
+    }
+
+    std::vector<unsigned char> mip(sliceSize, 0), slice(sliceSize);
+    for (int z = 0; z < volume.getDepth(); ++z) {
+        if (!volume.readSlice(z, slice.data())) {
+            return std::vector<unsigned char>();
+        }
+        ProjectionKernels::maxInto(mip.data(), slice.data(), sliceSize);
+    }
+    return mip;
+}
+
+std::vector<unsigned char> Projection::minimumIntensityProjection(const VolumeStream &volume) {
+    TRACE_SCOPE("Projection::minimumIntensityProjection streamed", "projection",
+                static_cast<size_t>(volume.getWidth()) * volume.getHeight() * (volume.getDepth() + 1));
+    size_t sliceSize = static_cast<size_t>(volume.getWidth()) * volume.getHeight();
+    if (sliceSize == 0 || volume.getDepth() == 0) {
+        return std::vector<unsigned char>();
+    }
+
+    std::vector<unsigned char> minip(sliceSize, 255), slice(sliceSize);
+    for (int z = 0; z < volume.getDepth(); ++z) {
+        if (!volume.readSlice(z, slice.data())) {
+            return std::vector<unsigned char>();
+        }
+        ProjectionKernels::minInto(minip.data(), slice.data(), sliceSize);
+    }
+    return minip;
+}
+
+std::vector<unsigned char> Projection::averageIntensityProjection(const VolumeStream &volume) {
+    TRACE_SCOPE("Projection::averageIntensityProjection streamed", "projection",
+                static_cast<size_t>(volume.getWidth()) * volume.getHeight() * (volume.getDepth() + 1));
+    size_t sliceSize = static_cast<size_t>(volume.getWidth()) * volume.getHeight();
+    if (sliceSize == 0 || volume.getDepth() == 0) {
+        return std::vector<unsigned char>();
+    }
+
+    // Accumulate in 16-bit partial sums and move them into the full sums before they can overflow
+    std::vector<unsigned long> sum(sliceSize, 0);
+    std::vector<unsigned short> partial(sliceSize, 0);
+    std::vector<unsigned char> slice(sliceSize);
+    for (int z = 0; z < volume.getDepth(); ++z) {
+        if (!volume.readSlice(z, slice.data())) {
+            return std::vector<unsigned char>();
+        }
+        ProjectionKernels::addInto(partial.data(), slice.data(), sliceSize);
+        if ((z + 1) % ProjectionKernels::flushInterval == 0 || z + 1 == volume.getDepth()) {
+            for (size_t i = 0; i < sliceSize; ++i) {
+                sum[i] += partial[i];
+                partial[i] = 0;
+            }
+        }
+    }
+
+    std::vector<unsigned char> aip(sliceSize);
+    for (size_t i = 0; i < sliceSize; ++i) {
+        aip[i] = static_cast<unsigned char>(sum[i] / volume.getDepth());
+    }
+    return aip;
+}
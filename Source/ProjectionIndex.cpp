@@ -0,0 +1,258 @@
+/**
+ * @file ProjectionIndex.cpp
+ *
+ * @brief Implements the ProjectionIndex class, which answers slab projections of a volume without rereading the slab.
+ *
+ * The per-block sums, maxima and minima are built in one pass over the volume, split into bands of pixels across the
+ * hardware threads exactly like the linear projections. The higher levels of the sparse tables then combine pairs of
+ * entries of the level below. Maxima and minima of 8-bit samples are combined with the SIMD projection kernels.
+ *
+ * @date Created on October 19, 2026
+ *
+ * @authors
+ * Advanced Programming Group Radix Sort:
+ *   - Benjamin Duncan (edsml-bd1023)
+ *   - Boyang Hu (edsml-bh223)
+ *   - Chawk Chamoun (edsml-cc8915)
+ *   - Mingsheng Cai (acse-sc4623)
+ *   - Moyu Zhang (acse-mz223)
+ *   - Ryan Benney (acse-rgb123)
+ */
+
+#include "ProjectionIndex.h"
+#include "Parallel.h"
+#include "ProjectionKernels.h"
+#include "Trace.h"
+
+#include <algorithm>
+#include <bit>
+#include <iostream>
+#include <stdexcept>
+
+namespace {
+    // Number of pixels of a slice built together by one thread
+    constexpr size_t bandPixels = 16384;
+
+    // Replaces every accumulator sample by the larger or smaller of itself and the matching source sample
+    template<typename T>
+    void foldInto(T *accumulator, const T *source, size_t count, bool keepMaximum) {
+        if constexpr (std::is_same_v<T, unsigned char>) {
+            if (keepMaximum) {
+                ProjectionKernels::maxInto(accumulator, source, count);
+            } else {
+                ProjectionKernels::minInto(accumulator, source, count);
+            }
+        } else if (keepMaximum) {
+            for (size_t i = 0; i < count; ++i) {
+                accumulator[i] = std::max(accumulator[i], source[i]);
+            }
+        } else {
+            for (size_t i = 0; i < count; ++i) {
+                accumulator[i] = std::min(accumulator[i], source[i]);
+            }
+        }
+    }
+}
+
+template<typename T>
+ProjectionIndex<T>::ProjectionIndex()
+        : width(0), height(0), depth(0), blockSize(defaultBlockSize), blockCount(0), data(nullptr) {}
+
+template<typename T>
+ProjectionIndex<T>::ProjectionIndex(int width, int height, int depth, const T *data, int blockSize)
+        : width(width), height(height), depth(depth), blockSize(blockSize), blockCount(0), data(data) {
+    if (blockSize < 1) {
+        throw std::invalid_argument("Projection index block size must be at least 1.");
+    }
+    size_t slicePixels = static_cast<size_t>(width) * height;
+    if (slicePixels == 0 || depth <= 0) {
+        this->depth = 0;
+        return;
+    }
+    if (!data) {
+        throw std::invalid_argument("Projection index needs the samples of the volume.");
+    }
+
+    TRACE_SCOPE("ProjectionIndex::build", "projection", slicePixels * depth * sizeof(T));
+    blockCount = depth / blockSize;
+    prefixSums.assign((static_cast<size_t>(blockCount) + 1) * slicePixels, 0);
+    int levels = blockCount > 0 ? std::bit_width(static_cast<unsigned int>(blockCount)) : 0;
+    maxima.resize(levels);
+    minima.resize(levels);
+    if (levels == 0) {
+        return;
+    }
+    maxima[0].resize(static_cast<size_t>(blockCount) * slicePixels);
+    minima[0].resize(static_cast<size_t>(blockCount) * slicePixels);
+
+    // Level 0 and the running sums: every thread walks all blocks of its own band of pixels
+    size_t bands = (slicePixels + bandPixels - 1) / bandPixels;
+    Parallel::forRange(bands, [&](size_t first, size_t last) {
+        for (size_t band = first; band < last; ++band) {
+            size_t begin = band * bandPixels;
+            size_t count = std::min(slicePixels, begin + bandPixels) - begin;
+            for (int block = 0; block < blockCount; ++block) {
+                T *maximum = maxima[0].data() + block * slicePixels + begin;
+                T *minimum = minima[0].data() + block * slicePixels + begin;
+                const Sum *previous = prefixSums.data() + block * slicePixels + begin;
+                Sum *next = prefixSums.data() + (block + 1) * slicePixels + begin;
+                std::copy(previous, previous + count, next);
+
+                for (int z = block * blockSize; z < (block + 1) * blockSize; ++z) {
+                    const T *slice = data + z * slicePixels + begin;
+                    if (z == block * blockSize) {
+                        std::copy(slice, slice + count, maximum);
+                        std::copy(slice, slice + count, minimum);
+                    } else {
+                        foldInto(maximum, slice, count, true);
+                        foldInto(minimum, slice, count, false);
+                    }
+                    for (size_t i = 0; i < count; ++i) {
+                        next[i] += slice[i];
+                    }
+                }
+            }
+        }
+    });
+
+    // Level k combines two neighbouring entries of level k - 1, which together cover 2^k blocks
+    for (int level = 1; level < levels; ++level) {
+        int half = 1 << (level - 1);
+        int entries = blockCount - (1 << level) + 1;
+        maxima[level].resize(static_cast<size_t>(entries) * slicePixels);
+        minima[level].resize(static_cast<size_t>(entries) * slicePixels);
+        Parallel::forRange(entries, [&](size_t first, size_t last) {
+            for (size_t entry = first; entry < last; ++entry) {
+                for (auto *table: {&maxima, &minima}) {
+                    const T *left = (*table)[level - 1].data() + entry * slicePixels;
+                    const T *right = (*table)[level - 1].data() + (entry + half) * slicePixels;
+                    T *combined = (*table)[level].data() + entry * slicePixels;
+                    std::copy(left, left + slicePixels, combined);
+                    foldInto(combined, right, slicePixels, table == &maxima);
+                }
+            }
+        });
+    }
+}
+
+template<typename T>
+int ProjectionIndex<T>::getBlockSize() const {
+    return blockSize;
+}
+
+template<typename T>
+size_t ProjectionIndex<T>::getMemoryUsage() const {
+    size_t bytes = prefixSums.size() * sizeof(Sum);
+    for (size_t level = 0; level < maxima.size(); ++level) {
+        bytes += (maxima[level].size() + minima[level].size()) * sizeof(T);
+    }
+    return bytes;
+}
+
+template<typename T>
+bool ProjectionIndex<T>::splitSlab(int begin, int end, int &firstBlock, int &lastBlock) const {
+    if (begin < 0 || begin > end || end >= depth) {
+        std::cerr << "Error: Invalid slab for the projection index. Please ensure 0 <= begin <= end < depth."
+                  << std::endl;
+        return false;
+    }
+    firstBlock = (begin + blockSize - 1) / blockSize;
+    lastBlock = std::max(firstBlock, (end + 1) / blockSize);
+    return true;
+}
+
+template<typename T>
+std::vector<T> ProjectionIndex<T>::extremum(int begin, int end, const std::vector<std::vector<T>> &table,
+                                            bool keepMaximum) const {
+    int firstBlock, lastBlock;
+    if (!splitSlab(begin, end, firstBlock, lastBlock)) {
+        return std::vector<T>();
+    }
+    size_t slicePixels = static_cast<size_t>(width) * height;
+    std::vector<T> result(slicePixels);
+
+    // The loose slices at both ends of the slab; without whole blocks that is the entire slab
+    int looseEnd = end + 1, looseBegin = end + 1;
+    if (firstBlock < lastBlock) {
+        int level = std::bit_width(static_cast<unsigned int>(lastBlock - firstBlock)) - 1;
+        const T *left = table[level].data() + firstBlock * slicePixels;
+        const T *right = table[level].data() + (lastBlock - (1 << level)) * slicePixels;
+        std::copy(left, left + slicePixels, result.begin());
+        foldInto(result.data(), right, slicePixels, keepMaximum);
+        looseEnd = firstBlock * blockSize;
+        looseBegin = lastBlock * blockSize;
+    } else {
+        const T *slice = data + begin * slicePixels;
+        std::copy(slice, slice + slicePixels, result.begin());
+        ++begin;
+    }
+
+    for (int z = begin; z <= end; ++z) {
+        if (z == looseEnd) {
+            z = looseBegin;
+            if (z > end) {
+                break;
+            }
+        }
+        foldInto(result.data(), data + z * slicePixels, slicePixels, keepMaximum);
+    }
+    return result;
+}
+
+template<typename T>
+std::vector<T> ProjectionIndex<T>::maximum(int begin, int end) const {
+    TRACE_SCOPE("ProjectionIndex::maximum", "projection", static_cast<size_t>(width) * height * sizeof(T));
+    return extremum(begin, end, maxima, true);
+}
+
+template<typename T>
+std::vector<T> ProjectionIndex<T>::minimum(int begin, int end) const {
+    TRACE_SCOPE("ProjectionIndex::minimum", "projection", static_cast<size_t>(width) * height * sizeof(T));
+    return extremum(begin, end, minima, false);
+}
+
+template<typename T>
+std::vector<T> ProjectionIndex<T>::average(int begin, int end) const {
+    TRACE_SCOPE("ProjectionIndex::average", "projection", static_cast<size_t>(width) * height * sizeof(T));
+    int firstBlock, lastBlock;
+    if (!splitSlab(begin, end, firstBlock, lastBlock)) {
+        return std::vector<T>();
+    }
+    size_t slicePixels = static_cast<size_t>(width) * height;
+    std::vector<Sum> sum(slicePixels, 0);
+
+    // Sum of the whole blocks from the running sums, then the loose slices at both ends
+    int looseEnd = end + 1, looseBegin = end + 1;
+    if (firstBlock < lastBlock) {
+        const Sum *upper = prefixSums.data() + lastBlock * slicePixels;
+        const Sum *lower = prefixSums.data() + firstBlock * slicePixels;
+        for (size_t i = 0; i < slicePixels; ++i) {
+            sum[i] = upper[i] - lower[i];
+        }
+        looseEnd = firstBlock * blockSize;
+        looseBegin = lastBlock * blockSize;
+    }
+    for (int z = begin; z <= end; ++z) {
+        if (z == looseEnd) {
+            z = looseBegin;
+            if (z > end) {
+                break;
+            }
+        }
+        const T *slice = data + z * slicePixels;
+        for (size_t i = 0; i < slicePixels; ++i) {
+            sum[i] += slice[i];
+        }
+    }
+
+    std::vector<T> result(slicePixels);
+    int count = end - begin + 1;
+    for (size_t i = 0; i < slicePixels; ++i) {
+        result[i] = static_cast<T>(sum[i] / count);
+    }
+    return result;
+}
+
+template class ProjectionIndex<unsigned char>;
+template class ProjectionIndex<unsigned short>;
+template class ProjectionIndex<float>;
@@ -0,0 +1,254 @@
+/**
+ * @file ProjectionKernels.cpp
+ *
+ * @brief Implements the vectorised inner loops of the 8-bit z-projections and their runtime dispatch.
+ *
+ * Each kernel exists once per instruction set. The SIMD versions are compiled with the target attribute of their
+ * instruction set, so the rest of the library keeps its baseline flags and the wider versions are only reached after
+ * the processor has been checked for support. All versions use unaligned loads and finish the samples that do not fill
+ * a whole register with the scalar loop, so they accept any pointer and any count and give identical results.
+ *
+ * @date Created on October 19, 2026
+ *
+ * @authors
+ * Advanced Programming Group Radix Sort:
+ *   - Benjamin Duncan (edsml-bd1023)
+ *   - Boyang Hu (edsml-bh223)
+ *   - Chawk Chamoun (edsml-cc8915)
+ *   - Mingsheng Cai (acse-sc4623)
+ *   - Moyu Zhang (acse-mz223)
+ *   - Ryan Benney (acse-rgb123)
+ */
+
+#include "ProjectionKernels.h"
+
+#include <algorithm>
+#include <atomic>
+
+#if defined(__x86_64__) || defined(__i386__)
+#define PROJECTION_KERNELS_X86
+#include <immintrin.h>
+#endif
+
+namespace {
+    void maxScalar(unsigned char *accumulator, const unsigned char *source, size_t begin, size_t count) {
+        for (size_t i = begin; i < count; ++i) {
+            accumulator[i] = std::max(accumulator[i], source[i]);
+        }
+    }
+
+    void minScalar(unsigned char *accumulator, const unsigned char *source, size_t begin, size_t count) {
+        for (size_t i = begin; i < count; ++i) {
+            accumulator[i] = std::min(accumulator[i], source[i]);
+        }
+    }
+
+    void addScalar(unsigned short *partialSums, const unsigned char *source, size_t begin, size_t count) {
+        for (size_t i = begin; i < count; ++i) {
+            partialSums[i] = static_cast<unsigned short>(partialSums[i] + source[i]);
+        }
+    }
+
+#ifdef PROJECTION_KERNELS_X86
+    __attribute__((target("sse2")))
+    void maxSSE2(unsigned char *accumulator, const unsigned char *source, size_t count) {
+        size_t i = 0;
+        for (; i + 16 <= count; i += 16) {
+            __m128i a = _mm_loadu_si128(reinterpret_cast<const __m128i *>(accumulator + i));
+            __m128i s = _mm_loadu_si128(reinterpret_cast<const __m128i *>(source + i));
+            _mm_storeu_si128(reinterpret_cast<__m128i *>(accumulator + i), _mm_max_epu8(a, s));
+        }
+        maxScalar(accumulator, source, i, count);
+    }
+
+    __attribute__((target("sse2")))
+    void minSSE2(unsigned char *accumulator, const unsigned char *source, size_t count) {
+        size_t i = 0;
+        for (; i + 16 <= count; i += 16) {
+            __m128i a = _mm_loadu_si128(reinterpret_cast<const __m128i *>(accumulator + i));
+            __m128i s = _mm_loadu_si128(reinterpret_cast<const __m128i *>(source + i));
+            _mm_storeu_si128(reinterpret_cast<__m128i *>(accumulator + i), _mm_min_epu8(a, s));
+        }
+        minScalar(accumulator, source, i, count);
+    }
+
+    __attribute__((target("sse2")))
+    void addSSE2(unsigned short *partialSums, const unsigned char *source, size_t count) {
+        const __m128i zero = _mm_setzero_si128();
+        size_t i = 0;
+        for (; i + 16 <= count; i += 16) {
+            __m128i s = _mm_loadu_si128(reinterpret_cast<const __m128i *>(source + i));
+            auto *low = reinterpret_cast<__m128i *>(partialSums + i);
+            auto *high = reinterpret_cast<__m128i *>(partialSums + i + 8);
+            _mm_storeu_si128(low, _mm_add_epi16(_mm_loadu_si128(low), _mm_unpacklo_epi8(s, zero)));
+            _mm_storeu_si128(high, _mm_add_epi16(_mm_loadu_si128(high), _mm_unpackhi_epi8(s, zero)));
+        }
+        addScalar(partialSums, source, i, count);
+    }
+
+    __attribute__((target("avx2")))
+    void maxAVX2(unsigned char *accumulator, const unsigned char *source, size_t count) {
+        size_t i = 0;
+        for (; i + 32 <= count; i += 32) {
+            __m256i a = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(accumulator + i));
+            __m256i s = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(source + i));
+            _mm256_storeu_si256(reinterpret_cast<__m256i *>(accumulator + i), _mm256_max_epu8(a, s));
+        }
+        maxScalar(accumulator, source, i, count);
+    }
+
+    __attribute__((target("avx2")))
+    void minAVX2(unsigned char *accumulator, const unsigned char *source, size_t count) {
+        size_t i = 0;
+        for (; i + 32 <= count; i += 32) {
+            __m256i a = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(accumulator + i));
+            __m256i s = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(source + i));
+            _mm256_storeu_si256(reinterpret_cast<__m256i *>(accumulator + i), _mm256_min_epu8(a, s));
+        }
+        minScalar(accumulator, source, i, count);
+    }
+
+    __attribute__((target("avx2")))
+    void addAVX2(unsigned short *partialSums, const unsigned char *source, size_t count) {
+        size_t i = 0;
+        for (; i + 32 <= count; i += 32) {
+            __m128i low = _mm_loadu_si128(reinterpret_cast<const __m128i *>(source + i));
+            __m128i high = _mm_loadu_si128(reinterpret_cast<const __m128i *>(source + i + 16));
+            auto *lowSums = reinterpret_cast<__m256i *>(partialSums + i);
+            auto *highSums = reinterpret_cast<__m256i *>(partialSums + i + 16);
+            _mm256_storeu_si256(lowSums, _mm256_add_epi16(_mm256_loadu_si256(lowSums), _mm256_cvtepu8_epi16(low)));
+            _mm256_storeu_si256(highSums, _mm256_add_epi16(_mm256_loadu_si256(highSums), _mm256_cvtepu8_epi16(high)));
+        }
+        addScalar(partialSums, source, i, count);
+    }
+
+    __attribute__((target("avx512f,avx512bw")))
+    void maxAVX512(unsigned char *accumulator, const unsigned char *source, size_t count) {
+        size_t i = 0;
+        for (; i + 64 <= count; i += 64) {
+            __m512i a = _mm512_loadu_si512(accumulator + i);
+            __m512i s = _mm512_loadu_si512(source + i);
+            _mm512_storeu_si512(accumulator + i, _mm512_max_epu8(a, s));
+        }
+        maxScalar(accumulator, source, i, count);
+    }
+
+    __attribute__((target("avx512f,avx512bw")))
+    void minAVX512(unsigned char *accumulator, const unsigned char *source, size_t count) {
+        size_t i = 0;
+        for (; i + 64 <= count; i += 64) {
+            __m512i a = _mm512_loadu_si512(accumulator + i);
+            __m512i s = _mm512_loadu_si512(source + i);
+            _mm512_storeu_si512(accumulator + i, _mm512_min_epu8(a, s));
+        }
+        minScalar(accumulator, source, i, count);
+    }
+
+    __attribute__((target("avx512f,avx512bw")))
+    void addAVX512(unsigned short *partialSums, const unsigned char *source, size_t count) {
+        size_t i = 0;
+        for (; i + 64 <= count; i += 64) {
+            __m256i low = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(source + i));
+            __m256i high = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(source + i + 32));
+            _mm512_storeu_si512(partialSums + i,
+                                _mm512_add_epi16(_mm512_loadu_si512(partialSums + i), _mm512_cvtepu8_epi16(low)));
+            _mm512_storeu_si512(partialSums + i + 32,
+                                _mm512_add_epi16(_mm512_loadu_si512(partialSums + i + 32), _mm512_cvtepu8_epi16(high)));
+        }
+        addScalar(partialSums, source, i, count);
+    }
+#endif
+
+    // The level the kernels dispatch to, starting at the widest one the processor supports
+    std::atomic<SimdLevel> &activeLevel() {
+        static std::atomic<SimdLevel> level(ProjectionKernels::detectedLevel());
+        return level;
+    }
+}
+
+SimdLevel ProjectionKernels::detectedLevel() {
+#ifdef PROJECTION_KERNELS_X86
+    static const SimdLevel level = []() {
+        __builtin_cpu_init();
+        if (__builtin_cpu_supports("avx512f") && __builtin_cpu_supports("avx512bw")) {
+            return SimdLevel::AVX512;
+        }
+        if (__builtin_cpu_supports("avx2")) {
+            return SimdLevel::AVX2;
+        }
+        if (__builtin_cpu_supports("sse2")) {
+            return SimdLevel::SSE2;
+        }
+        return SimdLevel::Scalar;
+    }();
+    return level;
+#else
+    return SimdLevel::Scalar;
+#endif
+}
+
+SimdLevel ProjectionKernels::getLevel() {
+    return activeLevel().load(std::memory_order_relaxed);
+}
+
+void ProjectionKernels::setLevel(SimdLevel level) {
+    activeLevel().store(std::min(level, detectedLevel()), std::memory_order_relaxed);
+}
+
+const char *ProjectionKernels::levelName(SimdLevel level) {
+    switch (level) {
+        case SimdLevel::SSE2:
+            return "sse2";
+        case SimdLevel::AVX2:
+            return "avx2";
+        case SimdLevel::AVX512:
+            return "avx512";
+        default:
+            return "scalar";
+    }
+}
+
+void ProjectionKernels::maxInto(unsigned char *accumulator, const unsigned char *source, size_t count) {
+    switch (getLevel()) {
+#ifdef PROJECTION_KERNELS_X86
+        case SimdLevel::AVX512:
+            return maxAVX512(accumulator, source, count);
+        case SimdLevel::AVX2:
+            return maxAVX2(accumulator, source, count);
+        case SimdLevel::SSE2:
+            return maxSSE2(accumulator, source, count);
+#endif
+        default:
+            return maxScalar(accumulator, source, 0, count);
+    }
+}
+
+void ProjectionKernels::minInto(unsigned char *accumulator, const unsigned char *source, size_t count) {
+    switch (getLevel()) {
+#ifdef PROJECTION_KERNELS_X86
+        case SimdLevel::AVX512:
+            return minAVX512(accumulator, source, count);
+        case SimdLevel::AVX2:
+            return minAVX2(accumulator, source, count);
+        case SimdLevel::SSE2:
+            return minSSE2(accumulator, source, count);
+#endif
+        default:
+            return minScalar(accumulator, source, 0, count);
+    }
+}
+
+void ProjectionKernels::addInto(unsigned short *partialSums, const unsigned char *source, size_t count) {
+    switch (getLevel()) {
+#ifdef PROJECTION_KERNELS_X86
+        case SimdLevel::AVX512:
+            return addAVX512(partialSums, source, count);
+        case SimdLevel::AVX2:
+            return addAVX2(partialSums, source, count);
+        case SimdLevel::SSE2:
+            return addSSE2(partialSums, source, count);
+#endif
+        default:
+            return addScalar(partialSums, source, 0, count);
+    }
+}
@@ -0,0 +1,399 @@
+/**
+ * @file Pyramid.cpp
+ *
+ * @brief Implements multi-resolution pyramids of images and volumes for fast previews.
+ *
+ * The box reduction sums the 2x2 (2x2x2) source samples of every output sample directly in one contiguous loop per
+ * output row. The Gaussian is separable: each source row is reduced horizontally into unnormalised sums once per strip of
+ * output rows, the output rows combine the 4 reduced rows they read with the vertical weights, and for volumes the
+ * reduced slices are combined along z, keeping the slices that neighbouring output slices share. Sums stay unnormalised
+ * until the end and are divided once by the total weight, so integer samples are rounded only once. The interior of every
+ * row is reduced without edge clamping in loops that the compiler vectorises; only the first and last output samples
+ * clamp their taps.
+ *
+ * @date Created on October 19, 2026
+ *
+ * @authors
+ * Advanced Programming Group Radix Sort:
+ *   - Benjamin Duncan (edsml-bd1023)
+ *   - Boyang Hu (edsml-bh223)
+ *   - Chawk Chamoun (edsml-cc8915)
+ *   - Mingsheng Cai (acse-sc4623)
+ *   - Moyu Zhang (acse-mz223)
+ *   - Ryan Benney (acse-rgb123)
+ */
+
+#include "Pyramid.h"
+#include "BufferPool.h"
+#include "Parallel.h"
+#include "Trace.h"
+
+#include <algorithm>
+#include <bit>
+#include <stdexcept>
+#include <type_traits>
+
+namespace {
+    // Unnormalised sums: exact integers for integer samples, float for float samples
+    template<typename T>
+    using Accumulator = std::conditional_t<std::is_floating_point_v<T>, float, unsigned int>;
+
+    // Taps of a reduction along one axis: output sample i reads input samples 2i + offset[k] with weight weight[k]
+    struct Taps {
+        int count;
+        int offset[4];
+        unsigned int weight[4];
+        unsigned int total;
+    };
+
+    Taps tapsFor(DownsampleMode mode) {
+        if (mode == DownsampleMode::Gaussian) {
+            return {4, {-1, 0, 1, 2}, {1, 3, 3, 1}, 8};
+        }
+        return {2, {0, 1, 0, 0}, {1, 1, 0, 0}, 2};
+    }
+
+    // Number of levels needed to halve a size down to 1
+    int halvings(int size) {
+        return size > 1 ? std::bit_width(static_cast<unsigned int>(size - 1)) : 0;
+    }
+
+    // Reduces one row of width pixels with interleaved channels horizontally into (width + 1) / 2 unnormalised pixels
+    template<typename T>
+    void reduceRow(const T *row, int width, int channels, const Taps &taps, Accumulator<T> *out) {
+        using Acc = Accumulator<T>;
+        int outWidth = (width + 1) / 2;
+        auto clamped = [&](int x, int c, int k) -> Acc {
+            int source = std::clamp(2 * x + taps.offset[k], 0, width - 1);
+            return static_cast<Acc>(row[source * channels + c]) * static_cast<Acc>(taps.weight[k]);
+        };
+        auto edge = [&](int x) {
+            for (int c = 0; c < channels; ++c) {
+                Acc sum = 0;
+                for (int k = 0; k < taps.count; ++k) {
+                    sum += clamped(x, c, k);
+                }
+                out[x * channels + c] = sum;
+            }
+        };
+
+        // Output pixels whose taps all lie inside the row
+        int first = taps.count == 4 ? 1 : 0;
+        int last = taps.count == 4 ? (width - 3) / 2 : width / 2 - 1;
+        for (int x = 0; x < std::min(first, outWidth); ++x) {
+            edge(x);
+        }
+        if (taps.count == 4) {
+            for (int x = first; x <= last; ++x) {
+                for (int c = 0; c < channels; ++c) {
+                    const T *s = row + (2 * x - 1) * channels + c;
+                    out[x * channels + c] = static_cast<Acc>(s[0]) + 3 * static_cast<Acc>(s[channels]) +
+                                            3 * static_cast<Acc>(s[2 * channels]) + static_cast<Acc>(s[3 * channels]);
+                }
+            }
+        } else if (channels == 1) {
+            for (int x = 0; x <= last; ++x) {
+                out[x] = static_cast<Acc>(row[2 * x]) + static_cast<Acc>(row[2 * x + 1]);
+            }
+        } else {
+            for (int x = 0; x <= last; ++x) {
+                for (int c = 0; c < channels; ++c) {
+                    const T *s = row + 2 * x * channels + c;
+                    out[x * channels + c] = static_cast<Acc>(s[0]) + static_cast<Acc>(s[channels]);
+                }
+            }
+        }
+        for (int x = std::max(first, last + 1); x < outWidth; ++x) {
+            edge(x);
+        }
+    }
+
+    // Number of output rows reduced together by the Gaussian, which keeps the reduced source rows of a strip in cache
+    constexpr int stripRows = 32;
+
+    // Reduces output rows [rowBegin, rowEnd) of a slice into unnormalised sums with weight taps.total^2; every source
+    // row of a strip is reduced horizontally once and then shared by the output rows that read it
+    template<typename T>
+    void reduceRows(const T *slice, int width, int height, int channels, const Taps &taps, int rowBegin, int rowEnd,
+                    Accumulator<T> *out, std::vector<Accumulator<T>> &rowScratch) {
+        using Acc = Accumulator<T>;
+        size_t outRow = static_cast<size_t>((width + 1) / 2) * channels;
+        for (int stripBegin = rowBegin; stripBegin < rowEnd; stripBegin += stripRows) {
+            int stripEnd = std::min(rowEnd, stripBegin + stripRows);
+            int firstSource = 2 * stripBegin + taps.offset[0];
+            int lastSource = 2 * (stripEnd - 1) + taps.offset[taps.count - 1];
+            rowScratch.resize((lastSource - firstSource + 1) * outRow);
+            for (int source = firstSource; source <= lastSource; ++source) {
+                int clamped = std::clamp(source, 0, height - 1);
+                reduceRow(slice + static_cast<size_t>(clamped) * width * channels, width, channels, taps,
+                          rowScratch.data() + (source - firstSource) * outRow);
+            }
+
+            for (int y = stripBegin; y < stripEnd; ++y) {
+                Acc *target = out + (y - rowBegin) * outRow;
+                const Acc *rows[4];
+                for (int k = 0; k < taps.count; ++k) {
+                    rows[k] = rowScratch.data() + (2 * y + taps.offset[k] - firstSource) * outRow;
+                }
+                if (taps.count == 4) {
+                    for (size_t i = 0; i < outRow; ++i) {
+                        target[i] = rows[0][i] + 3 * rows[1][i] + 3 * rows[2][i] + rows[3][i];
+                    }
+                } else {
+                    for (size_t i = 0; i < outRow; ++i) {
+                        target[i] = rows[0][i] + rows[1][i];
+                    }
+                }
+            }
+        }
+    }
+
+    // Divides unnormalised sums by their total weight, rounding integer samples to nearest
+    template<typename T>
+    void normalise(const Accumulator<T> *sums, size_t count, unsigned int total, T *out) {
+        for (size_t i = 0; i < count; ++i) {
+            if constexpr (std::is_floating_point_v<T>) {
+                out[i] = sums[i] / static_cast<float>(total);
+            } else {
+                out[i] = static_cast<T>((sums[i] + total / 2) / total);
+            }
+        }
+    }
+
+    // Box reduction of one output row from Rows source rows (2 for images, 4 for volumes), without intermediate sums
+    template<int Rows, typename T>
+    void boxRow(const T *const *rows, int width, int channels, T *out) {
+        using Acc = Accumulator<T>;
+        constexpr unsigned int total = 2 * Rows;
+        auto finish = [](Acc sum) -> T {
+            if constexpr (std::is_floating_point_v<T>) {
+                return sum / static_cast<float>(total);
+            } else {
+                return static_cast<T>((sum + total / 2) / total);
+            }
+        };
+
+        int pairs = width / 2;
+        if (channels == 1) {
+            for (int x = 0; x < pairs; ++x) {
+                Acc sum = 0;
+                for (int r = 0; r < Rows; ++r) {
+                    sum += static_cast<Acc>(rows[r][2 * x]) + static_cast<Acc>(rows[r][2 * x + 1]);
+                }
+                out[x] = finish(sum);
+            }
+        } else {
+            for (int x = 0; x < pairs; ++x) {
+                for (int c = 0; c < channels; ++c) {
+                    Acc sum = 0;
+                    for (int r = 0; r < Rows; ++r) {
+                        sum += static_cast<Acc>(rows[r][2 * x * channels + c]) +
+                               static_cast<Acc>(rows[r][(2 * x + 1) * channels + c]);
+                    }
+                    out[x * channels + c] = finish(sum);
+                }
+            }
+        }
+        // An odd last column repeats the edge pixel
+        if (width % 2) {
+            for (int c = 0; c < channels; ++c) {
+                Acc sum = 0;
+                for (int r = 0; r < Rows; ++r) {
+                    sum += 2 * static_cast<Acc>(rows[r][(width - 1) * channels + c]);
+                }
+                out[pairs * channels + c] = finish(sum);
+            }
+        }
+    }
+
+    template<typename T>
+    void downsampleImage(const T *source, int width, int height, int channels, DownsampleMode mode, T *out) {
+        int outHeight = (height + 1) / 2;
+        size_t rowSize = static_cast<size_t>(width) * channels;
+        size_t outRow = static_cast<size_t>((width + 1) / 2) * channels;
+        Parallel::forRange(outHeight, [&](size_t begin, size_t end) {
+            if (mode == DownsampleMode::Box) {
+                for (size_t y = begin; y < end; ++y) {
+                    const T *rows[2] = {source + 2 * y * rowSize,
+                                        source + std::min<size_t>(2 * y + 1, height - 1) * rowSize};
+                    boxRow<2>(rows, width, channels, out + y * outRow);
+                }
+                return;
+            }
+            Taps taps = tapsFor(mode);
+            std::vector<Accumulator<T>> sums((end - begin) * outRow), rowScratch;
+            reduceRows(source, width, height, channels, taps, static_cast<int>(begin), static_cast<int>(end),
+                       sums.data(), rowScratch);
+            normalise(sums.data(), sums.size(), taps.total * taps.total, out + begin * outRow);
+        }, 16);
+    }
+
+    template<typename T>
+    void downsampleVolume(const T *source, int width, int height, int depth, DownsampleMode mode, T *out) {
+        int outHeight = (height + 1) / 2, outDepth = (depth + 1) / 2;
+        size_t sliceSize = static_cast<size_t>(width) * height;
+        size_t outSlice = static_cast<size_t>((width + 1) / 2) * outHeight;
+        Parallel::forRange(outDepth, [&](size_t begin, size_t end) {
+            if (mode == DownsampleMode::Box) {
+                for (size_t z = begin; z < end; ++z) {
+                    const T *front = source + 2 * z * sliceSize;
+                    const T *back = source + std::min<size_t>(2 * z + 1, depth - 1) * sliceSize;
+                    for (int y = 0; y < outHeight; ++y) {
+                        size_t top = static_cast<size_t>(2 * y) * width;
+                        size_t bottom = static_cast<size_t>(std::min(2 * y + 1, height - 1)) * width;
+                        const T *rows[4] = {front + top, front + bottom, back + top, back + bottom};
+                        boxRow<4>(rows, width, 1, out + z * outSlice + static_cast<size_t>(y) * ((width + 1) / 2));
+                    }
+                }
+                return;
+            }
+
+            // Neighbouring output slices share two of their four source slices, so the last reduced slices are kept
+            Taps taps = tapsFor(mode);
+            std::vector<Accumulator<T>> sums(outSlice), rowScratch;
+            std::vector<std::vector<Accumulator<T>>> reduced(taps.count, std::vector<Accumulator<T>>(outSlice));
+            std::vector<int> reducedZ(taps.count, -1);
+            for (size_t z = begin; z < end; ++z) {
+                std::fill(sums.begin(), sums.end(), Accumulator<T>(0));
+                for (int k = 0; k < taps.count; ++k) {
+                    int sourceZ = std::clamp(2 * static_cast<int>(z) + taps.offset[k], 0, depth - 1);
+                    auto cached = std::find(reducedZ.begin(), reducedZ.end(), sourceZ);
+                    size_t slot;
+                    if (cached != reducedZ.end()) {
+                        slot = cached - reducedZ.begin();
+                    } else {
+                        // Replace the slice furthest behind, which no later output slice reads
+                        slot = std::min_element(reducedZ.begin(), reducedZ.end()) - reducedZ.begin();
+                        reduceRows(source + sourceZ * sliceSize, width, height, 1, taps, 0, outHeight,
+                                   reduced[slot].data(), rowScratch);
+                        reducedZ[slot] = sourceZ;
+                    }
+                    Accumulator<T> weight = static_cast<Accumulator<T>>(taps.weight[k]);
+                    const Accumulator<T> *slice = reduced[slot].data();
+                    for (size_t i = 0; i < outSlice; ++i) {
+                        sums[i] += weight * slice[i];
+                    }
+                }
+                normalise(sums.data(), outSlice, taps.total * taps.total * taps.total, out + z * outSlice);
+            }
+        });
+    }
+}
+
+ImagePyramid::ImagePyramid(Image &base, DownsampleMode mode)
+        : base(base), mode(mode), levels(std::max(getLevelCount() - 1, 0)) {}
+
+int ImagePyramid::getLevelCount() const {
+    return 1 + std::max(halvings(base.getWidth()), halvings(base.getHeight()));
+}
+
+Image &ImagePyramid::getLevel(int level) {
+    if (level < 0 || level >= getLevelCount()) {
+        throw std::out_of_range("Pyramid level does not exist.");
+    }
+    levels.resize(getLevelCount() - 1);
+    if (level == 0) {
+        return base;
+    }
+    if (!levels[level - 1]) {
+        levels[level - 1] = std::make_unique<Image>(downsample(getLevel(level - 1), mode));
+    }
+    return *levels[level - 1];
+}
+
+bool ImagePyramid::isLevelBuilt(int level) const {
+    return level == 0 || (level > 0 && level <= static_cast<int>(levels.size()) && levels[level - 1]);
+}
+
+void ImagePyramid::invalidate(int firstLevel) {
+    for (size_t i = std::max(firstLevel, 1) - 1; i < levels.size(); ++i) {
+        levels[i].reset();
+    }
+}
+
+Image ImagePyramid::downsample(const Image &source, DownsampleMode mode) {
+    int width = source.getWidth(), height = source.getHeight(), channels = source.getChannels();
+    if (!source.getData() || width <= 0 || height <= 0 || channels <= 0) {
+        return Image();
+    }
+    TRACE_SCOPE("ImagePyramid::downsample", "pyramid",
+                static_cast<size_t>(width) * height * channels * bytesPerSample(source.getDataType()));
+
+    int outWidth = (width + 1) / 2, outHeight = (height + 1) / 2;
+    Image result(outWidth, outHeight, channels, nullptr, source.getDataType());
+    Buffer buffer = BufferPool::global().acquire(
+            static_cast<size_t>(outWidth) * outHeight * channels * bytesPerSample(source.getDataType()));
+    switch (source.getDataType()) {
+        case DataType::UInt16:
+            downsampleImage(source.getDataAs<unsigned short>(), width, height, channels, mode,
+                            reinterpret_cast<unsigned short *>(buffer.getData()));
+            break;
+        case DataType::Float32:
+            downsampleImage(source.getDataAs<float>(), width, height, channels, mode,
+                            reinterpret_cast<float *>(buffer.getData()));
+            break;
+        default:
+            downsampleImage(source.getData(), width, height, channels, mode, buffer.getData());
+            break;
+    }
+    result.updateData(std::move(buffer), source.getDataType());
+    return result;
+}
+
+VolumePyramid::VolumePyramid(Volume &base, DownsampleMode mode)
+        : base(base), mode(mode), levels(std::max(getLevelCount() - 1, 0)) {}
+
+int VolumePyramid::getLevelCount() const {
+    return 1 + std::max({halvings(base.getWidth()), halvings(base.getHeight()), halvings(base.getDepth())});
+}
+
+Volume &VolumePyramid::getLevel(int level) {
+    if (level < 0 || level >= getLevelCount()) {
+        throw std::out_of_range("Pyramid level does not exist.");
+    }
+    levels.resize(getLevelCount() - 1);
+    if (level == 0) {
+        return base;
+    }
+    if (!levels[level - 1]) {
+        levels[level - 1] = std::make_unique<Volume>(downsample(getLevel(level - 1), mode));
+    }
+    return *levels[level - 1];
+}
+
+bool VolumePyramid::isLevelBuilt(int level) const {
+    return level == 0 || (level > 0 && level <= static_cast<int>(levels.size()) && levels[level - 1]);
+}
+
+void VolumePyramid::invalidate(int firstLevel) {
+    for (size_t i = std::max(firstLevel, 1) - 1; i < levels.size(); ++i) {
+        levels[i].reset();
+    }
+}
+
+Volume VolumePyramid::downsample(const Volume &source, DownsampleMode mode) {
+    int width = source.getWidth(), height = source.getHeight(), depth = source.getDepth();
+    if (!source.getData() || width <= 0 || height <= 0 || depth <= 0) {
+        return Volume();
+    }
+    TRACE_SCOPE("VolumePyramid::downsample", "pyramid",
+                static_cast<size_t>(width) * height * depth * bytesPerSample(source.getDataType()));
+
+    int outWidth = (width + 1) / 2, outHeight = (height + 1) / 2, outDepth = (depth + 1) / 2;
+    Buffer buffer = BufferPool::global().acquire(
+            static_cast<size_t>(outWidth) * outHeight * outDepth * bytesPerSample(source.getDataType()));
+    switch (source.getDataType()) {
+        case DataType::UInt16:
+            downsampleVolume(source.getDataAs<unsigned short>(), width, height, depth, mode,
+                             reinterpret_cast<unsigned short *>(buffer.getData()));
+            break;
+        case DataType::Float32:
+            downsampleVolume(source.getDataAs<float>(), width, height, depth, mode,
+                             reinterpret_cast<float *>(buffer.getData()));
+            break;
+        default:
+            downsampleVolume(source.getData(), width, height, depth, mode, buffer.getData());
+            break;
+    }
+    return Volume(outWidth, outHeight, outDepth, std::move(buffer), source.getDataType());
+}
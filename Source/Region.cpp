@@ -0,0 +1,118 @@
+/**
+ * @file Region.cpp
+ *
+ * @brief Implements the helper that runs a filter on a region of an image or volume.
+ *
+ * The crop is copied row by row, so only the rows of the region and its halo are read, and the crop buffers come from
+ * the shared buffer pool. Copies work on bytes, so every sample type and channel count is handled alike.
+ *
+ * @date Created on October 19, 2026
+ *
+ * @authors
+ * Advanced Programming Group Radix Sort:
+ *   - Benjamin Duncan (edsml-bd1023)
+ *   - Boyang Hu (edsml-bh223)
+ *   - Chawk Chamoun (edsml-cc8915)
+ *   - Mingsheng Cai (acse-sc4623)
+ *   - Moyu Zhang (acse-mz223)
+ *   - Ryan Benney (acse-rgb123)
+ */
+
+#include "Region.h"
+#include "BufferPool.h"
+#include "Trace.h"
+
+#include <algorithm>
+#include <cstring>
+#include <iostream>
+
+bool Region::isValid(const Region2D &region, const Image &image) {
+    return region.width > 0 && region.height > 0 && region.x >= 0 && region.y >= 0 &&
+           region.x + region.width <= image.getWidth() && region.y + region.height <= image.getHeight();
+}
+
+bool Region::isValid(const Region3D &region, const Volume &volume) {
+    return region.width > 0 && region.height > 0 && region.depth > 0 && region.x >= 0 && region.y >= 0 &&
+           region.z >= 0 && region.x + region.width <= volume.getWidth() &&
+           region.y + region.height <= volume.getHeight() && region.z + region.depth <= volume.getDepth();
+}
+
+void Region::apply(Image &image, const Region2D &region, int halo, const std::function<void(Image &)> &filter) {
+    if (!image.getData() || !isValid(region, image)) {
+        std::cerr << "Error: The region of interest must be non-empty and lie inside the image." << std::endl;
+        return;
+    }
+
+    // The region plus its halo, clipped to the image
+    int x0 = std::max(0, region.x - halo), y0 = std::max(0, region.y - halo);
+    int x1 = std::min(image.getWidth(), region.x + region.width + halo);
+    int y1 = std::min(image.getHeight(), region.y + region.height + halo);
+    size_t pixelSize = image.getChannels() * bytesPerSample(image.getDataType());
+    size_t imageRow = image.getWidth() * pixelSize, cropRow = (x1 - x0) * pixelSize;
+    TRACE_SCOPE("Region::apply image", "filter", cropRow * (y1 - y0));
+
+    Image crop(x1 - x0, y1 - y0, image.getChannels(), nullptr, image.getDataType());
+    Buffer cropData = BufferPool::global().acquire(cropRow * (y1 - y0));
+    for (int y = y0; y < y1; ++y) {
+        std::memcpy(cropData.getData() + (y - y0) * cropRow, image.getData() + y * imageRow + x0 * pixelSize, cropRow);
+    }
+    crop.updateData(std::move(cropData), image.getDataType());
+
+    filter(crop);
+    if (crop.getWidth() != x1 - x0 || crop.getHeight() != y1 - y0 || crop.getChannels() != image.getChannels() ||
+        crop.getDataType() != image.getDataType() || !crop.getData()) {
+        std::cerr << "Error: The filter changed the image layout and cannot be applied to a region." << std::endl;
+        return;
+    }
+
+    // Write back the region only
+    size_t regionRow = region.width * pixelSize;
+    for (int y = region.y; y < region.y + region.height; ++y) {
+        std::memcpy(image.getData() + y * imageRow + region.x * pixelSize,
+                    crop.getData() + (y - y0) * cropRow + (region.x - x0) * pixelSize, regionRow);
+    }
+}
+
+void Region::apply(Volume &volume, const Region3D &region, int halo, const std::function<void(Volume &)> &filter) {
+    if (!volume.getData() || !isValid(region, volume)) {
+        std::cerr << "Error: The region of interest must be non-empty and lie inside the volume." << std::endl;
+        return;
+    }
+
+    // The region plus its halo, clipped to the volume
+    int x0 = std::max(0, region.x - halo), y0 = std::max(0, region.y - halo), z0 = std::max(0, region.z - halo);
+    int x1 = std::min(volume.getWidth(), region.x + region.width + halo);
+    int y1 = std::min(volume.getHeight(), region.y + region.height + halo);
+    int z1 = std::min(volume.getDepth(), region.z + region.depth + halo);
+    size_t sampleSize = bytesPerSample(volume.getDataType());
+    size_t volumeRow = volume.getWidth() * sampleSize, volumeSlice = volumeRow * volume.getHeight();
+    size_t cropRow = (x1 - x0) * sampleSize, cropSlice = cropRow * (y1 - y0);
+    TRACE_SCOPE("Region::apply volume", "filter", cropSlice * (z1 - z0));
+
+    Buffer cropData = BufferPool::global().acquire(cropSlice * (z1 - z0));
+    for (int z = z0; z < z1; ++z) {
+        for (int y = y0; y < y1; ++y) {
+            std::memcpy(cropData.getData() + (z - z0) * cropSlice + (y - y0) * cropRow,
+                        volume.getData() + z * volumeSlice + y * volumeRow + x0 * sampleSize, cropRow);
+        }
+    }
+    Volume crop(x1 - x0, y1 - y0, z1 - z0, std::move(cropData), volume.getDataType());
+
+    filter(crop);
+    if (crop.getWidth() != x1 - x0 || crop.getHeight() != y1 - y0 || crop.getDepth() != z1 - z0 ||
+        crop.getDataType() != volume.getDataType() || !crop.getData()) {
+        std::cerr << "Error: The filter changed the volume layout and cannot be applied to a region." << std::endl;
+        return;
+    }
+
+    // Write back the region only
+    size_t regionRow = region.width * sampleSize;
+    for (int z = region.z; z < region.z + region.depth; ++z) {
+        for (int y = region.y; y < region.y + region.height; ++y) {
+            std::memcpy(volume.getData() + z * volumeSlice + y * volumeRow + region.x * sampleSize,
+                        crop.getData() + (z - z0) * cropSlice + (y - y0) * cropRow + (region.x - x0) * sampleSize,
+                        regionRow);
+        }
+    }
+    volume.clearProjectionIndex();
+}
@@ -0,0 +1,376 @@
+/**
+ * @file ResultCache.cpp
+ *
+ * @brief Implements the content-addressed cache of intermediate results.
+ *
+ * The index of entries lives in memory and is guarded by a mutex, while files are read and written outside the lock
+ * so that several threads can use the cache at once. An entry missing from the index is looked up on disk before it
+ * counts as a miss, which picks up entries written by other processes sharing the directory.
+ *
+ * @date Created on October 19, 2026
+ *
+ * @authors
+ * Advanced Programming Group Radix Sort:
+ *   - Benjamin Duncan (edsml-bd1023)
+ *   - Boyang Hu (edsml-bh223)
+ *   - Chawk Chamoun (edsml-cc8915)
+ *   - Mingsheng Cai (acse-sc4623)
+ *   - Moyu Zhang (acse-mz223)
+ *   - Ryan Benney (acse-rgb123)
+ */
+
+#include "ResultCache.h"
+#include "BufferPool.h"
+#include "Parallel.h"
+#include "Trace.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <random>
+#include <system_error>
+#include <tuple>
+
+namespace {
+    constexpr char magic[8] = {'M', 'D', 'I', 'P', 'R', 'C', '1', '\n'}; // First bytes of every entry
+    constexpr size_t chunkBytes = static_cast<size_t>(1) << 20; // Samples hashed together by keyOf
+
+    // Hashes the shape and samples of a volume or image, chunk by chunk in parallel
+    std::uint64_t contentKey(const std::int32_t (&shape)[5], const unsigned char *data, size_t bytes) {
+        std::uint64_t seed = ResultCache::hash(shape, sizeof(shape));
+        if (!data || bytes == 0) {
+            return seed;
+        }
+        std::vector<std::uint64_t> chunks((bytes + chunkBytes - 1) / chunkBytes);
+        Parallel::forRange(chunks.size(), [&](size_t begin, size_t end) {
+            for (size_t i = begin; i < end; ++i) {
+                size_t offset = i * chunkBytes;
+                chunks[i] = ResultCache::hash(data + offset, std::min(chunkBytes, bytes - offset));
+            }
+        });
+        return ResultCache::hash(chunks.data(), chunks.size() * sizeof(std::uint64_t), seed);
+    }
+
+    bool validDataType(std::uint32_t type) {
+        return type == static_cast<std::uint32_t>(DataType::UInt8) ||
+               type == static_cast<std::uint32_t>(DataType::UInt16) ||
+               type == static_cast<std::uint32_t>(DataType::Float32);
+    }
+}
+
+ResultCache::ResultCache(const std::string &directory, size_t capacityBytes)
+        : directory(directory), capacityBytes(capacityBytes), usedBytes(0) {
+    std::error_code error;
+    std::filesystem::create_directories(directory, error);
+    if (error) {
+        std::cerr << "Error: Cannot create the cache directory " << directory << ": " << error.message() << std::endl;
+        return;
+    }
+
+    // Index the existing entries, most recently used first
+    std::vector<std::tuple<std::filesystem::file_time_type, std::uint64_t, size_t>> found;
+    for (const auto &file: std::filesystem::directory_iterator(directory, error)) {
+        std::string name = file.path().filename().string();
+        if (name.size() != 20 || file.path().extension() != ".raw" ||
+            name.find_first_not_of("0123456789abcdef") != 16) {
+            continue;
+        }
+        std::error_code sizeError, timeError;
+        size_t bytes = file.file_size(sizeError);
+        auto time = file.last_write_time(timeError);
+        if (!sizeError && !timeError) {
+            found.emplace_back(time, std::stoull(name.substr(0, 16), nullptr, 16), bytes);
+        }
+    }
+    std::sort(found.begin(), found.end());
+    for (const auto &[time, key, bytes]: found) {
+        recent.push_front(key);
+        entries[key] = {bytes, recent.begin()};
+        usedBytes += bytes;
+    }
+    evict(0);
+}
+
+void ResultCache::evict(size_t keep) {
+    std::error_code error;
+    while (usedBytes > capacityBytes && recent.size() > keep) {
+        std::uint64_t oldest = recent.back();
+        std::filesystem::remove(pathOf(oldest), error);
+        usedBytes -= entries[oldest].bytes;
+        entries.erase(oldest);
+        recent.pop_back();
+    }
+}
+
+std::string ResultCache::pathOf(std::uint64_t key) const {
+    char name[24];
+    std::snprintf(name, sizeof(name), "%016llx.raw", static_cast<unsigned long long>(key));
+    return (std::filesystem::path(directory) / name).string();
+}
+
+std::uint64_t ResultCache::hash(const void *data, size_t size, std::uint64_t seed) {
+    const std::uint64_t m = 0xc6a4a7935bd1e995ULL;
+    const int r = 47;
+    const auto *bytes = static_cast<const unsigned char *>(data);
+    std::uint64_t h = seed ^ (size * m);
+
+    size_t words = size / 8;
+    for (size_t i = 0; i < words; ++i) {
+        std::uint64_t k;
+        std::memcpy(&k, bytes + i * 8, 8);
+        k *= m;
+        k ^= k >> r;
+        k *= m;
+        h ^= k;
+        h *= m;
+    }
+    size_t tail = size % 8;
+    if (tail > 0) {
+        std::uint64_t k = 0;
+        for (size_t i = 0; i < tail; ++i) {
+            k |= static_cast<std::uint64_t>(bytes[words * 8 + i]) << (8 * i);
+        }
+        h ^= k;
+        h *= m;
+    }
+    h ^= h >> r;
+    h *= m;
+    h ^= h >> r;
+    return h;
+}
+
+std::uint64_t ResultCache::keyOf(const Volume &volume) {
+    std::int32_t shape[5] = {0, volume.getWidth(), volume.getHeight(), volume.getDepth(),
+                             static_cast<std::int32_t>(volume.getDataType())};
+    size_t bytes = static_cast<size_t>(volume.getWidth()) * volume.getHeight() * volume.getDepth() *
+                   bytesPerSample(volume.getDataType());
+    return contentKey(shape, volume.getData(), bytes);
+}
+
+std::uint64_t ResultCache::keyOf(const Image &image) {
+    std::int32_t shape[5] = {1, image.getWidth(), image.getHeight(), image.getChannels(),
+                             static_cast<std::int32_t>(image.getDataType())};
+    size_t bytes = static_cast<size_t>(image.getWidth()) * image.getHeight() * image.getChannels() *
+                   bytesPerSample(image.getDataType());
+    return contentKey(shape, image.getData(), bytes);
+}
+
+std::uint64_t ResultCache::keyOfFiles(const std::vector<std::string> &paths) {
+    std::uint64_t key = hash(nullptr, 0, paths.size());
+    for (const auto &path: paths) {
+        // Missing files hash as size -1, so they still give a key of their own
+        std::error_code sizeError, timeError;
+        auto size = std::filesystem::file_size(path, sizeError);
+        auto time = std::filesystem::last_write_time(path, timeError);
+        std::int64_t stamp[2] = {sizeError ? -1 : static_cast<std::int64_t>(size),
+                                 timeError ? 0 : static_cast<std::int64_t>(time.time_since_epoch().count())};
+        key = hash(path.data(), path.size(), key);
+        key = hash(stamp, sizeof(stamp), key);
+    }
+    return key;
+}
+
+std::uint64_t ResultCache::extend(std::uint64_t key, const std::string &description) {
+    return hash(description.data(), description.size(), key);
+}
+
+bool ResultCache::read(std::uint64_t key, Shape &shape, Buffer &data) {
+    std::string path = pathOf(key);
+    {
+        // Entries written by other processes are picked up from the disk
+        std::lock_guard<std::mutex> lock(mutex);
+        if (entries.find(key) == entries.end()) {
+            std::error_code error;
+            size_t bytes = std::filesystem::file_size(path, error);
+            if (error) {
+                return false;
+            }
+            recent.push_front(key);
+            entries[key] = {bytes, recent.begin()};
+            usedBytes += bytes;
+            evict(1);
+        }
+    }
+
+    std::error_code sizeError;
+    size_t fileBytes = std::filesystem::file_size(path, sizeError);
+    size_t headerBytes = sizeof(magic) + sizeof(key) + sizeof(shape);
+    std::ifstream file(path, std::ios::binary);
+    char header[sizeof(magic)];
+    std::uint64_t storedKey = 0;
+    bool ok = file.read(header, sizeof(header)) && std::memcmp(header, magic, sizeof(magic)) == 0 &&
+              file.read(reinterpret_cast<char *>(&storedKey), sizeof(storedKey)) && storedKey == key &&
+              file.read(reinterpret_cast<char *>(&shape), sizeof(shape)) && shape.width > 0 && shape.height > 0 &&
+              shape.depthOrChannels > 0 && validDataType(shape.dataType);
+
+    // The shape must account for exactly the rest of the file before anything is allocated for it
+    size_t bytes = 0;
+    ok = ok && !sizeError && fileBytes >= headerBytes &&
+         !__builtin_mul_overflow(static_cast<size_t>(shape.width), static_cast<size_t>(shape.height), &bytes) &&
+         !__builtin_mul_overflow(bytes, static_cast<size_t>(shape.depthOrChannels), &bytes) &&
+         !__builtin_mul_overflow(bytes, bytesPerSample(static_cast<DataType>(shape.dataType)), &bytes) &&
+         bytes == fileBytes - headerBytes;
+    if (ok) {
+        TRACE_SCOPE("ResultCache::read", "io", bytes);
+        data = BufferPool::global().acquire(bytes);
+        ok = static_cast<bool>(file.read(reinterpret_cast<char *>(data.getData()),
+                                         static_cast<std::streamsize>(bytes)));
+    }
+    file.close();
+
+    std::lock_guard<std::mutex> lock(mutex);
+    auto entry = entries.find(key);
+    if (entry == entries.end()) {
+        // Evicted by another thread while it was read; the samples read are still valid
+        return ok;
+    }
+    std::error_code error;
+    if (!ok) {
+        std::cerr << "Warning: Dropping the damaged cache entry " << path << "." << std::endl;
+        std::filesystem::remove(path, error);
+        usedBytes -= entry->second.bytes;
+        recent.erase(entry->second.position);
+        entries.erase(entry);
+        return false;
+    }
+    recent.splice(recent.begin(), recent, entry->second.position);
+    std::filesystem::last_write_time(path, std::filesystem::file_time_type::clock::now(), error);
+    return true;
+}
+
+bool ResultCache::write(std::uint64_t key, const Shape &shape, const unsigned char *data, size_t bytes) {
+    size_t fileBytes = sizeof(magic) + sizeof(key) + sizeof(shape) + bytes;
+    if (fileBytes > capacityBytes) {
+        std::cerr << "Error: A result of " << fileBytes << " bytes does not fit in the cache." << std::endl;
+        return false;
+    }
+    TRACE_SCOPE("ResultCache::write", "io", bytes);
+
+    // Written under a unique name and renamed, so that readers never see a partial entry
+    std::string path = pathOf(key);
+    std::string temporary = path + ".tmp" + std::to_string(std::random_device()());
+    {
+        std::ofstream file(temporary, std::ios::binary | std::ios::trunc);
+        bool ok = file.write(magic, sizeof(magic)) &&
+                  file.write(reinterpret_cast<const char *>(&key), sizeof(key)) &&
+                  file.write(reinterpret_cast<const char *>(&shape), sizeof(shape)) &&
+                  file.write(reinterpret_cast<const char *>(data), static_cast<std::streamsize>(bytes));
+        file.close();
+        if (!ok || file.fail()) {
+            std::cerr << "Error: Cannot write the cache entry " << temporary << "." << std::endl;
+            std::error_code error;
+            std::filesystem::remove(temporary, error);
+            return false;
+        }
+    }
+    std::error_code error;
+    std::filesystem::rename(temporary, path, error);
+    if (error) {
+        std::cerr << "Error: Cannot write the cache entry " << path << ": " << error.message() << std::endl;
+        std::filesystem::remove(temporary, error);
+        return false;
+    }
+
+    std::lock_guard<std::mutex> lock(mutex);
+    auto entry = entries.find(key);
+    if (entry != entries.end()) {
+        usedBytes -= entry->second.bytes;
+        recent.erase(entry->second.position);
+    }
+    recent.push_front(key);
+    entries[key] = {fileBytes, recent.begin()};
+    usedBytes += fileBytes;
+    evict(1);
+    return true;
+}
+
+bool ResultCache::load(std::uint64_t key, Volume &volume) {
+    Shape shape{};
+    Buffer data;
+    if (!read(key, shape, data) || shape.kind != 0) {
+        return false;
+    }
+    volume = Volume(shape.width, shape.height, shape.depthOrChannels, std::move(data),
+                    static_cast<DataType>(shape.dataType));
+    return true;
+}
+
+bool ResultCache::load(std::uint64_t key, Image &image) {
+    Shape shape{};
+    Buffer data;
+    if (!read(key, shape, data) || shape.kind != 1) {
+        return false;
+    }
+    image = Image(shape.width, shape.height, shape.depthOrChannels, nullptr, static_cast<DataType>(shape.dataType));
+    image.updateData(std::move(data), static_cast<DataType>(shape.dataType));
+    return true;
+}
+
+bool ResultCache::store(std::uint64_t key, const Volume &volume) {
+    if (!volume.getData()) {
+        std::cerr << "Error: Cannot cache an empty volume." << std::endl;
+        return false;
+    }
+    Shape shape{0, volume.getWidth(), volume.getHeight(), volume.getDepth(),
+                static_cast<std::uint32_t>(volume.getDataType())};
+    size_t bytes = static_cast<size_t>(volume.getWidth()) * volume.getHeight() * volume.getDepth() *
+                   bytesPerSample(volume.getDataType());
+    return write(key, shape, volume.getData(), bytes);
+}
+
+bool ResultCache::store(std::uint64_t key, const Image &image) {
+    if (!image.getData()) {
+        std::cerr << "Error: Cannot cache an empty image." << std::endl;
+        return false;
+    }
+    Shape shape{1, image.getWidth(), image.getHeight(), image.getChannels(),
+                static_cast<std::uint32_t>(image.getDataType())};
+    size_t bytes = static_cast<size_t>(image.getWidth()) * image.getHeight() * image.getChannels() *
+                   bytesPerSample(image.getDataType());
+    return write(key, shape, image.getData(), bytes);
+}
+
+template<typename Data>
+size_t ResultCache::runStages(Data &data, std::uint64_t inputKey, const std::vector<CachedStage<Data>> &stages) {
+    // Results from the first stage that is not reproducible onwards are neither loaded nor stored
+    std::vector<std::uint64_t> keys = {inputKey};
+    size_t cacheable = 0;
+    while (cacheable < stages.size() && !stages[cacheable].description.empty()) {
+        keys.push_back(extend(keys.back(), stages[cacheable].description));
+        ++cacheable;
+    }
+
+    // Resume from the longest cached prefix of the chain
+    size_t skipped = cacheable;
+    while (skipped > 0 && !load(keys[skipped], data)) {
+        --skipped;
+    }
+    for (size_t i = skipped; i < stages.size(); ++i) {
+        stages[i].apply(data);
+        if (i < cacheable) {
+            store(keys[i + 1], data);
+        }
+    }
+    return skipped;
+}
+
+size_t ResultCache::run(Volume &volume, std::uint64_t inputKey, const std::vector<CachedStage<Volume>> &stages) {
+    return runStages(volume, inputKey, stages);
+}
+
+size_t ResultCache::run(Image &image, std::uint64_t inputKey, const std::vector<CachedStage<Image>> &stages) {
+    return runStages(image, inputKey, stages);
+}
+
+size_t ResultCache::getUsedBytes() {
+    std::lock_guard<std::mutex> lock(mutex);
+    return usedBytes;
+}
+
+size_t ResultCache::getEntryCount() {
+    std::lock_guard<std::mutex> lock(mutex);
+    return entries.size();
+}
@@ -24,13 +24,90 @@
  */
 
 #include "Slice.h"
+#include <algorithm>
 #include <cstring>
 #include <iostream>
 #include <string>
 
+namespace {
+    // Shared implementation of the linear getPlaneSlice overloads
+    template<typename T>
+    std::vector<T> extractPlaneSlice(int width, int height, int depth, const T *data, const std::string &plane,
+                                     int sliceIndex) {
+        // Validate the slice index
+        if (sliceIndex < 1) {
+            std::cerr << "Slice index must be greater than 0." << std::endl;
+            return {};
+        }
+
+        std::vector<T> slice;
+
+        // Extract the desired slice based on the specified plane
+        if (plane == "x-y") {
+            if (sliceIndex > depth) {
+                std::cerr << "Slice index out of range for x-y plane." << std::endl;
+                return {};
+            }
+            // Compute the start of the desired slice in the data array
+            const T *sliceStart = data + static_cast<size_t>(sliceIndex - 1) * width * height;
+            slice.assign(sliceStart, sliceStart + width * height);
+
+        } else if (plane == "x-z") {
+            if (sliceIndex > height) {
+                std::cerr << "Slice index out of range for x-z plane." << std::endl;
+                return {};
+            }
+            // Copy the data for the desired slice into the slice vector
+            slice.resize(width * depth);
+            for (int z = 0; z < depth; ++z) {
+                for (int x = 0; x < width; ++x) {
+                    slice[z * width + x] = data[z * width * height + (sliceIndex - 1) * width + x];
+                }
+            }
+
+        } else if (plane == "y-z") {
+            if (sliceIndex > width) {
+                std::cerr << "Slice index out of range for y-z plane." << std::endl;
+                return {};
+            }
+            // Copy the data for the desired slice into the slice vector
+            slice.resize(height * depth);
+            for (int z = 0; z < depth; ++z) {
+                for (int y = 0; y < height; ++y) {
+                    slice[z * height + y] = data[z * width * height + y * width + (sliceIndex - 1)];
+                }
+            }
+
+        } else {
+            std::cerr << "Invalid plane specified. Valid planes are 'x-y', 'x-z', and 'y-z'." << std::endl;
+        }
+
+        return slice;
+    }
+}
+
 std::vector<unsigned char>
 Slice::getPlaneSlice(int width, int height, int depth, const unsigned char *data, const std::string &plane,
                      int sliceIndex) {
+    return extractPlaneSlice(width, height, depth, data, plane, sliceIndex);
+}
+
+template<typename T>
+std::vector<T>
+Slice::getPlaneSlice(int width, int height, int depth, const T *data, const std::string &plane, int sliceIndex) {
+    return extractPlaneSlice(width, height, depth, data, plane, sliceIndex);
+}
+
+template std::vector<unsigned short>
+Slice::getPlaneSlice(int, int, int, const unsigned short *, const std::string &, int);
+template std::vector<float> Slice::getPlaneSlice(int, int, int, const float *, const std::string &, int);
+
+std::vector<unsigned char>
+Slice::getPlaneSlice(const BrickedVolume &volume, const std::string &plane, int sliceIndex) {
+    int width = volume.getWidth();
+    int height = volume.getHeight();
+    int depth = volume.getDepth();
+
     // Validate the slice index
     if (sliceIndex < 1) {
         std::cerr << "Slice index must be greater than 0." << std::endl;
@@ -45,22 +122,19 @@ Slice::getPlaneSlice(int width, int height, int depth, const unsigned char *data
             std::cerr << "Slice index out of range for x-y plane." << std::endl;
             return {};
         }
-        // Compute the start of the desired slice in the data array
-        const unsigned char *sliceStart = data + (sliceIndex - 1) * width * height;
         slice.resize(width * height);
-        std::memcpy(slice.data(), sliceStart, width * height);
+        for (int y = 0; y < height; ++y) {
+            volume.readSpanX(0, y, sliceIndex - 1, width, &slice[y * width]);
+        }
 
     } else if (plane == "x-z") {
         if (sliceIndex > height) {
             std::cerr << "Slice index out of range for x-z plane." << std::endl;
             return {};
         }
-        // Copy the data for the desired slice into the slice vector
         slice.resize(width * depth);
         for (int z = 0; z < depth; ++z) {
-            for (int x = 0; x < width; ++x) {
-                slice[z * width + x] = data[z * width * height + (sliceIndex - 1) * width + x];
-            }
+            volume.readSpanX(0, sliceIndex - 1, z, width, &slice[z * width]);
         }
 
     } else if (plane == "y-z") {
@@ -68,11 +142,22 @@ Slice::getPlaneSlice(int width, int height, int depth, const unsigned char *data
             std::cerr << "Slice index out of range for y-z plane." << std::endl;
             return {};
         }
-        // Copy the data for the desired slice into the slice vector
+        // Walk the column of bricks that contains the plane, reading each brick once
+        int brickSize = volume.getBrickSize();
+        int x = sliceIndex - 1;
+        int localX = x % brickSize;
         slice.resize(height * depth);
-        for (int z = 0; z < depth; ++z) {
-            for (int y = 0; y < height; ++y) {
-                slice[z * height + y] = data[z * width * height + y * width + (sliceIndex - 1)];
+        for (int bz = 0; bz < volume.getBricksZ(); ++bz) {
+            for (int by = 0; by < volume.getBricksY(); ++by) {
+                const unsigned char *brick = volume.getBrick(x / brickSize, by, bz);
+                int zEnd = std::min(brickSize, depth - bz * brickSize);
+                int yEnd = std::min(brickSize, height - by * brickSize);
+                for (int lz = 0; lz < zEnd; ++lz) {
+                    for (int ly = 0; ly < yEnd; ++ly) {
+                        slice[(bz * brickSize + lz) * height + by * brickSize + ly] =
+                                brick[(lz * brickSize + ly) * brickSize + localX];
+                    }
+                }
             }
         }
 
@@ -0,0 +1,537 @@
+/**
+ * @file TiffStack.cpp
+ *
+ * @brief Implements the multi-page TIFF reader.
+ *
+ * Opening a file walks its chain of image file directories and checks every page, so decoding never has to reject a
+ * page halfway through a load. The strips and tiles are then decoded from the mapped file without locks or copies of
+ * the compressed data: uncompressed strips are copied, PackBits runs are expanded and LZW codes are decoded straight
+ * into the output, followed by byte swapping, undoing the horizontal predictor and inverting white-is-zero samples.
+ * Only tiles that overhang the right or bottom edge of a page go through a scratch buffer.
+ *
+ * @date Created on October 19, 2026
+ *
+ * @authors
+ * Advanced Programming Group Radix Sort:
+ *   - Benjamin Duncan (edsml-bd1023)
+ *   - Boyang Hu (edsml-bh223)
+ *   - Chawk Chamoun (edsml-cc8915)
+ *   - Mingsheng Cai (acse-sc4623)
+ *   - Moyu Zhang (acse-mz223)
+ *   - Ryan Benney (acse-rgb123)
+ */
+
+#include "TiffStack.h"
+#include "BufferPool.h"
+#include "Parallel.h"
+#include "Trace.h"
+
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <cstring>
+#include <iostream>
+#include <limits>
+#include <unordered_set>
+
+namespace {
+    // Tags of the image file directory fields this reader uses
+    enum Tag : uint16_t {
+        imageWidthTag = 256,
+        imageLengthTag = 257,
+        bitsPerSampleTag = 258,
+        compressionTag = 259,
+        photometricTag = 262,
+        stripOffsetsTag = 273,
+        samplesPerPixelTag = 277,
+        rowsPerStripTag = 278,
+        stripByteCountsTag = 279,
+        predictorTag = 317,
+        tileWidthTag = 322,
+        tileLengthTag = 323,
+        tileOffsetsTag = 324,
+        tileByteCountsTag = 325,
+        sampleFormatTag = 339
+    };
+
+    constexpr size_t entrySize = 12; // Bytes per directory entry
+    constexpr size_t maxPages = 1 << 20; // Longest directory chain followed before the file is treated as corrupt
+    constexpr size_t maxPackBitsExpansion = 64; // A two-byte run decodes to at most 128 bytes
+    constexpr size_t maxLzwExpansion = 4096; // A code of at least 9 bits decodes to at most 4096 bytes
+
+    // Reads an unsigned integer of the file byte order
+    uint32_t readUnsigned(const unsigned char *p, int bytes, bool bigEndian) {
+        uint32_t value = 0;
+        for (int i = 0; i < bytes; ++i) {
+            value |= static_cast<uint32_t>(p[bigEndian ? i : bytes - 1 - i]) << (8 * (bytes - 1 - i));
+        }
+        return value;
+    }
+
+    // Decodes PackBits runs until out is full
+    bool unpackBits(const unsigned char *source, size_t size, unsigned char *out, size_t outSize) {
+        size_t in = 0, written = 0;
+        while (written < outSize && in < size) {
+            auto header = static_cast<signed char>(source[in++]);
+            if (header >= 0) {
+                size_t count = static_cast<size_t>(header) + 1;
+                if (in + count > size || written + count > outSize) {
+                    return false;
+                }
+                std::memcpy(out + written, source + in, count);
+                in += count;
+                written += count;
+            } else if (header != -128) {
+                size_t count = static_cast<size_t>(1 - header);
+                if (in >= size || written + count > outSize) {
+                    return false;
+                }
+                std::memset(out + written, source[in++], count);
+                written += count;
+            }
+        }
+        return written == outSize;
+    }
+
+    // Decodes TIFF LZW codes (MSB-first, 9 to 12 bits, code width raised one code early) until out is full
+    bool decodeLzw(const unsigned char *source, size_t size, unsigned char *out, size_t outSize) {
+        constexpr int clearCode = 256, endCode = 257, firstFree = 258, tableSize = 4096;
+        uint16_t prefix[tableSize], length[tableSize];
+        unsigned char suffix[tableSize], first[tableSize];
+        for (int i = 0; i < 256; ++i) {
+            prefix[i] = 0;
+            length[i] = 1;
+            suffix[i] = first[i] = static_cast<unsigned char>(i);
+        }
+
+        size_t in = 0, written = 0;
+        uint32_t bitBuffer = 0;
+        int bitCount = 0, codeWidth = 9, next = firstFree, previous = -1;
+        while (written < outSize) {
+            while (bitCount < codeWidth && in < size) {
+                bitBuffer = (bitBuffer << 8) | source[in++];
+                bitCount += 8;
+            }
+            if (bitCount < codeWidth) {
+                break;
+            }
+            int code = static_cast<int>((bitBuffer >> (bitCount - codeWidth)) & ((1u << codeWidth) - 1));
+            bitCount -= codeWidth;
+            if (code == endCode) {
+                break;
+            }
+            if (code == clearCode) {
+                codeWidth = 9;
+                next = firstFree;
+                previous = -1;
+                continue;
+            }
+            if (previous < 0) {
+                if (code > 255) {
+                    return false;
+                }
+                out[written++] = static_cast<unsigned char>(code);
+                previous = code;
+                continue;
+            }
+            if (code > next || (code == next && next == tableSize)) {
+                return false;
+            }
+            if (next < tableSize) {
+                // A code equal to next is the string about to be added, which ends with its own first byte
+                prefix[next] = static_cast<uint16_t>(previous);
+                suffix[next] = first[code == next ? previous : code];
+                first[next] = first[previous];
+                length[next] = static_cast<uint16_t>(length[previous] + 1);
+                ++next;
+            }
+
+            // Strings are stored back to front, so each one is written from its last byte; bytes past out are dropped
+            size_t end = written + length[code];
+            for (int entry = code, position = static_cast<int>(length[code]) - 1; position >= 0; --position) {
+                if (written + position < outSize) {
+                    out[written + position] = suffix[entry];
+                }
+                entry = prefix[entry];
+            }
+            written = std::min(end, outSize);
+            previous = code;
+            if (next + 1 >= (1 << codeWidth) && codeWidth < 12) {
+                ++codeWidth;
+            }
+        }
+        return written == outSize;
+    }
+
+    // Swaps samples to host byte order, undoes the horizontal predictor and inverts white-is-zero samples
+    template<typename T>
+    void finishRows(unsigned char *data, size_t rowSamples, size_t rows, bool swap, bool predictor, bool invert) {
+        for (size_t row = 0; row < rows; ++row) {
+            unsigned char *bytes = data + row * rowSamples * sizeof(T);
+            T previous = 0;
+            for (size_t x = 0; x < rowSamples; ++x) {
+                T value;
+                std::memcpy(&value, bytes + x * sizeof(T), sizeof(T));
+                if constexpr (sizeof(T) > 1) {
+                    if (swap) {
+                        if constexpr (sizeof(T) == 2) {
+                            value = static_cast<T>(std::byteswap(static_cast<uint16_t>(value)));
+                        } else {
+                            value = std::bit_cast<T>(std::byteswap(std::bit_cast<uint32_t>(value)));
+                        }
+                    }
+                }
+                if constexpr (std::numeric_limits<T>::is_integer) {
+                    if (predictor) {
+                        value = static_cast<T>(value + previous);
+                        previous = value;
+                    }
+                    if (invert) {
+                        value = static_cast<T>(std::numeric_limits<T>::max() - value);
+                    }
+                }
+                std::memcpy(bytes + x * sizeof(T), &value, sizeof(T));
+            }
+        }
+    }
+}
+
+TiffStack::TiffStack() : bigEndian(false) {}
+
+bool TiffStack::readDirectory(size_t offset, Page &page, size_t &next) const {
+    const unsigned char *data = file.getData();
+    size_t fileSize = file.getSize();
+    if (offset + 2 > fileSize) {
+        std::cerr << "Error: A TIFF page directory lies outside the file." << std::endl;
+        return false;
+    }
+    size_t count = readUnsigned(data + offset, 2, bigEndian);
+    if (offset + 2 + count * entrySize + 4 > fileSize) {
+        std::cerr << "Error: A TIFF page directory lies outside the file." << std::endl;
+        return false;
+    }
+
+    // Values of every field this reader uses; fields whose values fit in 4 bytes store them in the entry itself
+    uint32_t width = 0, height = 0, bitsPerSample = 1, compression = noCompression, photometric = 1;
+    uint32_t samplesPerPixel = 1, rowsPerStrip = std::numeric_limits<uint32_t>::max(), predictor = 1;
+    uint32_t tileWidth = 0, tileLength = 0, sampleFormat = 1;
+    std::vector<uint32_t> offsets, byteCounts;
+    for (size_t i = 0; i < count; ++i) {
+        const unsigned char *entry = data + offset + 2 + i * entrySize;
+        uint16_t tag = static_cast<uint16_t>(readUnsigned(entry, 2, bigEndian));
+        uint32_t type = readUnsigned(entry + 2, 2, bigEndian);
+        uint32_t valueCount = readUnsigned(entry + 4, 4, bigEndian);
+        int valueSize = type == 1 ? 1 : type == 3 ? 2 : type == 4 ? 4 : 0;
+        if (valueSize == 0 || valueCount == 0) {
+            continue;
+        }
+        const unsigned char *values = entry + 8;
+        if (static_cast<size_t>(valueCount) * valueSize > 4) {
+            size_t valueOffset = readUnsigned(entry + 8, 4, bigEndian);
+            if (valueOffset + static_cast<size_t>(valueCount) * valueSize > fileSize) {
+                std::cerr << "Error: A TIFF field lies outside the file." << std::endl;
+                return false;
+            }
+            values = data + valueOffset;
+        }
+        uint32_t value = readUnsigned(values, valueSize, bigEndian);
+        switch (tag) {
+            case imageWidthTag: width = value; break;
+            case imageLengthTag: height = value; break;
+            case bitsPerSampleTag: bitsPerSample = value; break;
+            case compressionTag: compression = value; break;
+            case photometricTag: photometric = value; break;
+            case samplesPerPixelTag: samplesPerPixel = value; break;
+            case rowsPerStripTag: rowsPerStrip = value; break;
+            case predictorTag: predictor = value; break;
+            case tileWidthTag: tileWidth = value; break;
+            case tileLengthTag: tileLength = value; break;
+            case sampleFormatTag: sampleFormat = value; break;
+            case stripOffsetsTag:
+            case tileOffsetsTag:
+            case stripByteCountsTag:
+            case tileByteCountsTag: {
+                auto &target = tag == stripOffsetsTag || tag == tileOffsetsTag ? offsets : byteCounts;
+                target.resize(valueCount);
+                for (uint32_t j = 0; j < valueCount; ++j) {
+                    target[j] = readUnsigned(values + static_cast<size_t>(j) * valueSize, valueSize, bigEndian);
+                }
+                break;
+            }
+            default: break;
+        }
+    }
+    next = readUnsigned(data + offset + 2 + count * entrySize, 4, bigEndian);
+
+    if (width == 0 || height == 0 || width > std::numeric_limits<int>::max() ||
+        height > std::numeric_limits<int>::max()) {
+        std::cerr << "Error: A TIFF page has no valid size." << std::endl;
+        return false;
+    }
+    if (samplesPerPixel != 1 || photometric > 1) {
+        std::cerr << "Error: Only grey-scale TIFF pages with one sample per pixel are supported." << std::endl;
+        return false;
+    }
+    if (bitsPerSample == 8 && sampleFormat == 1) {
+        page.dataType = DataType::UInt8;
+    } else if (bitsPerSample == 16 && sampleFormat == 1) {
+        page.dataType = DataType::UInt16;
+    } else if (bitsPerSample == 32 && sampleFormat == 3) {
+        page.dataType = DataType::Float32;
+    } else {
+        std::cerr << "Error: Unsupported TIFF sample format (" << bitsPerSample << " bits, format " << sampleFormat
+                  << "); only unsigned 8-bit, unsigned 16-bit and 32-bit float samples are supported." << std::endl;
+        return false;
+    }
+    if (compression != noCompression && compression != lzwCompression && compression != packBitsCompression) {
+        std::cerr << "Error: Unsupported TIFF compression " << compression
+                  << "; only uncompressed, LZW and PackBits pages are supported." << std::endl;
+        return false;
+    }
+    if (predictor != 1 && (predictor != 2 || page.dataType == DataType::Float32)) {
+        std::cerr << "Error: Unsupported TIFF predictor " << predictor << "." << std::endl;
+        return false;
+    }
+
+    size_t pageBytes = 0;
+    if (!checkedSampleBytes({width, height}, page.dataType, pageBytes)) {
+        std::cerr << "Error: A TIFF page is too large to address." << std::endl;
+        return false;
+    }
+
+    page.width = static_cast<int>(width);
+    page.height = static_cast<int>(height);
+    page.compression = static_cast<int>(compression);
+    page.predictor = predictor == 2;
+    page.whiteIsZero = photometric == 0;
+    size_t segments;
+    if (tileWidth > 0 || tileLength > 0) {
+        if (tileWidth == 0 || tileLength == 0 || tileWidth > 65536 || tileLength > 65536) {
+            std::cerr << "Error: A TIFF page has an invalid tile size." << std::endl;
+            return false;
+        }
+        page.segmentWidth = static_cast<int>(tileWidth);
+        page.segmentHeight = static_cast<int>(tileLength);
+        page.segmentsAcross = static_cast<int>((width + tileWidth - 1) / tileWidth);
+        segments = static_cast<size_t>(page.segmentsAcross) * ((height + tileLength - 1) / tileLength);
+    } else {
+        page.segmentWidth = page.width;
+        page.segmentHeight = static_cast<int>(std::clamp<uint32_t>(rowsPerStrip, 1, height));
+        page.segmentsAcross = 1;
+        segments = (height + page.segmentHeight - 1) / page.segmentHeight;
+    }
+    if (offsets.size() != segments || byteCounts.size() != segments) {
+        std::cerr << "Error: A TIFF page does not locate each of its " << segments << " strips or tiles." << std::endl;
+        return false;
+    }
+    size_t storedBytes = 0;
+    for (size_t i = 0; i < segments; ++i) {
+        if (static_cast<size_t>(offsets[i]) + byteCounts[i] > fileSize) {
+            std::cerr << "Error: A TIFF strip or tile lies outside the file." << std::endl;
+            return false;
+        }
+        storedBytes += byteCounts[i];
+    }
+
+    // The strips or tiles must be able to decode to the whole page, so a forged size is caught before allocating
+    size_t expansion = 1;
+    if (compression == lzwCompression) {
+        expansion = maxLzwExpansion;
+    } else if (compression == packBitsCompression) {
+        expansion = maxPackBitsExpansion;
+    }
+    if (pageBytes / expansion > storedBytes) {
+        std::cerr << "Error: A TIFF page holds too little data for its size." << std::endl;
+        return false;
+    }
+    page.offsets = std::move(offsets);
+    page.byteCounts = std::move(byteCounts);
+    return true;
+}
+
+bool TiffStack::decodeSegment(const Page &page, size_t segment, unsigned char *out,
+                              std::vector<unsigned char> &scratch) const {
+    size_t sampleSize = bytesPerSample(page.dataType);
+    size_t rowBytes = static_cast<size_t>(page.width) * sampleSize;
+    size_t segmentRowBytes = static_cast<size_t>(page.segmentWidth) * sampleSize;
+    size_t x = segment % page.segmentsAcross * page.segmentWidth;
+    size_t y = segment / page.segmentsAcross * page.segmentHeight;
+    size_t rows = std::min<size_t>(page.segmentHeight, page.height - y);
+    size_t columns = std::min<size_t>(page.segmentWidth, page.width - x);
+
+    // Strips and tiles that fit the page are decoded in place; full tiles always hold segmentHeight rows
+    bool inPlace = page.segmentsAcross == 1 && columns == static_cast<size_t>(page.segmentWidth);
+    size_t decodedRows = inPlace ? rows : static_cast<size_t>(page.segmentHeight);
+    size_t decodedSize = decodedRows * segmentRowBytes;
+    unsigned char *decoded = out + y * rowBytes;
+    if (!inPlace) {
+        scratch.resize(decodedSize);
+        decoded = scratch.data();
+    }
+
+    const unsigned char *source = file.getData() + page.offsets[segment];
+    size_t size = page.byteCounts[segment];
+    bool ok;
+    if (page.compression == lzwCompression) {
+        ok = decodeLzw(source, size, decoded, decodedSize);
+    } else if (page.compression == packBitsCompression) {
+        ok = unpackBits(source, size, decoded, decodedSize);
+    } else {
+        ok = size >= decodedSize;
+        if (ok) {
+            std::memcpy(decoded, source, decodedSize);
+        }
+    }
+    if (!ok) {
+        return false;
+    }
+
+    bool swap = bigEndian != (std::endian::native == std::endian::big);
+    if (page.dataType == DataType::UInt8) {
+        finishRows<unsigned char>(decoded, page.segmentWidth, decodedRows, false, page.predictor, page.whiteIsZero);
+    } else if (page.dataType == DataType::UInt16) {
+        finishRows<unsigned short>(decoded, page.segmentWidth, decodedRows, swap, page.predictor, page.whiteIsZero);
+    } else {
+        finishRows<float>(decoded, page.segmentWidth, decodedRows, swap, false, false);
+    }
+    if (!inPlace) {
+        for (size_t row = 0; row < rows; ++row) {
+            std::memcpy(out + (y + row) * rowBytes + x * sampleSize, decoded + row * segmentRowBytes,
+                        columns * sampleSize);
+        }
+    }
+    return true;
+}
+
+bool TiffStack::open(const std::string &path) {
+    pages.clear();
+    if (!file.open(path)) {
+        return false;
+    }
+    const unsigned char *data = file.getData();
+    size_t size = file.getSize();
+    bool valid = size >= 8 && (std::memcmp(data, "II", 2) == 0 || std::memcmp(data, "MM", 2) == 0);
+    bigEndian = valid && data[0] == 'M';
+    if (!valid || readUnsigned(data + 2, 2, bigEndian) != 42) {
+        std::cerr << "Error: " << path << " is not a TIFF file; BigTIFF files are not supported." << std::endl;
+        file.close();
+        return false;
+    }
+
+    // Follow the directory chain, refusing to revisit a directory so that a looping chain cannot hang the reader
+    std::vector<Page> found;
+    std::unordered_set<size_t> visited;
+    for (size_t offset = readUnsigned(data + 4, 4, bigEndian); offset != 0;) {
+        if (!visited.insert(offset).second || found.size() == maxPages) {
+            std::cerr << "Error: The page directories of " << path << " form a loop." << std::endl;
+            file.close();
+            return false;
+        }
+        Page page;
+        size_t next;
+        if (!readDirectory(offset, page, next)) {
+            std::cerr << "Error: Page " << found.size() << " of " << path << " cannot be read." << std::endl;
+            file.close();
+            return false;
+        }
+        found.push_back(std::move(page));
+        offset = next;
+    }
+    if (found.empty()) {
+        std::cerr << "Error: " << path << " has no pages." << std::endl;
+        file.close();
+        return false;
+    }
+    pages = std::move(found);
+    return true;
+}
+
+bool TiffStack::isOpen() const {
+    return !pages.empty();
+}
+
+int TiffStack::getPageCount() const {
+    return static_cast<int>(pages.size());
+}
+
+int TiffStack::getWidth() const {
+    return pages.empty() ? 0 : pages.front().width;
+}
+
+int TiffStack::getHeight() const {
+    return pages.empty() ? 0 : pages.front().height;
+}
+
+DataType TiffStack::getDataType() const {
+    return pages.empty() ? DataType::UInt8 : pages.front().dataType;
+}
+
+bool TiffStack::readPage(int index, unsigned char *out) const {
+    if (index < 0 || index >= getPageCount()) {
+        std::cerr << "Error: TIFF page " << index << " does not exist." << std::endl;
+        return false;
+    }
+    const Page &page = pages[index];
+    std::atomic<bool> failed(false);
+    Parallel::forRange(page.offsets.size(), [&](size_t begin, size_t end) {
+        std::vector<unsigned char> scratch;
+        for (size_t segment = begin; segment < end && !failed.load(std::memory_order_relaxed); ++segment) {
+            if (!decodeSegment(page, segment, out, scratch)) {
+                failed.store(true, std::memory_order_relaxed);
+            }
+        }
+    });
+    if (failed) {
+        std::cerr << "Error: TIFF page " << index << " is corrupt." << std::endl;
+        return false;
+    }
+    return true;
+}
+
+bool TiffStack::load(Volume &volume) const {
+    if (!isOpen()) {
+        std::cerr << "Error: No TIFF file is open." << std::endl;
+        return false;
+    }
+    const Page &first = pages.front();
+    std::vector<size_t> firstSegment(pages.size() + 1, 0);
+    for (size_t i = 0; i < pages.size(); ++i) {
+        if (pages[i].width != first.width || pages[i].height != first.height || pages[i].dataType != first.dataType) {
+            std::cerr << "Error: TIFF page " << i << " differs in size or sample type from the first page."
+                      << std::endl;
+            return false;
+        }
+        firstSegment[i + 1] = firstSegment[i] + pages[i].offsets.size();
+    }
+
+    size_t pageSize = static_cast<size_t>(first.width) * first.height * bytesPerSample(first.dataType);
+    size_t volumeSize = 0;
+    if (!checkedSampleBytes({first.width, first.height, getPageCount()}, first.dataType, volumeSize)) {
+        std::cerr << "Error: The TIFF stack is too large to address." << std::endl;
+        return false;
+    }
+    TRACE_SCOPE("TiffStack::load", "io", volumeSize);
+    Buffer data = BufferPool::global().acquire(volumeSize);
+    unsigned char *out = data.getData();
+
+    // Strips of all pages form one range, so a stack of few pages with many strips still uses every thread
+    std::atomic<bool> failed(false);
+    Parallel::forRange(firstSegment.back(), [&](size_t begin, size_t end) {
+        std::vector<unsigned char> scratch;
+        size_t index = std::upper_bound(firstSegment.begin(), firstSegment.end(), begin) - firstSegment.begin() - 1;
+        for (size_t segment = begin; segment < end && !failed.load(std::memory_order_relaxed); ++segment) {
+            while (segment >= firstSegment[index + 1]) {
+                ++index;
+            }
+            if (!decodeSegment(pages[index], segment - firstSegment[index], out + index * pageSize, scratch)) {
+                failed.store(true, std::memory_order_relaxed);
+            }
+        }
+    });
+    if (failed) {
+        std::cerr << "Error: A strip or tile of the TIFF file is corrupt." << std::endl;
+        return false;
+    }
+    volume = Volume(first.width, first.height, getPageCount(), std::move(data), first.dataType);
+    return true;
+}
@@ -0,0 +1,131 @@
+/**
+ * @file Trace.cpp
+ *
+ * @brief Implements the trace recorder and its Chrome trace export.
+ *
+ * This file stores the events recorded by ScopedTimer in a mutex-protected list, assigns small ids to the threads that
+ * record them, writes them in the Chrome trace event format, and enables tracing at start-up when the MDIP_TRACE
+ * environment variable names an output file.
+ *
+ * @date Created on October 19, 2026
+ *
+ * @authors
+ * Advanced Programming Group Radix Sort:
+ *   - Benjamin Duncan (edsml-bd1023)
+ *   - Boyang Hu (edsml-bh223)
+ *   - Chawk Chamoun (edsml-cc8915)
+ *   - Mingsheng Cai (acse-sc4623)
+ *   - Moyu Zhang (acse-mz223)
+ *   - Ryan Benney (acse-rgb123)
+ */
+
+#include "Trace.h"
+
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <mutex>
+
+std::atomic<bool> Trace::enabled{false};
+
+namespace {
+    // Recorded events and the lock that protects them
+    struct TraceStore {
+        std::mutex mutex;
+        std::vector<TraceEvent> events;
+        std::chrono::steady_clock::time_point epoch = std::chrono::steady_clock::now();
+    };
+
+    TraceStore &store() {
+        static TraceStore instance;
+        return instance;
+    }
+
+    // Enables tracing when MDIP_TRACE is set and writes the trace to that file at exit
+    struct EnvironmentTrace {
+        std::string path;
+
+        EnvironmentTrace() {
+            if (const char *value = std::getenv("MDIP_TRACE"); value && *value) {
+                path = value;
+                Trace::setEnabled(true);
+            }
+        }
+
+        ~EnvironmentTrace() {
+            if (!path.empty() && !Trace::saveChromeTrace(path)) {
+                std::cerr << "Error: Failed to write trace to " << path << std::endl;
+            }
+        }
+    };
+
+    EnvironmentTrace environmentTrace;
+}
+
+void Trace::setEnabled(bool enable) {
+    // Create the store first, so that the epoch precedes every recorded scope
+    store();
+    enabled.store(enable, std::memory_order_relaxed);
+}
+
+void Trace::clear() {
+    std::lock_guard<std::mutex> lock(store().mutex);
+    store().events.clear();
+}
+
+std::vector<TraceEvent> Trace::getEvents() {
+    std::lock_guard<std::mutex> lock(store().mutex);
+    return store().events;
+}
+
+void Trace::record(const TraceEvent &event) {
+    std::lock_guard<std::mutex> lock(store().mutex);
+    store().events.push_back(event);
+}
+
+long long Trace::sinceEpoch(std::chrono::steady_clock::time_point time) {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(time - store().epoch).count();
+}
+
+unsigned int Trace::currentThreadId() {
+    static std::atomic<unsigned int> nextId{0};
+    thread_local unsigned int id = nextId.fetch_add(1);
+    return id;
+}
+
+void Trace::writeChromeTrace(std::ostream &out) {
+    auto events = getEvents();
+    out << "{\"traceEvents\": [";
+    for (size_t i = 0; i < events.size(); ++i) {
+        const auto &event = events[i];
+        // Chrome trace times are in microseconds
+        out << (i ? "," : "") << "\n  {\"name\": \"" << event.name << "\", \"cat\": \"" << event.category
+            << "\", \"ph\": \"X\", \"ts\": " << event.startNs / 1000.0 << ", \"dur\": " << event.durationNs / 1000.0
+            << ", \"pid\": 1, \"tid\": " << event.threadId << ", \"args\": {\"bytes\": " << event.bytes;
+        if (event.durationNs > 0 && event.bytes > 0) {
+            out << ", \"gb_per_s\": " << static_cast<double>(event.bytes) / event.durationNs;
+        }
+        if (event.threads > 0) {
+            out << ", \"threads\": " << event.threads << ", \"utilisation\": " << event.utilisation;
+        }
+        out << "}}";
+    }
+    out << "\n], \"displayTimeUnit\": \"ms\"}\n";
+}
+
+bool Trace::saveChromeTrace(const std::string &path) {
+    std::ofstream file(path);
+    if (!file) {
+        std::cerr << "Error: Unable to open trace file " << path << std::endl;
+        return false;
+    }
+    writeChromeTrace(file);
+    return static_cast<bool>(file);
+}
+
+void ScopedTimer::finish() {
+    auto end = std::chrono::steady_clock::now();
+    Trace::record({name, category, Trace::sinceEpoch(start),
+                   std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count(), bytes,
+                   Trace::currentThreadId(), threads, utilisation});
+}
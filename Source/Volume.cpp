@@ -26,29 +26,111 @@
 #include "Projection.h"
 #include "Slice.h"
 #include "Algorithm.h"
+#include "Trace.h"
+#include "BufferPool.h"
+#include "Parallel.h"
 #include "stb_image.h"
-#include "stb_image_write.h"
+#include "OutputService.h"
 
 #include <iostream>
+#include <mutex>
+#include <atomic>
 #include <filesystem>
 #include <cstring>
 #include <variant>
 #include <algorithm>
+#include <type_traits>
+#include <stdexcept>
+#include <new>
+#include <utility>
 
 #define STB_IMAGE_IMPLEMENTATION
 #define STB_IMAGE_WRITE_IMPLEMENTATION
 
 namespace fs = std::filesystem;
 
+namespace {
+    // Sums the sizes of the files a volume is loaded from, for the trace
+    size_t totalFileSize(const std::vector<std::string> &paths) {
+        size_t total = 0;
+        std::error_code error;
+        for (const auto &path: paths) {
+            auto size = fs::file_size(path, error);
+            total += error ? 0 : static_cast<size_t>(size);
+        }
+        return total;
+    }
+
+    // Converts projected or sliced samples to the 8-bit range used for saving
+    template<typename T>
+    std::vector<unsigned char> toUInt8(const std::vector<T> &samples) {
+        std::vector<unsigned char> converted(samples.size());
+        std::transform(samples.begin(), samples.end(), converted.begin(), DataTypeTraits<T>::toUInt8);
+        return converted;
+    }
+
+    // Calls function with the data cast to its sample type and returns the result as 8-bit samples
+    template<typename Function>
+    std::vector<unsigned char> visitUInt8(DataType type, const unsigned char *data, Function function) {
+        switch (type) {
+            case DataType::UInt16:
+                return toUInt8(function(reinterpret_cast<const unsigned short *>(data)));
+            case DataType::Float32:
+                return toUInt8(function(reinterpret_cast<const float *>(data)));
+            default:
+                return function(data);
+        }
+    }
+}
+
 // Constructors and Destructors
-Volume::Volume() : width(0), height(0), depth(0), data(nullptr) {}
+Volume::Volume() : width(0), height(0), depth(0), doubleBuffering(false), dataType(DataType::UInt8) {}
+
+Volume::Volume(int width, int height, int depth) : width(width), height(height), depth(depth), doubleBuffering(false),
+                                                   dataType(DataType::UInt8) {}
+
+Volume::Volume(int width, int height, int depth, unsigned char *data)
+        : width(width), height(height), depth(depth),
+          data(Buffer::view(data, static_cast<size_t>(width) * height * depth)), doubleBuffering(false),
+          dataType(DataType::UInt8) {}
+
+Volume::Volume(int width, int height, int depth, Buffer &&data, DataType dataType)
+        : width(width), height(height), depth(depth), data(std::move(data)), doubleBuffering(false),
+          dataType(dataType) {
+    size_t bytes = 0;
+    if (!checkedSampleBytes({width, height, depth}, dataType, bytes)) {
+        throw std::invalid_argument("Volume dimensions are negative or too large to address.");
+    }
+    if (this->data.getSize() != bytes) {
+        throw std::invalid_argument("Volume buffer size does not match the volume dimensions.");
+    }
+}
 
-Volume::Volume(int width, int height, int depth) : width(width), height(height), depth(depth), data(nullptr) {}
+Volume::Volume(Volume &&other) noexcept
+        : width(other.width), height(other.height), depth(other.depth), data(std::move(other.data)),
+          spare(std::move(other.spare)), doubleBuffering(other.doubleBuffering), dataType(other.dataType),
+          projectionIndex(std::move(other.projectionIndex)) {
+    other.width = other.height = other.depth = 0;
+    other.clearProjectionIndex();
+}
 
-Volume::Volume(int width, int height, int depth, unsigned char *data) : width(width), height(height), depth(depth),
-                                                                        data(data) {}
+Volume &Volume::operator=(Volume &&other) noexcept {
+    if (this != &other) {
+        width = std::exchange(other.width, 0);
+        height = std::exchange(other.height, 0);
+        depth = std::exchange(other.depth, 0);
+        data = std::move(other.data);
+        spare = std::move(other.spare);
+        doubleBuffering = other.doubleBuffering;
+        dataType = other.dataType;
+        projectionIndex = std::move(other.projectionIndex);
+        other.clearProjectionIndex();
+    }
+    return *this;
+}
 
-Volume::~Volume() {}
+// The buffer releases owned data; views of caller memory are left alone
+Volume::~Volume() = default;
 
 // Getters
 int Volume::getWidth() const {
@@ -64,7 +146,11 @@ int Volume::getDepth() const {
 }
 
 unsigned char *Volume::getData() const {
-    return data; // Return a pointer to the volume's data buffer
+    return data.getData(); // Return a pointer to the volume's data buffer
+}
+
+DataType Volume::getDataType() const {
+    return dataType;
 }
 
 unsigned char Volume::getVoxel(int x, int y, int z) const {
@@ -74,85 +160,216 @@ unsigned char Volume::getVoxel(int x, int y, int z) const {
         return 0;
     }
 
-    // Calculate the index of the voxel in the volume's data array
-    return data[z * width * height + y * width + x];
+    // Calculate the index of the voxel in the volume's data array and convert wider samples to 8 bits
+    size_t index = static_cast<size_t>(z) * width * height + static_cast<size_t>(y) * width + x;
+    switch (dataType) {
+        case DataType::UInt16:
+            return DataTypeTraits<unsigned short>::toUInt8(getDataAs<unsigned short>()[index]);
+        case DataType::Float32:
+            return DataTypeTraits<float>::toUInt8(getDataAs<float>()[index]);
+        default:
+            return data.getData()[index];
+    }
 }
 
 // Setters
 void Volume::setWidth(int width) {
     this->width = width;
+    clearProjectionIndex();
 }
 
 void Volume::setHeight(int height) {
     this->height = height;
+    clearProjectionIndex();
 }
 
 void Volume::setDepth(int depth) {
     this->depth = depth;
+    clearProjectionIndex();
 }
 
 void Volume::updateData(const std::vector<unsigned char> &newData) {
+    assignData(newData.data(), newData.size(), DataType::UInt8);
+}
+
+void Volume::assignData(const void *newData, size_t count, DataType type) {
     // Ensure the new data size matches the volume size
-    if (newData.size() != width * height * depth) {
+    if (count != static_cast<size_t>(width) * height * depth) {
         std::cerr << "Error: New data size does not match the volume size." << std::endl;
         return;
     }
 
-    // Allocate new memory block if data is nullptr or reuse existing memory
-    if (data == nullptr) {
-        data = new unsigned char[newData.size()];
+    clearProjectionIndex();
+
+    // Allocate new memory block if there is no data or the sample size changes, otherwise reuse existing memory
+    if (data.isEmpty() || bytesPerSample(type) != bytesPerSample(dataType)) {
+        data = Buffer(count * bytesPerSample(type));
     }
 
     // Copy the new data into the volume's data array
-    std::copy(newData.begin(), newData.end(), data);
+    std::memcpy(data.getData(), newData, count * bytesPerSample(type));
+    dataType = type;
+}
+
+void Volume::updateData(Buffer &&newData, DataType type) {
+    // Ensure the new data size matches the volume size
+    size_t bytes = 0;
+    if (!checkedSampleBytes({width, height, depth}, type, bytes) || newData.getSize() != bytes) {
+        std::cerr << "Error: New data size does not match the volume size." << std::endl;
+        return;
+    }
+    clearProjectionIndex();
+
+    // Memory owned by the caller must receive the result itself, so copy into it and keep newData as the spare
+    if (!data.isEmpty() && !data.ownsData() && data.getSize() == bytes) {
+        std::memcpy(data.getData(), newData.getData(), bytes);
+        dataType = type;
+        if (doubleBuffering) {
+            spare = std::move(newData);
+        } else {
+            newData.reset();
+        }
+        return;
+    }
+
+    // Otherwise swap the buffers; the old one is kept as the spare or released when newData goes out of scope
+    data.swap(newData);
+    dataType = type;
+    if (doubleBuffering && newData.ownsData()) {
+        spare = std::move(newData);
+    } else {
+        newData.reset();
+    }
+}
+
+Buffer Volume::takeSpareBuffer(DataType type) {
+    size_t bytes = 0;
+    if (!checkedSampleBytes({width, height, depth}, type, bytes)) {
+        throw std::bad_alloc();
+    }
+    if (spare.getSize() == bytes) {
+        return std::move(spare);
+    }
+    spare.reset();
+    return BufferPool::global().acquire(bytes);
+}
+
+void Volume::setDoubleBuffering(bool enabled) {
+    doubleBuffering = enabled;
+    if (!enabled) {
+        spare.reset();
+    }
+}
+
+bool Volume::isDoubleBuffering() const {
+    return doubleBuffering;
+}
+
+void Volume::buildProjectionIndex(int blockSize) {
+    switch (dataType) {
+        case DataType::UInt16:
+            projectionIndex.emplace<ProjectionIndex<unsigned short>>(width, height, depth,
+                                                                     getDataAs<unsigned short>(), blockSize);
+            break;
+        case DataType::Float32:
+            projectionIndex.emplace<ProjectionIndex<float>>(width, height, depth, getDataAs<float>(), blockSize);
+            break;
+        default:
+            projectionIndex.emplace<ProjectionIndex<unsigned char>>(width, height, depth, data.getData(), blockSize);
+            break;
+    }
+}
+
+void Volume::clearProjectionIndex() {
+    projectionIndex.emplace<std::monostate>();
+}
+
+bool Volume::hasProjectionIndex() const {
+    return !std::holds_alternative<std::monostate>(projectionIndex);
 }
 
-bool Volume::loadFromFiles(const std::vector<std::string> &paths) {
+bool Volume::loadFromFiles(const std::vector<std::string> &paths, DataType type) {
     std::cout << "Loading volume from " << paths.size() << " files..." << std::endl;
 
-    depth = paths.size();
-    if (depth == 0) {
+    if (paths.empty()) {
         std::cerr << "Error: No paths provided for volume loading." << std::endl;
         return false;
     }
+    TRACE_SCOPE("Volume::loadFromFiles", "io", Trace::isEnabled() ? totalFileSize(paths) : 0);
 
-    int channels;
-    // Assuming all images have the same size and number of channels
-    data = stbi_load(paths[0].c_str(), &width, &height, &channels, 0);
-    if (!data) {
+    // The first header fixes the size of every slice, so the volume is allocated before any slice is decoded
+    int sliceWidth, sliceHeight, channels;
+    if (!stbi_info(paths[0].c_str(), &sliceWidth, &sliceHeight, &channels)) {
         std::cerr << "Error loading volume slice: " << paths[0] << std::endl;
         return false;
     }
-    size_t sliceSize = width * height * channels;
-    unsigned char *volumeData = (unsigned char *) malloc(sliceSize * depth);
-    if (!volumeData) {
-        std::cerr << "Failed to allocate memory for volume data." << std::endl;
+    int sliceCount = static_cast<int>(paths.size());
+    size_t sliceSize = static_cast<size_t>(sliceWidth) * sliceHeight;
+    size_t volumeBytes = 0;
+    if (!checkedSampleBytes({sliceWidth, sliceHeight, sliceCount}, type, volumeBytes)) {
+        std::cerr << "Error: The volume is too large to load: " << paths[0] << std::endl;
         return false;
     }
-    memcpy(volumeData, data, sliceSize);
-    stbi_image_free(data);
+    Buffer volumeBuffer(volumeBytes);
+    unsigned char *volumeData = volumeBuffer.getData();
+
+    // Each worker decodes one slice at a time straight to a single channel; stb_image reduces colour to luma
+    std::atomic<bool> success = true;
+    std::mutex errorMutex;
+    Parallel::forRange(paths.size(), [&](size_t begin, size_t end) {
+        for (size_t i = begin; i < end && success; ++i) {
+            int decodedWidth, decodedHeight, decodedChannels;
+            void *slice = type == DataType::UInt8
+                          ? static_cast<void *>(stbi_load(paths[i].c_str(), &decodedWidth, &decodedHeight,
+                                                          &decodedChannels, 1))
+                          : static_cast<void *>(stbi_load_16(paths[i].c_str(), &decodedWidth, &decodedHeight,
+                                                             &decodedChannels, 1));
+            if (!slice || decodedWidth != sliceWidth || decodedHeight != sliceHeight) {
+                std::lock_guard<std::mutex> lock(errorMutex);
+                if (!slice) {
+                    std::cerr << "Error loading volume slice: " << paths[i] << std::endl;
+                } else {
+                    std::cerr << "Error: Volume slice " << paths[i] << " does not match the size of the first slice."
+                              << std::endl;
+                }
+                stbi_image_free(slice);
+                success = false;
+                return;
+            }
 
-    for (int i = 1; i < depth; ++i) {
-        data = stbi_load(paths[i].c_str(), &width, &height, &channels, 0);
-        if (!data) {
-            std::cerr << "Error loading volume slice: " << paths[i] << std::endl;
-            free(volumeData);
-            return false;
+            if (type == DataType::Float32) {
+                // Float volumes use the 8-bit intensity scale
+                const auto *samples = static_cast<const unsigned short *>(slice);
+                float *out = reinterpret_cast<float *>(volumeData) + sliceSize * i;
+                for (size_t j = 0; j < sliceSize; ++j) {
+                    out[j] = samples[j] / 257.0f;
+                }
+            } else {
+                size_t sliceBytes = sliceSize * bytesPerSample(type);
+                memcpy(volumeData + sliceBytes * i, slice, sliceBytes);
+            }
+            stbi_image_free(slice);
         }
-        memcpy(volumeData + sliceSize * i, data, sliceSize);
-        stbi_image_free(data);
+    });
+    if (!success) {
+        return false;
     }
 
-    data = volumeData;
-
-    std::cout << "Volume loaded with size " << width << " x " << height << " x " << depth << " with " << channels
-              << " channel(s)." << std::endl;
+    clearProjectionIndex();
+    width = sliceWidth;
+    height = sliceHeight;
+    depth = sliceCount;
+    data = std::move(volumeBuffer);
+    dataType = type;
 
+    const char *typeName = type == DataType::UInt8 ? "8-bit" : (type == DataType::UInt16 ? "16-bit" : "float");
+    std::cout << "Volume loaded with size " << width << " x " << height << " x " << depth << " from " << channels
+              << "-channel slices as " << typeName << " samples." << std::endl;
     return true;
 }
 
 
-bool Volume::loadFromDirectory(const std::string &directoryPath) {
+bool Volume::loadFromDirectory(const std::string &directoryPath, DataType type) {
     std::vector<std::string> paths;
 
     // Iterate over the directory and add the paths of all regular files to the vector
@@ -177,7 +394,47 @@ bool Volume::loadFromDirectory(const std::string &directoryPath) {
     Algorithm::quickSort(paths, 0, paths.size() - 1);
 
     // Use the loadFromFiles member function to load the volume from the collected paths
-    return loadFromFiles(paths);
+    return loadFromFiles(paths, type);
+}
+
+std::vector<unsigned char> Volume::getSliceUInt8(const std::string &plane, int sliceIndex) const {
+    return visitUInt8(dataType, data.getData(), [&](const auto *samples) {
+        return Slice::getPlaneSlice(width, height, depth, samples, plane, sliceIndex);
+    });
+}
+
+std::vector<unsigned char> Volume::getProjectionUInt8(const std::string &projector, int begin, int end) const {
+    // Answer MIP, MinIP and AIP from the slab projection index if one has been built
+    if (hasProjectionIndex() && (projector == "MIP" || projector == "MinIP" || projector == "AIP")) {
+        return std::visit([&](const auto &index) -> std::vector<unsigned char> {
+            if constexpr (std::is_same_v<std::decay_t<decltype(index)>, std::monostate>) {
+                return std::vector<unsigned char>();
+            } else if (projector == "MIP") {
+                return toUInt8(index.maximum(begin, end));
+            } else if (projector == "MinIP") {
+                return toUInt8(index.minimum(begin, end));
+            } else {
+                return toUInt8(index.average(begin, end));
+            }
+        }, projectionIndex);
+    }
+
+    // The range is contiguous in memory, so the projection reads it in place
+    size_t offset = static_cast<size_t>(begin) * width * height * bytesPerSample(dataType);
+    int rangeDepth = end - begin + 1;
+    return visitUInt8(dataType, data.getData() + offset, [&](const auto *samples) {
+        using Sample = std::remove_cvref_t<decltype(*samples)>;
+        if (projector == "MIP") {
+            return Projection::maximumIntensityProjection(width, height, rangeDepth, samples);
+        } else if (projector == "MinIP") {
+            return Projection::minimumIntensityProjection(width, height, rangeDepth, samples);
+        } else if (projector == "AIP") {
+            return Projection::averageIntensityProjection(width, height, rangeDepth, samples);
+        } else if (projector == "MedIP") {
+            return Projection::medianIntensityProjection(width, height, rangeDepth, samples);
+        }
+        return std::vector<Sample>();
+    });
 }
 
 void Volume::save(const std::string &path, const std::string &plane) const {
@@ -187,31 +444,30 @@ void Volume::save(const std::string &path, const std::string &plane) const {
         return;
     }
 
-    // Check if the output directory exists, and create it if it doesn't
-    if (!fs::exists(path)) {
-        if (!fs::create_directories(path)) { // create_directories 无错误时创建多级目录
-            std::cerr << "Error: Failed to create output directory." << std::endl;
-            return;
-        }
+    // Create the output directory unless it is known to exist
+    if (!OutputService::global().ensureDirectory(path)) {
+        return;
     }
 
+    TRACE_SCOPE("Volume::save", "io", static_cast<size_t>(width) * height * depth * bytesPerSample(dataType));
+
     // If no option is provided, save all slices based on the plane
     int numSlices = (plane == "x-y") ? depth : ((plane == "x-z") ? height : ((plane == "y-z") ? width : 0));
 
+    // For x-z, height becomes the number of slices and depth the height of each slice; likewise width for y-z
+    int sliceWidth = (plane == "y-z") ? height : width;
+    int sliceHeight = (plane == "x-y") ? height : depth;
+
+    // Slices are encoded in the background while the next ones are extracted
+    std::vector<std::future<bool>> written;
     for (int i = 1; i <= numSlices; ++i) {
-        auto sliceData = Slice::getPlaneSlice(width, height, depth, data, plane, i);
         std::string fullPath = path + "/slice_" + std::to_string(i) + ".png";
-        if (plane == "x-y") {
-            stbi_write_png(fullPath.c_str(), width, height, 1, sliceData.data(), width);
-        } else if (plane == "x-z") {
-            // For x-z, height becomes the number of slices, width stays the same, and depth is the height of each slice.
-            stbi_write_png(fullPath.c_str(), width, depth, 1, sliceData.data(), width);
-        } else if (plane == "y-z") {
-            // For y-z, width becomes the number of slices, height stays the same, and depth is the height of each slice.
-            stbi_write_png(fullPath.c_str(), height, depth, 1, sliceData.data(), height);
-        }
+        written.push_back(OutputService::global().submitPng(fullPath, sliceWidth, sliceHeight, 1,
+                                                            getSliceUInt8(plane, i)));
+    }
+    for (auto &result: written) {
+        result.wait();
     }
-
 }
 
 void Volume::save(const std::string &path, const std::string &plane, int sliceIndex) const {
@@ -221,12 +477,9 @@ void Volume::save(const std::string &path, const std::string &plane, int sliceIn
         return;
     }
 
-    // Check if the output directory exists, and create it if it doesn't
-    if (!fs::exists(path)) {
-        if (!fs::create_directories(path)) { // create_directories 无错误时创建多级目录
-            std::cerr << "Error: Failed to create output directory." << std::endl;
-            return;
-        }
+    // Create the output directory unless it is known to exist
+    if (!OutputService::global().ensureDirectory(path)) {
+        return;
     }
 
     // Check the slice index
@@ -235,15 +488,19 @@ void Volume::save(const std::string &path, const std::string &plane, int sliceIn
         return;
     }
 
+    TRACE_SCOPE("Volume::save slice", "io", (plane == "x-y" ? static_cast<size_t>(width) * height :
+                                             static_cast<size_t>(plane == "x-z" ? width : height) * depth) *
+                                            bytesPerSample(dataType));
+
     // Save a specific slice
-    auto sliceData = Slice::getPlaneSlice(width, height, depth, data, plane, sliceIndex);
+    auto sliceData = getSliceUInt8(plane, sliceIndex);
     std::string fullPath = path + "/slice_" + std::to_string(sliceIndex) + ".png";
     if (plane == "x-y") {
-        stbi_write_png(fullPath.c_str(), width, height, 1, sliceData.data(), width);
+        OutputService::global().writePng(fullPath, width, height, 1, sliceData.data());
     } else if (plane == "x-z") {
-        stbi_write_png(fullPath.c_str(), width, depth, 1, sliceData.data(), width);
+        OutputService::global().writePng(fullPath, width, depth, 1, sliceData.data());
     } else if (plane == "y-z") {
-        stbi_write_png(fullPath.c_str(), height, depth, 1, sliceData.data(), height);
+        OutputService::global().writePng(fullPath, height, depth, 1, sliceData.data());
     }
 }
 
@@ -261,27 +518,18 @@ void Volume::save(const std::string &path, const std::string &plane, std::string
         return;
     }
 
-    // Check if the output directory exists, and create it if it doesn't
-    if (!fs::exists(path)) {
-        if (!fs::create_directories(path)) { // create_directories 无错误时创建多级目录
-            std::cerr << "Error: Failed to create output directory." << std::endl;
-            return;
-        }
+    // Create the output directory unless it is known to exist
+    if (!OutputService::global().ensureDirectory(path)) {
+        return;
     }
 
+    TRACE_SCOPE("Volume::save projection", "io",
+                static_cast<size_t>(width) * height * depth * bytesPerSample(dataType));
+
     // Save a specific projection in the x-y plane, such as MIP, MinIP, AIP, or MedIP
-    std::vector<unsigned char> projectionData;
-    if (projector == "MIP") {
-        projectionData = Projection::maximumIntensityProjection(width, height, depth, data);
-    } else if (projector == "MinIP") {
-        projectionData = Projection::minimumIntensityProjection(width, height, depth, data);
-    } else if (projector == "AIP") {
-        projectionData = Projection::averageIntensityProjection(width, height, depth, data);
-    } else if (projector == "MedIP") {
-        projectionData = Projection::medianIntensityProjection(width, height, depth, data);
-    }
+    std::vector<unsigned char> projectionData = getProjectionUInt8(projector, 0, depth - 1);
     std::string fullPath = path + "/" + projector + ".png";
-    stbi_write_png(fullPath.c_str(), width, height, 1, projectionData.data(), width);
+    OutputService::global().writePng(fullPath, width, height, 1, projectionData.data());
 }
 
 void Volume::save(const std::string &path, const std::string &plane, const std::string &projector, int begin,
@@ -297,37 +545,20 @@ void Volume::save(const std::string &path, const std::string &plane, const std::
         return;
     }
 
-    if (!fs::exists(path) && !fs::create_directories(path)) {
-        std::cerr << "Error: Failed to create output directory." << std::endl;
+    if (!OutputService::global().ensureDirectory(path)) {
         return;
     }
 
+    TRACE_SCOPE("Volume::save projection range", "io",
+                static_cast<size_t>(width) * height * (end - begin + 1) * bytesPerSample(dataType));
+
     // Adjust begin and end to zero-based indexing for internal use
     begin--;
     end--;
 
-    // Prepare a vector to hold the selected slices' data
-    std::vector<unsigned char> selectedSlicesData((end - begin + 1) * width * height);
-
-    // Copy the data from the specified range
-    for (int i = begin; i <= end; ++i) {
-        std::memcpy(&selectedSlicesData[(i - begin) * width * height], &data[i * width * height], width * height);
-    }
-
-    std::vector<unsigned char> projectionData;
-    if (projector == "MIP") {
-        projectionData = Projection::maximumIntensityProjection(width, height, end - begin + 1,
-                                                                selectedSlicesData.data());
-    } else if (projector == "MinIP") {
-        projectionData = Projection::minimumIntensityProjection(width, height, end - begin + 1,
-                                                                selectedSlicesData.data());
-    } else if (projector == "AIP") {
-        projectionData = Projection::averageIntensityProjection(width, height, end - begin + 1,
-                                                                selectedSlicesData.data());
-    } else if (projector == "MedIP") {
-        projectionData = Projection::medianIntensityProjection(width, height, end - begin + 1,
-                                                               selectedSlicesData.data());
-    } else {
+    // Project the specified range of slices
+    std::vector<unsigned char> projectionData = getProjectionUInt8(projector, begin, end);
+    if (projectionData.empty()) {
         std::cerr << "Invalid projector specified. Valid projectors are 'MIP', 'MinIP', 'AIP', and 'MedIP'."
                   << std::endl;
         return;
@@ -335,5 +566,5 @@ void Volume::save(const std::string &path, const std::string &plane, const std::
 
     std::string fullPath =
             path + "/" + projector + "_range_" + std::to_string(begin + 1) + "_" + std::to_string(end + 1) + ".png";
-    stbi_write_png(fullPath.c_str(), width, height, 1, projectionData.data(), width);
+    OutputService::global().writePng(fullPath, width, height, 1, projectionData.data());
 }
@@ -0,0 +1,494 @@
+/**
+ * @file VolumeFormats.cpp
+ *
+ * @brief Implements the NRRD and NIfTI-1 readers and writers.
+ *
+ * Both readers parse the header into the volume size, sample type, payload location, byte order and encoding, and then
+ * share one payload loader. The loader maps the payload when its byte order matches the host and its offset is a
+ * multiple of the sample size, and otherwise reads or inflates it into a pooled buffer and swaps the byte order if
+ * needed.
+ *
+ * @date Created on October 19, 2026
+ *
+ * @authors
+ * Advanced Programming Group Radix Sort:
+ *   - Benjamin Duncan (edsml-bd1023)
+ *   - Boyang Hu (edsml-bh223)
+ *   - Chawk Chamoun (edsml-cc8915)
+ *   - Mingsheng Cai (acse-sc4623)
+ *   - Moyu Zhang (acse-mz223)
+ *   - Ryan Benney (acse-rgb123)
+ */
+
+#include "VolumeFormats.h"
+#include "BufferPool.h"
+#include "Inflate.h"
+#include "MappedFile.h"
+#include "TiffStack.h"
+#include "Trace.h"
+
+#include <algorithm>
+#include <bit>
+#include <cctype>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <limits>
+#include <map>
+#include <sstream>
+#include <vector>
+
+namespace fs = std::filesystem;
+
+namespace {
+    constexpr size_t niftiHeaderSize = 348; // Size of the NIfTI-1 header
+    constexpr size_t niftiDataOffset = 352; // Header plus the four-byte extension flag
+    constexpr size_t maxDeflateRatio = 1032; // Deflate cannot expand data more than this, so larger claims are corrupt
+
+    // Where and how the samples of a volume file are stored
+    struct Payload {
+        std::string path; // File holding the samples
+        size_t offset = 0; // First byte of the samples
+        bool bigEndian = false; // Byte order of multi-byte samples
+        bool gzip = false; // Whether the samples are gzip-compressed
+    };
+
+    bool endsWith(const std::string &text, const std::string &suffix) {
+        if (text.size() < suffix.size()) {
+            return false;
+        }
+        return std::equal(suffix.rbegin(), suffix.rend(), text.rbegin(), [](char a, char b) {
+            return std::tolower(static_cast<unsigned char>(a)) == b;
+        });
+    }
+
+    std::string trim(const std::string &text) {
+        size_t first = text.find_first_not_of(" \t\r\n");
+        if (first == std::string::npos) {
+            return "";
+        }
+        return text.substr(first, text.find_last_not_of(" \t\r\n") - first + 1);
+    }
+
+    // Reverses the bytes of every sample
+    void swapBytes(unsigned char *data, size_t size, size_t sampleSize) {
+        for (size_t i = 0; i + sampleSize <= size; i += sampleSize) {
+            std::reverse(data + i, data + i + sampleSize);
+        }
+    }
+
+    // Loads the samples of a volume into a buffer the volume can own
+    bool loadPayload(const Payload &payload, size_t size, size_t sampleSize, Buffer &out) {
+        bool swap = sampleSize > 1 && payload.bigEndian != (std::endian::native == std::endian::big);
+
+        if (payload.gzip) {
+            MappedFile file;
+            if (!file.open(payload.path)) {
+                return false;
+            }
+            if (payload.offset > file.getSize()) {
+                std::cerr << "Error: " << payload.path << " ends before its compressed data." << std::endl;
+                return false;
+            }
+            if (size / maxDeflateRatio > file.getSize() - payload.offset) {
+                std::cerr << "Error: The gzip data in " << payload.path << " is too short to hold " << size
+                          << " bytes." << std::endl;
+                return false;
+            }
+            out = BufferPool::global().acquire(size);
+            if (!Inflate::gunzip(file.getData() + payload.offset, file.getSize() - payload.offset, out.getData(),
+                                 size)) {
+                std::cerr << "Error: The gzip data in " << payload.path << " is corrupt or does not hold " << size
+                          << " bytes." << std::endl;
+                return false;
+            }
+        } else if (!swap && payload.offset % sampleSize == 0) {
+            out = MappedFile::mapRange(payload.path, payload.offset, size);
+            return !out.isEmpty();
+        } else {
+            std::error_code error;
+            auto fileSize = fs::file_size(payload.path, error);
+            if (error || payload.offset > fileSize || size > fileSize - payload.offset) {
+                std::cerr << "Error: " << payload.path << " does not hold " << size << " bytes of samples."
+                          << std::endl;
+                return false;
+            }
+            std::ifstream file(payload.path, std::ios::binary);
+            out = BufferPool::global().acquire(size);
+            file.seekg(static_cast<std::streamoff>(payload.offset));
+            if (!file.read(reinterpret_cast<char *>(out.getData()), static_cast<std::streamsize>(size))) {
+                std::cerr << "Error: " << payload.path << " does not hold " << size << " bytes of samples."
+                          << std::endl;
+                return false;
+            }
+        }
+
+        if (swap) {
+            swapBytes(out.getData(), size, sampleSize);
+        }
+        return true;
+    }
+
+    // Writes samples in little-endian byte order
+    void writeLittleEndian(std::ofstream &out, const Volume &volume) {
+        size_t sampleSize = bytesPerSample(volume.getDataType());
+        size_t size = static_cast<size_t>(volume.getWidth()) * volume.getHeight() * volume.getDepth() * sampleSize;
+        if (std::endian::native == std::endian::little || sampleSize == 1) {
+            out.write(reinterpret_cast<const char *>(volume.getData()), static_cast<std::streamsize>(size));
+            return;
+        }
+        std::vector<unsigned char> swapped(volume.getData(), volume.getData() + size);
+        swapBytes(swapped.data(), size, sampleSize);
+        out.write(reinterpret_cast<const char *>(swapped.data()), static_cast<std::streamsize>(size));
+    }
+
+    bool checkVolume(const Volume &volume) {
+        if (!volume.getData() || volume.getWidth() <= 0 || volume.getHeight() <= 0 || volume.getDepth() <= 0) {
+            std::cerr << "Error: Cannot save an empty volume." << std::endl;
+            return false;
+        }
+        return true;
+    }
+
+    // Builds the volume from its payload; false leaves the target unchanged
+    bool finishLoad(const Payload &payload, int width, int height, int depth, DataType type, Volume &volume) {
+        size_t size = 0;
+        if (!checkedSampleBytes({width, height, depth}, type, size)) {
+            std::cerr << "Error: " << payload.path << " describes a volume too large to address." << std::endl;
+            return false;
+        }
+        TRACE_SCOPE("VolumeFormats::load", "io", size);
+        Buffer samples;
+        if (!loadPayload(payload, size, bytesPerSample(type), samples)) {
+            return false;
+        }
+        volume = Volume(width, height, depth, std::move(samples), type);
+        return true;
+    }
+
+    // Little-endian fields of the NIfTI header written by saveNifti
+    template<typename T>
+    void putField(unsigned char *header, size_t offset, T value) {
+        if constexpr (std::endian::native == std::endian::big) {
+            auto *bytes = reinterpret_cast<unsigned char *>(&value);
+            std::reverse(bytes, bytes + sizeof(T));
+        }
+        std::memcpy(header + offset, &value, sizeof(T));
+    }
+
+    // Fields of a NIfTI header in its own byte order
+    template<typename T>
+    T getField(const unsigned char *header, size_t offset, bool swap) {
+        T value;
+        std::memcpy(&value, header + offset, sizeof(T));
+        if (swap) {
+            auto *bytes = reinterpret_cast<unsigned char *>(&value);
+            std::reverse(bytes, bytes + sizeof(T));
+        }
+        return value;
+    }
+}
+
+bool VolumeFormats::load(const std::string &path, Volume &volume) {
+    if (endsWith(path, ".nrrd") || endsWith(path, ".nhdr")) {
+        return loadNrrd(path, volume);
+    }
+    if (endsWith(path, ".nii") || endsWith(path, ".nii.gz")) {
+        return loadNifti(path, volume);
+    }
+    if (endsWith(path, ".tif") || endsWith(path, ".tiff")) {
+        TiffStack stack;
+        return stack.open(path) && stack.load(volume);
+    }
+    std::cerr << "Error: " << path << " is not a .nrrd, .nhdr, .nii, .nii.gz, .tif or .tiff file." << std::endl;
+    return false;
+}
+
+bool VolumeFormats::save(const Volume &volume, const std::string &path) {
+    if (endsWith(path, ".nrrd")) {
+        return saveNrrd(volume, path);
+    }
+    if (endsWith(path, ".nii")) {
+        return saveNifti(volume, path);
+    }
+    std::cerr << "Error: Volumes can only be saved as .nrrd or .nii files, not " << path << "." << std::endl;
+    return false;
+}
+
+bool VolumeFormats::loadNrrd(const std::string &path, Volume &volume) {
+    std::ifstream file(path, std::ios::binary);
+    std::string line;
+    if (!file || !std::getline(file, line) || line.rfind("NRRD000", 0) != 0) {
+        std::cerr << "Error: " << path << " is not a NRRD file." << std::endl;
+        return false;
+    }
+
+    // Fields up to the blank line that ends the header; comments and key/value pairs are skipped
+    std::map<std::string, std::string> fields;
+    while (std::getline(file, line)) {
+        if (!line.empty() && line.back() == '\r') {
+            line.pop_back();
+        }
+        if (line.empty()) {
+            break;
+        }
+        size_t colon = line.find(": ");
+        if (line[0] == '#' || colon == std::string::npos || line.find(":=") != std::string::npos) {
+            continue;
+        }
+        std::string name = line.substr(0, colon);
+        name.erase(std::remove(name.begin(), name.end(), ' '), name.end());
+        fields[name] = trim(line.substr(colon + 2));
+    }
+    std::streamoff headerEnd = file ? static_cast<std::streamoff>(file.tellg()) : -1;
+
+    DataType type;
+    const std::string &typeName = fields["type"];
+    if (typeName == "uchar" || typeName == "unsigned char" || typeName == "uint8" || typeName == "uint8_t") {
+        type = DataType::UInt8;
+    } else if (typeName == "ushort" || typeName == "unsigned short" || typeName == "unsigned short int" ||
+               typeName == "uint16" || typeName == "uint16_t") {
+        type = DataType::UInt16;
+    } else if (typeName == "float") {
+        type = DataType::Float32;
+    } else {
+        std::cerr << "Error: Unsupported NRRD sample type '" << typeName << "' in " << path << "." << std::endl;
+        return false;
+    }
+
+    int dimension = std::atoi(fields["dimension"].c_str());
+    std::istringstream sizeStream(fields["sizes"]);
+    long sizes[3] = {1, 1, 1};
+    for (int i = 0; i < dimension && i < 3; ++i) {
+        sizeStream >> sizes[i];
+    }
+    if ((dimension != 2 && dimension != 3) || !sizeStream || sizes[0] < 1 || sizes[1] < 1 || sizes[2] < 1 ||
+        sizes[0] > std::numeric_limits<int>::max() || sizes[1] > std::numeric_limits<int>::max() ||
+        sizes[2] > std::numeric_limits<int>::max()) {
+        std::cerr << "Error: " << path << " must describe a 2D or 3D NRRD array with positive sizes." << std::endl;
+        return false;
+    }
+
+    Payload payload;
+    const std::string &encoding = fields["encoding"];
+    if (encoding == "gzip" || encoding == "gz") {
+        payload.gzip = true;
+    } else if (encoding != "raw") {
+        std::cerr << "Error: Unsupported NRRD encoding '" << encoding << "' in " << path << "." << std::endl;
+        return false;
+    }
+    payload.bigEndian = fields["endian"] == "big";
+
+    // The samples follow the header unless a detached data file is named
+    std::string dataFile = fields.count("datafile") ? fields["datafile"] : "";
+    if (dataFile.empty()) {
+        if (headerEnd < 0) {
+            std::cerr << "Error: " << path << " has no data after its header." << std::endl;
+            return false;
+        }
+        payload.path = path;
+        payload.offset = static_cast<size_t>(headerEnd);
+    } else {
+        if (dataFile.rfind("LIST", 0) == 0 || dataFile.find('%') != std::string::npos) {
+            std::cerr << "Error: Multi-file NRRD data in " << path << " is not supported." << std::endl;
+            return false;
+        }
+        fs::path dataPath(dataFile);
+        payload.path = (dataPath.is_absolute() ? dataPath : fs::path(path).parent_path() / dataPath).string();
+    }
+
+    // Lines and bytes to skip before the samples; a byte skip of -1 means the samples end the raw file
+    size_t payloadSize = 0;
+    if (!checkedSampleBytes({sizes[0], sizes[1], sizes[2]}, type, payloadSize)) {
+        std::cerr << "Error: " << path << " describes a volume too large to address." << std::endl;
+        return false;
+    }
+    long lineSkip = fields.count("lineskip") ? std::atol(fields["lineskip"].c_str()) : 0;
+    long byteSkip = fields.count("byteskip") ? std::atol(fields["byteskip"].c_str()) : 0;
+    if (lineSkip > 0) {
+        std::ifstream data(payload.path, std::ios::binary);
+        data.seekg(static_cast<std::streamoff>(payload.offset));
+        for (long i = 0; i < lineSkip && std::getline(data, line); ++i) {}
+        if (!data) {
+            std::cerr << "Error: " << payload.path << " ends within its skipped lines." << std::endl;
+            return false;
+        }
+        payload.offset = static_cast<size_t>(data.tellg());
+    }
+    if (byteSkip == -1 && !payload.gzip) {
+        std::error_code error;
+        auto fileSize = fs::file_size(payload.path, error);
+        if (error || fileSize < payloadSize) {
+            std::cerr << "Error: " << payload.path << " is shorter than its samples." << std::endl;
+            return false;
+        }
+        payload.offset = static_cast<size_t>(fileSize) - payloadSize;
+    } else if (byteSkip > 0) {
+        payload.offset += static_cast<size_t>(byteSkip);
+    }
+
+    return finishLoad(payload, static_cast<int>(sizes[0]), static_cast<int>(sizes[1]), static_cast<int>(sizes[2]),
+                      type, volume);
+}
+
+bool VolumeFormats::saveNrrd(const Volume &volume, const std::string &path) {
+    if (!checkVolume(volume)) {
+        return false;
+    }
+    const char *typeName = "uint8";
+    if (volume.getDataType() == DataType::UInt16) {
+        typeName = "uint16";
+    } else if (volume.getDataType() == DataType::Float32) {
+        typeName = "float";
+    }
+    std::ofstream out(path, std::ios::binary | std::ios::trunc);
+    out << "NRRD0004\n"
+        << "# Complete NRRD file format specification at:\n"
+        << "# http://teem.sourceforge.net/nrrd/format.html\n"
+        << "type: " << typeName << "\n"
+        << "dimension: 3\n"
+        << "sizes: " << volume.getWidth() << " " << volume.getHeight() << " " << volume.getDepth() << "\n"
+        << "encoding: raw\n"
+        << "endian: little\n\n";
+    writeLittleEndian(out, volume);
+    if (!out) {
+        std::cerr << "Error: Failed to write " << path << "." << std::endl;
+        return false;
+    }
+    return true;
+}
+
+bool VolumeFormats::loadNifti(const std::string &path, Volume &volume) {
+    Payload payload;
+    payload.path = path;
+    payload.gzip = endsWith(path, ".gz");
+
+    // A compressed file is inflated whole, since its header is compressed too
+    std::vector<unsigned char> inflated;
+    unsigned char header[niftiHeaderSize];
+    if (payload.gzip) {
+        MappedFile file;
+        if (!file.open(path) || !Inflate::gunzip(file.getData(), file.getSize(), inflated) ||
+            inflated.size() < niftiHeaderSize) {
+            std::cerr << "Error: " << path << " is not a valid gzip-compressed NIfTI file." << std::endl;
+            return false;
+        }
+        std::memcpy(header, inflated.data(), niftiHeaderSize);
+    } else {
+        std::ifstream file(path, std::ios::binary);
+        if (!file.read(reinterpret_cast<char *>(header), niftiHeaderSize)) {
+            std::cerr << "Error: " << path << " is too short to be a NIfTI file." << std::endl;
+            return false;
+        }
+    }
+
+    // sizeof_hdr is 348 in the byte order of the file
+    bool swap = getField<int32_t>(header, 0, false) != static_cast<int32_t>(niftiHeaderSize);
+    if (swap && getField<int32_t>(header, 0, true) != static_cast<int32_t>(niftiHeaderSize)) {
+        std::cerr << "Error: " << path << " is not a NIfTI-1 file." << std::endl;
+        return false;
+    }
+    if (std::memcmp(header + 344, "n+1", 4) != 0) {
+        std::cerr << "Error: " << path << " is not a single-file NIfTI-1 image; .hdr/.img pairs are not supported."
+                  << std::endl;
+        return false;
+    }
+    payload.bigEndian = swap != (std::endian::native == std::endian::big);
+
+    int16_t dims[8];
+    for (int i = 0; i < 8; ++i) {
+        dims[i] = getField<int16_t>(header, 40 + 2 * i, swap);
+    }
+    bool validDims = dims[0] >= 2 && dims[0] <= 7;
+    for (int i = 1; validDims && i <= dims[0]; ++i) {
+        validDims = dims[i] >= 1 && (i <= 3 || dims[i] == 1);
+    }
+    if (!validDims) {
+        std::cerr << "Error: " << path << " must hold a 2D or 3D NIfTI image." << std::endl;
+        return false;
+    }
+    int width = dims[1], height = dims[2], depth = dims[0] >= 3 ? dims[3] : 1;
+
+    DataType type;
+    switch (getField<int16_t>(header, 70, swap)) {
+        case 2:
+            type = DataType::UInt8;
+            break;
+        case 512:
+            type = DataType::UInt16;
+            break;
+        case 16:
+            type = DataType::Float32;
+            break;
+        default:
+            std::cerr << "Error: Unsupported NIfTI datatype " << getField<int16_t>(header, 70, swap) << " in " << path
+                      << "; only DT_UINT8, DT_UINT16 and DT_FLOAT32 are supported." << std::endl;
+            return false;
+    }
+
+    float voxOffset = getField<float>(header, 108, swap);
+    if (!(voxOffset >= niftiHeaderSize) || voxOffset > static_cast<float>(std::numeric_limits<int32_t>::max())) {
+        std::cerr << "Error: " << path << " has an invalid data offset." << std::endl;
+        return false;
+    }
+    payload.offset = static_cast<size_t>(voxOffset);
+
+    if (!payload.gzip) {
+        return finishLoad(payload, width, height, depth, type, volume);
+    }
+
+    size_t size = static_cast<size_t>(width) * height * depth * bytesPerSample(type);
+    if (payload.offset > inflated.size() || size > inflated.size() - payload.offset) {
+        std::cerr << "Error: " << path << " does not hold " << size << " bytes of samples." << std::endl;
+        return false;
+    }
+    Buffer samples = BufferPool::global().acquire(size);
+    std::memcpy(samples.getData(), inflated.data() + payload.offset, size);
+    if (payload.bigEndian != (std::endian::native == std::endian::big) && bytesPerSample(type) > 1) {
+        swapBytes(samples.getData(), size, bytesPerSample(type));
+    }
+    volume = Volume(width, height, depth, std::move(samples), type);
+    return true;
+}
+
+bool VolumeFormats::saveNifti(const Volume &volume, const std::string &path) {
+    if (!checkVolume(volume)) {
+        return false;
+    }
+    if (volume.getWidth() > std::numeric_limits<int16_t>::max() ||
+        volume.getHeight() > std::numeric_limits<int16_t>::max() ||
+        volume.getDepth() > std::numeric_limits<int16_t>::max()) {
+        std::cerr << "Error: NIfTI-1 dimensions are limited to 32767 voxels." << std::endl;
+        return false;
+    }
+
+    unsigned char header[niftiDataOffset] = {};
+    putField<int32_t>(header, 0, static_cast<int32_t>(niftiHeaderSize));
+    header[38] = 'r'; // regular
+    const int16_t dims[8] = {3, static_cast<int16_t>(volume.getWidth()), static_cast<int16_t>(volume.getHeight()),
+                             static_cast<int16_t>(volume.getDepth()), 1, 1, 1, 1};
+    for (int i = 0; i < 8; ++i) {
+        putField<int16_t>(header, 40 + 2 * i, dims[i]);
+        putField<float>(header, 76 + 4 * i, 1.0f); // Unit spacing, and qfac 1 in pixdim[0]
+    }
+    int16_t datatype = 2; // DT_UINT8
+    if (volume.getDataType() == DataType::UInt16) {
+        datatype = 512; // DT_UINT16
+    } else if (volume.getDataType() == DataType::Float32) {
+        datatype = 16; // DT_FLOAT32
+    }
+    putField<int16_t>(header, 70, datatype);
+    putField<int16_t>(header, 72, static_cast<int16_t>(8 * bytesPerSample(volume.getDataType())));
+    putField<float>(header, 108, static_cast<float>(niftiDataOffset));
+    std::memcpy(header + 344, "n+1", 4);
+
+    std::ofstream out(path, std::ios::binary | std::ios::trunc);
+    out.write(reinterpret_cast<const char *>(header), niftiDataOffset);
+    writeLittleEndian(out, volume);
+    if (!out) {
+        std::cerr << "Error: Failed to write " << path << "." << std::endl;
+        return false;
+    }
+    return true;
+}
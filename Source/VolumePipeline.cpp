@@ -0,0 +1,227 @@
+/**
+ * @file VolumePipeline.cpp
+ *
+ * @brief Implements the three-stage slab pipeline.
+ *
+ * Decode workers take slab indices from a shared counter and read each slab together with the context slices the
+ * operations need, so slabs are independent and context slices are read by both neighbouring slabs. Each stage closes
+ * the queue it feeds once its last worker finishes, which lets the next stage drain the queue and finish in turn. A
+ * failure closes both queues at once: waiting producers give up, and consumers drop whatever is still queued.
+ *
+ * @date Created on October 19, 2026
+ *
+ * @authors
+ * Advanced Programming Group Radix Sort:
+ *   - Benjamin Duncan (edsml-bd1023)
+ *   - Boyang Hu (edsml-bh223)
+ *   - Chawk Chamoun (edsml-cc8915)
+ *   - Mingsheng Cai (acse-sc4623)
+ *   - Moyu Zhang (acse-mz223)
+ *   - Ryan Benney (acse-rgb123)
+ */
+
+#include "VolumePipeline.h"
+#include "BoundedQueue.h"
+#include "BufferPool.h"
+#include "Trace.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <iostream>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+
+namespace {
+    // A slab of output slices and the input slices around it
+    struct Slab {
+        int begin = 0, end = 0; // Output slices [begin, end)
+        int first = 0; // Index of the first slice held by the volume
+        Volume volume;
+    };
+
+    double secondsSince(std::chrono::steady_clock::time_point start) {
+        return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    }
+}
+
+VolumePipeline::VolumePipeline(const PipelineOptions &options)
+        : options(options), peakSlabs(0), decodeSeconds(0), computeSeconds(0), encodeSeconds(0) {
+    if (options.slabDepth < 1 || options.decodeWorkers < 1 || options.computeWorkers < 1 ||
+        options.encodeWorkers < 1 || options.queueSlabs < 1) {
+        throw std::invalid_argument("Pipeline slab depth, worker counts and queue lengths must be at least 1.");
+    }
+}
+
+VolumePipeline &VolumePipeline::addFilter(IFilter3D &filter) {
+    return addOperation({filter.getReach(), [&filter](Volume &volume, const Region3D &region) {
+        filter.apply(volume, region);
+    }});
+}
+
+VolumePipeline &VolumePipeline::addOperation(const SlabOperation &operation) {
+    if (operation.reach < 0 || !operation.apply) {
+        throw std::invalid_argument("Every pipeline operation needs a non-negative reach and a function.");
+    }
+    operations.push_back(operation);
+    return *this;
+}
+
+bool VolumePipeline::run(const VolumeStream &input, const std::string &outputDirectory) {
+    int width = input.getWidth(), height = input.getHeight(), depth = input.getDepth();
+    if (depth == 0) {
+        std::cerr << "Error: No slices available for the pipeline." << std::endl;
+        return false;
+    }
+    size_t sliceSize = static_cast<size_t>(width) * height;
+    TRACE_SCOPE("VolumePipeline::run", "io", sliceSize * depth * 2);
+
+    int reach = 0;
+    for (const auto &operation: operations) {
+        reach += operation.reach;
+    }
+    int slabs = (depth + options.slabDepth - 1) / options.slabDepth;
+
+    BoundedQueue<Slab> decoded(options.queueSlabs), computed(options.queueSlabs);
+    std::atomic<int> nextSlab(0), decoding(options.decodeWorkers), computing(options.computeWorkers);
+    std::atomic<bool> failed(false);
+    std::mutex mutex; // Guards the counters below
+    int liveSlabs = 0;
+    peakSlabs = 0;
+    decodeSeconds = computeSeconds = encodeSeconds = 0;
+
+    auto fail = [&]() {
+        failed = true;
+        decoded.close();
+        computed.close();
+    };
+    auto hold = [&](int change) {
+        std::lock_guard<std::mutex> lock(mutex);
+        liveSlabs += change;
+        peakSlabs = std::max(peakSlabs, liveSlabs);
+    };
+    auto addTime = [&](double &total, double seconds) {
+        std::lock_guard<std::mutex> lock(mutex);
+        total += seconds;
+    };
+
+    auto decode = [&]() {
+        double busy = 0;
+        for (int s = nextSlab++; s < slabs && !failed; s = nextSlab++) {
+            auto start = std::chrono::steady_clock::now();
+            Slab slab;
+            slab.begin = s * options.slabDepth;
+            slab.end = std::min(depth, slab.begin + options.slabDepth);
+            slab.first = std::max(0, slab.begin - reach);
+            int last = std::min(depth, slab.end + reach);
+            hold(1);
+            Buffer data = BufferPool::global().acquire(sliceSize * (last - slab.first));
+            bool ok = true;
+            for (int z = slab.first; ok && z < last; ++z) {
+                ok = input.readSlice(z, data.getData() + (z - slab.first) * sliceSize);
+            }
+            slab.volume = Volume(width, height, last - slab.first, std::move(data), DataType::UInt8);
+            busy += secondsSince(start);
+            if (!ok) {
+                fail();
+            }
+            // Waits while the compute workers are behind
+            if (!ok || !decoded.push(std::move(slab))) {
+                hold(-1);
+                break;
+            }
+        }
+        addTime(decodeSeconds, busy);
+        if (--decoding == 0) {
+            decoded.close();
+        }
+    };
+
+    auto compute = [&]() {
+        double busy = 0;
+        Slab slab;
+        while (decoded.pop(slab)) {
+            if (!failed) {
+                auto start = std::chrono::steady_clock::now();
+                int last = slab.first + slab.volume.getDepth(), remaining = reach;
+                for (const auto &operation: operations) {
+                    remaining -= operation.reach;
+                    int z0 = std::max(slab.first, slab.begin - remaining), z1 = std::min(last, slab.end + remaining);
+                    operation.apply(slab.volume, {0, 0, z0 - slab.first, width, height, z1 - z0});
+                }
+                busy += secondsSince(start);
+                // Waits while the encode workers are behind
+                if (computed.push(std::move(slab))) {
+                    continue;
+                }
+            }
+            slab = Slab();
+            hold(-1);
+        }
+        addTime(computeSeconds, busy);
+        if (--computing == 0) {
+            computed.close();
+        }
+    };
+
+    auto encode = [&]() {
+        double busy = 0;
+        Slab slab;
+        while (computed.pop(slab)) {
+            auto start = std::chrono::steady_clock::now();
+            for (int z = slab.begin; !failed && z < slab.end; ++z) {
+                const unsigned char *data = slab.volume.getData() + (z - slab.first) * sliceSize;
+                if (!VolumeStream::writeSlice(outputDirectory, z, width, height, data)) {
+                    fail();
+                }
+            }
+            busy += secondsSince(start);
+            slab = Slab();
+            hold(-1);
+        }
+        addTime(encodeSeconds, busy);
+    };
+
+    std::vector<std::thread> workers;
+    for (int i = 0; i < options.decodeWorkers; ++i) {
+        workers.emplace_back(decode);
+    }
+    for (int i = 0; i < options.computeWorkers; ++i) {
+        workers.emplace_back(compute);
+    }
+    for (int i = 1; i < options.encodeWorkers; ++i) {
+        workers.emplace_back(encode);
+    }
+    encode();
+    for (auto &worker: workers) {
+        worker.join();
+    }
+
+    if (failed) {
+        std::cerr << "Error: The pipeline stopped before every slice was written to " << outputDirectory << "."
+                  << std::endl;
+        return false;
+    }
+    return true;
+}
+
+int VolumePipeline::getSlabLimit() const {
+    return options.decodeWorkers + options.computeWorkers + options.encodeWorkers + 2 * options.queueSlabs;
+}
+
+int VolumePipeline::getPeakSlabs() const {
+    return peakSlabs;
+}
+
+double VolumePipeline::getDecodeSeconds() const {
+    return decodeSeconds;
+}
+
+double VolumePipeline::getComputeSeconds() const {
+    return computeSeconds;
+}
+
+double VolumePipeline::getEncodeSeconds() const {
+    return encodeSeconds;
+}
@@ -0,0 +1,131 @@
+/**
+ * @file VolumeStream.cpp
+ *
+ * @brief Implements on-demand slice access for volumes stored as image stacks.
+ *
+ * This file implements the VolumeStream class, which reads individual slices of an image stack only when they are
+ * requested. Opening a stack only inspects the header of the first slice through stbi_info, and each subsequent read
+ * decodes exactly one slice as single-channel data, so the memory used by a stream is independent of the stack depth.
+ *
+ * @date Created on October 19, 2026
+ *
+ * @authors
+ * Advanced Programming Group Radix Sort:
+ *   - Benjamin Duncan (edsml-bd1023)
+ *   - Boyang Hu (edsml-bh223)
+ *   - Chawk Chamoun (edsml-cc8915)
+ *   - Mingsheng Cai (acse-sc4623)
+ *   - Moyu Zhang (acse-mz223)
+ *   - Ryan Benney (acse-rgb123)
+ */
+
+#include "VolumeStream.h"
+#include "Algorithm.h"
+#include "OutputService.h"
+#include "Trace.h"
+#include "stb_image.h"
+
+#include <cstring>
+#include <filesystem>
+#include <iostream>
+
+namespace fs = std::filesystem;
+
+VolumeStream::VolumeStream() : width(0), height(0), depth(0) {}
+
+bool VolumeStream::openFiles(const std::vector<std::string> &paths) {
+    width = height = depth = 0;
+    this->paths.clear();
+
+    if (paths.empty()) {
+        std::cerr << "Error: No paths provided for volume streaming." << std::endl;
+        return false;
+    }
+
+    // Only the header of the first slice is read; all slices are assumed to share its size
+    int channels;
+    if (!stbi_info(paths[0].c_str(), &width, &height, &channels)) {
+        std::cerr << "Error reading volume slice: " << paths[0] << std::endl;
+        width = height = 0;
+        return false;
+    }
+
+    this->paths = paths;
+    depth = static_cast<int>(paths.size());
+    return true;
+}
+
+bool VolumeStream::openDirectory(const std::string &directoryPath) {
+    std::vector<std::string> paths;
+
+    // Iterate over the directory and add the paths of all regular files to the vector
+    try {
+        for (const auto &entry: fs::directory_iterator(directoryPath)) {
+            if (entry.is_regular_file()) {
+                paths.push_back(entry.path().string());
+            }
+        }
+    } catch (const fs::filesystem_error &e) {
+        std::cerr << "Filesystem error: " << e.what() << std::endl;
+        return false;
+    }
+
+    // Make sure at least one image file was found
+    if (paths.empty()) {
+        std::cerr << "Error: No image files found in the provided directory." << std::endl;
+        return false;
+    }
+
+    // Sort the paths the same way as Volume::loadFromDirectory
+    Algorithm::quickSort(paths, 0, paths.size() - 1);
+
+    return openFiles(paths);
+}
+
+int VolumeStream::getWidth() const {
+    return width;
+}
+
+int VolumeStream::getHeight() const {
+    return height;
+}
+
+int VolumeStream::getDepth() const {
+    return depth;
+}
+
+bool VolumeStream::readSlice(int z, unsigned char *out) const {
+    if (z < 0 || z >= depth) {
+        std::cerr << "Error: Slice index out of range for volume stream." << std::endl;
+        return false;
+    }
+    TRACE_SCOPE("VolumeStream::readSlice", "io", static_cast<size_t>(width) * height);
+
+    int sliceWidth, sliceHeight, channels;
+    unsigned char *slice = stbi_load(paths[z].c_str(), &sliceWidth, &sliceHeight, &channels, 1);
+    if (!slice) {
+        std::cerr << "Error loading volume slice: " << paths[z] << std::endl;
+        return false;
+    }
+    if (sliceWidth != width || sliceHeight != height) {
+        std::cerr << "Error: Volume slice " << paths[z] << " does not match the size of the first slice." << std::endl;
+        stbi_image_free(slice);
+        return false;
+    }
+
+    std::memcpy(out, slice, static_cast<size_t>(width) * height);
+    stbi_image_free(slice);
+    return true;
+}
+
+bool VolumeStream::writeSlice(const std::string &directoryPath, int z, int width, int height,
+                              const unsigned char *data) {
+    TRACE_SCOPE("VolumeStream::writeSlice", "io", static_cast<size_t>(width) * height);
+    // Create the output directory unless it is known to exist
+    if (!OutputService::global().ensureDirectory(directoryPath)) {
+        return false;
+    }
+
+    std::string fullPath = directoryPath + "/slice_" + std::to_string(z + 1) + ".png";
+    return OutputService::global().writePng(fullPath, width, height, 1, data);
+}
@@ -30,6 +30,7 @@
 #include <string>
 
 #include "Volume.h"
+#include "FilteredVolume.h"
 #include "Filters/Gaussian3DFilter.h"
 #include "Filters/Median3DFilter.h"
 #include "Filters/PixelFilter.h"
@@ -37,6 +38,8 @@
 #include "Filters/Box2DFilter.h"
 #include "Filters/Gaussian2DFilter.h"
 #include "Filters/EdgeFilter.h"
+#include "ProcessingClient.h"
+#include "ProcessingServer.h"
 
 #define STB_IMAGE_WRITE_IMPLEMENTATION
 
@@ -48,7 +51,49 @@
 
 namespace fs = std::filesystem;
 
-int main() {
+// Runs "--serve <socket> [workers]" or "--request <socket> <request> [output.png]"; returns the exit code
+int runCommand(int argc, char *argv[]) {
+    std::string mode = argv[1];
+    if (mode == "--serve" && (argc == 3 || argc == 4)) {
+        try {
+            ProcessingServer server(argv[2], argc == 4 ? std::stoi(argv[3]) : 4);
+            return server.run() ? 0 : 1;
+        } catch (const std::exception &exception) {
+            std::cerr << "Error: " << exception.what() << std::endl;
+            return 1;
+        }
+    }
+    if (mode == "--request" && (argc == 4 || argc == 5)) {
+        ProcessingClient client;
+        ProcessingResponse response;
+        if (!client.connect(argv[2]) || !client.request(argv[3], response)) {
+            return 1;
+        }
+        if (!response.ok) {
+            std::cerr << "Error: " << response.error << std::endl;
+            return 1;
+        }
+        if (response.channels == 0) {
+            std::cout << (response.data.empty() ? "OK" : std::string(response.data.begin(), response.data.end()))
+                      << std::endl;
+        } else if (argc == 5) {
+            stbi_write_png(argv[4], response.width, response.height, response.channels, response.data.data(),
+                           response.width * response.channels);
+            std::cout << "Saved " << response.width << "x" << response.height << " result to " << argv[4] << std::endl;
+        } else {
+            std::cout << "OK " << response.width << "x" << response.height << "x" << response.channels << std::endl;
+        }
+        return 0;
+    }
+    std::cerr << "Usage: " << argv[0]
+              << " [--serve <socket> [workers] | --request <socket> \"<request>\" [output.png]]" << std::endl;
+    return 1;
+}
+
+int main(int argc, char *argv[]) {
+    if (argc > 1) {
+        return runCommand(argc, argv);
+    }
     std::cout << "Welcome to the Data Processing Program!" << std::endl;
     std::cout << "Please select the operation you want to perform:" << std::endl;
     std::cout << "1. Process 2D image data" << std::endl;
@@ -298,8 +343,7 @@ int main() {
                     // Create a Gaussian3DFilter object
                     Gaussian3DFilter filter(sigma, kernelSize);
 
-                    // Apply filter to the volume data
-                    filter.apply(volume);
+                    // The filter is applied once the output is known, so a single slice only filters its neighbours
 
                     std::cout << "Please select the operation you want to perform:" << std::endl;
                     std::cout << "1. Save filtered data as 2D images" << std::endl;
@@ -333,7 +377,8 @@ int main() {
                                 return 1;
                             }
 
-                            // Save the filtered volume data as a series of 2D images
+                            // Apply filter to the volume data and save it as a series of 2D images
+                            filter.apply(volume);
                             volume.save(outputDir, plane);
 
                             std::cout << "Volume processing and saving completed." << std::endl;
@@ -369,8 +414,8 @@ int main() {
                             std::cout << "Please enter the slice index to save:" << std::endl;
                             std::cin >> sliceIndex;
 
-                            // Save the filtered volume data slice
-                            volume.save(outputDir, plane, sliceIndex);
+                            // Filter and save only the requested slice
+                            FilteredVolume(volume).addFilter(filter).save(outputDir, plane, sliceIndex);
 
                             std::cout << "Volume processing and saving completed." << std::endl;
 
@@ -389,18 +434,22 @@ int main() {
                             std::cout << "Please enter the directory path to save the projection images:" << std::endl;
                             std::cin >> outputDir;
 
+                            // Project the filtered volume; MIP, MinIP and AIP are computed without storing it
+                            FilteredVolume filtered(volume);
+                            filtered.addFilter(filter);
+
                             switch (choice) {
                                 case 1:
-                                    volume.save(outputDir, "x-y", "MIP");
+                                    filtered.save(outputDir, "x-y", "MIP");
                                     break;
                                 case 2:
-                                    volume.save(outputDir, "x-y", "MinIP");
+                                    filtered.save(outputDir, "x-y", "MinIP");
                                     break;
                                 case 3:
-                                    volume.save(outputDir, "x-y", "AIP");
+                                    filtered.save(outputDir, "x-y", "AIP");
                                     break;
                                 case 4:
-                                    volume.save(outputDir, "x-y", "MedIP");
+                                    filtered.save(outputDir, "x-y", "MedIP");
                                     break;
                                 default:
                                     std::cerr << "Error: Invalid choice." << std::endl;
@@ -428,8 +477,7 @@ int main() {
                     // Create a Median3DFilter object
                     Median3DFilter medianFilter(kernelSize);
 
-                    // Apply filter to the volume data
-                    medianFilter.apply(volume);
+                    // The filter is applied once the output is known, so a single slice only filters its neighbours
 
                     std::cout << "Please select the operation you want to perform:" << std::endl;
                     std::cout << "1. Save filtered data as 2D images" << std::endl;
@@ -463,7 +511,8 @@ int main() {
                                 return 1;
                             }
 
-                            // Save the filtered volume data as a series of 2D images
+                            // Apply filter to the volume data and save it as a series of 2D images
+                            medianFilter.apply(volume);
                             volume.save(outputDir, plane);
 
                             std::cout << "Volume processing and saving completed." << std::endl;
@@ -499,8 +548,8 @@ int main() {
                             std::cout << "Please enter the slice index to save:" << std::endl;
                             std::cin >> sliceIndex;
 
-                            // Save the filtered volume data slice
-                            volume.save(outputDir, plane, sliceIndex);
+                            // Filter and save only the requested slice
+                            FilteredVolume(volume).addFilter(medianFilter).save(outputDir, plane, sliceIndex);
 
                             std::cout << "Volume processing and saving completed." << std::endl;
 
@@ -519,18 +568,22 @@ int main() {
                             std::cout << "Please enter the directory path to save the projection images:" << std::endl;
                             std::cin >> outputDir;
 
+                            // Project the filtered volume; MIP, MinIP and AIP are computed without storing it
+                            FilteredVolume filtered(volume);
+                            filtered.addFilter(medianFilter);
+
                             switch (choice) {
                                 case 1:
-                                    volume.save(outputDir, "x-y", "MIP");
+                                    filtered.save(outputDir, "x-y", "MIP");
                                     break;
                                 case 2:
-                                    volume.save(outputDir, "x-y", "MinIP");
+                                    filtered.save(outputDir, "x-y", "MinIP");
                                     break;
                                 case 3:
-                                    volume.save(outputDir, "x-y", "AIP");
+                                    filtered.save(outputDir, "x-y", "AIP");
                                     break;
                                 case 4:
-                                    volume.save(outputDir, "x-y", "MedIP");
+                                    filtered.save(outputDir, "x-y", "MedIP");
                                     break;
                                 default:
                                     std::cerr << "Error: Invalid choice." << std::endl;
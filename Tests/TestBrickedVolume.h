@@ -0,0 +1,179 @@
+/**
+ * @file TestBrickedVolume.h
+ *
+ * @brief Unit Tests for the BrickedVolume Class.
+ *
+ * This header file defines the TestBrickedVolume class, which checks that the bricked storage layout is a faithful copy
+ * of the linear Volume layout. The tests cover round-trip conversion for both brick orders, volumes whose dimensions are
+ * not multiples of the brick size, and that the brick-aware Slice, Projection, Gaussian3DFilter and Median3DFilter code
+ * paths produce exactly the same results as their linear counterparts.
+ *
+ * Usage:
+ * As an extension of the Test base class, the TestBrickedVolume class implements the runTests method to execute all test
+ * cases through the Test class's runTest template method.
+ *
+ * @date Created on October 19, 2026.
+ *
+ * @authors
+ * Advanced Programming Group Radix Sort:
+ *   - Benjamin Duncan (edsml-bd1023)
+ *   - Boyang Hu (edsml-bh223)
+ *   - Chawk Chamoun (edsml-cc8915)
+ *   - Mingsheng Cai (acse-sc4623)
+ *   - Moyu Zhang (acse-mz223)
+ *   - Ryan Benney (acse-rgb123)
+ */
+
+#pragma once
+
+#include "Test.h"
+#include "BrickedVolume.h"
+#include "Slice.h"
+#include "Projection.h"
+#include "Filters/Gaussian3DFilter.h"
+#include "Filters/Median3DFilter.h"
+
+#include <vector>
+#include <cassert>
+#include <stdexcept>
+
+class TestBrickedVolume : public Test {
+private:
+    static constexpr int width = 37, height = 21, depth = 19; // Deliberately not multiples of the brick size
+
+    /**
+     * Generates Pseudo-Random Volume Data
+     *
+     * Fills a buffer with a deterministic pseudo-random pattern so that every voxel differs from its neighbours and any
+     * layout mistake shows up as a mismatch.
+     *
+     * @return A vector of width * height * depth voxels in z-major order.
+     */
+    std::vector<unsigned char> generateData() const {
+        std::vector<unsigned char> data(width * height * depth);
+        unsigned int state = 12345;
+        for (auto &value: data) {
+            state = state * 1103515245u + 12345u;
+            value = static_cast<unsigned char>(state >> 16);
+        }
+        return data;
+    }
+
+public:
+    /**
+     * Tests Round-Trip Conversion for Both Brick Orders
+     *
+     * Converts a linear volume to the bricked layout and back, checking that every voxel is preserved and that getVoxel
+     * agrees with the linear data.
+     */
+    void testRoundTrip() {
+        auto data = generateData();
+        Volume volume(width, height, depth, data.data());
+
+        for (BrickOrder order: {BrickOrder::Linear, BrickOrder::Morton}) {
+            BrickedVolume bricked(volume, 8, order);
+            assert(bricked.getBricksX() == 5 && bricked.getBricksY() == 3 && bricked.getBricksZ() == 3);
+            assert(bricked.toLinear() == data && "Round trip through the bricked layout changed the data.");
+            assert(bricked.getVoxel(36, 20, 18) == data.back() && "getVoxel returned the wrong value.");
+            assert(bricked.getVoxel(9, 3, 17) == data[(17 * height + 3) * width + 9] && "getVoxel returned the wrong value.");
+        }
+    }
+
+    /**
+     * Tests Brick-Aware Slicing
+     *
+     * Checks that slices extracted from a bricked volume match the slices of the linear volume on every plane.
+     */
+    void testSlices() {
+        auto data = generateData();
+        BrickedVolume bricked(Volume(width, height, depth, data.data()), 8);
+
+        for (int z = 1; z <= depth; z += 6) {
+            assert(Slice::getPlaneSlice(bricked, "x-y", z) ==
+                   Slice::getPlaneSlice(width, height, depth, data.data(), "x-y", z));
+        }
+        for (int y = 1; y <= height; y += 5) {
+            assert(Slice::getPlaneSlice(bricked, "x-z", y) ==
+                   Slice::getPlaneSlice(width, height, depth, data.data(), "x-z", y));
+        }
+        for (int x = 1; x <= width; x += 9) {
+            assert(Slice::getPlaneSlice(bricked, "y-z", x) ==
+                   Slice::getPlaneSlice(width, height, depth, data.data(), "y-z", x));
+        }
+        assert(Slice::getPlaneSlice(bricked, "y-z", width + 1).empty() && "Out of range slice should be empty.");
+    }
+
+    /**
+     * Tests Brick-Aware Projections
+     *
+     * Checks that all four intensity projections of a bricked volume match the linear projections.
+     */
+    void testProjections() {
+        auto data = generateData();
+        BrickedVolume bricked(Volume(width, height, depth, data.data()), 8);
+
+        assert(Projection::maximumIntensityProjection(bricked) ==
+               Projection::maximumIntensityProjection(width, height, depth, data.data()));
+        assert(Projection::minimumIntensityProjection(bricked) ==
+               Projection::minimumIntensityProjection(width, height, depth, data.data()));
+        assert(Projection::averageIntensityProjection(bricked) ==
+               Projection::averageIntensityProjection(width, height, depth, data.data()));
+        assert(Projection::medianIntensityProjection(bricked) ==
+               Projection::medianIntensityProjection(width, height, depth, data.data()));
+    }
+
+    /**
+     * Tests the Brick-Aware 3D Filters
+     *
+     * Applies Gaussian3DFilter and Median3DFilter to both layouts and checks that the results are identical.
+     */
+    void testFilters() {
+        auto data = generateData();
+
+        auto linearData = data;
+        Volume linear(width, height, depth, linearData.data());
+        BrickedVolume bricked(linear, 8);
+        Gaussian3DFilter gaussian(1.5, 5);
+        gaussian.apply(linear);
+        gaussian.apply(bricked);
+        assert(bricked.toLinear() == std::vector<unsigned char>(linear.getData(), linear.getData() + data.size()) &&
+               "Bricked Gaussian filter differs from the linear result.");
+
+        linearData = data;
+        Volume linearMedian(width, height, depth, linearData.data());
+        BrickedVolume brickedMedian(linearMedian, 8, BrickOrder::Linear);
+        Median3DFilter median(3);
+        median.apply(linearMedian);
+        median.apply(brickedMedian);
+        assert(brickedMedian.toLinear() ==
+               std::vector<unsigned char>(linearMedian.getData(), linearMedian.getData() + data.size()) &&
+               "Bricked median filter differs from the linear result.");
+    }
+
+    /**
+     * Tests Rejection of Invalid Brick Sizes
+     *
+     * Ensures that a brick size that is not a power of two is rejected.
+     */
+    void testInvalidBrickSize() {
+        try {
+            BrickedVolume bricked(8, 8, 8, 24);
+            assert(false && "BrickedVolume accepted a brick size that is not a power of two.");
+        } catch (const std::invalid_argument &) {
+            // Expected
+        }
+    }
+
+    /**
+     * Runs the BrickedVolume Unit Tests
+     *
+     * Executes all the unit tests for the BrickedVolume class and the brick-aware code paths that use it.
+     */
+    virtual void runTests() override {
+        runTest<TestBrickedVolume>(&TestBrickedVolume::testRoundTrip, "Bricked Volume Round Trip");
+        runTest<TestBrickedVolume>(&TestBrickedVolume::testSlices, "Bricked Volume Slices");
+        runTest<TestBrickedVolume>(&TestBrickedVolume::testProjections, "Bricked Volume Projections");
+        runTest<TestBrickedVolume>(&TestBrickedVolume::testFilters, "Bricked Volume 3D Filters");
+        runTest<TestBrickedVolume>(&TestBrickedVolume::testInvalidBrickSize, "Bricked Volume Invalid Brick Size");
+    }
+};
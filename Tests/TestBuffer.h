@@ -0,0 +1,181 @@
+/**
+ * @file TestBuffer.h
+ *
+ * @brief Unit Tests for the Buffer class and the move semantics of Image and Volume.
+ *
+ * This header file defines the TestBuffer class, which verifies that buffers allocated by the class are aligned, that
+ * adopted memory is released exactly once with its own deleter while views never release anything, that moving and
+ * swapping buffers exchanges ownership without copying, and that images and volumes can be moved and returned by value.
+ *
+ * Usage:
+ * As an extension of the Test base class, the TestBuffer class implements the runTests method to execute all test cases
+ * through the Test class's runTest template method.
+ *
+ * @date Created on October 19, 2026.
+ *
+ * @authors
+ * Advanced Programming Group Radix Sort:
+ *   - Benjamin Duncan (edsml-bd1023)
+ *   - Boyang Hu (edsml-bh223)
+ *   - Chawk Chamoun (edsml-cc8915)
+ *   - Mingsheng Cai (acse-sc4623)
+ *   - Moyu Zhang (acse-mz223)
+ *   - Ryan Benney (acse-rgb123)
+ */
+
+#pragma once
+
+#include "Test.h"
+#include "Buffer.h"
+#include "Image.h"
+#include "Volume.h"
+
+#include <cassert>
+#include <cstdint>
+#include <cstring>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+class TestBuffer : public Test {
+private:
+    static inline int released = 0; // Number of calls to countingDeleter
+
+    /**
+     * Releases new[] memory and counts the call
+     */
+    static void countingDeleter(void *data) {
+        ++released;
+        delete[] static_cast<unsigned char *>(data);
+    }
+
+    /**
+     * Builds a Volume Holding a Ramp and Returns It by Value
+     */
+    static Volume makeRamp(int width, int height, int depth) {
+        Buffer buffer(static_cast<size_t>(width) * height * depth);
+        for (size_t i = 0; i < buffer.getSize(); ++i) {
+            buffer.getData()[i] = static_cast<unsigned char>(i);
+        }
+        return Volume(width, height, depth, std::move(buffer));
+    }
+
+public:
+    /**
+     * Tests Aligned Allocation
+     */
+    void testAlignedAllocation() {
+        for (size_t size: {1, 63, 64, 1000, 1 << 20}) {
+            Buffer buffer(size);
+            assert(buffer.getSize() == size && "Buffer has the wrong size.");
+            assert(buffer.ownsData() && "Allocated buffer must own its memory.");
+            assert(reinterpret_cast<std::uintptr_t>(buffer.getData()) % Buffer::alignment == 0 &&
+                   "Buffer is not aligned to 64 bytes.");
+        }
+        Buffer empty(0);
+        assert(empty.isEmpty() && !empty.ownsData() && "Zero-sized buffer must be empty.");
+    }
+
+    /**
+     * Tests That Adopted Memory Is Released Once and Views Are Never Released
+     */
+    void testOwnershipAndViews() {
+        released = 0;
+        {
+            Buffer owner(new unsigned char[16], 16, countingDeleter);
+            Buffer moved(std::move(owner));
+            assert(owner.isEmpty() && !owner.ownsData() && "Moved-from buffer must be empty.");
+            assert(moved.getSize() == 16 && moved.ownsData() && "Move did not transfer ownership.");
+            Buffer assigned;
+            assigned = std::move(moved);
+            assert(released == 0 && "Memory released while still owned.");
+        }
+        assert(released == 1 && "Adopted memory must be released exactly once.");
+
+        std::vector<unsigned char> storage(32, 7);
+        {
+            Buffer view = Buffer::view(storage.data(), storage.size());
+            assert(!view.ownsData() && view.getData() == storage.data() && "View must refer to the caller's memory.");
+        }
+        assert(storage[0] == 7 && "View must not touch the caller's memory.");
+
+        // Reassigning an owning buffer releases its previous memory
+        released = 0;
+        Buffer first(new unsigned char[4], 4, countingDeleter);
+        first = Buffer(8);
+        assert(released == 1 && first.getSize() == 8 && "Assignment did not release the previous memory.");
+    }
+
+    /**
+     * Tests That Swapping Exchanges Pointers Without Copying
+     */
+    void testSwap() {
+        Buffer a(10), b(20);
+        unsigned char *pointerA = a.getData(), *pointerB = b.getData();
+        a.swap(b);
+        assert(a.getData() == pointerB && a.getSize() == 20 && "Swap did not exchange the first buffer.");
+        assert(b.getData() == pointerA && b.getSize() == 10 && "Swap did not exchange the second buffer.");
+    }
+
+    /**
+     * Tests Moving Images and Handing Them a Buffer
+     */
+    void testImageMove() {
+        unsigned char pixels[6] = {1, 2, 3, 4, 5, 6};
+        Image source(3, 2, 1, pixels);
+        unsigned char *data = source.getData();
+
+        Image moved(std::move(source));
+        assert(moved.getData() == data && moved.getWidth() == 3 && moved.getHeight() == 2 && "Image move failed.");
+        assert(source.getData() == nullptr && source.getWidth() == 0 && "Moved-from image must be empty.");
+
+        Image assigned;
+        assigned = std::move(moved);
+        assert(assigned.getData() == data && assigned.getData()[5] == 6 && "Image move assignment failed.");
+
+        Buffer replacement(6);
+        std::memset(replacement.getData(), 9, 6);
+        unsigned char *replacementData = replacement.getData();
+        assigned.updateData(std::move(replacement), DataType::UInt8);
+        assert(assigned.getData() == replacementData && replacement.isEmpty() && "Image did not take the buffer.");
+    }
+
+    /**
+     * Tests Returning Volumes by Value and Moving Them
+     */
+    void testVolumeMove() {
+        Volume volume = makeRamp(4, 3, 2);
+        assert(volume.getWidth() == 4 && volume.getDepth() == 2 && "Returned volume has the wrong size.");
+        assert(volume.getVoxel(1, 2, 1) == 12 + 8 + 1 && "Returned volume has the wrong data.");
+
+        unsigned char *data = volume.getData();
+        Volume moved;
+        moved = std::move(volume);
+        assert(moved.getData() == data && volume.getData() == nullptr && "Volume move assignment failed.");
+
+        bool threw = false;
+        try {
+            Volume wrong(4, 4, 4, Buffer(10));
+        } catch (const std::invalid_argument &) {
+            threw = true;
+        }
+        assert(threw && "Mismatched buffer size must be rejected.");
+
+        // Volumes over caller memory still write their results into it
+        std::vector<unsigned char> storage(8, 0);
+        Volume view(2, 2, 2, storage.data());
+        view.updateData(std::vector<unsigned char>(8, 5));
+        assert(storage[7] == 5 && "Volume over caller memory must update it in place.");
+    }
+
+    /**
+     * Runs the Buffer Unit Tests
+     */
+    virtual void runTests() override {
+        runTest<TestBuffer>(&TestBuffer::testAlignedAllocation, "Buffer Aligned Allocation");
+        runTest<TestBuffer>(&TestBuffer::testOwnershipAndViews, "Buffer Ownership and Views");
+        runTest<TestBuffer>(&TestBuffer::testSwap, "Buffer Swap");
+        runTest<TestBuffer>(&TestBuffer::testImageMove, "Image Move");
+        runTest<TestBuffer>(&TestBuffer::testVolumeMove, "Volume Move");
+    }
+};
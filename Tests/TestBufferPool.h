@@ -0,0 +1,177 @@
+/**
+ * @file TestBufferPool.h
+ *
+ * @brief Unit Tests for the BufferPool class.
+ *
+ * This header file defines the TestBufferPool class, which verifies the size classes of the pool, that released buffers
+ * are handed out again and counted as hits, that the cache limit is respected, that concurrent threads can share a pool,
+ * and that filtering same-sized inputs one after another reuses the memory of the shared pool.
+ *
+ * Usage:
+ * As an extension of the Test base class, the TestBufferPool class implements the runTests method to execute all test
+ * cases through the Test class's runTest template method.
+ *
+ * @date Created on October 19, 2026.
+ *
+ * @authors
+ * Advanced Programming Group Radix Sort:
+ *   - Benjamin Duncan (edsml-bd1023)
+ *   - Boyang Hu (edsml-bh223)
+ *   - Chawk Chamoun (edsml-cc8915)
+ *   - Mingsheng Cai (acse-sc4623)
+ *   - Moyu Zhang (acse-mz223)
+ *   - Ryan Benney (acse-rgb123)
+ */
+
+#pragma once
+
+#include "Test.h"
+#include "BufferPool.h"
+#include "Volume.h"
+#include "Filters/Gaussian3DFilter.h"
+
+#include <cassert>
+#include <cstdint>
+#include <limits>
+#include <new>
+#include <thread>
+#include <vector>
+
+class TestBufferPool : public Test {
+public:
+    /**
+     * Tests the Rounding of Sizes to Size Classes
+     */
+    void testSizeClasses() {
+        assert(BufferPool::sizeClass(1) == 4096 && "Small sizes must use the smallest class.");
+        assert(BufferPool::sizeClass(4096) == 4096 && "A class size must map to itself.");
+        assert(BufferPool::sizeClass(4097) == 5120 && "Sizes must round up to a quarter step.");
+        assert(BufferPool::sizeClass(8192) == 8192 && "Powers of two must map to themselves.");
+        for (size_t size = 4097; size < (1 << 22); size = size * 3 / 2 + 1) {
+            size_t capacity = BufferPool::sizeClass(size);
+            assert(capacity >= size && capacity * 4 <= size * 5 && "Size class wastes more than a fifth.");
+        }
+
+        // The largest class is 7/8 of the address space; rounding anything above it up would wrap around
+        size_t largest = size_t{7} << (std::numeric_limits<size_t>::digits - 3);
+        assert(BufferPool::sizeClass(largest - 1) == largest && "The largest class must be reachable.");
+        bool rejected = false;
+        try {
+            BufferPool::sizeClass(largest + 1);
+        } catch (const std::bad_alloc &) {
+            rejected = true;
+        }
+        assert(rejected && "A size class wrapped around.");
+
+        BufferPool pool;
+        rejected = false;
+        try {
+            Buffer buffer = pool.acquire(std::numeric_limits<size_t>::max() - 10);
+        } catch (const std::bad_alloc &) {
+            rejected = true;
+        }
+        assert(rejected && pool.getStats().bytesInUse == 0 && "An oversized request did not fail cleanly.");
+    }
+
+    /**
+     * Tests That Released Buffers Are Reused and Counted
+     */
+    void testReuseAndStats() {
+        BufferPool pool;
+        unsigned char *first;
+        {
+            Buffer buffer = pool.acquire(100000);
+            first = buffer.getData();
+            assert(buffer.getSize() == 100000 && buffer.ownsData() && "Pooled buffer has the wrong size.");
+            assert(reinterpret_cast<std::uintptr_t>(first) % Buffer::alignment == 0 && "Pooled buffer is not aligned.");
+        }
+        BufferPoolStats stats = pool.getStats();
+        assert(stats.requests == 1 && stats.hits == 0 && stats.bytesInUse == 0 && "Wrong stats after first release.");
+        assert(stats.bytesCached == BufferPool::sizeClass(100000) && "Released buffer was not cached.");
+
+        // A request of another size in the same class reuses the block
+        Buffer second = pool.acquire(99000);
+        assert(second.getData() == first && "Released block was not reused.");
+        Buffer third = pool.acquire(100000);
+        assert(third.getData() != first && "A block must not be handed out twice.");
+
+        stats = pool.getStats();
+        assert(stats.requests == 3 && stats.hits == 1 && "Wrong hit count.");
+        assert(stats.hitRate() > 0.3 && stats.hitRate() < 0.34 && "Wrong hit rate.");
+        assert(stats.peakBytesInUse == 2 * BufferPool::sizeClass(100000) && "Wrong peak usage.");
+        assert(stats.bytesCached == 0 && "Cached bytes not updated on reuse.");
+    }
+
+    /**
+     * Tests the Cache Limit and Trimming
+     */
+    void testCacheLimit() {
+        BufferPool pool(0);
+        {
+            Buffer buffer = pool.acquire(5000);
+        }
+        assert(pool.getStats().bytesCached == 0 && "A pool without cache must free released blocks.");
+
+        pool.setCacheLimit(BufferPool::defaultCacheLimit);
+        {
+            Buffer a = pool.acquire(5000), b = pool.acquire(70000);
+        }
+        assert(pool.getStats().bytesCached == BufferPool::sizeClass(5000) + BufferPool::sizeClass(70000) &&
+               "Released blocks were not cached.");
+        pool.setCacheLimit(BufferPool::sizeClass(70000));
+        assert(pool.getStats().bytesCached <= BufferPool::sizeClass(70000) && "Lowering the limit must evict.");
+        pool.trim();
+        assert(pool.getStats().bytesCached == 0 && "Trim must free every idle block.");
+    }
+
+    /**
+     * Tests Sharing a Pool Between Threads
+     */
+    void testConcurrentUse() {
+        BufferPool pool;
+        std::vector<std::thread> threads;
+        for (int t = 0; t < 4; ++t) {
+            threads.emplace_back([&pool, t]() {
+                for (int i = 0; i < 200; ++i) {
+                    Buffer buffer = pool.acquire(4096 * (1 + (i + t) % 3));
+                    buffer.getData()[0] = static_cast<unsigned char>(t);
+                    buffer.getData()[buffer.getSize() - 1] = static_cast<unsigned char>(i);
+                }
+            });
+        }
+        for (auto &thread: threads) {
+            thread.join();
+        }
+        BufferPoolStats stats = pool.getStats();
+        assert(stats.requests == 800 && stats.bytesInUse == 0 && "Concurrent use lost track of buffers.");
+        assert(stats.hits + 12 >= stats.requests && "Blocks were not reused across iterations.");
+    }
+
+    /**
+     * Tests That Filtering Same-Sized Volumes Reuses Pooled Memory
+     */
+    void testFilterReuse() {
+        const int size = 24;
+        std::vector<unsigned char> first(size * size * size, 100), second(size * size * size, 50);
+        Volume firstVolume(size, size, size, first.data()), secondVolume(size, size, size, second.data());
+        Gaussian3DFilter filter(1.0, 3);
+
+        filter.apply(firstVolume);
+        BufferPool::global().resetStats();
+        filter.apply(secondVolume);
+        BufferPoolStats stats = BufferPool::global().getStats();
+        assert(stats.requests > 0 && stats.hits == stats.requests && "Second filter run did not reuse the pool.");
+        assert(second[size * size * size / 2] == 50 && "Pooled scratch memory changed the result.");
+    }
+
+    /**
+     * Runs the Buffer Pool Unit Tests
+     */
+    virtual void runTests() override {
+        runTest<TestBufferPool>(&TestBufferPool::testSizeClasses, "Buffer Pool Size Classes");
+        runTest<TestBufferPool>(&TestBufferPool::testReuseAndStats, "Buffer Pool Reuse and Stats");
+        runTest<TestBufferPool>(&TestBufferPool::testCacheLimit, "Buffer Pool Cache Limit");
+        runTest<TestBufferPool>(&TestBufferPool::testConcurrentUse, "Buffer Pool Concurrent Use");
+        runTest<TestBufferPool>(&TestBufferPool::testFilterReuse, "Buffer Pool Filter Reuse");
+    }
+};
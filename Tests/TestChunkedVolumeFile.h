@@ -0,0 +1,283 @@
+/**
+ * @file TestChunkedVolumeFile.h
+ *
+ * @brief Unit Tests for the chunked volume file format.
+ *
+ * This header file defines the TestChunkedVolumeFile class, which checks that the built-in codec round-trips runs,
+ * repeated patterns and random bytes and rejects corrupt input, that volumes of every sample type survive a save and
+ * load, that boxes and slice ranges read through the chunk index match the original volume, and that invalid files
+ * and regions are reported.
+ *
+ * Usage:
+ * As an extension of the Test base class, the TestChunkedVolumeFile class implements the runTests method to execute all
+ * test cases through the Test class's runTest template method.
+ *
+ * @date Created on October 19, 2026.
+ *
+ * @authors
+ * Advanced Programming Group Radix Sort:
+ *   - Benjamin Duncan (edsml-bd1023)
+ *   - Boyang Hu (edsml-bh223)
+ *   - Chawk Chamoun (edsml-cc8915)
+ *   - Mingsheng Cai (acse-sc4623)
+ *   - Moyu Zhang (acse-mz223)
+ *   - Ryan Benney (acse-rgb123)
+ */
+
+#pragma once
+
+#include "Test.h"
+#include "ChunkedVolumeFile.h"
+
+#include <cassert>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <random>
+#include <vector>
+
+class TestChunkedVolumeFile : public Test {
+private:
+    // Smooth gradient with noise in the low bits, like a scan
+    template<typename T>
+    static std::vector<T> scanLikeSamples(int width, int height, int depth) {
+        std::mt19937 generator(7);
+        std::uniform_int_distribution<int> noise(0, 3);
+        std::vector<T> samples(static_cast<size_t>(width) * height * depth);
+        for (int z = 0; z < depth; ++z) {
+            for (int y = 0; y < height; ++y) {
+                for (int x = 0; x < width; ++x) {
+                    samples[(static_cast<size_t>(z) * height + y) * width + x] =
+                            static_cast<T>((x + y + z) % 200 + noise(generator));
+                }
+            }
+        }
+        return samples;
+    }
+
+    static std::string tempPath(const std::string &name) {
+        return (std::filesystem::temp_directory_path() / name).string();
+    }
+
+    // Saves a volume, reopens it and compares a full load against the original
+    template<typename T>
+    static void checkRoundTrip(DataType type) {
+        const int width = 37, height = 29, depth = 21;
+        auto samples = scanLikeSamples<T>(width, height, depth);
+        Volume volume(width, height, depth);
+        volume.updateData(samples);
+        std::string path = tempPath("test_chunked_roundtrip.mdip");
+        bool saved = ChunkedVolumeFile::save(volume, path, 8);
+        assert(saved && "Saving a chunked volume failed.");
+
+        ChunkedVolumeFile file;
+        bool opened = file.open(path);
+        assert(opened && "Opening a chunked volume failed.");
+        assert(file.getWidth() == width && file.getHeight() == height && file.getDepth() == depth &&
+               "The chunked volume size was not preserved.");
+        assert(file.getDataType() == type && file.getChunkSize() == 8 && "The chunked volume header is wrong.");
+        Volume loaded;
+        bool loadedFile = file.load(loaded);
+        assert(loadedFile && "Loading a chunked volume failed.");
+        assert(loaded.getDataType() == type && "The loaded volume has the wrong sample type.");
+        assert(std::memcmp(loaded.getData(), samples.data(), samples.size() * sizeof(T)) == 0 &&
+               "The loaded volume differs from the saved one.");
+        std::filesystem::remove(path);
+    }
+
+public:
+    /**
+     * @brief Test Codec Round Trip
+     *
+     * Compresses runs, repeated patterns, random bytes and short blocks and checks that each decompresses to the
+     * original, that runs shrink, and that truncated or mis-sized input is rejected.
+     */
+    void testCodecRoundTrip() {
+        std::mt19937 generator(3);
+        std::uniform_int_distribution<int> byte(0, 255);
+        std::vector<std::vector<unsigned char>> blocks = {{}, {42}, {1, 2, 3}, std::vector<unsigned char>(100000, 9)};
+        std::vector<unsigned char> pattern(70000), random(5000);
+        for (size_t i = 0; i < pattern.size(); ++i) {
+            pattern[i] = static_cast<unsigned char>(i % 13 * 7);
+        }
+        for (auto &value: random) {
+            value = static_cast<unsigned char>(byte(generator));
+        }
+        blocks.push_back(pattern);
+        blocks.push_back(random);
+
+        for (const auto &block: blocks) {
+            std::vector<unsigned char> compressed, restored(block.size());
+            ChunkCodec::compress(block.data(), block.size(), compressed);
+            assert(ChunkCodec::decompress(compressed.data(), compressed.size(), restored.data(), restored.size()) &&
+                   "Decompression of a valid block failed.");
+            assert(restored == block && "The codec did not round-trip a block.");
+            if (block.size() > 1 && !compressed.empty()) {
+                std::vector<unsigned char> wrong(block.size() - 1);
+                assert(!ChunkCodec::decompress(compressed.data(), compressed.size(), wrong.data(), wrong.size()) &&
+                       "A block decoded to the wrong size was accepted.");
+            }
+        }
+
+        std::vector<unsigned char> compressed;
+        ChunkCodec::compress(blocks[3].data(), blocks[3].size(), compressed);
+        assert(compressed.size() < 1000 && "A run of one value did not compress.");
+        std::vector<unsigned char> restored(blocks[3].size());
+        assert(!ChunkCodec::decompress(compressed.data(), compressed.size() / 2, restored.data(), restored.size()) &&
+               "Truncated input was accepted.");
+
+        std::vector<unsigned short> samples = {1, 258, 515, 772};
+        std::vector<unsigned char> shuffled(8), unshuffled(8);
+        ChunkCodec::shuffle(reinterpret_cast<unsigned char *>(samples.data()), 4, 2, shuffled.data());
+        ChunkCodec::unshuffle(shuffled.data(), 4, 2, unshuffled.data());
+        assert(std::memcmp(unshuffled.data(), samples.data(), 8) == 0 && "Shuffling did not round-trip.");
+    }
+
+    /**
+     * @brief Test Save And Load
+     *
+     * Saves 8-bit, 16-bit and float volumes whose sizes are not multiples of the chunk size and checks that they load
+     * back unchanged, and that a scan-like volume is stored in fewer bytes than its samples.
+     */
+    void testSaveAndLoad() {
+        checkRoundTrip<unsigned char>(DataType::UInt8);
+        checkRoundTrip<unsigned short>(DataType::UInt16);
+        checkRoundTrip<float>(DataType::Float32);
+
+        auto samples = scanLikeSamples<unsigned short>(64, 64, 64);
+        Volume volume(64, 64, 64);
+        volume.updateData(samples);
+        std::string path = tempPath("test_chunked_ratio.mdip");
+        bool saved = ChunkedVolumeFile::save(volume, path);
+        assert(saved && "Saving a chunked volume failed.");
+        ChunkedVolumeFile file;
+        bool opened = file.open(path);
+        assert(opened && file.getStoredSize() < samples.size() * sizeof(unsigned short) / 2 &&
+               "A scan-like volume was not compressed.");
+        std::filesystem::remove(path);
+    }
+
+    /**
+     * @brief Test Random Access
+     *
+     * Reads boxes that cross chunk borders and single-slice and multi-slice ranges and compares them against the
+     * original samples.
+     */
+    void testRandomAccess() {
+        const int width = 45, height = 33, depth = 27;
+        auto samples = scanLikeSamples<unsigned short>(width, height, depth);
+        Volume volume(width, height, depth);
+        volume.updateData(samples);
+        std::string path = tempPath("test_chunked_access.mdip");
+        bool saved = ChunkedVolumeFile::save(volume, path, 16);
+        assert(saved && "Saving a chunked volume failed.");
+        ChunkedVolumeFile file;
+        bool opened = file.open(path);
+        assert(opened && "Opening a chunked volume failed.");
+
+        for (const Region3D &region: {Region3D{0, 0, 0, 1, 1, 1}, Region3D{13, 5, 9, 20, 17, 11},
+                                      Region3D{40, 30, 20, 5, 3, 7}, Region3D{0, 0, 0, width, height, depth}}) {
+            std::vector<unsigned short> box(static_cast<size_t>(region.width) * region.height * region.depth);
+            bool read = file.readRegion(region, reinterpret_cast<unsigned char *>(box.data()));
+            assert(read && "Reading a box failed.");
+            for (int z = 0; z < region.depth; ++z) {
+                for (int y = 0; y < region.height; ++y) {
+                    for (int x = 0; x < region.width; ++x) {
+                        size_t source = (static_cast<size_t>(region.z + z) * height + region.y + y) * width +
+                                        region.x + x;
+                        assert(box[(static_cast<size_t>(z) * region.height + y) * region.width + x] ==
+                               samples[source] && "A box read from the chunked file is wrong.");
+                    }
+                }
+            }
+        }
+
+        size_t slice = static_cast<size_t>(width) * height;
+        std::vector<unsigned short> slices(slice * 3);
+        bool read = file.readSlices(15, 15, reinterpret_cast<unsigned char *>(slices.data()));
+        assert(read && std::equal(slices.begin(), slices.begin() + slice, samples.begin() + 15 * slice) &&
+               "A single slice read from the chunked file is wrong.");
+        read = file.readSlices(14, 16, reinterpret_cast<unsigned char *>(slices.data()));
+        assert(read && std::equal(slices.begin(), slices.end(), samples.begin() + 14 * slice) &&
+               "A slice range read from the chunked file is wrong.");
+        std::filesystem::remove(path);
+    }
+
+    /**
+     * @brief Test Invalid Input
+     *
+     * Checks that missing and foreign files, headers with overflowing sizes, out-of-range regions and slices, and empty
+     * volumes are rejected.
+     */
+    void testInvalidInput() {
+        ChunkedVolumeFile file;
+        bool opened = file.open(tempPath("test_chunked_missing.mdip"));
+        assert(!opened && !file.isOpen() && "A missing file was opened.");
+        std::vector<unsigned char> out(8);
+        bool read = file.readRegion({0, 0, 0, 1, 1, 1}, out.data());
+        assert(!read && "A closed file was read.");
+
+        std::string path = tempPath("test_chunked_foreign.mdip");
+        {
+            std::ofstream foreign(path, std::ios::binary);
+            foreign << "This is not a chunked volume file, just some text that is long enough.";
+        }
+        opened = file.open(path);
+        assert(!opened && "A foreign file was opened.");
+
+        Volume empty;
+        bool saved = ChunkedVolumeFile::save(empty, path);
+        assert(!saved && "An empty volume was saved.");
+
+        std::vector<unsigned char> voxels(4 * 4 * 4, 1);
+        Volume volume(4, 4, 4, voxels.data());
+        saved = ChunkedVolumeFile::save(volume, path, 0);
+        assert(!saved && "A chunk size of 0 was accepted.");
+        saved = ChunkedVolumeFile::save(volume, path, 2);
+        opened = file.open(path);
+        assert(saved && opened && "Saving a small volume failed.");
+        read = file.readRegion({3, 0, 0, 2, 1, 1}, out.data());
+        assert(!read && "A region outside the volume was read.");
+        read = file.readSlices(2, 4, out.data());
+        assert(!read && "A slice range outside the volume was read.");
+        saved = ChunkedVolumeFile::save(volume, path, ChunkedVolumeFile::maxChunkSize + 1);
+        assert(!saved && "An oversized chunk edge was accepted.");
+
+        // Headers whose sizes would overflow or whose chunk edge is too long are rejected before allocating anything
+        saved = ChunkedVolumeFile::save(volume, path, 2);
+        assert(saved && "Saving a small volume failed.");
+        auto patchHeader = [&](std::uint32_t extent, std::uint32_t chunkEdge) {
+            std::fstream patched(path, std::ios::binary | std::ios::in | std::ios::out);
+            for (int field = 0; field < 4; ++field) {
+                std::uint32_t value = field < 3 ? extent : chunkEdge;
+                unsigned char bytes[4] = {static_cast<unsigned char>(value), static_cast<unsigned char>(value >> 8),
+                                          static_cast<unsigned char>(value >> 16),
+                                          static_cast<unsigned char>(value >> 24)};
+                patched.seekp(8 + 4 * field);
+                patched.write(reinterpret_cast<const char *>(bytes), 4);
+            }
+        };
+        patchHeader(INT32_MAX, 1);
+        opened = file.open(path);
+        assert(!opened && "A header whose volume size overflows was accepted.");
+        patchHeader(4, ChunkedVolumeFile::maxChunkSize + 1);
+        opened = file.open(path);
+        assert(!opened && "A header with an oversized chunk edge was accepted.");
+        patchHeader(1 << 20, 1);
+        opened = file.open(path);
+        assert(!opened && "A header with a chunk index larger than the file was accepted.");
+        std::filesystem::remove(path);
+    }
+
+    /**
+     * @brief Run all tests
+     *
+     * Runs all the tests for the chunked volume file format.
+     */
+    void runTests() override {
+        runTest<TestChunkedVolumeFile>(&TestChunkedVolumeFile::testCodecRoundTrip, "Codec Round Trip");
+        runTest<TestChunkedVolumeFile>(&TestChunkedVolumeFile::testSaveAndLoad, "Save And Load");
+        runTest<TestChunkedVolumeFile>(&TestChunkedVolumeFile::testRandomAccess, "Random Access");
+        runTest<TestChunkedVolumeFile>(&TestChunkedVolumeFile::testInvalidInput, "Invalid Input");
+    }
+};
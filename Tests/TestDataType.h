@@ -0,0 +1,320 @@
+/**
+ * @file TestDataType.h
+ *
+ * @brief Unit Tests for 16-bit and float sample support.
+ *
+ * This header file defines the TestDataType class, which checks that volumes and images can hold 16-bit and float samples
+ * end to end. The tests load a 16-bit PNG stack without losing precision, compare the typed projections and 3D filters
+ * with the 8-bit code paths on data whose values map exactly between the types, check the conversion applied when typed
+ * volumes are saved, and verify that the 8-bit-only 2D filters leave typed images untouched.
+ *
+ * Usage:
+ * As an extension of the Test base class, the TestDataType class implements the runTests method to execute all test
+ * cases through the Test class's runTest template method.
+ *
+ * @date Created on October 19, 2026.
+ *
+ * @authors
+ * Advanced Programming Group Radix Sort:
+ *   - Benjamin Duncan (edsml-bd1023)
+ *   - Boyang Hu (edsml-bh223)
+ *   - Chawk Chamoun (edsml-cc8915)
+ *   - Mingsheng Cai (acse-sc4623)
+ *   - Moyu Zhang (acse-mz223)
+ *   - Ryan Benney (acse-rgb123)
+ */
+
+#pragma once
+
+#include "Test.h"
+#include "Volume.h"
+#include "Image.h"
+#include "Projection.h"
+#include "Filters/Gaussian3DFilter.h"
+#include "Filters/Median3DFilter.h"
+#include "Filters/Box2DFilter.h"
+#include "stb_image.h"
+
+#include <vector>
+#include <string>
+#include <cassert>
+#include <cmath>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+
+class TestDataType : public Test {
+private:
+    static constexpr int width = 13, height = 11, depth = 7;
+
+    /**
+     * Generates Pseudo-Random 8-bit Volume Data
+     *
+     * @return A vector of width * height * depth voxels in z-major order.
+     */
+    std::vector<unsigned char> generateData() const {
+        std::vector<unsigned char> data(width * height * depth);
+        unsigned int state = 777;
+        for (auto &value: data) {
+            state = state * 1664525u + 1013904223u;
+            value = static_cast<unsigned char>(state >> 24);
+        }
+        return data;
+    }
+
+    /**
+     * Widens 8-bit Data to 16 bits
+     *
+     * Multiplies every value by 257, the mapping that stb_image uses, so that 8-bit results can be compared exactly.
+     *
+     * @param data The 8-bit samples.
+     * @return The 16-bit samples.
+     */
+    std::vector<unsigned short> widen(const std::vector<unsigned char> &data) const {
+        std::vector<unsigned short> wide(data.size());
+        for (size_t i = 0; i < data.size(); ++i) {
+            wide[i] = static_cast<unsigned short>(data[i] * 257);
+        }
+        return wide;
+    }
+
+    /**
+     * Writes a 16-bit Grayscale PNG
+     *
+     * stb_image_write only produces 8-bit PNGs, so this helper writes the file directly, storing the image rows in
+     * uncompressed deflate blocks.
+     *
+     * @param path The path of the file to write.
+     * @param samples The width * height samples of the image.
+     */
+    void writePng16(const std::filesystem::path &path, const unsigned short *samples) const {
+        auto crc32 = [](const std::vector<unsigned char> &bytes) {
+            unsigned int crc = 0xffffffffu;
+            for (unsigned char byte: bytes) {
+                crc ^= byte;
+                for (int k = 0; k < 8; ++k) {
+                    crc = (crc >> 1) ^ (0xedb88320u & (0u - (crc & 1u)));
+                }
+            }
+            return ~crc;
+        };
+        auto putBigEndian = [](std::vector<unsigned char> &bytes, unsigned int value) {
+            for (int shift = 24; shift >= 0; shift -= 8) {
+                bytes.push_back(static_cast<unsigned char>(value >> shift));
+            }
+        };
+        std::ofstream file(path, std::ios::binary);
+        auto writeChunk = [&](const char *type, const std::vector<unsigned char> &payload) {
+            std::vector<unsigned char> chunk(type, type + 4);
+            chunk.insert(chunk.end(), payload.begin(), payload.end());
+            std::vector<unsigned char> length, crc;
+            putBigEndian(length, static_cast<unsigned int>(payload.size()));
+            putBigEndian(crc, crc32(chunk));
+            file.write(reinterpret_cast<const char *>(length.data()), 4);
+            file.write(reinterpret_cast<const char *>(chunk.data()), static_cast<std::streamsize>(chunk.size()));
+            file.write(reinterpret_cast<const char *>(crc.data()), 4);
+        };
+
+        // Filter byte 0 followed by big-endian samples for every row
+        std::vector<unsigned char> raw;
+        for (int y = 0; y < height; ++y) {
+            raw.push_back(0);
+            for (int x = 0; x < width; ++x) {
+                raw.push_back(static_cast<unsigned char>(samples[y * width + x] >> 8));
+                raw.push_back(static_cast<unsigned char>(samples[y * width + x] & 0xff));
+            }
+        }
+        std::vector<unsigned char> zlib = {0x78, 0x01, 0x01}; // final stored block
+        unsigned int length = static_cast<unsigned int>(raw.size());
+        zlib.insert(zlib.end(), {static_cast<unsigned char>(length), static_cast<unsigned char>(length >> 8),
+                                 static_cast<unsigned char>(~length), static_cast<unsigned char>(~length >> 8)});
+        zlib.insert(zlib.end(), raw.begin(), raw.end());
+        unsigned int a = 1, b = 0;
+        for (unsigned char byte: raw) {
+            a = (a + byte) % 65521;
+            b = (b + a) % 65521;
+        }
+        putBigEndian(zlib, (b << 16) | a);
+
+        std::vector<unsigned char> header;
+        putBigEndian(header, width);
+        putBigEndian(header, height);
+        header.insert(header.end(), {16, 0, 0, 0, 0}); // 16-bit grayscale
+        file.write("\x89PNG\r\n\x1a\n", 8);
+        writeChunk("IHDR", header);
+        writeChunk("IDAT", zlib);
+        writeChunk("IEND", {});
+    }
+
+public:
+    /**
+     * Tests Loading a 16-bit Stack
+     *
+     * Writes a stack of 16-bit PNG slices and checks that loading them as 16-bit samples keeps every value, and that
+     * loading them as floats stores the values on the 8-bit intensity scale.
+     */
+    void testLoad16Bit() {
+        auto root = std::filesystem::temp_directory_path() / "mdip_data_type";
+        std::filesystem::remove_all(root);
+        std::filesystem::create_directories(root);
+        std::vector<unsigned short> expected(width * height * depth);
+        for (size_t i = 0; i < expected.size(); ++i) {
+            expected[i] = static_cast<unsigned short>((i * 4099) % 65536);
+        }
+        for (int z = 0; z < depth; ++z) {
+            char name[32];
+            std::snprintf(name, sizeof(name), "slice_%02d.png", z);
+            writePng16(root / name, &expected[z * width * height]);
+        }
+
+        Volume wide;
+        bool loaded = wide.loadFromDirectory(root.string(), DataType::UInt16);
+        assert(loaded && "Failed to load the 16-bit stack.");
+        assert(wide.getDataType() == DataType::UInt16);
+        assert(wide.getWidth() == width && wide.getHeight() == height && wide.getDepth() == depth);
+        assert(std::equal(expected.begin(), expected.end(), wide.getDataAs<unsigned short>()) &&
+               "16-bit samples changed on load.");
+        size_t last = expected.size() - 1;
+        bool converted = wide.getVoxel(width - 1, height - 1, depth - 1) ==
+                         DataTypeTraits<unsigned short>::toUInt8(expected[last]);
+        assert(converted && "getVoxel did not convert a 16-bit sample.");
+
+        Volume real;
+        loaded = real.loadFromDirectory(root.string(), DataType::Float32);
+        assert(loaded && "Failed to load the stack as floats.");
+        assert(real.getDataType() == DataType::Float32);
+        for (size_t i = 0; i < expected.size(); ++i) {
+            assert(std::fabs(real.getDataAs<float>()[i] - expected[i] / 257.0f) < 1e-4f && "Float samples are wrong.");
+        }
+
+        std::filesystem::remove_all(root);
+    }
+
+    /**
+     * Tests the Typed Projections
+     *
+     * Projects 16-bit and float copies of an 8-bit volume and checks that MIP, MinIP and MedIP select exactly the widened
+     * 8-bit results, and that the float AIP is the exact average.
+     */
+    void testProjections() {
+        auto data = generateData();
+        auto wide = widen(data);
+        std::vector<float> real(data.begin(), data.end());
+
+        auto mip = Projection::maximumIntensityProjection(width, height, depth, data.data());
+        auto minip = Projection::minimumIntensityProjection(width, height, depth, data.data());
+        auto medip = Projection::medianIntensityProjection(width, height, depth, data.data());
+        assert(Projection::maximumIntensityProjection(width, height, depth, wide.data()) == widen(mip));
+        assert(Projection::minimumIntensityProjection(width, height, depth, wide.data()) == widen(minip));
+        assert(Projection::medianIntensityProjection(width, height, depth, wide.data()) == widen(medip));
+        assert(Projection::medianIntensityProjection(width, height, depth, real.data()) ==
+               std::vector<float>(medip.begin(), medip.end()));
+
+        auto aip = Projection::averageIntensityProjection(width, height, depth, real.data());
+        for (int i = 0; i < width * height; ++i) {
+            double sum = 0.0;
+            for (int z = 0; z < depth; ++z) {
+                sum += data[z * width * height + i];
+            }
+            assert(std::fabs(aip[i] - sum / depth) < 1e-4 && "Float AIP is not the exact average.");
+        }
+    }
+
+    /**
+     * Tests the Typed 3D Filters
+     *
+     * Filters 8-bit, 16-bit and float copies of the same volume. The median filter commutes with the widening, so its
+     * results must match exactly. The 8-bit Gaussian filter rounds after each of its three passes, so the wider results
+     * may differ from it by up to half a level per pass.
+     */
+    void testFilters() {
+        auto data = generateData();
+        size_t size = data.size();
+
+        auto narrow = data;
+        Volume narrowVolume(width, height, depth, narrow.data());
+        Median3DFilter(3).apply(narrowVolume);
+
+        Volume wideVolume(width, height, depth);
+        wideVolume.updateData(widen(data));
+        Median3DFilter(3).apply(wideVolume);
+        assert(wideVolume.getDataType() == DataType::UInt16 && "Median filter changed the sample type.");
+        assert(std::vector<unsigned short>(wideVolume.getDataAs<unsigned short>(),
+                                           wideVolume.getDataAs<unsigned short>() + size) ==
+               widen(std::vector<unsigned char>(narrow.begin(), narrow.end())) &&
+               "16-bit median filter differs from the 8-bit result.");
+
+        narrow = data;
+        Volume gaussianNarrow(width, height, depth, narrow.data());
+        Gaussian3DFilter(1.0, 5).apply(gaussianNarrow);
+
+        Volume gaussianWide(width, height, depth);
+        gaussianWide.updateData(widen(data));
+        Gaussian3DFilter(1.0, 5).apply(gaussianWide);
+
+        Volume gaussianReal(width, height, depth);
+        gaussianReal.updateData(std::vector<float>(data.begin(), data.end()));
+        Gaussian3DFilter(1.0, 5).apply(gaussianReal);
+        assert(gaussianReal.getDataType() == DataType::Float32 && "Gaussian filter changed the sample type.");
+
+        for (size_t i = 0; i < size; ++i) {
+            assert(std::abs(gaussianWide.getDataAs<unsigned short>()[i] / 257.0 - narrow[i]) <= 1.5 &&
+                   "16-bit Gaussian filter differs from the 8-bit result.");
+            assert(std::fabs(gaussianReal.getDataAs<float>()[i] - narrow[i]) <= 1.5f &&
+                   "Float Gaussian filter differs from the 8-bit result.");
+        }
+    }
+
+    /**
+     * Tests Saving a 16-bit Volume
+     *
+     * Saves an x-y slice of a 16-bit volume and checks that the PNG holds the samples scaled to 8 bits.
+     */
+    void testSave() {
+        auto root = std::filesystem::temp_directory_path() / "mdip_data_type_save";
+        std::vector<unsigned short> wide(width * height * depth);
+        for (size_t i = 0; i < wide.size(); ++i) {
+            wide[i] = static_cast<unsigned short>((i * 1237) % 65536);
+        }
+        Volume volume(width, height, depth);
+        volume.updateData(wide);
+        volume.save(root.string(), "x-y", 3);
+
+        int w, h, c;
+        unsigned char *slice = stbi_load((root / "slice_3.png").string().c_str(), &w, &h, &c, 1);
+        assert(slice && w == width && h == height && "Typed slice was not saved.");
+        for (int i = 0; slice && i < width * height; ++i) {
+            assert(slice[i] == DataTypeTraits<unsigned short>::toUInt8(wide[2 * width * height + i]));
+        }
+        stbi_image_free(slice);
+        std::filesystem::remove_all(root);
+    }
+
+    /**
+     * Tests That 2D Filters Skip Typed Images
+     *
+     * The 2D filters only support 8-bit samples, so a 16-bit image must be left unchanged.
+     */
+    void testImageFilterRejectsTypedImage() {
+        std::vector<unsigned short> samples(width * height);
+        for (size_t i = 0; i < samples.size(); ++i) {
+            samples[i] = static_cast<unsigned short>(i * 300);
+        }
+        Image image(width, height, 1, reinterpret_cast<unsigned char *>(samples.data()), DataType::UInt16);
+        Box2DFilter(3).apply(image);
+        assert(image.getDataType() == DataType::UInt16);
+        assert(std::equal(samples.begin(), samples.end(), image.getDataAs<unsigned short>()) &&
+               "A 2D filter modified a 16-bit image.");
+    }
+
+    /**
+     * Runs the Data Type Unit Tests
+     */
+    virtual void runTests() override {
+        runTest<TestDataType>(&TestDataType::testLoad16Bit, "Data Type Load 16-bit Stack");
+        runTest<TestDataType>(&TestDataType::testProjections, "Data Type Typed Projections");
+        runTest<TestDataType>(&TestDataType::testFilters, "Data Type Typed 3D Filters");
+        runTest<TestDataType>(&TestDataType::testSave, "Data Type Save 16-bit Volume");
+        runTest<TestDataType>(&TestDataType::testImageFilterRejectsTypedImage, "Data Type 2D Filters Skip Typed Images");
+    }
+};
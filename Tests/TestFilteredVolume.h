@@ -0,0 +1,348 @@
+/**
+ * @file TestFilteredVolume.h
+ *
+ * @brief Unit Tests for the lazy filtered view of a volume.
+ *
+ * This header file defines the TestFilteredVolume class, which checks that slabs, slices and projections read through
+ * a FilteredVolume equal those of the fully filtered volume for every sample type and plane, that only the slices
+ * within reach of a request are filtered and that cached slices are reused and evicted, that projections fused with
+ * the filtering match for every slab depth, and that invalid requests are reported.
+ *
+ * Usage:
+ * As an extension of the Test base class, the TestFilteredVolume class implements the runTests method to execute all
+ * test cases through the Test class's runTest template method.
+ *
+ * @date Created on October 19, 2026.
+ *
+ * @authors
+ * Advanced Programming Group Radix Sort:
+ *   - Benjamin Duncan (edsml-bd1023)
+ *   - Boyang Hu (edsml-bh223)
+ *   - Chawk Chamoun (edsml-cc8915)
+ *   - Mingsheng Cai (acse-sc4623)
+ *   - Moyu Zhang (acse-mz223)
+ *   - Ryan Benney (acse-rgb123)
+ */
+
+#pragma once
+
+#include "Test.h"
+#include "FilteredVolume.h"
+#include "Projection.h"
+#include "Slice.h"
+#include "Volume.h"
+#include "Filters/Gaussian3DFilter.h"
+#include "Filters/Median3DFilter.h"
+#include "stb_image.h"
+
+#include <cassert>
+#include <cstring>
+#include <filesystem>
+#include <random>
+#include <string>
+#include <vector>
+
+class TestFilteredVolume : public Test {
+private:
+    static constexpr int width = 17, height = 13, depth = 24;
+
+    // A volume of random samples of the given type, with values on the 0-255 scale
+    static Volume randomVolume(DataType type, unsigned int seed) {
+        std::mt19937 generator(seed);
+        std::uniform_int_distribution<int> distribution(0, 255);
+        size_t count = static_cast<size_t>(width) * height * depth;
+        Buffer data(count * bytesPerSample(type));
+        for (size_t i = 0; i < count; ++i) {
+            int value = distribution(generator);
+            if (type == DataType::UInt16) {
+                reinterpret_cast<unsigned short *>(data.getData())[i] = static_cast<unsigned short>(value * 257);
+            } else if (type == DataType::Float32) {
+                reinterpret_cast<float *>(data.getData())[i] = static_cast<float>(value) * 0.75f;
+            } else {
+                data.getData()[i] = static_cast<unsigned char>(value);
+            }
+        }
+        return Volume(width, height, depth, std::move(data), type);
+    }
+
+    static Volume copyOf(const Volume &volume) {
+        size_t size = static_cast<size_t>(volume.getWidth()) * volume.getHeight() * volume.getDepth() *
+                      bytesPerSample(volume.getDataType());
+        Buffer data(size);
+        std::memcpy(data.getData(), volume.getData(), size);
+        return Volume(volume.getWidth(), volume.getHeight(), volume.getDepth(), std::move(data),
+                      volume.getDataType());
+    }
+
+    // Checks that slices [begin, end) of a slab read through the view equal those of the filtered volume
+    static bool slabMatches(FilteredVolume &view, const Volume &filtered, int begin, int end) {
+        Volume slab;
+        if (!view.getSlab(begin, end, slab) || slab.getDepth() != end - begin ||
+            slab.getDataType() != filtered.getDataType()) {
+            return false;
+        }
+        size_t sliceBytes = static_cast<size_t>(width) * height * bytesPerSample(filtered.getDataType());
+        return std::memcmp(slab.getData(), filtered.getData() + begin * sliceBytes, (end - begin) * sliceBytes) == 0;
+    }
+
+    // The 8-bit projection of slices [begin, end) of a volume of samples of type T
+    template<typename T>
+    static std::vector<unsigned char> projectRange(const Volume &volume, const std::string &projector, int begin,
+                                                   int end) {
+        const T *data = volume.getDataAs<T>() + static_cast<size_t>(begin) * width * height;
+        std::vector<T> projection;
+        if (projector == "MIP") {
+            projection = Projection::maximumIntensityProjection(width, height, end - begin, data);
+        } else if (projector == "MinIP") {
+            projection = Projection::minimumIntensityProjection(width, height, end - begin, data);
+        } else {
+            projection = Projection::averageIntensityProjection(width, height, end - begin, data);
+        }
+        std::vector<unsigned char> result(projection.size());
+        for (size_t i = 0; i < projection.size(); ++i) {
+            result[i] = DataTypeTraits<T>::toUInt8(projection[i]);
+        }
+        return result;
+    }
+
+    static std::vector<unsigned char> loadPng(const std::string &path) {
+        int w, h, channels;
+        unsigned char *pixels = stbi_load(path.c_str(), &w, &h, &channels, 1);
+        if (!pixels) {
+            return {};
+        }
+        std::vector<unsigned char> result(pixels, pixels + static_cast<size_t>(w) * h);
+        stbi_image_free(pixels);
+        return result;
+    }
+
+public:
+    /**
+     * @brief Test slabs of a filter chain against the fully filtered volume.
+     *
+     * Reads slabs at the borders and in the middle of 8-bit, 16-bit and float volumes through a Gaussian and median
+     * chain and compares them with filtering the whole volume.
+     */
+    void testSlabs() {
+        for (DataType type: {DataType::UInt8, DataType::UInt16, DataType::Float32}) {
+            Volume source = randomVolume(type, 7);
+            Gaussian3DFilter gaussian(1.2, 5);
+            Median3DFilter median(3);
+            Volume filtered = copyOf(source);
+            gaussian.apply(filtered);
+            if (type == DataType::UInt8) {
+                median.apply(filtered);
+            }
+
+            FilteredVolume view(source);
+            view.addFilter(gaussian);
+            if (type == DataType::UInt8) {
+                view.addFilter(median);
+            }
+            for (auto [begin, end]: {std::pair{0, 1}, {depth - 1, depth}, {11, 12}, {5, 14}, {0, depth}}) {
+                bool same = slabMatches(view, filtered, begin, end);
+                assert(same && "A slab of the filtered view differs from the filtered volume.");
+            }
+        }
+    }
+
+    /**
+     * @brief Test slices of every plane against the fully filtered volume.
+     *
+     * Compares 8-bit x-y, x-z and y-z slices read through the view with slices of the filtered volume.
+     */
+    void testSlices() {
+        Volume source = randomVolume(DataType::UInt8, 11);
+        Gaussian3DFilter gaussian(1.0, 3);
+        Median3DFilter median(5);
+        Volume filtered = copyOf(source);
+        median.apply(filtered);
+        gaussian.apply(filtered);
+        FilteredVolume view(source);
+        view.addFilter(median).addFilter(gaussian);
+
+        for (const std::string plane: {"x-y", "x-z", "y-z"}) {
+            int slices = plane == "x-y" ? depth : (plane == "x-z" ? height : width);
+            for (int index: {1, slices / 2, slices}) {
+                auto expected = Slice::getPlaneSlice(width, height, depth, filtered.getData(), plane, index);
+                auto actual = view.getSliceUInt8(plane, index);
+                assert(!actual.empty() && actual == expected && "A slice of the filtered view differs.");
+            }
+        }
+    }
+
+    /**
+     * @brief Test that only the slices within reach are filtered and that the cache is used.
+     *
+     * Counts the x-y slices filtered for single slices, repeated and overlapping requests, and checks that a small
+     * cache evicts the least recently used slices.
+     */
+    void testCache() {
+        Volume source = randomVolume(DataType::UInt8, 13);
+        Gaussian3DFilter gaussian(1.0, 5);
+        Volume filtered = copyOf(source);
+        gaussian.apply(filtered);
+
+        FilteredVolume view(source);
+        view.addFilter(gaussian);
+        bool same = slabMatches(view, filtered, 10, 11);
+        assert(same && view.getComputedSlices() == 1 && "A single slice was not filtered on its own.");
+        same = slabMatches(view, filtered, 10, 11);
+        assert(same && view.getComputedSlices() == 1 && "A cached slice was filtered again.");
+        same = slabMatches(view, filtered, 8, 14);
+        assert(same && view.getComputedSlices() == 6 && "Only the missing slices of a slab should be filtered.");
+
+        FilteredVolume small(source, 3);
+        small.addFilter(gaussian);
+        same = slabMatches(small, filtered, 0, 3) && slabMatches(small, filtered, 0, 1) &&
+               slabMatches(small, filtered, 3, 4);
+        assert(same && small.getComputedSlices() == 4 && "A slice was filtered again before being evicted.");
+        same = slabMatches(small, filtered, 0, 1) && slabMatches(small, filtered, 1, 2);
+        assert(same && small.getComputedSlices() == 5 && "The least recently used slice was not evicted.");
+
+        // Adding a filter changes every slice
+        Median3DFilter median(3);
+        view.addFilter(median);
+        median.apply(filtered);
+        same = slabMatches(view, filtered, 10, 11);
+        assert(same && view.getComputedSlices() == 7 && "Adding a filter did not empty the cache.");
+    }
+
+    /**
+     * @brief Test fused projections against projections of the fully filtered volume.
+     *
+     * Computes MIP, MinIP and AIP of whole and partial ranges of 8-bit, 16-bit and float volumes through a Gaussian and
+     * median chain with several slab depths, compares them with the projections of the filtered volume, and checks
+     * that the fused path leaves the cache alone.
+     */
+    void testFusedProjections() {
+        for (DataType type: {DataType::UInt8, DataType::UInt16, DataType::Float32}) {
+            Volume source = randomVolume(type, 23);
+            Gaussian3DFilter gaussian(1.1, 5);
+            Median3DFilter median(3);
+            Volume filtered = copyOf(source);
+            gaussian.apply(filtered);
+            if (type == DataType::UInt8) {
+                median.apply(filtered);
+            }
+            FilteredVolume view(source);
+            view.addFilter(gaussian);
+            if (type == DataType::UInt8) {
+                view.addFilter(median);
+            }
+
+            for (const std::string projector: {"MIP", "MinIP", "AIP"}) {
+                for (auto [begin, end]: {std::pair{0, depth}, {3, 17}, {9, 10}}) {
+                    std::vector<unsigned char> expected;
+                    if (type == DataType::UInt16) {
+                        expected = projectRange<unsigned short>(filtered, projector, begin, end);
+                    } else if (type == DataType::Float32) {
+                        expected = projectRange<float>(filtered, projector, begin, end);
+                    } else {
+                        expected = projectRange<unsigned char>(filtered, projector, begin, end);
+                    }
+                    for (int slabDepth: {1, 5, 32}) {
+                        auto actual = view.getProjectionUInt8(projector, begin, end, slabDepth);
+                        assert(!actual.empty() && actual == expected && "A fused projection differs.");
+                    }
+                }
+            }
+            assert(view.getComputedSlices() == 0 && "A fused projection filled the cache.");
+        }
+    }
+
+    /**
+     * @brief Test saving slices and projections through the view.
+     *
+     * Saves slices and range projections of a filtered 16-bit volume through the view and through Volume::save and
+     * checks that the files have the same pixels.
+     */
+    void testSave() {
+        auto lazyDirectory = std::filesystem::temp_directory_path() / "test_filtered_volume_lazy";
+        auto fullDirectory = std::filesystem::temp_directory_path() / "test_filtered_volume_full";
+        std::filesystem::remove_all(lazyDirectory);
+        std::filesystem::remove_all(fullDirectory);
+
+        Volume source = randomVolume(DataType::UInt16, 17);
+        Gaussian3DFilter gaussian(1.5, 5);
+        Volume filtered = copyOf(source);
+        gaussian.apply(filtered);
+        FilteredVolume view(source);
+        view.addFilter(gaussian);
+
+        std::vector<std::string> names;
+        for (auto [plane, index]: {std::pair{"x-y", 12}, {"x-z", 1}, {"y-z", 9}}) {
+            view.save(lazyDirectory.string(), plane, index);
+            filtered.save(fullDirectory.string(), plane, index);
+            std::string name = std::string("slice_") + std::to_string(index) + ".png";
+            auto lazy = loadPng((lazyDirectory / name).string()), full = loadPng((fullDirectory / name).string());
+            assert(!lazy.empty() && lazy == full && "A saved slice of the view differs.");
+            std::filesystem::remove(lazyDirectory / name);
+            std::filesystem::remove(fullDirectory / name);
+        }
+        for (const std::string projector: {"MIP", "MinIP", "AIP", "MedIP"}) {
+            view.save(lazyDirectory.string(), "x-y", projector, 4, 9);
+            filtered.save(fullDirectory.string(), "x-y", projector, 4, 9);
+            std::string name = projector + "_range_4_9.png";
+            auto lazy = loadPng((lazyDirectory / name).string()), full = loadPng((fullDirectory / name).string());
+            assert(!lazy.empty() && lazy == full && "A saved projection of the view differs.");
+
+            view.save(lazyDirectory.string(), "x-y", projector);
+            filtered.save(fullDirectory.string(), "x-y", projector);
+            lazy = loadPng((lazyDirectory / (projector + ".png")).string());
+            full = loadPng((fullDirectory / (projector + ".png")).string());
+            assert(!lazy.empty() && lazy == full && "A saved whole-volume projection of the view differs.");
+        }
+        std::filesystem::remove_all(lazyDirectory);
+        std::filesystem::remove_all(fullDirectory);
+    }
+
+    /**
+     * @brief Test the handling of invalid requests.
+     *
+     * Out-of-range slabs and slices, unknown planes and projectors and empty volumes must be reported without
+     * output.
+     */
+    void testInvalidInput() {
+        Volume source = randomVolume(DataType::UInt8, 19);
+        Median3DFilter median(3);
+        FilteredVolume view(source);
+        view.addFilter(median);
+        Volume slab;
+        bool ok = view.getSlab(-1, 2, slab) || view.getSlab(3, 3, slab) || view.getSlab(0, depth + 1, slab);
+        assert(!ok && slab.getDepth() == 0 && "An invalid slab was filtered.");
+        bool empty = view.getSliceUInt8("x-y", 0).empty() && view.getSliceUInt8("x-z", height + 1).empty() &&
+                     view.getSliceUInt8("z-x", 1).empty();
+        assert(empty && view.getComputedSlices() == 0 && "An invalid slice was filtered.");
+
+        auto directory = std::filesystem::temp_directory_path() / "test_filtered_volume_invalid";
+        std::filesystem::remove_all(directory);
+        view.save(directory.string(), "x-y", "MaxIP", 1, 2);
+        view.save(directory.string(), "x-z", "MIP", 1, 2);
+        view.save(directory.string(), "x-y", "MIP", 3, 2);
+        view.save(directory.string(), "x-y", depth + 1);
+        view.save(directory.string(), "y-z", "AIP");
+        bool none = view.getProjectionUInt8("MIP", 2, 2).empty() && view.getProjectionUInt8("AIP", 0, depth, 0).empty();
+        assert(none && "An invalid projection was computed.");
+        assert(!std::filesystem::exists(directory) && "An invalid request wrote output.");
+
+        Volume nothing;
+        FilteredVolume emptyView(nothing);
+        ok = emptyView.getSlab(0, 1, slab);
+        assert(!ok && "A slab of an empty volume was filtered.");
+    }
+
+    /**
+     * @brief Run all tests
+     *
+     * Runs all the tests for the lazy filtered view of a volume.
+     */
+    void runTests() override {
+        runTest<TestFilteredVolume>(&TestFilteredVolume::testSlabs, "Slabs");
+        runTest<TestFilteredVolume>(&TestFilteredVolume::testSlices, "Slices");
+        runTest<TestFilteredVolume>(&TestFilteredVolume::testCache, "Cache");
+        runTest<TestFilteredVolume>(&TestFilteredVolume::testFusedProjections, "Fused Projections");
+        runTest<TestFilteredVolume>(&TestFilteredVolume::testSave, "Save");
+        runTest<TestFilteredVolume>(&TestFilteredVolume::testInvalidInput, "Invalid Input");
+    }
+};
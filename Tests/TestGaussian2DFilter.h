@@ -35,6 +35,8 @@
 #include <cassert>
 #include <iostream>
 #include <memory>
+#include <utility>
+#include <vector>
 
 class TestGaussian2DFilter : public Test {
 private:
@@ -205,6 +207,65 @@ public:
         std::cout << "Sigma impact on blurring effect test passed." << std::endl;
     }
 
+    /**
+     * Tests the Accuracy of the Fixed-Point Mode
+     *
+     * Blurs the same pseudo-random RGB image in floating-point and fixed-point mode for each padding type and asserts
+     * that the largest difference between the two results is at most one grey level.
+     */
+    void testFixedPointAccuracy() {
+        int width = 21, height = 17, channels = 3;
+        std::vector<unsigned char> pixels(width * height * channels);
+        unsigned int state = 99;
+        for (auto &value: pixels) {
+            state = state * 1664525u + 1013904223u;
+            value = static_cast<unsigned char>(state >> 24);
+        }
+
+        for (auto padding: {PaddingType::ZeroPadding, PaddingType::EdgeReplication, PaddingType::ReflectPadding}) {
+            for (auto [kernelSize, sigma]: {std::pair{3, 0.8}, std::pair{5, 1.0}, std::pair{9, 2.5}}) {
+                Image floating(width, height, channels, pixels.data());
+                Image fixed(width, height, channels, pixels.data());
+                Gaussian2DFilter(kernelSize, sigma, padding).apply(floating);
+                Gaussian2DFilter(kernelSize, sigma, padding, GaussianMode::FixedPoint).apply(fixed);
+
+                int maxError = 0;
+                for (size_t i = 0; i < pixels.size(); ++i) {
+                    maxError = std::max(maxError, std::abs(floating.getData()[i] - fixed.getData()[i]));
+                }
+                assert(maxError <= 1 && "Fixed-point Gaussian differs from the floating-point result by more than 1.");
+            }
+        }
+    }
+
+    /**
+     * Tests the Recursive Mode Against the Direct Convolution
+     *
+     * With edge replication and a large sigma, the recursive blur should stay within three grey levels of the direct
+     * convolution, whose conversion truncates rather than rounds.
+     */
+    void testRecursiveMode() {
+        int width = 40, height = 36, channels = 3;
+        std::vector<unsigned char> pixels(width * height * channels);
+        unsigned int state = 7;
+        for (auto &value: pixels) {
+            state = state * 1664525u + 1013904223u;
+            value = static_cast<unsigned char>(state >> 24);
+        }
+
+        double sigma = 4.0;
+        Image direct(width, height, channels, pixels.data());
+        Image recursive(width, height, channels, pixels.data());
+        Gaussian2DFilter(33, sigma, PaddingType::EdgeReplication).apply(direct);
+        Gaussian2DFilter(1, sigma, PaddingType::EdgeReplication, GaussianMode::Recursive).apply(recursive);
+
+        int maxError = 0;
+        for (size_t i = 0; i < pixels.size(); ++i) {
+            maxError = std::max(maxError, std::abs(direct.getData()[i] - recursive.getData()[i]));
+        }
+        assert(maxError <= 3 && "Recursive Gaussian differs from the direct convolution by more than 3.");
+    }
+
     /**
      * Executes All Defined Test Cases for the Gaussian2DFilter
      *
@@ -217,5 +278,7 @@ public:
         runTest<TestGaussian2DFilter>(&TestGaussian2DFilter::testApplyGaussianBlur, "Apply Gaussian Blur");
         runTest<TestGaussian2DFilter>(&TestGaussian2DFilter::testBlurringEffect, "Blurring Effect");
         runTest<TestGaussian2DFilter>(&TestGaussian2DFilter::testSigmaImpact, "Sigma Impact");
+        runTest<TestGaussian2DFilter>(&TestGaussian2DFilter::testFixedPointAccuracy, "Gaussian2DFilter Fixed-Point Accuracy");
+        runTest<TestGaussian2DFilter>(&TestGaussian2DFilter::testRecursiveMode, "Gaussian2DFilter Recursive Mode");
     }
 };
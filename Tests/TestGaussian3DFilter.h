@@ -35,6 +35,10 @@
 #include <iostream>
 #include <numeric>
 #include <cassert>
+#include <memory>
+#include <stdexcept>
+#include <utility>
+#include <vector>
 
 class TestGaussian3DFilter : public Test {
 private:
@@ -233,6 +237,106 @@ public:
         analyzeVolumeSmoothing(testVolume, originalData);
     }
 
+    /**
+     * Tests the Quantisation of Gaussian Kernels
+     *
+     * Checks that the quantised weights sum to exactly 2^shift, fit in 16 bits and stay within one unit of the scaled
+     * floating-point weights.
+     */
+    void testKernelQuantisation() {
+        for (double sigma: {0.2, 0.8, 1.5, 4.0}) {
+            for (int kernelSize: {1, 3, 7, 25}) {
+                auto kernel = generateGaussianKernel(sigma, kernelSize);
+                int shift = 0;
+                auto quantised = GaussianKernel::quantise(kernel, shift);
+                assert(shift > 0 && shift <= GaussianKernel::maxShift);
+
+                long total = 0;
+                for (size_t i = 0; i < kernel.size(); ++i) {
+                    total += quantised[i];
+                    assert(std::fabs(quantised[i] - kernel[i] * (1 << shift)) < 1.0 && "Quantised weight is too far off.");
+                }
+                assert(total == (1L << shift) && "Quantised weights do not sum to a power of two.");
+            }
+        }
+    }
+
+    /**
+     * Tests the Accuracy of the Fixed-Point Mode
+     *
+     * Filters the same pseudo-random volume in floating-point and fixed-point mode for several kernels and asserts that
+     * the largest difference between the two results is at most one grey level.
+     */
+    void testFixedPointAccuracy() {
+        int width = 31, height = 23, depth = 17;
+        std::vector<unsigned char> original(width * height * depth);
+        unsigned int state = 4242;
+        for (auto &value: original) {
+            state = state * 1103515245u + 12345u;
+            value = static_cast<unsigned char>(state >> 16);
+        }
+
+        for (auto [sigma, kernelSize]: {std::pair{0.8, 3}, std::pair{1.0, 5}, std::pair{2.0, 9}, std::pair{3.5, 21}}) {
+            auto floating = original, fixed = original;
+            Volume floatingVolume(width, height, depth, floating.data());
+            Volume fixedVolume(width, height, depth, fixed.data());
+            Gaussian3DFilter(sigma, kernelSize).apply(floatingVolume);
+            Gaussian3DFilter(sigma, kernelSize, GaussianMode::FixedPoint).apply(fixedVolume);
+
+            int maxError = 0;
+            for (size_t i = 0; i < original.size(); ++i) {
+                maxError = std::max(maxError, std::abs(floating[i] - fixed[i]));
+            }
+            assert(maxError <= 1 && "Fixed-point Gaussian differs from the floating-point result by more than 1.");
+        }
+    }
+
+    /**
+     * Tests the Recursive Mode Against the Direct Convolution
+     *
+     * For large sigma the recursive filter should agree with a kernel spanning four standard deviations either side to
+     * within two grey levels, leave a constant volume unchanged, and reject sigma values it cannot approximate.
+     */
+    void testRecursiveMode() {
+        int width = 40, height = 36, depth = 30;
+        std::vector<unsigned char> original(width * height * depth);
+        unsigned int state = 7;
+        for (auto &value: original) {
+            state = state * 1664525u + 1013904223u;
+            value = static_cast<unsigned char>(state >> 24);
+        }
+
+        for (double sigma: {4.0, 8.0}) {
+            int kernelSize = 2 * static_cast<int>(std::ceil(4.0 * sigma)) + 1;
+            auto direct = original, recursive = original;
+            Volume directVolume(width, height, depth, direct.data());
+            Volume recursiveVolume(width, height, depth, recursive.data());
+            Gaussian3DFilter(sigma, kernelSize).apply(directVolume);
+            Gaussian3DFilter(sigma, 1, GaussianMode::Recursive).apply(recursiveVolume);
+
+            int maxError = 0;
+            for (size_t i = 0; i < original.size(); ++i) {
+                maxError = std::max(maxError, std::abs(direct[i] - recursive[i]));
+            }
+            assert(maxError <= 2 && "Recursive Gaussian differs from the direct convolution by more than 2.");
+        }
+
+        std::vector<unsigned char> constant(original.size(), 173);
+        Volume constantVolume(width, height, depth, constant.data());
+        Gaussian3DFilter(20.0, 1, GaussianMode::Recursive).apply(constantVolume);
+        for (auto value: constant) {
+            assert(value == 173 && "Recursive Gaussian changed a constant volume.");
+        }
+
+        bool thrown = false;
+        try {
+            Gaussian3DFilter(0.3, 3, GaussianMode::Recursive);
+        } catch (const std::invalid_argument &) {
+            thrown = true;
+        }
+        assert(thrown && "Recursive Gaussian accepted a sigma below 0.5.");
+    }
+
     /**
      * Executes All Defined Test Cases for the Gaussian3DFilter
      *
@@ -244,6 +348,9 @@ public:
         runTest<TestGaussian3DFilter>(&TestGaussian3DFilter::testGaussianKernelGeneration, "Gaussian Kernel Generation");
         runTest<TestGaussian3DFilter>(&TestGaussian3DFilter::testApplyGaussianFilter, "Apply Gaussian3DFilter");
         runTest<TestGaussian3DFilter>(&TestGaussian3DFilter::testGaussianFilterSmoothness, "Gaussian3DFilter Smoothness");
+        runTest<TestGaussian3DFilter>(&TestGaussian3DFilter::testKernelQuantisation, "Gaussian Kernel Quantisation");
+        runTest<TestGaussian3DFilter>(&TestGaussian3DFilter::testFixedPointAccuracy, "Gaussian3DFilter Fixed-Point Accuracy");
+        runTest<TestGaussian3DFilter>(&TestGaussian3DFilter::testRecursiveMode, "Gaussian3DFilter Recursive Mode");
     }
 };
 
@@ -0,0 +1,444 @@
+/**
+ * @file TestImageStream.h
+ *
+ * @brief Unit Tests for the row-streaming PNG codec and band-by-band filtering.
+ *
+ * This header file defines the TestImageStream class, which checks that PNG files written row by row decode to the
+ * same pixels with stb_image and with the streaming reader, that the reader matches stb_image on every sample format
+ * it supports, that the incremental zlib encoder and decoder agree with the existing decoders whatever the sizes of
+ * their inputs and outputs, that filtering an image band by band gives exactly the result of filtering it whole, and
+ * that invalid input is reported.
+ *
+ * Usage:
+ * As an extension of the Test base class, the TestImageStream class implements the runTests method to execute all
+ * test cases through the Test class's runTest template method.
+ *
+ * @date Created on October 19, 2026.
+ *
+ * @authors
+ * Advanced Programming Group Radix Sort:
+ *   - Benjamin Duncan (edsml-bd1023)
+ *   - Boyang Hu (edsml-bh223)
+ *   - Chawk Chamoun (edsml-cc8915)
+ *   - Mingsheng Cai (acse-sc4623)
+ *   - Moyu Zhang (acse-mz223)
+ *   - Ryan Benney (acse-rgb123)
+ */
+
+#pragma once
+
+#include "Test.h"
+#include "Deflate.h"
+#include "Image.h"
+#include "ImageStream.h"
+#include "Inflate.h"
+#include "PngStream.h"
+#include "Filters/Box2DFilter.h"
+#include "Filters/EdgeFilter.h"
+#include "Filters/Gaussian2DFilter.h"
+#include "Filters/Median2DFilter.h"
+#include "stb_image.h"
+#include "stb_image_write.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cstdlib>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <vector>
+
+class TestImageStream : public Test {
+private:
+    // Small PNG files written with zlib, covering the sample formats stb_image_write does not produce
+    static inline const std::vector<unsigned char> grey16Png = { // 16-bit grey-scale, data split over three IDATs
+        0x89, 0x50, 0x4E, 0x47, 0x0D, 0x0A, 0x1A, 0x0A, 0x00, 0x00, 0x00, 0x0D, 0x49, 0x48, 0x44, 0x52, 0x00, 0x00,
+        0x00, 0x05, 0x00, 0x00, 0x00, 0x03, 0x10, 0x00, 0x00, 0x00, 0x00, 0x2E, 0xCD, 0x46, 0x67, 0x00, 0x00, 0x00,
+        0x01, 0x49, 0x44, 0x41, 0x54, 0x78, 0x76, 0xE6, 0x84, 0xE6, 0x00, 0x00, 0x00, 0x07, 0x49, 0x44, 0x41, 0x54,
+        0xDA, 0x63, 0x60, 0xA8, 0x56, 0x5E, 0xEC, 0x3C, 0xDD, 0x30, 0xF7, 0x00, 0x00, 0x00, 0x22, 0x49, 0x44, 0x41,
+        0x54, 0x76, 0x3A, 0xF3, 0x73, 0xAF, 0x34, 0x83, 0xD3, 0xE3, 0x34, 0xEE, 0x4E, 0xE3, 0x35, 0xD1, 0xE7, 0x9B,
+        0x19, 0x5A, 0xBD, 0x57, 0x14, 0x9F, 0x9E, 0xFD, 0xEE, 0xB0, 0xE0, 0x6B, 0x00, 0xDF, 0x3F, 0x0F, 0x00, 0x9B,
+        0xE5, 0xFB, 0x9F, 0x00, 0x00, 0x00, 0x00, 0x49, 0x45, 0x4E, 0x44, 0xAE, 0x42, 0x60, 0x82
+    };
+    static inline const std::vector<unsigned char> palettePng = { // 2-bit palette with tRNS alpha
+        0x89, 0x50, 0x4E, 0x47, 0x0D, 0x0A, 0x1A, 0x0A, 0x00, 0x00, 0x00, 0x0D, 0x49, 0x48, 0x44, 0x52, 0x00, 0x00,
+        0x00, 0x07, 0x00, 0x00, 0x00, 0x03, 0x02, 0x03, 0x00, 0x00, 0x00, 0x22, 0xAD, 0xFD, 0x56, 0x00, 0x00, 0x00,
+        0x0C, 0x50, 0x4C, 0x54, 0x45, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x0A, 0x14, 0x1E, 0x22,
+        0x88, 0x29, 0x04, 0x00, 0x00, 0x00, 0x03, 0x74, 0x52, 0x4E, 0x53, 0xFF, 0x80, 0x00, 0x7F, 0x6D, 0x68, 0x78,
+        0x00, 0x00, 0x00, 0x11, 0x49, 0x44, 0x41, 0x54, 0x78, 0xDA, 0x63, 0x90, 0x96, 0x60, 0xC8, 0xC9, 0x61, 0xD8,
+        0xB8, 0x01, 0x00, 0x07, 0x67, 0x02, 0x6D, 0xB1, 0xC3, 0x54, 0x87, 0x00, 0x00, 0x00, 0x00, 0x49, 0x45, 0x4E,
+        0x44, 0xAE, 0x42, 0x60, 0x82
+    };
+    static inline const std::vector<unsigned char> oneBitPng = { // 1-bit grey-scale
+        0x89, 0x50, 0x4E, 0x47, 0x0D, 0x0A, 0x1A, 0x0A, 0x00, 0x00, 0x00, 0x0D, 0x49, 0x48, 0x44, 0x52, 0x00, 0x00,
+        0x00, 0x0A, 0x00, 0x00, 0x00, 0x02, 0x01, 0x00, 0x00, 0x00, 0x00, 0x49, 0x1A, 0x70, 0x7D, 0x00, 0x00, 0x00,
+        0x0E, 0x49, 0x44, 0x41, 0x54, 0x78, 0xDA, 0x63, 0x08, 0x75, 0x60, 0x58, 0xD5, 0x00, 0x00, 0x04, 0x83, 0x01,
+        0xC0, 0xFD, 0xFB, 0x4F, 0xD9, 0x00, 0x00, 0x00, 0x00, 0x49, 0x45, 0x4E, 0x44, 0xAE, 0x42, 0x60, 0x82
+    };
+    static inline const std::vector<unsigned char> colourKeyPng = { // RGB with a tRNS colour key, filters 1 to 4
+        0x89, 0x50, 0x4E, 0x47, 0x0D, 0x0A, 0x1A, 0x0A, 0x00, 0x00, 0x00, 0x0D, 0x49, 0x48, 0x44, 0x52, 0x00, 0x00,
+        0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x08, 0x02, 0x00, 0x00, 0x00, 0x26, 0x93, 0x09, 0x29, 0x00, 0x00, 0x00,
+        0x06, 0x74, 0x52, 0x4E, 0x53, 0x00, 0x01, 0x00, 0x02, 0x00, 0x03, 0xC9, 0x4B, 0xAB, 0xF5, 0x00, 0x00, 0x00,
+        0x3B, 0x49, 0x44, 0x41, 0x54, 0x78, 0xDA, 0x63, 0x64, 0x64, 0x62, 0x56, 0xFF, 0xC7, 0xA2, 0xC1, 0xC0, 0xB0,
+        0x91, 0xE9, 0x0F, 0xD3, 0x7F, 0x2B, 0x16, 0x06, 0x1B, 0x10, 0xAB, 0xDC, 0x8A, 0x85, 0x99, 0x21, 0x8A, 0xE5,
+        0xED, 0x8A, 0x3F, 0xFE, 0x65, 0x2C, 0x22, 0x72, 0x0C, 0x2C, 0x8C, 0x5D, 0x7F, 0xD4, 0x37, 0xB1, 0x30, 0x30,
+        0x30, 0x74, 0xFA, 0xFD, 0x01, 0x00, 0x6D, 0xE9, 0x0F, 0x0F, 0xE1, 0x16, 0xE4, 0x95, 0x00, 0x00, 0x00, 0x00,
+        0x49, 0x45, 0x4E, 0x44, 0xAE, 0x42, 0x60, 0x82
+    };
+    static inline const std::vector<unsigned char> interlacedPng = { // Adam7 interlaced grey-scale
+        0x89, 0x50, 0x4E, 0x47, 0x0D, 0x0A, 0x1A, 0x0A, 0x00, 0x00, 0x00, 0x0D, 0x49, 0x48, 0x44, 0x52, 0x00, 0x00,
+        0x00, 0x02, 0x00, 0x00, 0x00, 0x02, 0x08, 0x00, 0x00, 0x00, 0x01, 0x20, 0xDA, 0x62, 0x6E, 0x00, 0x00, 0x00,
+        0x0E, 0x49, 0x44, 0x41, 0x54, 0x78, 0xDA, 0x63, 0x60, 0x64, 0x62, 0x60, 0x66, 0x01, 0x00, 0x00, 0x1D, 0x00,
+        0x0B, 0x10, 0xDD, 0x1C, 0x70, 0x00, 0x00, 0x00, 0x00, 0x49, 0x45, 0x4E, 0x44, 0xAE, 0x42, 0x60, 0x82
+    };
+
+    static std::string tempPath(const std::string &name) {
+        return (std::filesystem::temp_directory_path() / name).string();
+    }
+
+    static void writeFile(const std::string &path, const std::vector<unsigned char> &bytes) {
+        std::ofstream file(path, std::ios::binary);
+        file.write(reinterpret_cast<const char *>(bytes.data()), static_cast<std::streamsize>(bytes.size()));
+    }
+
+    // Pseudo-random pixels with smooth areas, so they both compress and exercise every PNG filter
+    static std::vector<unsigned char> pixels(int width, int height, int channels, uint32_t seed) {
+        std::vector<unsigned char> data(static_cast<size_t>(width) * height * channels);
+        uint32_t state = seed;
+        for (size_t i = 0; i < data.size(); ++i) {
+            state = state * 1103515245u + 12345u;
+            size_t pixel = i / channels;
+            data[i] = (state >> 16) % 3 == 0 ? static_cast<unsigned char>(state >> 8)
+                                              : static_cast<unsigned char>(pixel % width + pixel / width * 3);
+        }
+        return data;
+    }
+
+    // Decodes a whole file with PngReader
+    static bool readAll(const std::string &path, int desiredChannels, std::vector<unsigned char> &out) {
+        PngReader reader;
+        if (!reader.open(path, desiredChannels)) {
+            return false;
+        }
+        size_t rowBytes = static_cast<size_t>(reader.getWidth()) * reader.getChannels();
+        out.assign(rowBytes * reader.getHeight(), 0);
+        for (int y = 0; y < reader.getHeight(); ++y) {
+            if (!reader.readRow(out.data() + y * rowBytes)) {
+                return false;
+            }
+        }
+        return reader.getRowsRead() == reader.getHeight();
+    }
+
+    // Checks that PngReader and stb_image decode a file to the same pixels
+    static bool matchesStb(const std::string &path, int desiredChannels) {
+        int width, height, channels;
+        unsigned char *expected = stbi_load(path.c_str(), &width, &height, &channels, desiredChannels);
+        if (!expected) {
+            return false;
+        }
+        int outChannels = desiredChannels ? desiredChannels : channels;
+        std::vector<unsigned char> actual;
+        PngReader reader;
+        bool same = readAll(path, desiredChannels, actual) && reader.open(path, desiredChannels) &&
+                    reader.getWidth() == width && reader.getHeight() == height &&
+                    reader.getChannels() == outChannels &&
+                    actual.size() == static_cast<size_t>(width) * height * outChannels &&
+                    std::memcmp(actual.data(), expected, actual.size()) == 0;
+        stbi_image_free(expected);
+        return same;
+    }
+
+    static bool writePng(const std::string &path, int width, int height, int channels,
+                         const std::vector<unsigned char> &data) {
+        PngWriter writer;
+        if (!writer.open(path, width, height, channels)) {
+            return false;
+        }
+        size_t rowBytes = static_cast<size_t>(width) * channels;
+        for (int y = 0; y < height; ++y) {
+            if (!writer.writeRow(data.data() + y * rowBytes)) {
+                return false;
+            }
+        }
+        return writer.close();
+    }
+
+    // Compares an output PNG with an image filtered in memory
+    static bool sameAs(const std::string &path, const Image &image) {
+        int width, height, channels;
+        unsigned char *loaded = stbi_load(path.c_str(), &width, &height, &channels, 0);
+        if (!loaded) {
+            return false;
+        }
+        bool same = width == image.getWidth() && height == image.getHeight() && channels == image.getChannels() &&
+                    std::memcmp(loaded, image.getData(), static_cast<size_t>(width) * height * channels) == 0;
+        stbi_image_free(loaded);
+        return same;
+    }
+
+public:
+    /**
+     * @brief Test the PNG writer and reader against stb_image.
+     *
+     * Writes images of one to four channels with PngWriter and checks that stb_image and PngReader decode them to
+     * the written pixels, including an image large enough to span several IDAT chunks and slide the compression
+     * window, and checks that PngReader decodes a file written by stb_image_write.
+     */
+    void testCodecRoundTrip() {
+        std::string path = tempPath("test_png_stream.png");
+        for (int channels = 1; channels <= 4; ++channels) {
+            auto data = pixels(61, 37, channels, 5 + channels);
+            bool written = writePng(path, 61, 37, channels, data);
+            assert(written && "Writing a PNG file row by row failed.");
+            int width, height, stored;
+            unsigned char *decoded = stbi_load(path.c_str(), &width, &height, &stored, 0);
+            assert(decoded && width == 61 && height == 37 && stored == channels &&
+                   std::memcmp(decoded, data.data(), data.size()) == 0 && "stb_image decoded a different image.");
+            stbi_image_free(decoded);
+            std::vector<unsigned char> read;
+            bool ok = readAll(path, 0, read);
+            assert(ok && read == data && "PngReader decoded a different image.");
+        }
+
+        auto large = pixels(700, 300, 3, 41);
+        bool written = writePng(path, 700, 300, 3, large);
+        assert(written && std::filesystem::file_size(path) > 2 * PngWriter::chunkSize &&
+               "A large PNG file was not written in several chunks.");
+        std::vector<unsigned char> read;
+        bool ok = readAll(path, 0, read);
+        assert(ok && read == large && "A large PNG file did not survive a streamed round trip.");
+        ok = matchesStb(path, 3);
+        assert(ok && "stb_image decoded a large streamed PNG file differently.");
+
+        auto data = pixels(45, 29, 4, 3);
+        stbi_write_png(path.c_str(), 45, 29, 4, data.data(), 45 * 4);
+        ok = readAll(path, 0, read);
+        assert(ok && read == data && "PngReader decoded a file written by stb_image_write differently.");
+        PngReader reader;
+        reader.open(path);
+        for (int y = 0; y < 29; ++y) {
+            reader.readRow(read.data());
+        }
+        ok = reader.readRow(read.data());
+        assert(!ok && "PngReader read a row past the end of the image.");
+        std::filesystem::remove(path);
+    }
+
+    /**
+     * @brief Test PngReader on the sample formats of PNG.
+     *
+     * Decodes 16-bit and 1-bit grey-scale, palette and colour-keyed files with and without channel conversion and
+     * compares the result with stb_image; interlaced files must be reported as unsupported.
+     */
+    void testPngFormats() {
+        std::string path = tempPath("test_png_formats.png");
+        for (const auto *bytes: {&grey16Png, &palettePng, &oneBitPng, &colourKeyPng}) {
+            writeFile(path, *bytes);
+            for (int channels = 0; channels <= 4; ++channels) {
+                bool same = matchesStb(path, channels);
+                assert(same && "PngReader and stb_image disagree on a PNG sample format.");
+            }
+        }
+
+        writeFile(path, interlacedPng);
+        PngReader reader;
+        bool opened = reader.open(path);
+        assert(!opened && !reader.isOpen() && "An interlaced PNG file was opened.");
+        std::filesystem::remove(path);
+    }
+
+    /**
+     * @brief Test the incremental zlib encoder and decoder.
+     *
+     * Compresses data in pieces of varying sizes with DeflateStream, checks that stb_image and Inflate::inflate
+     * decode it, and decodes it again with InflateStream from many small pieces into reads of varying sizes.
+     */
+    void testInflateStream() {
+        std::vector<unsigned char> data = pixels(1000, 100, 3, 17);
+        for (size_t i = 100000; i < 160000; ++i) {
+            data[i] = data[i - 70000]; // Repeats beyond the reach of a match
+        }
+        DeflateStream deflater;
+        std::vector<unsigned char> compressed;
+        for (size_t done = 0, piece = 1; done < data.size(); piece = piece * 3 % 9973 + 1) {
+            size_t count = std::min(piece, data.size() - done);
+            deflater.write(data.data() + done, count, compressed);
+            done += count;
+        }
+        deflater.finish(compressed);
+        assert(compressed.size() < data.size() && "DeflateStream did not compress repetitive data.");
+
+        int length = 0;
+        char *decoded = stbi_zlib_decode_malloc(reinterpret_cast<const char *>(compressed.data()),
+                                                static_cast<int>(compressed.size()), &length);
+        assert(decoded && static_cast<size_t>(length) == data.size() &&
+               std::memcmp(decoded, data.data(), data.size()) == 0 && "stb_image could not decode DeflateStream.");
+        std::free(decoded);
+        std::vector<unsigned char> inflated(data.size());
+        size_t written = 0, consumed = 0;
+        bool ok = Inflate::inflate(compressed.data() + 2, compressed.size() - 2, inflated.data(), inflated.size(),
+                                   written, consumed);
+        assert(ok && written == data.size() && consumed + 6 == compressed.size() && inflated == data &&
+               "Inflate could not decode DeflateStream.");
+
+        InflateStream stream;
+        for (size_t done = 2, piece = 1; done < compressed.size(); piece = piece * 5 % 613 + 1) {
+            size_t count = std::min(piece, compressed.size() - done);
+            stream.addInput(compressed.data() + done, count);
+            done += count;
+        }
+        std::vector<unsigned char> streamed;
+        std::vector<unsigned char> buffer(777);
+        for (size_t want = 1, read = 1; read > 0; want = want * 7 % buffer.size() + 1) {
+            read = stream.read(buffer.data(), want);
+            streamed.insert(streamed.end(), buffer.begin(), buffer.begin() + static_cast<long>(read));
+        }
+        assert(!stream.hasFailed() && stream.isFinished() && streamed == data &&
+               "InflateStream decoded a different stream.");
+
+        InflateStream corrupt;
+        unsigned char reserved[] = {0x07}; // Final block of the reserved type 3
+        corrupt.addInput(reserved, 1);
+        size_t read = corrupt.read(buffer.data(), buffer.size());
+        assert(read == 0 && corrupt.hasFailed() && "InflateStream accepted a reserved block type.");
+    }
+
+    /**
+     * @brief Test band-by-band filtering against filtering in memory.
+     *
+     * Filters images band by band with chains of box, Gaussian, median and edge filters and several band heights,
+     * and checks that the output equals loading the image, applying the filters in turn and saving it.
+     */
+    void testFilterPng() {
+        std::string input = tempPath("test_image_stream_input.png"), output = tempPath("test_image_stream_output.png");
+        auto data = pixels(97, 83, 3, 23);
+        stbi_write_png(input.c_str(), 97, 83, 3, data.data(), 97 * 3);
+
+        Box2DFilter box(5, PaddingType::EdgeReplication);
+        Gaussian2DFilter gaussian(7, 1.5, PaddingType::ReflectPadding);
+        Median2DFilter median(3);
+        std::vector<StreamFilter> chain = {
+            {2, [&](Image &image, const Region2D &region) { box.apply(image, region); }},
+            {3, [&](Image &image, const Region2D &region) { gaussian.apply(image, region); }},
+            {1, [&](Image &image, const Region2D &region) { median.apply(image, region); }},
+        };
+        Image expected;
+        expected.loadFromFile(input);
+        box.apply(expected);
+        gaussian.apply(expected);
+        median.apply(expected);
+        for (int bandRows: {1, 8, 32, 500}) {
+            bool filtered = ImageStream::filterPng(input, output, chain, 0, bandRows);
+            assert(filtered && "Filtering a PNG file band by band failed.");
+            bool same = sameAs(output, expected);
+            assert(same && "Band-by-band filtering differs from filtering the whole image.");
+        }
+
+        EdgeFilter sobel(FilterType::Sobel, PaddingType::EdgeReplication);
+        std::vector<StreamFilter> edges = {
+            {1, [&](Image &image, const Region2D &region) { median.apply(image, region); }},
+            {2, [&](Image &image, const Region2D &region) { sobel.apply(image, region); }},
+        };
+        bool filtered = ImageStream::filterPng(input, output, edges, 1, 5);
+        assert(filtered && "Edge filtering a PNG file band by band failed.");
+        int width, height, channels;
+        unsigned char *luma = stbi_load(input.c_str(), &width, &height, &channels, 1);
+        Image expectedEdges(width, height, 1, luma);
+        stbi_image_free(luma);
+        median.apply(expectedEdges);
+        sobel.apply(expectedEdges);
+        bool same = sameAs(output, expectedEdges);
+        assert(same && "Band-by-band edge filtering differs from filtering the whole image.");
+
+        filtered = ImageStream::filterPng(input, output, {}, 2, 7);
+        std::vector<unsigned char> converted;
+        bool ok = readAll(output, 0, converted) && matchesStb(input, 2);
+        assert(filtered && ok && converted.size() == data.size() / 3 * 2 &&
+               "Streaming a PNG file without filters did not copy it.");
+        std::filesystem::remove(input);
+        std::filesystem::remove(output);
+    }
+
+    /**
+     * @brief Test the handling of invalid input.
+     *
+     * Missing, foreign, truncated and corrupt files, invalid band heights and filters, and a writer closed before
+     * its last row must be reported as failures.
+     */
+    void testInvalidInput() {
+        std::string input = tempPath("test_image_stream_invalid.png"), output = tempPath("test_image_stream_out.png");
+        std::filesystem::remove(input);
+        PngReader reader;
+        bool opened = reader.open(input);
+        assert(!opened && "A missing PNG file was opened.");
+        bool filtered = ImageStream::filterPng(input, output, {});
+        assert(!filtered && "A missing PNG file was filtered.");
+
+        writeFile(input, {'n', 'o', 't', ' ', 'a', ' ', 'p', 'n', 'g', ' ', 'f', 'i', 'l', 'e'});
+        opened = reader.open(input);
+        assert(!opened && "A file that is not a PNG file was opened.");
+
+        auto data = pixels(50, 40, 3, 29);
+        writePng(input, 50, 40, 3, data);
+        filtered = ImageStream::filterPng(input, output, {}, 0, 0);
+        assert(!filtered && "A PNG file was filtered in empty bands.");
+        Median2DFilter median(3);
+        filtered = ImageStream::filterPng(input, output,
+                                          {{-1, [&](Image &image, const Region2D &region) {
+                                              median.apply(image, region);
+                                          }}});
+        assert(!filtered && "A filter with a negative radius was accepted.");
+        filtered = ImageStream::filterPng(input, output, {{1, nullptr}});
+        assert(!filtered && "A filter without a function was accepted.");
+
+        // Cut the file in the middle of its compressed data
+        std::filesystem::resize_file(input, std::filesystem::file_size(input) / 2);
+        opened = reader.open(input);
+        std::vector<unsigned char> row(50 * 3);
+        bool all = opened;
+        for (int y = 0; all && y < 40; ++y) {
+            all = reader.readRow(row.data());
+        }
+        assert(!all && "A truncated PNG file was decoded.");
+        filtered = ImageStream::filterPng(input, output, {});
+        assert(!filtered && "A truncated PNG file was filtered.");
+
+        // Corrupt the compressed data with a reserved block type
+        writePng(input, 50, 40, 3, data);
+        {
+            std::fstream file(input, std::ios::binary | std::ios::in | std::ios::out);
+            file.seekp(8 + 25 + 8 + 2);
+            file.put(static_cast<char>(0x07));
+        }
+        bool ok = readAll(input, 0, data);
+        assert(!ok && "A PNG file with corrupt compressed data was decoded.");
+
+        PngWriter writer;
+        opened = writer.open(output, 4, 3, 1);
+        unsigned char zeros[4] = {};
+        writer.writeRow(zeros);
+        bool closed = writer.close();
+        assert(opened && !closed && "A PNG file with missing rows was closed.");
+        opened = writer.open(output, 0, 3, 1);
+        assert(!opened && "A PNG file with no columns was created.");
+        opened = writer.open(output, 4, 3, 5);
+        assert(!opened && "A PNG file with five channels was created.");
+        std::filesystem::remove(input);
+        std::filesystem::remove(output);
+    }
+
+    /**
+     * @brief Run all tests
+     *
+     * Runs all the tests for the row-streaming PNG codec and band-by-band filtering.
+     */
+    void runTests() override {
+        runTest<TestImageStream>(&TestImageStream::testCodecRoundTrip, "Codec Round Trip");
+        runTest<TestImageStream>(&TestImageStream::testPngFormats, "PNG Formats");
+        runTest<TestImageStream>(&TestImageStream::testInflateStream, "Inflate Stream");
+        runTest<TestImageStream>(&TestImageStream::testFilterPng, "Filter PNG");
+        runTest<TestImageStream>(&TestImageStream::testInvalidInput, "Invalid Input");
+    }
+};
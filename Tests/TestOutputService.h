@@ -0,0 +1,165 @@
+/**
+ * @file TestOutputService.h
+ *
+ * @brief Unit Tests for the background output service.
+ *
+ * This header file defines the TestOutputService class, which checks that nested output directories are created and
+ * remembered, that files queued from a bounded queue are all written with the right content, that each failed file is
+ * reported once through its future and through flush, and that Image and Volume saves go through the service.
+ *
+ * Usage:
+ * As an extension of the Test base class, the TestOutputService class implements the runTests method to execute all
+ * test cases through the Test class's runTest template method.
+ *
+ * @date Created on October 19, 2026.
+ *
+ * @authors
+ * Advanced Programming Group Radix Sort:
+ *   - Benjamin Duncan (edsml-bd1023)
+ *   - Boyang Hu (edsml-bh223)
+ *   - Chawk Chamoun (edsml-cc8915)
+ *   - Mingsheng Cai (acse-sc4623)
+ *   - Moyu Zhang (acse-mz223)
+ *   - Ryan Benney (acse-rgb123)
+ */
+
+#pragma once
+
+#include "Test.h"
+#include "Image.h"
+#include "OutputService.h"
+#include "Volume.h"
+
+#include <cassert>
+#include <filesystem>
+#include <fstream>
+#include <future>
+#include <string>
+#include <vector>
+
+class TestOutputService : public Test {
+private:
+    static std::filesystem::path tempDirectory(const std::string &name) {
+        auto directory = std::filesystem::temp_directory_path() / name;
+        std::filesystem::remove_all(directory);
+        return directory;
+    }
+
+public:
+    /**
+     * @brief Test Directory Creation
+     *
+     * Creates a nested directory twice, again after removing it, and checks that a directory cannot be created where a
+     * file exists.
+     */
+    void testDirectoryCreation() {
+        auto root = tempDirectory("test_output_directories");
+        OutputService service(1);
+        std::string nested = (root / "a" / "b" / "c").string();
+        bool created = service.ensureDirectory(nested);
+        assert(created && std::filesystem::is_directory(nested) && "A nested directory was not created.");
+        created = service.ensureDirectory(nested);
+        assert(created && "A known directory was reported as missing.");
+        std::filesystem::remove_all(root / "a");
+        created = service.ensureDirectory(nested);
+        assert(created && std::filesystem::is_directory(nested) && "A removed directory was not created again.");
+
+        std::ofstream((root / "file").string()) << "x";
+        created = service.ensureDirectory((root / "file" / "sub").string());
+        assert(!created && "A directory was created below a file.");
+        std::filesystem::remove_all(root);
+    }
+
+    /**
+     * @brief Test Background Writes
+     *
+     * Queues more files than the queue holds and checks that every file is written and loads back unchanged.
+     */
+    void testBackgroundWrites() {
+        auto root = tempDirectory("test_output_writes");
+        OutputService service(2, 4);
+        const int count = 40, width = 9, height = 7;
+        std::vector<std::future<bool>> results;
+        for (int i = 0; i < count; ++i) {
+            std::vector<unsigned char> pixels(width * height, static_cast<unsigned char>(i * 5));
+            std::string path = (root / ("batch" + std::to_string(i % 3)) / ("image_" + std::to_string(i) + ".png"))
+                    .string();
+            results.push_back(service.submitPng(path, width, height, 1, std::move(pixels)));
+        }
+        auto errors = service.flush();
+        assert(errors.empty() && service.getPendingCount() == 0 && "Background writes failed.");
+
+        for (int i = 0; i < count; ++i) {
+            assert(results[i].get() && "A written file reported a failure.");
+            Image image;
+            bool loaded = image.loadFromFile(
+                    (root / ("batch" + std::to_string(i % 3)) / ("image_" + std::to_string(i) + ".png")).string());
+            assert(loaded && image.getWidth() == width && image.getHeight() == height &&
+                   image.getData()[width * height - 1] == i * 5 && "A background write has the wrong content.");
+        }
+        std::filesystem::remove_all(root);
+    }
+
+    /**
+     * @brief Test Error Reporting
+     *
+     * Submits files that cannot be written and checks that each is reported through its future and once through flush.
+     */
+    void testErrorReporting() {
+        auto root = tempDirectory("test_output_errors");
+        std::filesystem::create_directories(root);
+        std::ofstream((root / "file").string()) << "x";
+        OutputService service(1);
+
+        std::string blocked = (root / "file" / "image.png").string();
+        auto first = service.submitPng(blocked, 2, 2, 1, std::vector<unsigned char>(4, 0));
+        auto second = service.submitPng((root / "short.png").string(), 2, 2, 1, std::vector<unsigned char>(3, 0));
+        auto third = service.submitPng((root / "fine.png").string(), 2, 2, 1, std::vector<unsigned char>(4, 0));
+        auto errors = service.flush();
+        assert(!first.get() && !second.get() && third.get() && "The futures report the wrong outcomes.");
+        assert(errors.size() == 2 && errors[0].path == blocked && "The failed files were not reported.");
+        errors = service.flush();
+        assert(errors.empty() && "Failures were reported twice.");
+        std::filesystem::remove_all(root);
+    }
+
+    /**
+     * @brief Test Image And Volume Saves
+     *
+     * Saves an image synchronously and asynchronously into missing directories and a volume as a stack of slices.
+     */
+    void testImageAndVolumeSaves() {
+        auto root = tempDirectory("test_output_saves");
+        std::vector<unsigned char> pixels(6 * 4 * 3, 200);
+        Image image(6, 4, 3, pixels.data());
+
+        bool saved = image.saveToFile((root / "sync" / "deep" / "image.png").string());
+        assert(saved && std::filesystem::exists(root / "sync" / "deep" / "image.png") && "A synchronous save failed.");
+        saved = image.saveToFileAsync((root / "async" / "image.png").string());
+        auto errors = OutputService::global().flush();
+        assert(saved && errors.empty() && std::filesystem::exists(root / "async" / "image.png") &&
+               "An asynchronous save failed.");
+
+        std::vector<unsigned char> voxels(5 * 4 * 6, 90);
+        Volume volume(5, 4, 6, voxels.data());
+        volume.save((root / "volume").string(), "x-z");
+        for (int i = 1; i <= 4; ++i) {
+            Image slice;
+            bool loaded = slice.loadFromFile((root / "volume" / ("slice_" + std::to_string(i) + ".png")).string());
+            assert(loaded && slice.getWidth() == 5 && slice.getHeight() == 6 && "A volume slice was not saved.");
+        }
+        std::filesystem::remove_all(root);
+    }
+
+    /**
+     * @brief Run all tests
+     *
+     * Runs all the tests for the output service.
+     */
+    void runTests() override {
+        runTest<TestOutputService>(&TestOutputService::testDirectoryCreation, "Directory Creation");
+        runTest<TestOutputService>(&TestOutputService::testBackgroundWrites, "Background Writes");
+        runTest<TestOutputService>(&TestOutputService::testErrorReporting, "Error Reporting");
+        runTest<TestOutputService>(&TestOutputService::testImageAndVolumeSaves, "Image And Volume Saves");
+    }
+};
@@ -0,0 +1,318 @@
+/**
+ * @file TestProcessingServer.h
+ *
+ * @brief Unit Tests for the resident processing server and its client.
+ *
+ * This header file defines the TestProcessingServer class, which runs a server on a temporary Unix domain socket and
+ * checks that slices, projections and filtered images it returns match those computed directly, that inputs are loaded
+ * once and then served from memory to several concurrent clients, that malformed requests are answered with errors
+ * without closing the connection, that the least recently used inputs are evicted to stay within the capacity, and
+ * that a file other than a socket at the socket path is never removed.
+ *
+ * Usage:
+ * As an extension of the Test base class, the TestProcessingServer class implements the runTests method to execute all
+ * test cases through the Test class's runTest template method.
+ *
+ * @date Created on October 19, 2026.
+ *
+ * @authors
+ * Advanced Programming Group Radix Sort:
+ *   - Benjamin Duncan (edsml-bd1023)
+ *   - Boyang Hu (edsml-bh223)
+ *   - Chawk Chamoun (edsml-cc8915)
+ *   - Mingsheng Cai (acse-sc4623)
+ *   - Moyu Zhang (acse-mz223)
+ *   - Ryan Benney (acse-rgb123)
+ */
+
+#pragma once
+
+#include "Test.h"
+#include "Image.h"
+#include "ProcessingClient.h"
+#include "ProcessingServer.h"
+#include "Projection.h"
+#include "Slice.h"
+#include "Volume.h"
+#include "VolumeFormats.h"
+#include "Filters/Box2DFilter.h"
+#include "Filters/Gaussian3DFilter.h"
+#include "Filters/Median3DFilter.h"
+
+#include <cassert>
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+class TestProcessingServer : public Test {
+private:
+    static constexpr int width = 14, height = 10, depth = 8;
+
+    static Volume randomVolume(unsigned int seed) {
+        size_t count = static_cast<size_t>(width) * height * depth;
+        Buffer data(count);
+        for (size_t i = 0; i < count; ++i) {
+            seed = seed * 1664525u + 1013904223u;
+            data.getData()[i] = static_cast<unsigned char>(seed >> 24);
+        }
+        return Volume(width, height, depth, std::move(data));
+    }
+
+    // A fresh directory under the temporary directory
+    static std::filesystem::path directoryFor(const std::string &name) {
+        auto directory = std::filesystem::temp_directory_path() / name;
+        std::filesystem::remove_all(directory);
+        std::filesystem::create_directories(directory);
+        return directory;
+    }
+
+    // A server running on its own thread
+    struct RunningServer {
+        std::string socketPath;
+        std::unique_ptr<ProcessingServer> server;
+        std::thread thread;
+
+        RunningServer(const std::string &socketPath, int workers, size_t capacityBytes)
+                : socketPath(socketPath),
+                  server(std::make_unique<ProcessingServer>(socketPath, workers, capacityBytes)) {
+            std::filesystem::remove(socketPath);
+            thread = std::thread([this]() { server->run(); });
+        }
+
+        // Connects a client, retrying while the server starts
+        bool connect(ProcessingClient &client) const {
+            for (int attempt = 0; attempt < 200; ++attempt) {
+                if (std::filesystem::exists(socketPath) && client.connect(socketPath)) {
+                    return true;
+                }
+                std::this_thread::sleep_for(std::chrono::milliseconds(10));
+            }
+            return false;
+        }
+
+        // Sends SHUTDOWN and waits for run to return
+        void shutdown() {
+            ProcessingClient client;
+            ProcessingResponse response;
+            if (connect(client)) {
+                client.request("SHUTDOWN", response);
+            } else {
+                server->stop();
+            }
+            thread.join();
+        }
+    };
+
+    static std::string socketPathFor(const std::string &name) {
+        return (std::filesystem::temp_directory_path() / (name + ".sock")).string();
+    }
+
+public:
+    /**
+     * @brief Test that slices, projections and filtered images match those computed directly.
+     */
+    void testRequests() {
+        auto directory = directoryFor("test_processing_server_requests");
+        std::string volumePath = (directory / "volume.nrrd").string();
+        std::string imagePath = (directory / "image.png").string();
+        bool saved = VolumeFormats::save(randomVolume(3), volumePath);
+        Volume source = randomVolume(5);
+        Image image(width, height, 1, source.getData());
+        saved = saved && image.saveToFile(imagePath);
+        assert(saved && "Could not write the test inputs.");
+
+        RunningServer running(socketPathFor("test_processing_server_requests"), 2,
+                              ProcessingServer::defaultCapacityBytes);
+        ProcessingClient client;
+        ProcessingResponse response;
+        bool answered = running.connect(client) && client.request("PING", response);
+        assert(answered && response.ok && response.data.empty() && "PING was not answered.");
+
+        Volume gaussian = randomVolume(3);
+        Gaussian3DFilter(1.0, 3).apply(gaussian);
+        auto expected = Slice::getPlaneSlice(width, height, depth, gaussian.getData(), "x-z", 4);
+        answered = client.request("SLICE " + volumePath + " x-z 4 gaussian:1.0:3", response);
+        assert(answered && response.ok && response.width == width && response.height == depth &&
+               response.channels == 1 && response.data == expected && "A filtered slice differs.");
+
+        Volume median = randomVolume(3);
+        Median3DFilter(3).apply(median);
+        expected = Projection::maximumIntensityProjection(width, height, depth, median.getData());
+        answered = client.request("PROJECT " + volumePath + " MIP all median:3", response);
+        assert(answered && response.ok && response.width == width && response.height == height &&
+               response.data == expected && "A filtered projection differs.");
+
+        Volume plain = randomVolume(3);
+        expected = Projection::minimumIntensityProjection(width, height, 3, plain.getData() + width * height * 2);
+        answered = client.request("PROJECT " + volumePath + " MinIP 3:5", response);
+        assert(answered && response.ok && response.data == expected && "A projection of a range differs.");
+
+        Image filtered(width, height, 1, source.getData());
+        Box2DFilter(3).apply(filtered);
+        expected.assign(filtered.getData(), filtered.getData() + width * height);
+        answered = client.request("IMAGE " + imagePath + " box:3", response);
+        assert(answered && response.ok && response.width == width && response.height == height &&
+               response.data == expected && "A filtered image differs.");
+
+        bool counted = running.server->getMisses() == 2 && running.server->getHits() == 2 &&
+                       running.server->getCachedBytes() == static_cast<size_t>(width) * height * (depth + 1);
+        assert(counted && "The inputs were not loaded once each.");
+
+        client.close();
+        running.shutdown();
+        bool removed = !std::filesystem::exists(running.socketPath);
+        assert(removed && "The socket was left behind.");
+        std::filesystem::remove_all(directory);
+    }
+
+    /**
+     * @brief Test that several clients are served at once from the cached volume.
+     */
+    void testConcurrentClients() {
+        auto directory = directoryFor("test_processing_server_concurrent");
+        std::string volumePath = (directory / "volume.nrrd").string();
+        bool saved = VolumeFormats::save(randomVolume(7), volumePath);
+        assert(saved && "Could not write the test volume.");
+
+        RunningServer running(socketPathFor("test_processing_server_concurrent"), 4,
+                              ProcessingServer::defaultCapacityBytes);
+        ProcessingClient first;
+        ProcessingResponse response;
+        bool answered = running.connect(first) && first.request("SLICE " + volumePath + " y-z 1", response);
+        assert(answered && response.ok && "The first request failed.");
+
+        Volume volume = randomVolume(7);
+        Median3DFilter(3).apply(volume);
+        constexpr int clients = 4, requests = 5;
+        std::vector<int> matches(clients, 0);
+        std::vector<std::thread> threads;
+        for (int c = 0; c < clients; ++c) {
+            threads.emplace_back([&, c]() {
+                ProcessingClient client;
+                ProcessingResponse answer;
+                if (!running.connect(client)) {
+                    return;
+                }
+                for (int r = 0; r < requests; ++r) {
+                    int index = 1 + (c + r) % height;
+                    auto expected = Slice::getPlaneSlice(width, height, depth, volume.getData(), "x-z", index);
+                    if (client.request("SLICE " + volumePath + " x-z " + std::to_string(index) + " median:3",
+                                       answer) && answer.ok && answer.data == expected) {
+                        ++matches[c];
+                    }
+                }
+            });
+        }
+        for (auto &thread: threads) {
+            thread.join();
+        }
+        for (int c = 0; c < clients; ++c) {
+            assert(matches[c] == requests && "A concurrent request was answered wrongly.");
+        }
+        bool counted = running.server->getMisses() == 1 && running.server->getHits() == clients * requests;
+        assert(counted && "Concurrent requests reloaded the cached volume.");
+
+        first.close();
+        running.shutdown();
+        std::filesystem::remove_all(directory);
+    }
+
+    /**
+     * @brief Test that malformed requests get errors and leave the connection usable.
+     */
+    void testErrors() {
+        auto directory = directoryFor("test_processing_server_errors");
+        std::string volumePath = (directory / "volume.nrrd").string();
+        bool saved = VolumeFormats::save(randomVolume(9), volumePath);
+        assert(saved && "Could not write the test volume.");
+
+        RunningServer running(socketPathFor("test_processing_server_errors"), 1,
+                              ProcessingServer::defaultCapacityBytes);
+        ProcessingClient client;
+        ProcessingResponse response;
+        bool connected = running.connect(client);
+        assert(connected && "Could not connect to the server.");
+
+        std::vector<std::string> invalid = {
+                "", "HELLO", "PING extra", "SLICE " + volumePath, "SLICE " + (directory / "missing.nrrd").string() +
+                " x-y 1", "SLICE " + volumePath + " a-b 1", "SLICE " + volumePath + " x-y 99",
+                "SLICE " + volumePath + " x-y one", "SLICE " + volumePath + " x-y 1 blur:3",
+                "SLICE " + volumePath + " x-y 1 median:4", "PROJECT " + volumePath + " MAX all",
+                "PROJECT " + volumePath + " MIP 5:2", "PROJECT " + volumePath + " MIP 5", "IMAGE missing.png",
+                "IMAGE " + volumePath + " sobel:3"};
+        for (const auto &request: invalid) {
+            bool rejected = client.request(request, response) && !response.ok && !response.error.empty();
+            assert(rejected && "A malformed request was not rejected.");
+        }
+
+        bool answered = client.request("STATS", response);
+        std::string text(response.data.begin(), response.data.end());
+        assert(answered && response.ok && response.channels == 0 && text.find("inputs=1") != std::string::npos &&
+               "STATS was not answered after the errors.");
+
+        client.close();
+        running.shutdown();
+        std::filesystem::remove_all(directory);
+    }
+
+    /**
+     * @brief Test that the least recently used inputs are evicted beyond the capacity.
+     */
+    void testEviction() {
+        auto directory = directoryFor("test_processing_server_eviction");
+        std::vector<std::string> paths;
+        for (int i = 0; i < 3; ++i) {
+            paths.push_back((directory / ("volume" + std::to_string(i) + ".nrrd")).string());
+            bool saved = VolumeFormats::save(randomVolume(11 + i), paths.back());
+            assert(saved && "Could not write a test volume.");
+        }
+
+        size_t volumeBytes = static_cast<size_t>(width) * height * depth;
+        RunningServer running(socketPathFor("test_processing_server_eviction"), 1, 2 * volumeBytes);
+        ProcessingClient client;
+        ProcessingResponse response;
+        bool connected = running.connect(client);
+        assert(connected && "Could not connect to the server.");
+
+        // 0 and 1 are cached, using 0 makes 1 the least recently used, so loading 2 evicts 1
+        for (int i: {0, 1, 0, 2, 0, 1}) {
+            bool answered = client.request("PROJECT " + paths[i] + " AIP all", response) && response.ok;
+            assert(answered && "A projection failed.");
+        }
+        bool evicted = running.server->getMisses() == 4 && running.server->getHits() == 2 &&
+                       running.server->getCachedBytes() == 2 * volumeBytes;
+        assert(evicted && "The least recently used volume was not evicted.");
+
+        client.close();
+        running.shutdown();
+        std::filesystem::remove_all(directory);
+    }
+
+    /**
+     * @brief Test that a file other than a socket at the socket path is kept and stops the server from starting.
+     */
+    void testExistingFile() {
+        std::string socketPath = socketPathFor("test_processing_server_existing");
+        {
+            std::ofstream file(socketPath);
+            file << "not a socket";
+        }
+        ProcessingServer server(socketPath, 1);
+        bool ran = server.run();
+        bool kept = std::filesystem::is_regular_file(socketPath) && std::filesystem::file_size(socketPath) == 12;
+        assert(!ran && kept && "The server replaced a regular file at its socket path.");
+        std::filesystem::remove(socketPath);
+    }
+
+    void runTests() override {
+        runTest<TestProcessingServer>(&TestProcessingServer::testRequests, "Requests");
+        runTest<TestProcessingServer>(&TestProcessingServer::testConcurrentClients, "Concurrent Clients");
+        runTest<TestProcessingServer>(&TestProcessingServer::testErrors, "Errors");
+        runTest<TestProcessingServer>(&TestProcessingServer::testEviction, "Eviction");
+        runTest<TestProcessingServer>(&TestProcessingServer::testExistingFile, "Existing File");
+    }
+};
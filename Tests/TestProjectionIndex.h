@@ -0,0 +1,142 @@
+/**
+ * @file TestProjectionIndex.h
+ *
+ * @brief Unit Tests for the ProjectionIndex class.
+ *
+ * This header file defines the TestProjectionIndex class, which compares the slab projections answered by the index with
+ * the projections computed directly over the slab, for every slab of a small volume and several block sizes, checks that
+ * invalid slabs and block sizes are rejected, and checks that a Volume drops its index when its data changes.
+ *
+ * Usage:
+ * As an extension of the Test base class, the TestProjectionIndex class implements the runTests method to execute all
+ * test cases through the Test class's runTest template method.
+ *
+ * @date Created on October 19, 2026.
+ *
+ * @authors
+ * Advanced Programming Group Radix Sort:
+ *   - Benjamin Duncan (edsml-bd1023)
+ *   - Boyang Hu (edsml-bh223)
+ *   - Chawk Chamoun (edsml-cc8915)
+ *   - Mingsheng Cai (acse-sc4623)
+ *   - Moyu Zhang (acse-mz223)
+ *   - Ryan Benney (acse-rgb123)
+ */
+
+#pragma once
+
+#include "Test.h"
+#include "Projection.h"
+#include "ProjectionIndex.h"
+#include "Volume.h"
+
+#include <cassert>
+#include <random>
+#include <stdexcept>
+#include <vector>
+
+class TestProjectionIndex : public Test {
+private:
+    // Compares every slab of a random volume against the direct projections
+    template<typename T>
+    static void checkAllSlabs(int blockSize, int maxValue) {
+        const int width = 7, height = 5, depth = 37;
+        const size_t slicePixels = static_cast<size_t>(width) * height;
+        std::mt19937 generator(blockSize);
+        std::uniform_int_distribution<int> distribution(0, maxValue);
+        std::vector<T> data(slicePixels * depth);
+        for (auto &sample: data) {
+            sample = static_cast<T>(distribution(generator));
+        }
+
+        ProjectionIndex<T> index(width, height, depth, data.data(), blockSize);
+        assert(index.getBlockSize() == blockSize && "Block size was not kept.");
+        for (int begin = 0; begin < depth; ++begin) {
+            for (int end = begin; end < depth; ++end) {
+                const T *slab = data.data() + begin * slicePixels;
+                int slabDepth = end - begin + 1;
+                assert(index.maximum(begin, end) ==
+                       Projection::maximumIntensityProjection(width, height, slabDepth, slab) &&
+                       "Indexed maximum differs from the direct projection.");
+                assert(index.minimum(begin, end) ==
+                       Projection::minimumIntensityProjection(width, height, slabDepth, slab) &&
+                       "Indexed minimum differs from the direct projection.");
+                assert(index.average(begin, end) ==
+                       Projection::averageIntensityProjection(width, height, slabDepth, slab) &&
+                       "Indexed average differs from the direct projection.");
+            }
+        }
+    }
+
+public:
+    /**
+     * Tests Indexed Slab Projections of 8-bit Volumes Against Direct Projections
+     */
+    void testUInt8Slabs() {
+        for (int blockSize: {1, 3, 4, 16, 64}) {
+            checkAllSlabs<unsigned char>(blockSize, 255);
+        }
+    }
+
+    /**
+     * Tests Indexed Slab Projections of 16-bit and Float Volumes Against Direct Projections
+     */
+    void testWideSlabs() {
+        checkAllSlabs<unsigned short>(4, 65535);
+        checkAllSlabs<float>(5, 255);
+    }
+
+    /**
+     * Tests That Invalid Block Sizes and Slabs Are Rejected
+     */
+    void testInvalidArguments() {
+        std::vector<unsigned char> data(2 * 2 * 8, 1);
+        bool threw = false;
+        try {
+            ProjectionIndex<unsigned char> index(2, 2, 8, data.data(), 0);
+        } catch (const std::invalid_argument &) {
+            threw = true;
+        }
+        assert(threw && "A block size of 0 must be rejected.");
+
+        ProjectionIndex<unsigned char> index(2, 2, 8, data.data(), 2);
+        assert(index.maximum(-1, 3).empty() && "A slab starting before the volume must be rejected.");
+        assert(index.minimum(5, 4).empty() && "A slab ending before it begins must be rejected.");
+        assert(index.average(0, 8).empty() && "A slab ending after the volume must be rejected.");
+        assert(index.getMemoryUsage() > 0 && "Index memory was not reported.");
+
+        ProjectionIndex<unsigned char> empty;
+        assert(empty.maximum(0, 0).empty() && "An empty index must not answer slabs.");
+    }
+
+    /**
+     * Tests Building and Invalidating the Index of a Volume
+     */
+    void testVolumeIndex() {
+        std::vector<unsigned char> data(4 * 4 * 20, 9);
+        Volume volume(4, 4, 20, data.data());
+        assert(!volume.hasProjectionIndex() && "A new volume must not have an index.");
+
+        volume.buildProjectionIndex(4);
+        assert(volume.hasProjectionIndex() && "Index was not built.");
+        const ProjectionIndex<unsigned char> *index = volume.getProjectionIndex<unsigned char>();
+        assert(index && !volume.getProjectionIndex<float>() && "Index has the wrong sample type.");
+        assert(index->maximum(2, 17) == std::vector<unsigned char>(16, 9) && "Volume index answers wrongly.");
+
+        Volume moved(std::move(volume));
+        assert(moved.hasProjectionIndex() && !volume.hasProjectionIndex() && "Index did not move with the volume.");
+
+        moved.updateData(std::vector<unsigned char>(4 * 4 * 20, 3));
+        assert(!moved.hasProjectionIndex() && "Changing the data must drop the index.");
+    }
+
+    /**
+     * Runs the Projection Index Unit Tests
+     */
+    virtual void runTests() override {
+        runTest<TestProjectionIndex>(&TestProjectionIndex::testUInt8Slabs, "Projection Index 8-bit Slabs");
+        runTest<TestProjectionIndex>(&TestProjectionIndex::testWideSlabs, "Projection Index Wide Slabs");
+        runTest<TestProjectionIndex>(&TestProjectionIndex::testInvalidArguments, "Projection Index Invalid Arguments");
+        runTest<TestProjectionIndex>(&TestProjectionIndex::testVolumeIndex, "Projection Index on Volume");
+    }
+};
@@ -0,0 +1,154 @@
+/**
+ * @file TestProjectionKernels.h
+ *
+ * @brief Unit Tests for the ProjectionKernels class.
+ *
+ * This header file defines the TestProjectionKernels class, which checks every SIMD kernel the processor supports against
+ * the scalar kernel on sample counts that do not fill whole registers, and checks the banded 8-bit projections against
+ * straightforward reference loops on a volume deeper than the flush interval of the 16-bit partial sums.
+ *
+ * Usage:
+ * As an extension of the Test base class, the TestProjectionKernels class implements the runTests method to execute all
+ * test cases through the Test class's runTest template method.
+ *
+ * @date Created on October 19, 2026.
+ *
+ * @authors
+ * Advanced Programming Group Radix Sort:
+ *   - Benjamin Duncan (edsml-bd1023)
+ *   - Boyang Hu (edsml-bh223)
+ *   - Chawk Chamoun (edsml-cc8915)
+ *   - Mingsheng Cai (acse-sc4623)
+ *   - Moyu Zhang (acse-mz223)
+ *   - Ryan Benney (acse-rgb123)
+ */
+
+#pragma once
+
+#include "Test.h"
+#include "Projection.h"
+#include "ProjectionKernels.h"
+
+#include <algorithm>
+#include <cassert>
+#include <random>
+#include <vector>
+
+class TestProjectionKernels : public Test {
+private:
+    // The instruction set levels up to the one detected on this processor
+    static std::vector<SimdLevel> availableLevels() {
+        std::vector<SimdLevel> levels;
+        for (SimdLevel level: {SimdLevel::Scalar, SimdLevel::SSE2, SimdLevel::AVX2, SimdLevel::AVX512}) {
+            if (level <= ProjectionKernels::detectedLevel()) {
+                levels.push_back(level);
+            }
+        }
+        return levels;
+    }
+
+    static std::vector<unsigned char> randomSamples(size_t count, unsigned int seed) {
+        std::mt19937 generator(seed);
+        std::uniform_int_distribution<int> distribution(0, 255);
+        std::vector<unsigned char> samples(count);
+        for (auto &sample: samples) {
+            sample = static_cast<unsigned char>(distribution(generator));
+        }
+        return samples;
+    }
+
+public:
+    /**
+     * Tests That Every Available Kernel Matches the Scalar Kernel
+     */
+    void testKernelsMatchScalar() {
+        SimdLevel original = ProjectionKernels::getLevel();
+        for (size_t count: {0, 1, 15, 17, 31, 63, 64, 65, 200, 1001}) {
+            auto source = randomSamples(count, static_cast<unsigned int>(count));
+            auto start = randomSamples(count, static_cast<unsigned int>(count) + 1);
+            std::vector<unsigned short> startSums(count);
+            for (size_t i = 0; i < count; ++i) {
+                startSums[i] = static_cast<unsigned short>(start[i] * 200);
+            }
+
+            std::vector<unsigned char> expectedMax, expectedMin;
+            std::vector<unsigned short> expectedSums;
+            for (SimdLevel level: availableLevels()) {
+                ProjectionKernels::setLevel(level);
+                assert(ProjectionKernels::getLevel() == level && "Supported level was not selected.");
+                std::vector<unsigned char> maximum = start, minimum = start;
+                std::vector<unsigned short> sums = startSums;
+                ProjectionKernels::maxInto(maximum.data(), source.data(), count);
+                ProjectionKernels::minInto(minimum.data(), source.data(), count);
+                ProjectionKernels::addInto(sums.data(), source.data(), count);
+                if (level == SimdLevel::Scalar) {
+                    expectedMax = maximum;
+                    expectedMin = minimum;
+                    expectedSums = sums;
+                    for (size_t i = 0; i < count; ++i) {
+                        assert(maximum[i] == std::max(start[i], source[i]) && "Scalar maximum is wrong.");
+                        assert(minimum[i] == std::min(start[i], source[i]) && "Scalar minimum is wrong.");
+                    }
+                } else {
+                    assert(maximum == expectedMax && "SIMD maximum differs from the scalar kernel.");
+                    assert(minimum == expectedMin && "SIMD minimum differs from the scalar kernel.");
+                    assert(sums == expectedSums && "SIMD sum differs from the scalar kernel.");
+                }
+            }
+        }
+        ProjectionKernels::setLevel(SimdLevel::AVX512);
+        assert(ProjectionKernels::getLevel() == ProjectionKernels::detectedLevel() && "Level was not clamped.");
+        ProjectionKernels::setLevel(original);
+    }
+
+    /**
+     * Tests the Banded 8-bit Projections Against Reference Loops at Every Available Level
+     */
+    void testProjectionsMatchReference() {
+        const int width = 131, height = 129, depth = 600;
+        const size_t slicePixels = static_cast<size_t>(width) * height;
+        auto data = randomSamples(slicePixels * depth, 7);
+        // Make some columns saturate so that the 16-bit partial sums reach their limit
+        for (int z = 0; z < depth; ++z) {
+            data[z * slicePixels] = 255;
+            data[z * slicePixels + slicePixels - 1] = 255;
+        }
+
+        std::vector<unsigned char> expectedMax(slicePixels, 0), expectedMin(slicePixels, 255), expectedAvg(slicePixels);
+        std::vector<unsigned long> sum(slicePixels, 0);
+        for (int z = 0; z < depth; ++z) {
+            for (size_t i = 0; i < slicePixels; ++i) {
+                unsigned char value = data[z * slicePixels + i];
+                expectedMax[i] = std::max(expectedMax[i], value);
+                expectedMin[i] = std::min(expectedMin[i], value);
+                sum[i] += value;
+            }
+        }
+        for (size_t i = 0; i < slicePixels; ++i) {
+            expectedAvg[i] = static_cast<unsigned char>(sum[i] / depth);
+        }
+        assert(expectedAvg[0] == 255 && "Reference average of a saturated column is wrong.");
+
+        SimdLevel original = ProjectionKernels::getLevel();
+        for (SimdLevel level: availableLevels()) {
+            ProjectionKernels::setLevel(level);
+            assert(Projection::maximumIntensityProjection(width, height, depth, data.data()) == expectedMax &&
+                   "Maximum projection differs from the reference.");
+            assert(Projection::minimumIntensityProjection(width, height, depth, data.data()) == expectedMin &&
+                   "Minimum projection differs from the reference.");
+            assert(Projection::averageIntensityProjection(width, height, depth, data.data()) == expectedAvg &&
+                   "Average projection differs from the reference.");
+        }
+        ProjectionKernels::setLevel(original);
+    }
+
+    /**
+     * Runs the Projection Kernel Unit Tests
+     */
+    virtual void runTests() override {
+        runTest<TestProjectionKernels>(&TestProjectionKernels::testKernelsMatchScalar,
+                                       "Projection Kernels Match Scalar");
+        runTest<TestProjectionKernels>(&TestProjectionKernels::testProjectionsMatchReference,
+                                       "Projection Kernels Match Reference");
+    }
+};
@@ -0,0 +1,161 @@
+/**
+ * @file TestPyramid.h
+ *
+ * @brief Unit Tests for the ImagePyramid and VolumePyramid classes.
+ *
+ * This header file defines the TestPyramid class, which checks the number and sizes of the pyramid levels, the values of
+ * box and Gaussian reductions including odd sizes and several channels, that levels are only built when requested and
+ * rebuilt after invalidation, and that projections and filters run on a chosen level.
+ *
+ * Usage:
+ * As an extension of the Test base class, the TestPyramid class implements the runTests method to execute all test cases
+ * through the Test class's runTest template method.
+ *
+ * @date Created on October 19, 2026.
+ *
+ * @authors
+ * Advanced Programming Group Radix Sort:
+ *   - Benjamin Duncan (edsml-bd1023)
+ *   - Boyang Hu (edsml-bh223)
+ *   - Chawk Chamoun (edsml-cc8915)
+ *   - Mingsheng Cai (acse-sc4623)
+ *   - Moyu Zhang (acse-mz223)
+ *   - Ryan Benney (acse-rgb123)
+ */
+
+#pragma once
+
+#include "Test.h"
+#include "Pyramid.h"
+#include "Projection.h"
+#include "Filters/Gaussian3DFilter.h"
+
+#include <cassert>
+#include <stdexcept>
+#include <vector>
+
+class TestPyramid : public Test {
+public:
+    /**
+     * Tests the Number and Sizes of the Levels
+     */
+    void testLevelSizes() {
+        std::vector<unsigned char> pixels(5 * 3, 0);
+        Image image(5, 3, 1, pixels.data());
+        ImagePyramid pyramid(image);
+        assert(pyramid.getLevelCount() == 4 && "A 5x3 image must have 4 levels.");
+        assert(pyramid.getLevel(1).getWidth() == 3 && pyramid.getLevel(1).getHeight() == 2 && "Wrong level 1 size.");
+        assert(pyramid.getLevel(3).getWidth() == 1 && pyramid.getLevel(3).getHeight() == 1 && "Wrong top level size.");
+
+        bool threw = false;
+        try {
+            pyramid.getLevel(4);
+        } catch (const std::out_of_range &) {
+            threw = true;
+        }
+        assert(threw && "A level above the top must be rejected.");
+    }
+
+    /**
+     * Tests Box Reduction of Images, Including Odd Sizes and Several Channels
+     */
+    void testBoxImage() {
+        std::vector<unsigned char> pixels = {10, 20, 30,
+                                             11, 21, 31};
+        Image image(3, 2, 1, pixels.data());
+        Image half = ImagePyramid::downsample(image, DownsampleMode::Box);
+        assert(half.getWidth() == 2 && half.getHeight() == 1 && "Wrong reduced size.");
+        assert(half.getData()[0] == 16 && "2x2 mean was not rounded to nearest.");
+        assert(half.getData()[1] == 31 && "Odd column must repeat the edge pixel.");
+
+        std::vector<unsigned char> rgb = {0, 100, 200, 4, 100, 200,
+                                          0, 100, 200, 4, 100, 200};
+        Image colour(2, 2, 3, rgb.data());
+        Image reduced = ImagePyramid::downsample(colour, DownsampleMode::Box);
+        assert(reduced.getChannels() == 3 && "Channels were not kept.");
+        assert(reduced.getData()[0] == 2 && reduced.getData()[1] == 100 && reduced.getData()[2] == 200 &&
+               "Channels were mixed.");
+    }
+
+    /**
+     * Tests That the Gaussian Reduction Keeps Constant Data Constant and Smooths Stripes
+     */
+    void testGaussian() {
+        std::vector<unsigned short> flat(9 * 7 * 2, 40000);
+        Image constant(9, 7, 2, reinterpret_cast<unsigned char *>(flat.data()), DataType::UInt16);
+        Image reduced = ImagePyramid::downsample(constant, DownsampleMode::Gaussian);
+        assert(reduced.getDataType() == DataType::UInt16 && "Sample type was not kept.");
+        for (int i = 0; i < reduced.getWidth() * reduced.getHeight() * 2; ++i) {
+            assert(reduced.getDataAs<unsigned short>()[i] == 40000 && "Gaussian weights do not sum to one.");
+        }
+
+        // Alternating columns of 0 and 255: the box mean and the 1-3-3-1 weights both give the mid grey inside
+        std::vector<unsigned char> stripes(8 * 8);
+        for (int i = 0; i < 64; ++i) {
+            stripes[i] = (i % 2) ? 255 : 0;
+        }
+        Image striped(8, 8, 1, stripes.data());
+        Image smooth = ImagePyramid::downsample(striped, DownsampleMode::Gaussian);
+        assert(smooth.getData()[1 * 4 + 1] == 128 && "Gaussian reduction of stripes is wrong.");
+
+        std::vector<float> samples(5 * 6 * 7, 12.5f);
+        Volume volume(5, 6, 7, Buffer(samples.size() * sizeof(float)), DataType::Float32);
+        std::copy(samples.begin(), samples.end(), volume.getDataAs<float>());
+        Volume half = VolumePyramid::downsample(volume, DownsampleMode::Gaussian);
+        assert(half.getWidth() == 3 && half.getHeight() == 3 && half.getDepth() == 4 && "Wrong reduced volume size.");
+        for (int i = 0; i < 3 * 3 * 4; ++i) {
+            assert(half.getDataAs<float>()[i] == 12.5f && "Gaussian volume weights do not sum to one.");
+        }
+    }
+
+    /**
+     * Tests Box Reduction of Volumes
+     */
+    void testBoxVolume() {
+        std::vector<unsigned char> voxels = {0, 10, 20, 30, 40, 50, 60, 70};
+        Volume volume(2, 2, 2, voxels.data());
+        Volume reduced = VolumePyramid::downsample(volume);
+        assert(reduced.getWidth() == 1 && reduced.getHeight() == 1 && reduced.getDepth() == 1 && "Wrong size.");
+        assert(reduced.getData()[0] == 35 && "2x2x2 mean is wrong.");
+    }
+
+    /**
+     * Tests Lazy Construction, Invalidation, and Running Operations on a Level
+     */
+    void testLazyLevels() {
+        const int size = 16;
+        std::vector<unsigned char> voxels(size * size * size, 50);
+        voxels[0] = 250;
+        Volume volume(size, size, size, voxels.data());
+        VolumePyramid pyramid(volume, DownsampleMode::Box);
+        assert(pyramid.getLevelCount() == 5 && "A 16^3 volume must have 5 levels.");
+        assert(pyramid.isLevelBuilt(0) && !pyramid.isLevelBuilt(1) && "Levels must not be built up front.");
+
+        Volume &preview = pyramid.getLevel(2);
+        assert(pyramid.isLevelBuilt(1) && pyramid.isLevelBuilt(2) && !pyramid.isLevelBuilt(3) &&
+               "Requesting a level must build exactly the levels below it.");
+        assert(preview.getWidth() == 4 && preview.getDepth() == 4 && "Wrong preview size.");
+
+        auto mip = Projection::maximumIntensityProjection(4, 4, 4, preview.getData());
+        assert(mip.size() == 16 && mip[0] > 50 && mip[1] == 50 && "Projection of the preview is wrong.");
+
+        Gaussian3DFilter filter(1.0, 3);
+        filter.apply(preview);
+        assert(preview.getWidth() == 4 && "Filtering a level must keep its size.");
+
+        pyramid.invalidate(2);
+        assert(pyramid.isLevelBuilt(1) && !pyramid.isLevelBuilt(2) && "Invalidate must drop the levels above.");
+        assert(pyramid.getLevel(2).getData()[1] == 50 && "Invalidated level was not rebuilt from the level below.");
+    }
+
+    /**
+     * Runs the Pyramid Unit Tests
+     */
+    virtual void runTests() override {
+        runTest<TestPyramid>(&TestPyramid::testLevelSizes, "Pyramid Level Sizes");
+        runTest<TestPyramid>(&TestPyramid::testBoxImage, "Pyramid Box Image Reduction");
+        runTest<TestPyramid>(&TestPyramid::testGaussian, "Pyramid Gaussian Reduction");
+        runTest<TestPyramid>(&TestPyramid::testBoxVolume, "Pyramid Box Volume Reduction");
+        runTest<TestPyramid>(&TestPyramid::testLazyLevels, "Pyramid Lazy Levels");
+    }
+};
@@ -0,0 +1,165 @@
+/**
+ * @file TestRegion.h
+ *
+ * @brief Unit Tests for region-of-interest filtering.
+ *
+ * This header file defines the TestRegion class, which checks that the ROI overloads of the 2D and 3D filters reproduce a
+ * full run inside the region, both in the interior and where the region meets the border, that nothing outside the
+ * region changes, and that invalid regions and filters that change the image layout are rejected.
+ *
+ * Usage:
+ * As an extension of the Test base class, the TestRegion class implements the runTests method to execute all test cases
+ * through the Test class's runTest template method.
+ *
+ * @date Created on October 19, 2026.
+ *
+ * @authors
+ * Advanced Programming Group Radix Sort:
+ *   - Benjamin Duncan (edsml-bd1023)
+ *   - Boyang Hu (edsml-bh223)
+ *   - Chawk Chamoun (edsml-cc8915)
+ *   - Mingsheng Cai (acse-sc4623)
+ *   - Moyu Zhang (acse-mz223)
+ *   - Ryan Benney (acse-rgb123)
+ */
+
+#pragma once
+
+#include "Test.h"
+#include "Region.h"
+#include "Filters/Box2DFilter.h"
+#include "Filters/EdgeFilter.h"
+#include "Filters/Gaussian3DFilter.h"
+#include "Filters/Median2DFilter.h"
+#include "Filters/Median3DFilter.h"
+#include "Filters/PixelFilter.h"
+
+#include <cassert>
+#include <cstring>
+#include <functional>
+#include <random>
+#include <vector>
+
+class TestRegion : public Test {
+private:
+    static std::vector<unsigned char> randomSamples(size_t count) {
+        std::mt19937 generator(static_cast<unsigned int>(count));
+        std::uniform_int_distribution<int> distribution(0, 255);
+        std::vector<unsigned char> samples(count);
+        for (auto &sample: samples) {
+            sample = static_cast<unsigned char>(distribution(generator));
+        }
+        return samples;
+    }
+
+    // Filters a region and the whole image and compares them inside and outside the region
+    static void checkImageRegion(int channels, const Region2D &region, const std::function<void(Image &)> &full,
+                                 const std::function<void(Image &, const Region2D &)> &partial) {
+        const int width = 23, height = 17;
+        auto pixels = randomSamples(static_cast<size_t>(width) * height * channels);
+        Image whole(width, height, channels, pixels.data()), cropped(width, height, channels, pixels.data());
+        full(whole);
+        partial(cropped, region);
+        for (int y = 0; y < height; ++y) {
+            for (int x = 0; x < width; ++x) {
+                bool inside = x >= region.x && x < region.x + region.width && y >= region.y &&
+                              y < region.y + region.height;
+                for (int c = 0; c < channels; ++c) {
+                    size_t i = (static_cast<size_t>(y) * width + x) * channels + c;
+                    unsigned char expected = inside ? whole.getData()[i] : pixels[i];
+                    assert(cropped.getData()[i] == expected && "Region filtering differs from a full run.");
+                }
+            }
+        }
+    }
+
+    // Filters a box and the whole volume and compares them inside and outside the box
+    static void checkVolumeRegion(const Region3D &region, IFilter3D &filter) {
+        const int width = 19, height = 15, depth = 13;
+        auto voxels = randomSamples(static_cast<size_t>(width) * height * depth);
+        std::vector<unsigned char> wholeData = voxels, croppedData = voxels;
+        Volume whole(width, height, depth, wholeData.data()), cropped(width, height, depth, croppedData.data());
+        filter.apply(whole);
+        filter.apply(cropped, region);
+        for (int z = 0; z < depth; ++z) {
+            for (int y = 0; y < height; ++y) {
+                for (int x = 0; x < width; ++x) {
+                    bool inside = x >= region.x && x < region.x + region.width && y >= region.y &&
+                                  y < region.y + region.height && z >= region.z && z < region.z + region.depth;
+                    size_t i = (static_cast<size_t>(z) * height + y) * width + x;
+                    assert(croppedData[i] == (inside ? wholeData[i] : voxels[i]) &&
+                           "Box filtering differs from a full run.");
+                }
+            }
+        }
+    }
+
+public:
+    /**
+     * Tests 2D Filters on Interior and Border Regions
+     */
+    void testImageRegions() {
+        for (Region2D region: {Region2D{5, 4, 9, 7}, Region2D{0, 0, 6, 17}, Region2D{15, 10, 8, 7}}) {
+            for (PaddingType padding: {PaddingType::ZeroPadding, PaddingType::EdgeReplication}) {
+                Box2DFilter box(5, padding);
+                checkImageRegion(3, region, [&](Image &image) { box.apply(image); },
+                                 [&](Image &image, const Region2D &roi) { box.apply(image, roi); });
+                Median2DFilter median(3, padding);
+                checkImageRegion(1, region, [&](Image &image) { median.apply(image); },
+                                 [&](Image &image, const Region2D &roi) { median.apply(image, roi); });
+                EdgeFilter edge(FilterType::Sobel, padding);
+                checkImageRegion(1, region, [&](Image &image) { edge.apply(image); },
+                                 [&](Image &image, const Region2D &roi) { edge.apply(image, roi); });
+            }
+            PixelFilter brightness("Brightness", 40);
+            checkImageRegion(3, region, [&](Image &image) { brightness.apply(image); },
+                             [&](Image &image, const Region2D &roi) { brightness.apply(image, roi); });
+        }
+    }
+
+    /**
+     * Tests 3D Filters on Interior and Border Boxes
+     */
+    void testVolumeRegions() {
+        for (Region3D region: {Region3D{4, 3, 5, 8, 6, 4}, Region3D{0, 0, 0, 7, 15, 3}, Region3D{12, 9, 7, 7, 6, 6}}) {
+            Gaussian3DFilter gaussian(1.0, 5);
+            checkVolumeRegion(region, gaussian);
+            Gaussian3DFilter fixedGaussian(1.0, 3, GaussianMode::FixedPoint);
+            checkVolumeRegion(region, fixedGaussian);
+            Median3DFilter median(3);
+            checkVolumeRegion(region, median);
+        }
+    }
+
+    /**
+     * Tests That Invalid Regions and Layout Changes Leave the Data Unchanged
+     */
+    void testRejectedRegions() {
+        auto pixels = randomSamples(8 * 8 * 3);
+        Image image(8, 8, 3, pixels.data());
+        Box2DFilter box(3);
+        for (Region2D region: {Region2D{-1, 0, 4, 4}, Region2D{6, 6, 3, 2}, Region2D{2, 2, 0, 3}}) {
+            assert(!Region::isValid(region, image) && "Invalid region was accepted.");
+            box.apply(image, region);
+        }
+        PixelFilter grayscale("Grayscale");
+        grayscale.apply(image, Region2D{1, 1, 4, 4});
+        assert(image.getChannels() == 3 && std::memcmp(image.getData(), pixels.data(), pixels.size()) == 0 &&
+               "A rejected region changed the image.");
+
+        std::vector<unsigned char> voxels(6 * 6 * 6, 7);
+        Volume volume(6, 6, 6, voxels.data());
+        Median3DFilter median(3);
+        median.apply(volume, Region3D{3, 3, 3, 4, 1, 1});
+        assert(voxels == std::vector<unsigned char>(6 * 6 * 6, 7) && "A rejected box changed the volume.");
+    }
+
+    /**
+     * Runs the Region of Interest Unit Tests
+     */
+    virtual void runTests() override {
+        runTest<TestRegion>(&TestRegion::testImageRegions, "Region of Interest 2D Filters");
+        runTest<TestRegion>(&TestRegion::testVolumeRegions, "Region of Interest 3D Filters");
+        runTest<TestRegion>(&TestRegion::testRejectedRegions, "Region of Interest Rejected Regions");
+    }
+};
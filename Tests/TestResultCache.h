@@ -0,0 +1,301 @@
+/**
+ * @file TestResultCache.h
+ *
+ * @brief Unit Tests for the content-addressed cache of intermediate results.
+ *
+ * This header file defines the TestResultCache class, which checks that keys change with the samples, shape, files
+ * and filter parameters they cover, that volumes and images survive a round trip through the cache, that a rerun
+ * chain resumes from its longest cached prefix with the same result as a full run, and that the least recently used
+ * entries are evicted to stay within the capacity.
+ *
+ * Usage:
+ * As an extension of the Test base class, the TestResultCache class implements the runTests method to execute all
+ * test cases through the Test class's runTest template method.
+ *
+ * @date Created on October 19, 2026.
+ *
+ * @authors
+ * Advanced Programming Group Radix Sort:
+ *   - Benjamin Duncan (edsml-bd1023)
+ *   - Boyang Hu (edsml-bh223)
+ *   - Chawk Chamoun (edsml-cc8915)
+ *   - Mingsheng Cai (acse-sc4623)
+ *   - Moyu Zhang (acse-mz223)
+ *   - Ryan Benney (acse-rgb123)
+ */
+
+#pragma once
+
+#include "Test.h"
+#include "Image.h"
+#include "ResultCache.h"
+#include "Volume.h"
+#include "Filters/Box2DFilter.h"
+#include "Filters/Gaussian2DFilter.h"
+#include "Filters/Gaussian3DFilter.h"
+#include "Filters/Median3DFilter.h"
+#include "Filters/PixelFilter.h"
+
+#include <cassert>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <vector>
+
+class TestResultCache : public Test {
+private:
+    static constexpr int width = 15, height = 11, depth = 9;
+
+    static Volume randomVolume(unsigned int seed) {
+        size_t count = static_cast<size_t>(width) * height * depth;
+        Buffer data(count);
+        for (size_t i = 0; i < count; ++i) {
+            seed = seed * 1664525u + 1013904223u;
+            data.getData()[i] = static_cast<unsigned char>(seed >> 24);
+        }
+        return Volume(width, height, depth, std::move(data));
+    }
+
+    static bool sameVolume(const Volume &a, const Volume &b) {
+        size_t bytes = static_cast<size_t>(a.getWidth()) * a.getHeight() * a.getDepth() *
+                       bytesPerSample(a.getDataType());
+        return a.getWidth() == b.getWidth() && a.getHeight() == b.getHeight() && a.getDepth() == b.getDepth() &&
+               a.getDataType() == b.getDataType() && std::memcmp(a.getData(), b.getData(), bytes) == 0;
+    }
+
+    // A fresh cache directory under the temporary directory
+    static std::filesystem::path directoryFor(const std::string &name) {
+        auto directory = std::filesystem::temp_directory_path() / name;
+        std::filesystem::remove_all(directory);
+        return directory;
+    }
+
+public:
+    /**
+     * @brief Test that keys cover the samples, shape, files and filter parameters.
+     */
+    void testKeys() {
+        std::vector<unsigned char> bytes(1000, 7);
+        std::uint64_t before = ResultCache::hash(bytes.data(), bytes.size());
+        bytes[999] = 8;
+        bool differs = ResultCache::hash(bytes.data(), bytes.size()) != before &&
+                       ResultCache::hash(bytes.data(), 999) != ResultCache::hash(bytes.data(), 998) &&
+                       ResultCache::hash(bytes.data(), 999, 1) != ResultCache::hash(bytes.data(), 999, 2);
+        assert(differs && "The hash ignores bytes, lengths or seeds.");
+
+        Volume a = randomVolume(1), b = randomVolume(1);
+        bool same = ResultCache::keyOf(a) == ResultCache::keyOf(b);
+        assert(same && "Equal volumes have different keys.");
+        b.getData()[width * height * depth - 1] ^= 1;
+        Volume reshaped(height, width, depth, Buffer(static_cast<size_t>(width) * height * depth));
+        std::memcpy(reshaped.getData(), a.getData(), static_cast<size_t>(width) * height * depth);
+        differs = ResultCache::keyOf(a) != ResultCache::keyOf(b) &&
+                  ResultCache::keyOf(a) != ResultCache::keyOf(reshaped);
+        assert(differs && "Different volumes have the same key.");
+
+        std::vector<std::string> descriptions = {
+                Gaussian3DFilter(1.0, 5).describe(), Gaussian3DFilter(1.0000001, 5).describe(),
+                Gaussian3DFilter(1.0, 3).describe(), Gaussian3DFilter(1.0, 5, GaussianMode::FixedPoint).describe(),
+                Median3DFilter(3).describe(), Median3DFilter(5).describe(), Box2DFilter(3).describe(),
+                Box2DFilter(3, PaddingType::ReflectPadding).describe(), Gaussian2DFilter(3, 1.0).describe()};
+        for (size_t i = 0; i < descriptions.size(); ++i) {
+            for (size_t j = i + 1; j < descriptions.size(); ++j) {
+                bool distinct = descriptions[i] != descriptions[j] &&
+                                ResultCache::extend(1, descriptions[i]) != ResultCache::extend(1, descriptions[j]);
+                assert(distinct && "Different filters have the same description.");
+            }
+        }
+
+        auto directory = directoryFor("test_result_cache_keys");
+        std::filesystem::create_directories(directory);
+        std::string path = (directory / "slice.raw").string();
+        std::ofstream(path) << "one";
+        std::uint64_t manifest = ResultCache::keyOfFiles({path});
+        std::ofstream(path) << "three";
+        differs = ResultCache::keyOfFiles({path}) != manifest &&
+                  ResultCache::keyOfFiles({path, path}) != ResultCache::keyOfFiles({path});
+        assert(differs && "Changing the files does not change the manifest key.");
+        std::filesystem::remove_all(directory);
+    }
+
+    /**
+     * @brief Test storing and loading volumes and images.
+     *
+     * Round-trips a 16-bit volume and a float colour image, and checks that missing entries, entries of the other kind
+     * and damaged files are misses.
+     */
+    void testStoreAndLoad() {
+        auto directory = directoryFor("test_result_cache_store");
+        ResultCache cache(directory.string());
+
+        Buffer samples(static_cast<size_t>(width) * height * depth * 2);
+        for (size_t i = 0; i < samples.getSize() / 2; ++i) {
+            reinterpret_cast<unsigned short *>(samples.getData())[i] = static_cast<unsigned short>(i * 37);
+        }
+        Volume volume(width, height, depth, std::move(samples), DataType::UInt16);
+        bool stored = cache.store(10, volume);
+        Volume loaded;
+        bool found = stored && cache.load(10, loaded);
+        assert(found && sameVolume(volume, loaded) && "A cached volume changed.");
+
+        Image image(4, 3, 3, nullptr, DataType::Float32);
+        image.updateData(Buffer(4 * 3 * 3 * sizeof(float)), DataType::Float32);
+        for (int i = 0; i < 36; ++i) {
+            image.getDataAs<float>()[i] = static_cast<float>(i) * 0.25f;
+        }
+        stored = cache.store(11, image);
+        Image loadedImage;
+        found = stored && cache.load(11, loadedImage);
+        assert(found && loadedImage.getChannels() == 3 && loadedImage.getDataType() == DataType::Float32 &&
+               std::memcmp(loadedImage.getData(), image.getData(), 36 * sizeof(float)) == 0 &&
+               "A cached image changed.");
+        assert(cache.getEntryCount() == 2 && "The cache did not index its entries.");
+
+        found = cache.load(12, loaded) || cache.load(11, loaded) || cache.load(10, loadedImage);
+        assert(!found && "A missing entry or an entry of the other kind was loaded.");
+
+        // A truncated file is dropped
+        for (const auto &file: std::filesystem::directory_iterator(directory)) {
+            std::filesystem::resize_file(file.path(), 20);
+        }
+        found = cache.load(10, loaded);
+        assert(!found && cache.getEntryCount() == 1 && "A damaged entry was loaded.");
+
+        // A header claiming more samples than the file holds is dropped without allocating them
+        for (std::int32_t extent: {1 << 20, INT32_MAX}) {
+            stored = cache.store(20, volume);
+            {
+                std::fstream file(directory / "0000000000000014.raw", std::ios::binary | std::ios::in | std::ios::out);
+                file.seekp(20);
+                for (int field = 0; field < 3; ++field) {
+                    file.write(reinterpret_cast<const char *>(&extent), sizeof(extent));
+                }
+            }
+            found = stored && cache.load(20, loaded);
+            assert(stored && !found && "An entry whose header does not match its size was loaded.");
+        }
+        std::filesystem::remove_all(directory);
+    }
+
+    /**
+     * @brief Test that a rerun chain resumes from its longest cached prefix.
+     *
+     * Runs a five-stage chain of 3D filters, reruns it, changes the last stage and reopens the cache, checking the
+     * number of skipped and computed stages and that every result equals applying the filters directly.
+     */
+    void testResumeChain() {
+        auto directory = directoryFor("test_result_cache_chain");
+        Gaussian3DFilter first(0.8, 3), second(1.0, 5), third(1.2, 5, GaussianMode::FixedPoint);
+        Median3DFilter fourth(3), fifth(3), changed(5);
+        int computed = 0;
+        auto counted = [&computed](IFilter3D &filter) {
+            return CachedStage<Volume>{filter.describe(), [&filter, &computed](Volume &volume) {
+                filter.apply(volume);
+                ++computed;
+            }};
+        };
+        auto expected = [&](IFilter3D &last) {
+            Volume volume = randomVolume(3);
+            for (IFilter3D *filter: std::vector<IFilter3D *>{&first, &second, &third, &fourth, &last}) {
+                filter->apply(volume);
+            }
+            return volume;
+        };
+        std::vector<CachedStage<Volume>> chain = {counted(first), counted(second), counted(third), counted(fourth),
+                                                  counted(fifth)};
+
+        ResultCache cache(directory.string());
+        Volume volume = randomVolume(3);
+        std::uint64_t key = ResultCache::keyOf(volume);
+        size_t skipped = cache.run(volume, key, chain);
+        assert(skipped == 0 && computed == 5 && sameVolume(volume, expected(fifth)) && "The first run differs.");
+
+        volume = randomVolume(3);
+        skipped = cache.run(volume, key, chain);
+        assert(skipped == 5 && computed == 5 && sameVolume(volume, expected(fifth)) && "The rerun was not cached.");
+
+        chain.back() = counted(changed);
+        volume = randomVolume(3);
+        skipped = cache.run(volume, key, chain);
+        assert(skipped == 4 && computed == 6 && sameVolume(volume, expected(changed)) &&
+               "Changing the last stage did not reuse the first four.");
+
+        // The entries outlive the cache object
+        ResultCache reopened(directory.string());
+        volume = randomVolume(3);
+        skipped = reopened.run(volume, key, chain);
+        assert(skipped == 5 && computed == 6 && reopened.getEntryCount() == 6 && "A reopened cache lost its entries.");
+
+        // Images go through the same chains, with 2D filters as stages
+        Image image(8, 6, 1, nullptr);
+        image.updateData(Buffer(48), DataType::UInt8);
+        std::memset(image.getData(), 90, 48);
+        image.getData()[20] = 255;
+        Box2DFilter box(3);
+        skipped = cache.run(image, ResultCache::keyOf(image), {ResultCache::stage<Image>(box)});
+        Image again(8, 6, 1, nullptr);
+        again.updateData(Buffer(48), DataType::UInt8);
+        std::memset(again.getData(), 90, 48);
+        again.getData()[20] = 255;
+        size_t skippedAgain = cache.run(again, ResultCache::keyOf(again), {ResultCache::stage<Image>(box)});
+        assert(skipped == 0 && skippedAgain == 1 && std::memcmp(image.getData(), again.getData(), 48) == 0 &&
+               "An image chain was not cached.");
+
+        // Random noise is not reproducible, so neither it nor the stages after it are cached
+        PixelFilter noise("SaltAndPepperNoise", std::nullopt, "", 0, 0.5);
+        std::vector<CachedStage<Image>> noisy = {ResultCache::stage<Image>(box), ResultCache::stage<Image>(noise),
+                                                 ResultCache::stage<Image>(box)};
+        size_t entries = cache.getEntryCount();
+        skipped = cache.run(image, ResultCache::keyOf(image), noisy);
+        skippedAgain = cache.run(again, ResultCache::keyOf(again), noisy);
+        assert(noise.describe().empty() && skipped == 0 && skippedAgain == 1 && cache.getEntryCount() == entries + 1 &&
+               "A result after a random stage was cached.");
+        std::filesystem::remove_all(directory);
+    }
+
+    /**
+     * @brief Test eviction of the least recently used entries.
+     *
+     * Fills a cache with room for two volumes, uses the older one and adds a third, and checks that the unused one is
+     * deleted, that the size stays within the capacity and that reopening with less room trims the oldest entries.
+     */
+    void testEviction() {
+        auto directory = directoryFor("test_result_cache_eviction");
+        size_t entryBytes = static_cast<size_t>(width) * height * depth + 64;
+        ResultCache cache(directory.string(), 2 * entryBytes);
+        Volume a = randomVolume(4), b = randomVolume(5), c = randomVolume(6), loaded;
+        bool ok = cache.store(1, a) && cache.store(2, b) && cache.load(1, loaded) && cache.store(3, c);
+        assert(ok && cache.getEntryCount() == 2 && cache.getUsedBytes() <= 2 * entryBytes &&
+               "The cache grew beyond its capacity.");
+        bool kept = cache.load(1, loaded) && sameVolume(loaded, a) && cache.load(3, loaded) && !cache.load(2, loaded);
+        assert(kept && "The least recently used entry was not the one evicted.");
+
+        ResultCache smaller(directory.string(), entryBytes);
+        kept = smaller.getEntryCount() == 1 && smaller.load(3, loaded) && sameVolume(loaded, c);
+        assert(kept && "Reopening with less room did not keep the most recent entry.");
+
+        ResultCache tiny(directory.string(), 100);
+        ok = tiny.store(4, a);
+        assert(!ok && tiny.getEntryCount() == 0 && "A result larger than the capacity was stored.");
+
+        // Entries found on disk count towards the capacity as soon as they are read
+        ResultCache writer(directory.string(), 4 * entryBytes);
+        ok = writer.store(5, a) && writer.store(6, b) && cache.load(5, loaded) && cache.load(6, loaded);
+        assert(ok && cache.getEntryCount() <= 2 && cache.getUsedBytes() <= 2 * entryBytes &&
+               "Reading entries written by another cache exceeded the capacity.");
+        std::filesystem::remove_all(directory);
+    }
+
+    /**
+     * @brief Run all tests
+     *
+     * Runs all the tests for the cache of intermediate results.
+     */
+    void runTests() override {
+        runTest<TestResultCache>(&TestResultCache::testKeys, "Keys");
+        runTest<TestResultCache>(&TestResultCache::testStoreAndLoad, "Store And Load");
+        runTest<TestResultCache>(&TestResultCache::testResumeChain, "Resume Chain");
+        runTest<TestResultCache>(&TestResultCache::testEviction, "Eviction");
+    }
+};
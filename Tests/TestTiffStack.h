@@ -0,0 +1,479 @@
+/**
+ * @file TestTiffStack.h
+ *
+ * @brief Unit Tests for the multi-page TIFF reader.
+ *
+ * This header file defines the TestTiffStack class, which builds multi-page TIFF files in both byte orders with
+ * uncompressed, PackBits and LZW strips and tiles, and checks that they load into the expected volume, that single
+ * pages can be read on their own, that long LZW streams with table resets decode, and that unsupported and corrupt
+ * files are reported.
+ *
+ * Usage:
+ * As an extension of the Test base class, the TestTiffStack class implements the runTests method to execute all test
+ * cases through the Test class's runTest template method.
+ *
+ * @date Created on October 19, 2026.
+ *
+ * @authors
+ * Advanced Programming Group Radix Sort:
+ *   - Benjamin Duncan (edsml-bd1023)
+ *   - Boyang Hu (edsml-bh223)
+ *   - Chawk Chamoun (edsml-cc8915)
+ *   - Mingsheng Cai (acse-sc4623)
+ *   - Moyu Zhang (acse-mz223)
+ *   - Ryan Benney (acse-rgb123)
+ */
+
+#pragma once
+
+#include "Test.h"
+#include "TiffStack.h"
+#include "VolumeFormats.h"
+
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <map>
+#include <string>
+#include <vector>
+
+class TestTiffStack : public Test {
+private:
+    // Layout of the TIFF files built by writeTiff
+    struct Layout {
+        int width = 13, height = 9, pages = 3;
+        int bits = 8; // 8, 16 or 32 (float)
+        int compression = TiffStack::noCompression;
+        bool predictor = false;
+        bool bigEndian = false;
+        int rowsPerStrip = 4;
+        int tileSize = 0; // Tiles of this edge length instead of strips if positive
+        int photometric = 1;
+        int samplesPerPixel = 1;
+    };
+
+    static std::string tempPath(const std::string &name) {
+        return (std::filesystem::temp_directory_path() / name).string();
+    }
+
+    // Pseudo-random samples with enough repetition to compress, stored in host byte order
+    static std::vector<unsigned char> stackSamples(const Layout &layout) {
+        size_t count = static_cast<size_t>(layout.width) * layout.height * layout.pages;
+        std::vector<unsigned char> samples(count * (layout.bits / 8));
+        uint32_t state = 11;
+        for (size_t i = 0; i < count; ++i) {
+            state = state * 1103515245u + 12345u;
+            uint32_t value = (state >> 16) % 5 == 0 ? (state >> 8) : static_cast<uint32_t>(i / 3 * 7);
+            if (layout.bits == 8) {
+                samples[i] = static_cast<unsigned char>(value);
+            } else if (layout.bits == 16) {
+                auto sample = static_cast<unsigned short>(value * 31);
+                std::memcpy(&samples[i * 2], &sample, 2);
+            } else {
+                float sample = static_cast<float>(value % 1000) * 0.25f;
+                std::memcpy(&samples[i * 4], &sample, 4);
+            }
+        }
+        return samples;
+    }
+
+    static void put(std::vector<unsigned char> &out, uint32_t value, int bytes, bool bigEndian) {
+        for (int i = 0; i < bytes; ++i) {
+            int shift = 8 * (bigEndian ? bytes - 1 - i : i);
+            out.push_back(static_cast<unsigned char>(value >> shift));
+        }
+    }
+
+    static std::vector<unsigned char> packBits(const std::vector<unsigned char> &data) {
+        std::vector<unsigned char> out;
+        for (size_t i = 0; i < data.size();) {
+            size_t run = 1;
+            while (i + run < data.size() && run < 128 && data[i + run] == data[i]) {
+                ++run;
+            }
+            if (run > 1) {
+                out.push_back(static_cast<unsigned char>(1 - static_cast<int>(run)));
+                out.push_back(data[i]);
+                i += run;
+                continue;
+            }
+            size_t literal = 1;
+            while (i + literal < data.size() && literal < 128 &&
+                   (i + literal + 1 >= data.size() || data[i + literal] != data[i + literal + 1])) {
+                ++literal;
+            }
+            out.push_back(static_cast<unsigned char>(literal - 1));
+            out.insert(out.end(), data.begin() + static_cast<long>(i), data.begin() + static_cast<long>(i + literal));
+            i += literal;
+        }
+        return out;
+    }
+
+    // TIFF LZW encoder: starts with a clear code, widens codes one entry early and clears before the table fills
+    static std::vector<unsigned char> lzw(const std::vector<unsigned char> &data) {
+        std::vector<unsigned char> out;
+        uint32_t bitBuffer = 0;
+        int bitCount = 0, width = 9, next = 258;
+        auto emit = [&](int code) {
+            bitBuffer = (bitBuffer << width) | static_cast<uint32_t>(code);
+            bitCount += width;
+            while (bitCount >= 8) {
+                out.push_back(static_cast<unsigned char>(bitBuffer >> (bitCount - 8)));
+                bitCount -= 8;
+            }
+        };
+        std::map<std::pair<int, unsigned char>, int> table;
+        emit(256);
+        int current = -1;
+        for (unsigned char byte: data) {
+            if (current < 0) {
+                current = byte;
+                continue;
+            }
+            auto found = table.find({current, byte});
+            if (found != table.end()) {
+                current = found->second;
+                continue;
+            }
+            emit(current);
+            table[{current, byte}] = next++;
+            if (next >= (1 << width) && width < 12) {
+                ++width;
+            }
+            if (next >= 4094) {
+                emit(256);
+                table.clear();
+                next = 258;
+                width = 9;
+            }
+            current = byte;
+        }
+        if (current >= 0) {
+            emit(current);
+            ++next;
+            if (next >= (1 << width) && width < 12) {
+                ++width;
+            }
+        }
+        emit(257);
+        if (bitCount > 0) {
+            out.push_back(static_cast<unsigned char>(bitBuffer << (8 - bitCount)));
+        }
+        return out;
+    }
+
+    // Cuts one page into strips or tiles, applies the predictor, byte order and compression of the layout
+    static std::vector<std::vector<unsigned char>> encodePage(const Layout &layout, const unsigned char *page) {
+        int sampleSize = layout.bits / 8;
+        int segmentWidth = layout.tileSize > 0 ? layout.tileSize : layout.width;
+        int segmentHeight = layout.tileSize > 0 ? layout.tileSize : layout.rowsPerStrip;
+        std::vector<std::vector<unsigned char>> segments;
+        for (int y0 = 0; y0 < layout.height; y0 += segmentHeight) {
+            for (int x0 = 0; x0 < layout.width; x0 += segmentWidth) {
+                int rows = layout.tileSize > 0 ? segmentHeight : std::min(segmentHeight, layout.height - y0);
+                std::vector<unsigned char> raw;
+                for (int y = y0; y < y0 + rows; ++y) {
+                    uint32_t previous = 0;
+                    for (int x = x0; x < x0 + segmentWidth; ++x) {
+                        uint32_t value = 0;
+                        if (x < layout.width && y < layout.height) {
+                            std::memcpy(&value, page + (static_cast<size_t>(y) * layout.width + x) * sampleSize,
+                                        sampleSize);
+                        }
+                        uint32_t stored = value;
+                        if (layout.photometric == 0) {
+                            stored = (sampleSize == 1 ? 255u : 65535u) - value;
+                        }
+                        uint32_t written = layout.predictor ? stored - previous : stored;
+                        previous = stored;
+                        put(raw, written, sampleSize, layout.bigEndian);
+                    }
+                }
+                if (layout.compression == TiffStack::lzwCompression) {
+                    raw = lzw(raw);
+                } else if (layout.compression == TiffStack::packBitsCompression) {
+                    raw = packBits(raw);
+                }
+                segments.push_back(std::move(raw));
+            }
+        }
+        return segments;
+    }
+
+    // Writes a multi-page TIFF of the samples, with each page's strips and arrays placed before its directory
+    static void writeTiff(const std::string &path, const Layout &layout, const std::vector<unsigned char> &samples) {
+        bool big = layout.bigEndian;
+        std::vector<unsigned char> out = {static_cast<unsigned char>(big ? 'M' : 'I'),
+                                          static_cast<unsigned char>(big ? 'M' : 'I')};
+        put(out, 42, 2, big);
+        put(out, 8, 4, big);
+        size_t link = 4; // Position of the field that points at the next directory
+        size_t pageSize = static_cast<size_t>(layout.width) * layout.height * (layout.bits / 8);
+        for (int p = 0; p < layout.pages; ++p) {
+            auto segments = encodePage(layout, samples.data() + p * pageSize);
+            std::vector<uint32_t> offsets, counts;
+            for (const auto &segment: segments) {
+                offsets.push_back(static_cast<uint32_t>(out.size()));
+                counts.push_back(static_cast<uint32_t>(segment.size()));
+                out.insert(out.end(), segment.begin(), segment.end());
+            }
+            if (out.size() % 2 != 0) {
+                out.push_back(0);
+            }
+            size_t arrays = out.size();
+            for (uint32_t value: offsets) {
+                put(out, value, 4, big);
+            }
+            for (uint32_t value: counts) {
+                put(out, value, 4, big);
+            }
+            auto arrayField = [&](size_t at) {
+                return segments.size() == 1 ? (at == arrays ? offsets[0] : counts[0]) : static_cast<uint32_t>(at);
+            };
+
+            bool tiled = layout.tileSize > 0;
+            std::vector<std::array<uint32_t, 4>> entries = {
+                    {256, 4, 1, static_cast<uint32_t>(layout.width)},
+                    {257, 4, 1, static_cast<uint32_t>(layout.height)},
+                    {258, 3, 1, static_cast<uint32_t>(layout.bits)},
+                    {259, 3, 1, static_cast<uint32_t>(layout.compression)},
+                    {262, 3, 1, static_cast<uint32_t>(layout.photometric)},
+                    {277, 3, 1, static_cast<uint32_t>(layout.samplesPerPixel)}};
+            if (tiled) {
+                entries.push_back({322, 3, 1, static_cast<uint32_t>(layout.tileSize)});
+                entries.push_back({323, 3, 1, static_cast<uint32_t>(layout.tileSize)});
+            } else {
+                entries.push_back({278, 4, 1, static_cast<uint32_t>(layout.rowsPerStrip)});
+            }
+            auto segmentCount = static_cast<uint32_t>(segments.size());
+            entries.push_back({tiled ? 324u : 273u, 4, segmentCount, arrayField(arrays)});
+            entries.push_back({tiled ? 325u : 279u, 4, segmentCount, arrayField(arrays + 4 * segments.size())});
+            if (layout.predictor) {
+                entries.push_back({317, 3, 1, 2});
+            }
+            entries.push_back({339, 3, 1, layout.bits == 32 ? 3u : 1u});
+            std::sort(entries.begin(), entries.end());
+
+            // Point the previous directory (or the header) at this one
+            std::vector<unsigned char> position;
+            put(position, static_cast<uint32_t>(out.size()), 4, big);
+            std::copy(position.begin(), position.end(), out.begin() + static_cast<long>(link));
+            put(out, static_cast<uint32_t>(entries.size()), 2, big);
+            for (const auto &entry: entries) {
+                put(out, entry[0], 2, big);
+                put(out, entry[1], 2, big);
+                put(out, entry[2], 4, big);
+                if (entry[1] == 3 && entry[2] == 1) {
+                    put(out, entry[3], 2, big);
+                    put(out, 0, 2, big);
+                } else {
+                    put(out, entry[3], 4, big);
+                }
+            }
+            link = out.size();
+            put(out, 0, 4, big);
+        }
+        std::ofstream file(path, std::ios::binary);
+        file.write(reinterpret_cast<const char *>(out.data()), static_cast<std::streamsize>(out.size()));
+    }
+
+    // Writes a stack with the layout, loads it and compares every sample
+    static void checkLayout(const Layout &layout, const char *message) {
+        auto samples = stackSamples(layout);
+        std::string path = tempPath("test_tiff_stack.tif");
+        writeTiff(path, layout, samples);
+        TiffStack stack;
+        bool opened = stack.open(path);
+        assert(opened && stack.getPageCount() == layout.pages && stack.getWidth() == layout.width &&
+               stack.getHeight() == layout.height && message);
+        Volume volume;
+        bool loaded = stack.load(volume);
+        assert(loaded && volume.getDepth() == layout.pages && message);
+        assert(std::memcmp(volume.getData(), samples.data(), samples.size()) == 0 && message);
+        std::filesystem::remove(path);
+    }
+
+public:
+    /**
+     * @brief Test Strips
+     *
+     * Loads striped stacks of every sample type in both byte orders, uncompressed and with PackBits and LZW, with and
+     * without the horizontal predictor, and with white-is-zero samples.
+     */
+    void testStrips() {
+        for (bool bigEndian: {false, true}) {
+            for (int compression: {TiffStack::noCompression, TiffStack::packBitsCompression,
+                                   TiffStack::lzwCompression}) {
+                for (int bits: {8, 16, 32}) {
+                    Layout layout;
+                    layout.bits = bits;
+                    layout.compression = compression;
+                    layout.bigEndian = bigEndian;
+                    checkLayout(layout, "A striped TIFF stack was loaded wrongly.");
+                    if (bits != 32) {
+                        layout.predictor = true;
+                        checkLayout(layout, "A TIFF stack with the predictor was loaded wrongly.");
+                    }
+                }
+            }
+        }
+
+        Layout layout;
+        layout.photometric = 0;
+        layout.bits = 16;
+        layout.rowsPerStrip = 100;
+        checkLayout(layout, "A white-is-zero TIFF stack was loaded wrongly.");
+    }
+
+    /**
+     * @brief Test Tiles
+     *
+     * Loads tiled stacks whose tiles overhang the right and bottom edges of the pages.
+     */
+    void testTiles() {
+        for (int compression: {TiffStack::noCompression, TiffStack::packBitsCompression, TiffStack::lzwCompression}) {
+            Layout layout;
+            layout.width = 37;
+            layout.height = 21;
+            layout.tileSize = 16;
+            layout.bits = 16;
+            layout.compression = compression;
+            layout.predictor = compression == TiffStack::lzwCompression;
+            checkLayout(layout, "A tiled TIFF stack was loaded wrongly.");
+        }
+    }
+
+    /**
+     * @brief Test LZW Table Reset
+     *
+     * Loads a page large enough for its LZW codes to grow to 12 bits and the code table to be cleared several times.
+     */
+    void testLzwTableReset() {
+        Layout layout;
+        layout.width = 300;
+        layout.height = 200;
+        layout.pages = 1;
+        layout.rowsPerStrip = 200;
+        layout.compression = TiffStack::lzwCompression;
+        checkLayout(layout, "A long LZW strip was decoded wrongly.");
+    }
+
+    /**
+     * @brief Test Random Access
+     *
+     * Reads single pages of a stack and loads it through VolumeFormats.
+     */
+    void testRandomAccess() {
+        Layout layout;
+        layout.pages = 5;
+        layout.compression = TiffStack::lzwCompression;
+        auto samples = stackSamples(layout);
+        std::string path = tempPath("test_tiff_pages.tiff");
+        writeTiff(path, layout, samples);
+
+        TiffStack stack;
+        bool opened = stack.open(path);
+        assert(opened && "Opening a TIFF stack failed.");
+        size_t pageSize = static_cast<size_t>(layout.width) * layout.height;
+        std::vector<unsigned char> page(pageSize);
+        for (int index: {3, 0, 4}) {
+            bool read = stack.readPage(index, page.data());
+            assert(read && std::memcmp(page.data(), samples.data() + index * pageSize, pageSize) == 0 &&
+                   "A single TIFF page was read wrongly.");
+        }
+        bool read = stack.readPage(5, page.data());
+        assert(!read && "A page past the end of the stack was read.");
+
+        Volume volume;
+        bool loaded = VolumeFormats::load(path, volume);
+        assert(loaded && volume.getDepth() == 5 && std::memcmp(volume.getData(), samples.data(), samples.size()) == 0 &&
+               "A TIFF stack was loaded wrongly through VolumeFormats.");
+        std::filesystem::remove(path);
+    }
+
+    /**
+     * @brief Test Invalid Input
+     *
+     * Checks that missing, foreign and truncated files, colour pages, corrupt compressed strips and pages whose size
+     * overflows or exceeds their strips are rejected.
+     */
+    void testInvalidInput() {
+        TiffStack stack;
+        bool opened = stack.open(tempPath("test_tiff_missing.tif"));
+        assert(!opened && !stack.isOpen() && "A missing file was opened.");
+
+        std::string path = tempPath("test_tiff_invalid.tif");
+        {
+            std::ofstream foreign(path, std::ios::binary);
+            foreign << "This is not a TIFF file.";
+        }
+        opened = stack.open(path);
+        assert(!opened && "A foreign file was opened.");
+
+        Layout layout;
+        auto samples = stackSamples(layout);
+        layout.samplesPerPixel = 3;
+        writeTiff(path, layout, samples);
+        opened = stack.open(path);
+        assert(!opened && "A colour TIFF stack was opened.");
+
+        layout.samplesPerPixel = 1;
+        layout.compression = TiffStack::packBitsCompression;
+        writeTiff(path, layout, samples);
+        std::filesystem::resize_file(path, 40);
+        opened = stack.open(path);
+        assert(!opened && "A truncated TIFF file was opened.");
+
+        // Overwrite the first strip with a PackBits run longer than the strip
+        writeTiff(path, layout, samples);
+        {
+            std::fstream file(path, std::ios::binary | std::ios::in | std::ios::out);
+            file.seekp(8);
+            file.put(static_cast<char>(-127));
+        }
+        opened = stack.open(path);
+        assert(opened && "Opening a TIFF stack with a corrupt strip failed.");
+        Volume volume;
+        bool loaded = stack.load(volume);
+        assert(!loaded && volume.getWidth() == 0 && "A TIFF stack with a corrupt strip was loaded.");
+
+        // Forge the width and height fields, the first two entries of the only directory, of a one-strip page
+        layout = Layout();
+        layout.pages = 1;
+        layout.bits = 32;
+        layout.rowsPerStrip = 0x7fffffff;
+        samples = stackSamples(layout);
+        for (uint32_t size: {0x7fffffffu, 0x10000u}) {
+            writeTiff(path, layout, samples);
+            {
+                std::fstream file(path, std::ios::binary | std::ios::in | std::ios::out);
+                uint32_t directory = 0;
+                file.seekg(4);
+                file.read(reinterpret_cast<char *>(&directory), 4);
+                for (uint32_t entry: {0u, 1u}) {
+                    file.seekp(directory + 2 + entry * 12 + 8);
+                    file.write(reinterpret_cast<const char *>(&size), 4);
+                }
+            }
+            opened = stack.open(path);
+            assert(!opened && "A TIFF page whose size overflows or exceeds its strips was opened.");
+        }
+        std::filesystem::remove(path);
+    }
+
+    /**
+     * @brief Run all tests
+     *
+     * Runs all the tests for the multi-page TIFF reader.
+     */
+    void runTests() override {
+        runTest<TestTiffStack>(&TestTiffStack::testStrips, "Strips");
+        runTest<TestTiffStack>(&TestTiffStack::testTiles, "Tiles");
+        runTest<TestTiffStack>(&TestTiffStack::testLzwTableReset, "LZW Table Reset");
+        runTest<TestTiffStack>(&TestTiffStack::testRandomAccess, "Random Access");
+        runTest<TestTiffStack>(&TestTiffStack::testInvalidInput, "Invalid Input");
+    }
+};
@@ -0,0 +1,132 @@
+/**
+ * @file TestTrace.h
+ *
+ * @brief Unit Tests for the stage tracing API.
+ *
+ * This header file defines the TestTrace class, which verifies that TRACE_SCOPE records nothing while tracing is
+ * disabled, that filtering a volume with tracing enabled records the filter and each of its passes with their byte
+ * counts and the thread utilisation of the parallel loops, and that the events are exported in the Chrome trace format.
+ *
+ * Usage:
+ * As an extension of the Test base class, the TestTrace class implements the runTests method to execute all test cases
+ * through the Test class's runTest template method.
+ *
+ * @date Created on October 19, 2026.
+ *
+ * @authors
+ * Advanced Programming Group Radix Sort:
+ *   - Benjamin Duncan (edsml-bd1023)
+ *   - Boyang Hu (edsml-bh223)
+ *   - Chawk Chamoun (edsml-cc8915)
+ *   - Mingsheng Cai (acse-sc4623)
+ *   - Moyu Zhang (acse-mz223)
+ *   - Ryan Benney (acse-rgb123)
+ */
+
+#pragma once
+
+#include "Test.h"
+#include "Trace.h"
+#include "Volume.h"
+#include "Filters/Gaussian3DFilter.h"
+
+#include <cassert>
+#include <cstring>
+#include <sstream>
+#include <string>
+#include <vector>
+
+class TestTrace : public Test {
+private:
+    /**
+     * Finds a Recorded Event by Name
+     *
+     * @param events The recorded events.
+     * @param name The stage name to look for.
+     * @return A pointer to the first matching event, or nullptr.
+     */
+    static const TraceEvent *findEvent(const std::vector<TraceEvent> &events, const char *name) {
+        for (const auto &event: events) {
+            if (std::strcmp(event.name, name) == 0) {
+                return &event;
+            }
+        }
+        return nullptr;
+    }
+
+public:
+    /**
+     * Tests That Nothing Is Recorded While Tracing Is Disabled
+     */
+    void testDisabled() {
+        Trace::setEnabled(false);
+        Trace::clear();
+        std::vector<unsigned char> data(8 * 8 * 8, 100);
+        Volume volume(8, 8, 8, data.data());
+        Gaussian3DFilter(1.0, 3).apply(volume);
+        assert(Trace::getEvents().empty() && "Events were recorded while tracing was disabled.");
+    }
+
+    /**
+     * Tests the Events Recorded for a 3D Filter
+     *
+     * The filter event must enclose its three passes, every pass must report the bytes it reads and writes, and the
+     * parallel loops must report a thread count and a utilisation between 0 and 1.
+     */
+    void testFilterStages() {
+        Trace::clear();
+        Trace::setEnabled(true);
+        int width = 20, height = 16, depth = 12;
+        std::vector<unsigned char> data(width * height * depth, 100);
+        Volume volume(width, height, depth, data.data());
+        Gaussian3DFilter(1.0, 3).apply(volume);
+        Trace::setEnabled(false);
+        auto events = Trace::getEvents();
+
+        const TraceEvent *apply = findEvent(events, "Gaussian3DFilter::apply");
+        assert(apply && "The filter was not recorded.");
+        for (const char *pass: {"Gaussian3DFilter X pass", "Gaussian3DFilter Y pass", "Gaussian3DFilter Z pass"}) {
+            const TraceEvent *event = findEvent(events, pass);
+            assert(event && "A filter pass was not recorded.");
+            assert(event->bytes == static_cast<size_t>(width) * height * depth * 2 && "Unexpected pass byte count.");
+            assert(event->startNs >= apply->startNs &&
+                   event->startNs + event->durationNs <= apply->startNs + apply->durationNs &&
+                   "A pass is not enclosed by its filter.");
+        }
+
+        const TraceEvent *loop = findEvent(events, "Parallel::forRange");
+        assert(loop && loop->threads >= 1 && "The parallel loops were not recorded.");
+        assert(loop->utilisation > 0.0 && loop->utilisation <= 1.0 + 1e-9 && "Utilisation out of range.");
+        Trace::clear();
+    }
+
+    /**
+     * Tests the Chrome Trace Export
+     */
+    void testChromeTrace() {
+        Trace::clear();
+        Trace::setEnabled(true);
+        {
+            TRACE_SCOPE("Test stage", "test", 1234);
+        }
+        Trace::setEnabled(false);
+
+        std::ostringstream out;
+        Trace::writeChromeTrace(out);
+        std::string json = out.str();
+        assert(json.find("\"traceEvents\"") != std::string::npos && "Missing traceEvents array.");
+        assert(json.find("\"name\": \"Test stage\"") != std::string::npos && "Missing event name.");
+        assert(json.find("\"ph\": \"X\"") != std::string::npos && "Events must be complete events.");
+        assert(json.find("\"bytes\": 1234") != std::string::npos && "Missing byte count.");
+        Trace::clear();
+    }
+
+    /**
+     * Runs the Trace Unit Tests
+     */
+    virtual void runTests() override {
+        runTest<TestTrace>(&TestTrace::testDisabled, "Trace Disabled");
+        runTest<TestTrace>(&TestTrace::testFilterStages, "Trace Filter Stages");
+        runTest<TestTrace>(&TestTrace::testChromeTrace, "Trace Chrome Export");
+    }
+};
@@ -27,10 +27,15 @@
 
 #include "Test.h"
 #include "Volume.h"
+#include "stb_image_write.h"
 
+#include <algorithm>
+#include <stdexcept>
 #include <vector>
 #include <cassert>
+#include <utility>
 #include <filesystem>
+#include <string>
 
 namespace fs = std::filesystem;
 
@@ -48,6 +53,15 @@ public:
         assert(vol.getWidth() == 100 && "Constructor width set failed.");
         assert(vol.getHeight() == 100 && "Constructor height set failed.");
         assert(vol.getDepth() == 100 && "Constructor depth set failed.");
+
+        // 80 x 107367629 x 536903681 floats wrap around to 64 bytes in size_t arithmetic
+        bool rejected = false;
+        try {
+            Volume wrapped(80, 107367629, 536903681, Buffer(64), DataType::Float32);
+        } catch (const std::invalid_argument &) {
+            rejected = true;
+        }
+        assert(rejected && "A buffer matching an overflowed volume size was accepted.");
     }
 
     /**
@@ -87,6 +101,60 @@ public:
         }
     }
 
+    /**
+     * Tests Handing Data to a Volume by Move
+     *
+     * Checks that updateData(Buffer &&, DataType) swaps an owned buffer in without copying, that a volume over memory
+     * owned by the caller receives the samples in that memory, and that a buffer of the wrong size is rejected.
+     */
+    void testUpdateDataByMove() {
+        Volume vol(4, 4, 4, Buffer(64));
+        Buffer result(64);
+        std::fill_n(result.getData(), 64, 9);
+        unsigned char *resultData = result.getData();
+        vol.updateData(std::move(result), DataType::UInt8);
+        assert(vol.getData() == resultData && result.isEmpty() && "updateData did not take the buffer.");
+
+        Buffer wrong(10);
+        vol.updateData(std::move(wrong), DataType::UInt8);
+        assert(vol.getData() == resultData && "A buffer of the wrong size must be rejected.");
+
+        std::vector<unsigned char> storage(64, 0);
+        Volume view(4, 4, 4, storage.data());
+        Buffer filtered(64);
+        std::fill_n(filtered.getData(), 64, 3);
+        view.updateData(std::move(filtered), DataType::UInt8);
+        assert(view.getData() == storage.data() && storage[63] == 3 && "Caller memory was not updated in place.");
+    }
+
+    /**
+     * Tests the Double-Buffer Mode
+     *
+     * Runs two filters on a volume in double-buffer mode and checks that the second filter writes into the buffer the
+     * first one replaced, so the volume alternates between the same two buffers.
+     */
+    void testDoubleBuffering() {
+        Volume vol(8, 8, 8, Buffer(512));
+        vol.setDoubleBuffering(true);
+        assert(vol.isDoubleBuffering() && "Double-buffer mode was not enabled.");
+        unsigned char *first = vol.getData();
+
+        Buffer output = vol.takeSpareBuffer(DataType::UInt8);
+        unsigned char *second = output.getData();
+        vol.updateData(std::move(output), DataType::UInt8);
+        assert(vol.getData() == second && "First swap failed.");
+
+        output = vol.takeSpareBuffer(DataType::UInt8);
+        assert(output.getData() == first && "The replaced buffer was not reused as the spare.");
+        vol.updateData(std::move(output), DataType::UInt8);
+        assert(vol.getData() == first && "Second swap failed.");
+
+        // A wider sample type needs a new spare buffer
+        Buffer wide = vol.takeSpareBuffer(DataType::UInt16);
+        assert(wide.getSize() == 1024 && "Spare buffer has the wrong size for 16-bit samples.");
+        vol.setDoubleBuffering(false);
+    }
+
     /**
      * Tests Loading and Saving Volume Data
      *
@@ -138,6 +206,47 @@ public:
         fs::remove("../Scans/fracture/MedIP_range_1_1.png");
     }
 
+    /**
+     * Tests Loading Colour Slices
+     *
+     * Writes RGB and RGBA slices, loads them as a volume and checks that every voxel holds one luma sample. Then checks
+     * that a stack whose slices differ in size is rejected and leaves the volume unchanged.
+     */
+    void testLoadColourSlices() {
+        auto directory = fs::temp_directory_path() / "test_volume_colour";
+        fs::create_directories(directory);
+        const int width = 5, height = 3;
+        std::vector<std::string> paths;
+        for (int z = 0; z < 4; ++z) {
+            int channels = z % 2 ? 4 : 3;
+            std::vector<unsigned char> pixels(width * height * channels, 0);
+            for (int i = 0; i < width * height; ++i) {
+                pixels[i * channels + z % 3] = 255; // Pure red, green or blue
+                if (channels == 4) {
+                    pixels[i * channels + 3] = 128;
+                }
+            }
+            paths.push_back((directory / ("slice_" + std::to_string(z) + ".png")).string());
+            stbi_write_png(paths.back().c_str(), width, height, channels, pixels.data(), width * channels);
+        }
+
+        Volume vol;
+        bool loaded = vol.loadFromFiles(paths);
+        assert(loaded && vol.getWidth() == width && vol.getHeight() == height && vol.getDepth() == 4 &&
+               "Colour slices were not loaded.");
+        const unsigned char luma[3] = {76, 149, 28}; // stb_image weights of pure red, green and blue
+        for (int z = 0; z < 4; ++z) {
+            assert(vol.getVoxel(width - 1, height - 1, z) == luma[z % 3] && "A colour slice was not reduced to luma.");
+        }
+
+        std::vector<unsigned char> small(2 * 2, 7);
+        paths.push_back((directory / "small.png").string());
+        stbi_write_png(paths.back().c_str(), 2, 2, 1, small.data(), 2);
+        loaded = vol.loadFromFiles(paths);
+        assert(!loaded && vol.getDepth() == 4 && "A stack of mismatched slices was accepted.");
+        fs::remove_all(directory);
+    }
+
     /**
      * Runs the Volume Unit Tests
      *
@@ -150,6 +259,9 @@ public:
         runTest<TestVolume>(&TestVolume::testVolumeConstruction, "Volume Construction");
         runTest<TestVolume>(&TestVolume::testVolumeGettersAndSetters, "Volume Getters and Setters");
         runTest<TestVolume>(&TestVolume::testUpdateData, "Update Data");
+        runTest<TestVolume>(&TestVolume::testUpdateDataByMove, "Update Data by Move");
+        runTest<TestVolume>(&TestVolume::testDoubleBuffering, "Double Buffering");
         runTest<TestVolume>(&TestVolume::testLoadAndSave, "Load and Save");
+        runTest<TestVolume>(&TestVolume::testLoadColourSlices, "Load Colour Slices");
     }
 };
@@ -0,0 +1,366 @@
+/**
+ * @file TestVolumeFormats.h
+ *
+ * @brief Unit Tests for the NRRD and NIfTI-1 readers and writers.
+ *
+ * This header file defines the TestVolumeFormats class, which checks that the gzip decoder inflates stored, fixed and
+ * dynamic Huffman blocks and rejects corrupt streams, that volumes of every sample type survive a NRRD and a NIfTI-1
+ * save and load, that big-endian, gzip-encoded, detached and unaligned NRRD payloads load correctly, that
+ * gzip-compressed NIfTI-1 files load, and that invalid files are reported.
+ *
+ * Usage:
+ * As an extension of the Test base class, the TestVolumeFormats class implements the runTests method to execute all
+ * test cases through the Test class's runTest template method.
+ *
+ * @date Created on October 19, 2026.
+ *
+ * @authors
+ * Advanced Programming Group Radix Sort:
+ *   - Benjamin Duncan (edsml-bd1023)
+ *   - Boyang Hu (edsml-bh223)
+ *   - Chawk Chamoun (edsml-cc8915)
+ *   - Mingsheng Cai (acse-sc4623)
+ *   - Moyu Zhang (acse-mz223)
+ *   - Ryan Benney (acse-rgb123)
+ */
+
+#pragma once
+
+#include "Test.h"
+#include "Inflate.h"
+#include "VolumeFormats.h"
+
+#include <cassert>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <vector>
+
+class TestVolumeFormats : public Test {
+private:
+    static std::string tempPath(const std::string &name) {
+        return (std::filesystem::temp_directory_path() / name).string();
+    }
+
+    static void writeFile(const std::string &path, const std::string &text, const unsigned char *data, size_t size) {
+        std::ofstream file(path, std::ios::binary);
+        file << text;
+        file.write(reinterpret_cast<const char *>(data), static_cast<std::streamsize>(size));
+    }
+
+    // Wraps bytes in a gzip member made of stored blocks, so tests can build compressed files without a compressor
+    static std::vector<unsigned char> storedGzip(const std::vector<unsigned char> &data) {
+        std::vector<unsigned char> out = {0x1f, 0x8b, 8, 0, 0, 0, 0, 0, 0, 3};
+        size_t position = 0;
+        do {
+            size_t length = std::min<size_t>(data.size() - position, 65535);
+            bool last = position + length == data.size();
+            out.push_back(last ? 1 : 0);
+            out.push_back(static_cast<unsigned char>(length));
+            out.push_back(static_cast<unsigned char>(length >> 8));
+            out.push_back(static_cast<unsigned char>(~length));
+            out.push_back(static_cast<unsigned char>(~length >> 8));
+            out.insert(out.end(), data.begin() + static_cast<long>(position),
+                       data.begin() + static_cast<long>(position + length));
+            position += length;
+        } while (position < data.size());
+        uint32_t crc = Inflate::crc32(data.data(), data.size());
+        auto size = static_cast<uint32_t>(data.size());
+        for (uint32_t value: {crc, size}) {
+            for (int shift = 0; shift < 32; shift += 8) {
+                out.push_back(static_cast<unsigned char>(value >> shift));
+            }
+        }
+        return out;
+    }
+
+    // Saves a volume in one format, loads it back and compares the samples
+    template<typename T>
+    static void checkRoundTrip(const std::string &name, int width, int height, int depth) {
+        std::vector<T> samples(static_cast<size_t>(width) * height * depth);
+        for (size_t i = 0; i < samples.size(); ++i) {
+            samples[i] = static_cast<T>(i * 37 % 251);
+        }
+        Volume volume(width, height, depth);
+        volume.updateData(samples);
+        std::string path = tempPath(name);
+        bool saved = VolumeFormats::save(volume, path);
+        assert(saved && "Saving a volume failed.");
+
+        Volume loaded;
+        bool loadedFile = VolumeFormats::load(path, loaded);
+        assert(loadedFile && "Loading a saved volume failed.");
+        assert(loaded.getWidth() == width && loaded.getHeight() == height && loaded.getDepth() == depth &&
+               "The volume size was not preserved.");
+        assert(loaded.getDataType() == volume.getDataType() && "The sample type was not preserved.");
+        assert(std::memcmp(loaded.getData(), samples.data(), samples.size() * sizeof(T)) == 0 &&
+               "The loaded volume differs from the saved one.");
+        std::filesystem::remove(path);
+    }
+
+    // Checks that a 4x3x2 16-bit volume holds the values i * 1000 + 7 used by the hand-written NRRD files
+    static void checkSequence(const Volume &volume, const char *message) {
+        assert(volume.getWidth() == 4 && volume.getHeight() == 3 && volume.getDepth() == 2 &&
+               volume.getDataType() == DataType::UInt16 && message);
+        const auto *samples = reinterpret_cast<const unsigned short *>(volume.getData());
+        for (int i = 0; i < 24; ++i) {
+            assert(samples[i] == i * 1000 + 7 && message);
+        }
+    }
+
+public:
+    /**
+     * @brief Test Inflate
+     *
+     * Inflates gzip streams made of a stored block, a fixed Huffman block and a dynamic Huffman block with matches,
+     * and checks the CRC-32 implementation and that corrupt and truncated streams are rejected.
+     */
+    void testInflate() {
+        const std::vector<unsigned char> fixed = {
+            0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0x2b, 0xcb, 0xcf, 0x29, 0xcd, 0x4d, 0x55, 0x28,
+            0xc3, 0x42, 0x01, 0x00, 0xba, 0xb8, 0x91, 0xcd, 0x1b, 0x00, 0x00, 0x00
+        };
+        const std::vector<unsigned char> stored = {
+            0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x03, 0x01, 0x28, 0x00, 0xd7, 0xff, 0x00, 0x01, 0x02,
+            0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f, 0x10, 0x11, 0x12, 0x13, 0x14,
+            0x15, 0x16, 0x17, 0x18, 0x19, 0x1a, 0x1b, 0x1c, 0x1d, 0x1e, 0x1f, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26,
+            0x27, 0x3c, 0x2e, 0xa6, 0x0d, 0x28, 0x00, 0x00, 0x00
+        };
+        const std::vector<unsigned char> dynamic = {
+            0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xcd, 0x4e, 0xc7, 0x11, 0x03, 0x41, 0x08, 0xab,
+            0x15, 0x45, 0xfa, 0xaf, 0xe0, 0x58, 0x57, 0xe1, 0xe1, 0x83, 0x02, 0x42, 0x2d, 0x24, 0x51, 0x6e, 0xd6, 0xc6,
+            0xde, 0xb4, 0xdc, 0xdd, 0x2e, 0x38, 0x06, 0x7b, 0x6a, 0x30, 0x76, 0x8e, 0x8b, 0xc8, 0xdb, 0xc5, 0x9e, 0x8c,
+            0xe7, 0xaa, 0x26, 0x39, 0x48, 0xb7, 0x46, 0xba, 0xc5, 0x8c, 0x16, 0x93, 0x09, 0xac, 0x50, 0x03, 0x5e, 0x42,
+            0x97, 0x67, 0x7b, 0x00, 0x35, 0x07, 0x66, 0x83, 0x5e, 0xc0, 0xdd, 0xdc, 0x9f, 0x8c, 0xd7, 0xd0, 0xa3, 0xe6,
+            0x57, 0xe1, 0x1f, 0x5b, 0x7d, 0x62, 0x58, 0x97, 0x8f, 0x2c, 0x01, 0x00, 0x00
+        };
+
+        std::vector<unsigned char> out;
+        bool decoded = Inflate::gunzip(fixed.data(), fixed.size(), out);
+        assert(decoded && std::string(out.begin(), out.end()) == "volume volume volume volume" &&
+               "A fixed Huffman block was decoded wrongly.");
+
+        decoded = Inflate::gunzip(stored.data(), stored.size(), out);
+        assert(decoded && out.size() == 40 && "A stored block was decoded wrongly.");
+        for (size_t i = 0; i < out.size(); ++i) {
+            assert(out[i] == i && "A stored block was decoded wrongly.");
+        }
+
+        // The dynamic stream holds two copies of the same 150 pseudo-random letters
+        std::vector<unsigned char> expected;
+        uint32_t state = 1;
+        for (int i = 0; i < 150; ++i) {
+            state = (state * 1103515245u + 12345u) & 0x7fffffffu;
+            expected.push_back(static_cast<unsigned char>("abcdefgh"[(state >> 16) % 8]));
+        }
+        expected.insert(expected.end(), expected.begin(), expected.end());
+        std::vector<unsigned char> exact(expected.size());
+        decoded = Inflate::gunzip(dynamic.data(), dynamic.size(), exact.data(), exact.size());
+        assert(decoded && exact == expected && "A dynamic Huffman block was decoded wrongly.");
+
+        const char *check = "123456789";
+        assert(Inflate::crc32(reinterpret_cast<const unsigned char *>(check), 9) == 0xcbf43926u &&
+               "The CRC-32 of the check string is wrong.");
+        assert(Inflate::isGzip(fixed.data(), fixed.size()) && !Inflate::isGzip(expected.data(), expected.size()) &&
+               "The gzip signature was not recognised.");
+
+        std::vector<unsigned char> corrupt = dynamic;
+        corrupt[corrupt.size() - 6] ^= 1;
+        decoded = Inflate::gunzip(corrupt.data(), corrupt.size(), out);
+        assert(!decoded && "A stream with a wrong CRC-32 was accepted.");
+        decoded = Inflate::gunzip(dynamic.data(), dynamic.size() / 2, exact.data(), exact.size());
+        assert(!decoded && "A truncated stream was accepted.");
+        std::vector<unsigned char> small(expected.size() - 1);
+        decoded = Inflate::gunzip(dynamic.data(), dynamic.size(), small.data(), small.size());
+        assert(!decoded && "A stream larger than its output was accepted.");
+    }
+
+    /**
+     * @brief Test Round Trip
+     *
+     * Saves 8-bit, 16-bit and float volumes as NRRD and NIfTI-1 files and checks that they load back unchanged.
+     */
+    void testRoundTrip() {
+        checkRoundTrip<unsigned char>("test_formats_uint8.nrrd", 17, 11, 5);
+        checkRoundTrip<unsigned short>("test_formats_uint16.nrrd", 16, 9, 4);
+        checkRoundTrip<float>("test_formats_float.nrrd", 8, 8, 3);
+        checkRoundTrip<unsigned char>("test_formats_uint8.nii", 17, 11, 5);
+        checkRoundTrip<unsigned short>("test_formats_uint16.nii", 16, 9, 4);
+        checkRoundTrip<float>("test_formats_float.nii", 8, 8, 3);
+    }
+
+    /**
+     * @brief Test NRRD Encodings
+     *
+     * Loads hand-written NRRD files with a big-endian raw payload, a gzip payload, a detached data file with a byte
+     * skip that leaves the samples unaligned, and a 2D image.
+     */
+    void testNrrdEncodings() {
+        const std::vector<unsigned char> gzipped = {
+            0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0x63, 0x60, 0x67, 0x7e, 0xcf, 0x7e, 0x9d, 0x7b,
+            0x3f, 0xff, 0x72, 0xe1, 0x7e, 0xf1, 0x72, 0xe9, 0x78, 0x79, 0x77, 0x65, 0x7d, 0x75, 0x71, 0xad, 0xff, 0x7a,
+            0xcf, 0x8d, 0xce, 0x9b, 0x6d, 0xb7, 0x9a, 0x6f, 0xd7, 0xee, 0x94, 0xef, 0x16, 0xee, 0x65, 0xef, 0xa7, 0x1e,
+            0xc4, 0x1f, 0xfa, 0x3d, 0xf2, 0x3e, 0x00, 0x22, 0xde, 0xa6, 0x3e, 0x30, 0x00, 0x00, 0x00
+        };
+        std::vector<unsigned char> bigEndian;
+        for (int i = 0; i < 24; ++i) {
+            bigEndian.push_back(static_cast<unsigned char>((i * 1000 + 7) >> 8));
+            bigEndian.push_back(static_cast<unsigned char>(i * 1000 + 7));
+        }
+        std::string header = "NRRD0004\n# A comment\ntype: unsigned short\ndimension: 3\nsizes: 4 3 2\n";
+
+        std::string path = tempPath("test_formats_big.nrrd");
+        writeFile(path, header + "encoding: raw\nendian: big\n\n", bigEndian.data(), bigEndian.size());
+        Volume volume;
+        bool loaded = VolumeFormats::load(path, volume);
+        assert(loaded && "Loading a big-endian NRRD file failed.");
+        checkSequence(volume, "A big-endian NRRD file was loaded wrongly.");
+
+        writeFile(path, header + "encoding: gzip\nendian: big\n\n", gzipped.data(), gzipped.size());
+        loaded = VolumeFormats::load(path, volume);
+        assert(loaded && "Loading a gzip NRRD file failed.");
+        checkSequence(volume, "A gzip NRRD file was loaded wrongly.");
+        std::filesystem::remove(path);
+
+        std::vector<unsigned char> littleEndian(1, 0xff);
+        for (int i = 0; i < 24; ++i) {
+            littleEndian.push_back(static_cast<unsigned char>(i * 1000 + 7));
+            littleEndian.push_back(static_cast<unsigned char>((i * 1000 + 7) >> 8));
+        }
+        std::string dataPath = tempPath("test_formats_detached.raw");
+        std::string headerPath = tempPath("test_formats_detached.nhdr");
+        writeFile(dataPath, "", littleEndian.data(), littleEndian.size());
+        writeFile(headerPath, header + "encoding: raw\nendian: little\nbyte skip: 1\ndata file: "
+                                       "test_formats_detached.raw\n\n", nullptr, 0);
+        loaded = VolumeFormats::load(headerPath, volume);
+        assert(loaded && "Loading a detached NRRD file failed.");
+        checkSequence(volume, "A detached NRRD file was loaded wrongly.");
+
+        writeFile(headerPath, header + "encoding: raw\nendian: little\nbyteskip: -1\ndatafile: "
+                                       "test_formats_detached.raw\n\n", nullptr, 0);
+        loaded = VolumeFormats::load(headerPath, volume);
+        assert(loaded && "Loading a NRRD file with a byte skip of -1 failed.");
+        checkSequence(volume, "A NRRD file with a byte skip of -1 was loaded wrongly.");
+        std::filesystem::remove(dataPath);
+        std::filesystem::remove(headerPath);
+
+        const unsigned char image[6] = {1, 2, 3, 4, 5, 6};
+        path = tempPath("test_formats_image.nrrd");
+        writeFile(path, "NRRD0001\ntype: uchar\ndimension: 2\nsizes: 3 2\nencoding: raw\n\n", image, 6);
+        loaded = VolumeFormats::load(path, volume);
+        assert(loaded && volume.getWidth() == 3 && volume.getHeight() == 2 && volume.getDepth() == 1 &&
+               std::memcmp(volume.getData(), image, 6) == 0 && "A 2D NRRD file was loaded wrongly.");
+        std::filesystem::remove(path);
+    }
+
+    /**
+     * @brief Test Compressed NIfTI
+     *
+     * Compresses a saved NIfTI-1 file into a .nii.gz file and checks that it loads to the same volume.
+     */
+    void testCompressedNifti() {
+        std::vector<unsigned short> samples(20 * 10 * 6);
+        for (size_t i = 0; i < samples.size(); ++i) {
+            samples[i] = static_cast<unsigned short>(i * 101);
+        }
+        Volume volume(20, 10, 6);
+        volume.updateData(samples);
+        std::string path = tempPath("test_formats_compressed.nii");
+        bool saved = VolumeFormats::save(volume, path);
+        assert(saved && "Saving a NIfTI-1 file failed.");
+
+        std::ifstream file(path, std::ios::binary);
+        std::vector<unsigned char> contents((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+        file.close();
+        auto compressed = storedGzip(contents);
+        writeFile(path + ".gz", "", compressed.data(), compressed.size());
+
+        Volume loaded;
+        bool loadedFile = VolumeFormats::load(path + ".gz", loaded);
+        assert(loadedFile && loaded.getWidth() == 20 && loaded.getHeight() == 10 && loaded.getDepth() == 6 &&
+               std::memcmp(loaded.getData(), samples.data(), samples.size() * 2) == 0 &&
+               "A compressed NIfTI-1 file was loaded wrongly.");
+        std::filesystem::remove(path);
+        std::filesystem::remove(path + ".gz");
+    }
+
+    /**
+     * @brief Test Invalid Input
+     *
+     * Checks that missing files, unknown extensions, foreign files, unsupported types and encodings, short payloads,
+     * sizes that overflow or exceed the data, and empty volumes are rejected and leave the volume unchanged.
+     */
+    void testInvalidInput() {
+        std::vector<unsigned char> voxels(8, 3);
+        Volume volume(2, 2, 2, voxels.data());
+        Volume empty;
+
+        bool result = VolumeFormats::load(tempPath("test_formats_missing.nrrd"), volume);
+        assert(!result && "A missing file was loaded.");
+        result = VolumeFormats::load(tempPath("test_formats.png"), volume);
+        assert(!result && "A file with an unknown extension was loaded.");
+        result = VolumeFormats::save(volume, tempPath("test_formats.nii.gz"));
+        assert(!result && "A volume was saved with an unsupported extension.");
+        result = VolumeFormats::save(empty, tempPath("test_formats_empty.nrrd"));
+        assert(!result && "An empty volume was saved.");
+
+        std::string path = tempPath("test_formats_invalid.nrrd");
+        std::string header = "NRRD0004\ndimension: 3\nsizes: 4 3 2\n";
+        writeFile(path, header + "type: short\nencoding: raw\n\n", voxels.data(), voxels.size());
+        result = VolumeFormats::load(path, volume);
+        assert(!result && "A signed NRRD sample type was accepted.");
+        writeFile(path, header + "type: uchar\nencoding: bzip2\n\n", voxels.data(), voxels.size());
+        result = VolumeFormats::load(path, volume);
+        assert(!result && "An unsupported NRRD encoding was accepted.");
+        writeFile(path, header + "type: uchar\nencoding: raw\n\n", voxels.data(), voxels.size());
+        result = VolumeFormats::load(path, volume);
+        assert(!result && "A NRRD file with a short payload was accepted.");
+        writeFile(path, header + "type: uchar\nencoding: gzip\n\n", voxels.data(), voxels.size());
+        result = VolumeFormats::load(path, volume);
+        assert(!result && "A NRRD file with corrupt gzip data was accepted.");
+
+        // Sizes whose byte count wraps around to the payload size, or that no file or gzip stream could hold
+        writeFile(path, "NRRD0004\ndimension: 3\nsizes: 80 107367629 536903681\ntype: float\nencoding: raw\n\n",
+                  voxels.data(), 64);
+        result = VolumeFormats::load(path, volume);
+        assert(!result && "A NRRD file whose size overflows was accepted.");
+        writeFile(path, "NRRD0004\ndimension: 3\nsizes: 65536 65536 65536\ntype: ushort\nendian: big\n"
+                        "encoding: raw\n\n", voxels.data(), voxels.size());
+        result = VolumeFormats::load(path, volume);
+        assert(!result && "A big-endian NRRD file with a huge size was accepted.");
+        std::vector<unsigned char> gzip = storedGzip(voxels);
+        writeFile(path, "NRRD0004\ndimension: 3\nsizes: 2147483647 2147483647 1\ntype: uchar\nencoding: gzip\n\n",
+                  gzip.data(), gzip.size());
+        result = VolumeFormats::load(path, volume);
+        assert(!result && "A gzip NRRD file with a huge size was accepted.");
+        writeFile(path, "Not a NRRD file\n", nullptr, 0);
+        result = VolumeFormats::load(path, volume);
+        assert(!result && "A foreign file was loaded as NRRD.");
+        std::filesystem::remove(path);
+
+        path = tempPath("test_formats_invalid.nii");
+        std::vector<unsigned char> foreign(400, 0);
+        writeFile(path, "", foreign.data(), foreign.size());
+        result = VolumeFormats::load(path, volume);
+        assert(!result && "A foreign file was loaded as NIfTI-1.");
+        std::filesystem::remove(path);
+
+        assert(volume.getWidth() == 2 && volume.getDepth() == 2 &&
+               volume.getData()[0] == 3 &&
+               "A failed load changed the volume.");
+    }
+
+    /**
+     * @brief Run all tests
+     *
+     * Runs all the tests for the NRRD and NIfTI-1 readers and writers.
+     */
+    void runTests() override {
+        runTest<TestVolumeFormats>(&TestVolumeFormats::testInflate, "Inflate");
+        runTest<TestVolumeFormats>(&TestVolumeFormats::testRoundTrip, "Round Trip");
+        runTest<TestVolumeFormats>(&TestVolumeFormats::testNrrdEncodings, "NRRD Encodings");
+        runTest<TestVolumeFormats>(&TestVolumeFormats::testCompressedNifti, "Compressed NIfTI");
+        runTest<TestVolumeFormats>(&TestVolumeFormats::testInvalidInput, "Invalid Input");
+    }
+};
@@ -0,0 +1,257 @@
+/**
+ * @file TestVolumePipeline.h
+ *
+ * @brief Unit Tests for the overlapped decode, filter and encode pipeline.
+ *
+ * This header file defines the TestVolumePipeline class, which checks that BoundedQueue blocks full producers and
+ * releases everyone on close, that slices written by a VolumePipeline equal those of filtering the loaded volume for
+ * several slab depths and worker counts, that the number of slabs held at once stays within the pipeline's limit, and
+ * that failures stop every stage.
+ *
+ * Usage:
+ * As an extension of the Test base class, the TestVolumePipeline class implements the runTests method to execute all
+ * test cases through the Test class's runTest template method.
+ *
+ * @date Created on October 19, 2026.
+ *
+ * @authors
+ * Advanced Programming Group Radix Sort:
+ *   - Benjamin Duncan (edsml-bd1023)
+ *   - Boyang Hu (edsml-bh223)
+ *   - Chawk Chamoun (edsml-cc8915)
+ *   - Mingsheng Cai (acse-sc4623)
+ *   - Moyu Zhang (acse-mz223)
+ *   - Ryan Benney (acse-rgb123)
+ */
+
+#pragma once
+
+#include "Test.h"
+#include "BoundedQueue.h"
+#include "Volume.h"
+#include "VolumePipeline.h"
+#include "VolumeStream.h"
+#include "Filters/Gaussian3DFilter.h"
+#include "Filters/Median3DFilter.h"
+#include "stb_image.h"
+#include "stb_image_write.h"
+
+#include <atomic>
+#include <cassert>
+#include <chrono>
+#include <cstdio>
+#include <filesystem>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+class TestVolumePipeline : public Test {
+private:
+    static constexpr int width = 19, height = 14, depth = 21;
+
+    static std::vector<unsigned char> generateData() {
+        std::vector<unsigned char> data(width * height * depth);
+        unsigned int state = 48;
+        for (auto &value: data) {
+            state = state * 1664525u + 1013904223u;
+            value = static_cast<unsigned char>(state >> 24);
+        }
+        return data;
+    }
+
+    static void writeStack(const std::filesystem::path &directory, const std::vector<unsigned char> &data) {
+        std::filesystem::create_directories(directory);
+        for (int z = 0; z < depth; ++z) {
+            char name[32];
+            std::snprintf(name, sizeof(name), "slice_%04d.png", z);
+            stbi_write_png((directory / name).string().c_str(), width, height, 1, &data[z * width * height], width);
+        }
+    }
+
+    // The slices written by a pipeline in z order, or an empty vector if one is missing
+    static std::vector<unsigned char> readOutput(const std::filesystem::path &directory) {
+        std::vector<unsigned char> data(width * height * depth);
+        for (int z = 0; z < depth; ++z) {
+            int w, h, c;
+            std::string path = (directory / ("slice_" + std::to_string(z + 1) + ".png")).string();
+            unsigned char *slice = stbi_load(path.c_str(), &w, &h, &c, 1);
+            if (!slice || w != width || h != height) {
+                stbi_image_free(slice);
+                return {};
+            }
+            std::copy(slice, slice + width * height, &data[z * width * height]);
+            stbi_image_free(slice);
+        }
+        return data;
+    }
+
+public:
+    /**
+     * @brief Test the blocking and closing of a bounded queue.
+     *
+     * A producer pushing into a full queue must wait for a pop, items come out in order, closing refuses pushes while
+     * queued items can still be popped, and a consumer waiting on an empty queue is woken by close.
+     */
+    void testBoundedQueue() {
+        BoundedQueue<int> queue(2);
+        bool pushed = queue.push(1) && queue.push(2);
+        assert(pushed && queue.size() == 2 && "Items were not queued.");
+
+        std::atomic<bool> done(false);
+        std::thread producer([&]() {
+            queue.push(3);
+            done = true;
+        });
+        std::this_thread::sleep_for(std::chrono::milliseconds(20));
+        assert(!done && "A push into a full queue did not wait.");
+        int item = 0;
+        bool popped = queue.pop(item);
+        producer.join();
+        assert(popped && item == 1 && done && "A pop did not release the waiting producer.");
+
+        queue.close();
+        pushed = queue.push(4);
+        assert(!pushed && "A closed queue accepted an item.");
+        popped = queue.pop(item) && item == 2 && queue.pop(item) && item == 3;
+        assert(popped && "Queued items were lost on close.");
+        popped = queue.pop(item);
+        assert(!popped && "A closed, empty queue returned an item.");
+
+        BoundedQueue<int> empty(1);
+        std::thread consumer([&]() {
+            int value;
+            popped = empty.pop(value);
+        });
+        std::this_thread::sleep_for(std::chrono::milliseconds(5));
+        empty.close();
+        consumer.join();
+        assert(!popped && "Close did not wake a waiting consumer.");
+
+        bool threw = false;
+        try {
+            BoundedQueue<int> none(0);
+        } catch (const std::invalid_argument &) {
+            threw = true;
+        }
+        assert(threw && "A queue without capacity was created.");
+    }
+
+    /**
+     * @brief Test the pipeline against filtering the loaded volume.
+     *
+     * Runs a Gaussian and median chain through pipelines with one-slice, mid-size and whole-stack slabs and with one or
+     * several workers per stage, and compares every written slice with the in-memory result.
+     */
+    void testMatchesInMemory() {
+        auto root = std::filesystem::temp_directory_path() / "mdip_pipeline_match";
+        std::filesystem::remove_all(root);
+        auto data = generateData();
+        writeStack(root / "input", data);
+        VolumeStream stream;
+        bool opened = stream.openDirectory((root / "input").string());
+        assert(opened && "Failed to open the slice stack.");
+
+        Gaussian3DFilter gaussian(1.3, 5);
+        Median3DFilter median(3);
+        auto expected = data;
+        Volume volume(width, height, depth, expected.data());
+        gaussian.apply(volume);
+        median.apply(volume);
+
+        int run = 0;
+        for (PipelineOptions options: {PipelineOptions{1, 1, 1, 1, 1}, PipelineOptions{5, 3, 2, 3, 1},
+                                       PipelineOptions{32, 2, 1, 2, 2}, PipelineOptions{}}) {
+            VolumePipeline pipeline(options);
+            pipeline.addFilter(gaussian).addFilter(median);
+            auto output = root / ("output_" + std::to_string(run++));
+            bool ok = pipeline.run(stream, output.string());
+            assert(ok && readOutput(output) == expected && "The pipeline differs from the in-memory filters.");
+        }
+        std::filesystem::remove_all(root);
+    }
+
+    /**
+     * @brief Test that the pipeline holds a bounded number of slabs.
+     *
+     * Slows the compute stage down so that decoding runs ahead, and checks that the slabs held at once stay within the
+     * limit while the output is still complete and every stage reports its time.
+     */
+    void testBackpressure() {
+        auto root = std::filesystem::temp_directory_path() / "mdip_pipeline_backpressure";
+        std::filesystem::remove_all(root);
+        auto data = generateData();
+        writeStack(root / "input", data);
+        VolumeStream stream;
+        bool opened = stream.openDirectory((root / "input").string());
+        assert(opened && "Failed to open the slice stack.");
+
+        VolumePipeline pipeline({1, 2, 1, 1, 1});
+        pipeline.addOperation({0, [](Volume &, const Region3D &) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(2));
+        }});
+        bool ok = pipeline.run(stream, (root / "output").string());
+        assert(ok && readOutput(root / "output") == data && "The pipeline changed the slices.");
+        assert(pipeline.getSlabLimit() == 6 && pipeline.getPeakSlabs() >= 1 &&
+               pipeline.getPeakSlabs() <= pipeline.getSlabLimit() && "The pipeline held too many slabs.");
+        assert(pipeline.getDecodeSeconds() > 0 && pipeline.getComputeSeconds() > 0 &&
+               pipeline.getEncodeSeconds() > 0 && "A stage reported no time.");
+        std::filesystem::remove_all(root);
+    }
+
+    /**
+     * @brief Test failures and invalid settings.
+     *
+     * A slice that disappears after the stack is opened must stop the pipeline without hanging, and empty stacks,
+     * invalid options and invalid operations must be rejected.
+     */
+    void testFailures() {
+        auto root = std::filesystem::temp_directory_path() / "mdip_pipeline_failures";
+        std::filesystem::remove_all(root);
+        writeStack(root / "input", generateData());
+        VolumeStream stream;
+        bool opened = stream.openDirectory((root / "input").string());
+        assert(opened && "Failed to open the slice stack.");
+        std::filesystem::remove(root / "input" / "slice_0013.png");
+
+        Median3DFilter median(3);
+        VolumePipeline pipeline({2, 2, 2, 2, 1});
+        pipeline.addFilter(median);
+        bool ok = pipeline.run(stream, (root / "output").string());
+        assert(!ok && "A missing slice was not reported.");
+        assert(pipeline.getPeakSlabs() <= pipeline.getSlabLimit() && "The failed pipeline held too many slabs.");
+
+        VolumeStream empty;
+        ok = pipeline.run(empty, (root / "empty").string());
+        assert(!ok && !std::filesystem::exists(root / "empty") && "An empty stack was processed.");
+
+        int rejected = 0;
+        for (PipelineOptions options: {PipelineOptions{0, 1, 1, 1, 1}, PipelineOptions{4, 1, 0, 1, 1},
+                                       PipelineOptions{4, 1, 1, 1, 0}}) {
+            try {
+                VolumePipeline invalid(options);
+            } catch (const std::invalid_argument &) {
+                ++rejected;
+            }
+        }
+        try {
+            pipeline.addOperation({-1, [](Volume &, const Region3D &) {}});
+        } catch (const std::invalid_argument &) {
+            ++rejected;
+        }
+        assert(rejected == 4 && "Invalid pipeline settings were accepted.");
+        std::filesystem::remove_all(root);
+    }
+
+    /**
+     * @brief Run all tests
+     *
+     * Runs all the tests for the overlapped decode, filter and encode pipeline.
+     */
+    void runTests() override {
+        runTest<TestVolumePipeline>(&TestVolumePipeline::testBoundedQueue, "Bounded Queue");
+        runTest<TestVolumePipeline>(&TestVolumePipeline::testMatchesInMemory, "Matches In-Memory Filters");
+        runTest<TestVolumePipeline>(&TestVolumePipeline::testBackpressure, "Backpressure");
+        runTest<TestVolumePipeline>(&TestVolumePipeline::testFailures, "Failures");
+    }
+};
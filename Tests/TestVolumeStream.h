@@ -0,0 +1,193 @@
+/**
+ * @file TestVolumeStream.h
+ *
+ * @brief Unit Tests for out-of-core volume streaming.
+ *
+ * This header file defines the TestVolumeStream class, which verifies that VolumeStream reads slice stacks correctly and
+ * that the streaming overloads of Gaussian3DFilter, Median3DFilter and the z-projections produce exactly the same output as
+ * the in-memory code paths. A small synthetic slice stack is written to a temporary directory for the duration of each test.
+ *
+ * Usage:
+ * As an extension of the Test base class, the TestVolumeStream class implements the runTests method to execute all test
+ * cases through the Test class's runTest template method.
+ *
+ * @date Created on October 19, 2026.
+ *
+ * @authors
+ * Advanced Programming Group Radix Sort:
+ *   - Benjamin Duncan (edsml-bd1023)
+ *   - Boyang Hu (edsml-bh223)
+ *   - Chawk Chamoun (edsml-cc8915)
+ *   - Mingsheng Cai (acse-sc4623)
+ *   - Moyu Zhang (acse-mz223)
+ *   - Ryan Benney (acse-rgb123)
+ */
+
+#pragma once
+
+#include "Test.h"
+#include "VolumeStream.h"
+#include "Projection.h"
+#include "Filters/Gaussian3DFilter.h"
+#include "Filters/Median3DFilter.h"
+#include "stb_image.h"
+#include "stb_image_write.h"
+
+#include <vector>
+#include <string>
+#include <cassert>
+#include <cstdio>
+#include <filesystem>
+
+class TestVolumeStream : public Test {
+private:
+    static constexpr int width = 23, height = 17, depth = 12;
+
+    /**
+     * Generates Pseudo-Random Volume Data
+     *
+     * @return A vector of width * height * depth voxels in z-major order.
+     */
+    std::vector<unsigned char> generateData() const {
+        std::vector<unsigned char> data(width * height * depth);
+        unsigned int state = 2024;
+        for (auto &value: data) {
+            state = state * 1664525u + 1013904223u;
+            value = static_cast<unsigned char>(state >> 24);
+        }
+        return data;
+    }
+
+    /**
+     * Writes a Volume as a Stack of PNG Slices
+     *
+     * Slices are named with zero-padded indices so that the directory ordering matches the z order.
+     *
+     * @param directory The directory to write the stack into.
+     * @param data The volume data in z-major order.
+     */
+    void writeStack(const std::filesystem::path &directory, const std::vector<unsigned char> &data) const {
+        std::filesystem::create_directories(directory);
+        for (int z = 0; z < depth; ++z) {
+            char name[32];
+            std::snprintf(name, sizeof(name), "slice_%04d.png", z);
+            stbi_write_png((directory / name).string().c_str(), width, height, 1, &data[z * width * height], width);
+        }
+    }
+
+    /**
+     * Reads the Slices Written by a Streaming Filter
+     *
+     * @param directory The directory containing "slice_<index>.png" files.
+     * @return The volume data in z-major order.
+     */
+    std::vector<unsigned char> readOutput(const std::filesystem::path &directory) const {
+        std::vector<unsigned char> data(width * height * depth);
+        for (int z = 0; z < depth; ++z) {
+            int w, h, c;
+            std::string path = (directory / ("slice_" + std::to_string(z + 1) + ".png")).string();
+            unsigned char *slice = stbi_load(path.c_str(), &w, &h, &c, 1);
+            assert(slice && w == width && h == height && "Streaming filter did not write the expected slice.");
+            if (slice) {
+                std::copy(slice, slice + width * height, &data[z * width * height]);
+                stbi_image_free(slice);
+            }
+        }
+        return data;
+    }
+
+public:
+    /**
+     * Tests Opening a Stack and Reading Slices
+     *
+     * Checks that the stream reports the right dimensions and returns each slice unchanged.
+     */
+    void testReadSlices() {
+        auto root = std::filesystem::temp_directory_path() / "mdip_stream_read";
+        auto data = generateData();
+        writeStack(root / "input", data);
+
+        VolumeStream stream;
+        bool opened = stream.openDirectory((root / "input").string());
+        assert(opened && "Failed to open the slice stack.");
+        assert(stream.getWidth() == width && stream.getHeight() == height && stream.getDepth() == depth);
+
+        std::vector<unsigned char> slice(width * height);
+        for (int z = 0; z < depth; ++z) {
+            bool read = stream.readSlice(z, slice.data());
+            assert(read && "Failed to read a slice.");
+            assert(std::equal(slice.begin(), slice.end(), &data[z * width * height]) && "Slice data mismatch.");
+        }
+        bool readPastEnd = stream.readSlice(depth, slice.data());
+        assert(!readPastEnd && "Reading past the last slice should fail.");
+
+        std::filesystem::remove_all(root);
+    }
+
+    /**
+     * Tests the Streaming 3D Filters Against the In-Memory Filters
+     *
+     * Streams the stack through Gaussian3DFilter and Median3DFilter and compares the written slices with the result of
+     * filtering the fully loaded volume.
+     */
+    void testStreamingFilters() {
+        auto root = std::filesystem::temp_directory_path() / "mdip_stream_filters";
+        auto data = generateData();
+        writeStack(root / "input", data);
+
+        VolumeStream stream;
+        bool opened = stream.openDirectory((root / "input").string());
+        assert(opened && "Failed to open the slice stack.");
+
+        Gaussian3DFilter gaussian(1.2, 5);
+        bool filtered = gaussian.apply(stream, (root / "gaussian").string());
+        assert(filtered && "Streaming Gaussian filter failed.");
+        auto expected = data;
+        Volume gaussianVolume(width, height, depth, expected.data());
+        gaussian.apply(gaussianVolume);
+        assert(readOutput(root / "gaussian") == expected && "Streaming Gaussian filter differs from in-memory result.");
+
+        Median3DFilter median(3);
+        filtered = median.apply(stream, (root / "median").string());
+        assert(filtered && "Streaming median filter failed.");
+        expected = data;
+        Volume medianVolume(width, height, depth, expected.data());
+        median.apply(medianVolume);
+        assert(readOutput(root / "median") == expected && "Streaming median filter differs from in-memory result.");
+
+        std::filesystem::remove_all(root);
+    }
+
+    /**
+     * Tests the Streaming Projections Against the In-Memory Projections
+     */
+    void testStreamingProjections() {
+        auto root = std::filesystem::temp_directory_path() / "mdip_stream_projections";
+        auto data = generateData();
+        writeStack(root / "input", data);
+
+        VolumeStream stream;
+        bool opened = stream.openDirectory((root / "input").string());
+        assert(opened && "Failed to open the slice stack.");
+        bool same = Projection::maximumIntensityProjection(stream) ==
+                    Projection::maximumIntensityProjection(width, height, depth, data.data());
+        assert(same && "Streaming MIP differs from in-memory result.");
+        same = Projection::minimumIntensityProjection(stream) ==
+               Projection::minimumIntensityProjection(width, height, depth, data.data());
+        assert(same && "Streaming MinIP differs from in-memory result.");
+        same = Projection::averageIntensityProjection(stream) ==
+               Projection::averageIntensityProjection(width, height, depth, data.data());
+        assert(same && "Streaming AIP differs from in-memory result.");
+
+        std::filesystem::remove_all(root);
+    }
+
+    /**
+     * Runs the VolumeStream Unit Tests
+     */
+    virtual void runTests() override {
+        runTest<TestVolumeStream>(&TestVolumeStream::testReadSlices, "Volume Stream Read Slices");
+        runTest<TestVolumeStream>(&TestVolumeStream::testStreamingFilters, "Volume Stream 3D Filters");
+        runTest<TestVolumeStream>(&TestVolumeStream::testStreamingProjections, "Volume Stream Projections");
+    }
+};
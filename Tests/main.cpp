@@ -40,6 +40,25 @@
 #include "TestEdgeFilter.h"
 #include "TestGaussian3DFilter.h"
 #include "TestMedian3DFilter.h"
+#include "TestBrickedVolume.h"
+#include "TestVolumeStream.h"
+#include "TestDataType.h"
+#include "TestTrace.h"
+#include "TestBuffer.h"
+#include "TestBufferPool.h"
+#include "TestProjectionKernels.h"
+#include "TestProjectionIndex.h"
+#include "TestPyramid.h"
+#include "TestRegion.h"
+#include "TestChunkedVolumeFile.h"
+#include "TestOutputService.h"
+#include "TestVolumeFormats.h"
+#include "TestTiffStack.h"
+#include "TestImageStream.h"
+#include "TestFilteredVolume.h"
+#include "TestVolumePipeline.h"
+#include "TestResultCache.h"
+#include "TestProcessingServer.h"
 
 #define STB_IMAGE_WRITE_IMPLEMENTATION
 
@@ -64,6 +83,25 @@ int main() {
     TestProjection testProjection;
     TestSlice testSlice;
     TestVolume testVolume;
+    TestBrickedVolume testBrickedVolume;
+    TestVolumeStream testVolumeStream;
+    TestDataType testDataType;
+    TestTrace testTrace;
+    TestBuffer testBuffer;
+    TestBufferPool testBufferPool;
+    TestProjectionKernels testProjectionKernels;
+    TestProjectionIndex testProjectionIndex;
+    TestPyramid testPyramid;
+    TestRegion testRegion;
+    TestChunkedVolumeFile testChunkedVolumeFile;
+    TestOutputService testOutputService;
+    TestVolumeFormats testVolumeFormats;
+    TestTiffStack testTiffStack;
+    TestImageStream testImageStream;
+    TestFilteredVolume testFilteredVolume;
+    TestVolumePipeline testVolumePipeline;
+    TestResultCache testResultCache;
+    TestProcessingServer testProcessingServer;
 
     // Run tests
     testAlgorithm.runTests();
@@ -79,6 +117,25 @@ int main() {
     testProjection.runTests();
     testSlice.runTests();
     testVolume.runTests();
+    testBrickedVolume.runTests();
+    testVolumeStream.runTests();
+    testDataType.runTests();
+    testTrace.runTests();
+    testBuffer.runTests();
+    testBufferPool.runTests();
+    testProjectionKernels.runTests();
+    testProjectionIndex.runTests();
+    testPyramid.runTests();
+    testRegion.runTests();
+    testChunkedVolumeFile.runTests();
+    testOutputService.runTests();
+    testVolumeFormats.runTests();
+    testTiffStack.runTests();
+    testImageStream.runTests();
+    testFilteredVolume.runTests();
+    testVolumePipeline.runTests();
+    testResultCache.runTests();
+    testProcessingServer.runTests();
 
     Test::summarize();  // Output test results
 